@@ -35,6 +35,7 @@
 
 #include <H5Support/H5Lite.h>
 
+#include <algorithm>
 #include <cstring>
 
 #if defined(H5Support_NAMESPACE)
@@ -412,6 +413,48 @@ bool H5Lite::datasetExists(hid_t loc_id, const std::string& dsetName)
   return err >= 0;
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+hid_t H5Lite::createChunkedDatasetProperties(int32_t rank, const hsize_t* chunkDims, int32_t deflateLevel, bool shuffle)
+{
+  H5SUPPORT_MUTEX_LOCK()
+
+  hid_t dcpl = H5Pcreate(H5P_DATASET_CREATE);
+  if(dcpl < 0)
+  {
+    return dcpl;
+  }
+  herr_t err = H5Pset_chunk(dcpl, rank, chunkDims);
+  if(err < 0)
+  {
+    H5Pclose(dcpl);
+    return err;
+  }
+
+  bool deflate = deflateLevel > 0 && H5Zfilter_avail(H5Z_FILTER_DEFLATE) > 0;
+  // Shuffling the bytes only pays off if a compression filter runs after it
+  if(shuffle && deflate)
+  {
+    err = H5Pset_shuffle(dcpl);
+    if(err < 0)
+    {
+      H5Pclose(dcpl);
+      return err;
+    }
+  }
+  if(deflate)
+  {
+    err = H5Pset_deflate(dcpl, static_cast<uint32_t>(deflateLevel > 9 ? 9 : deflateLevel));
+    if(err < 0)
+    {
+      H5Pclose(dcpl);
+      return err;
+    }
+  }
+  return dcpl;
+}
+
 // -----------------------------------------------------------------------------
 //  We assume a null terminated string
 // -----------------------------------------------------------------------------
@@ -467,59 +510,85 @@ herr_t H5Lite::writeStringDataset(hid_t loc_id, const std::string& dsetName, siz
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-herr_t H5Lite::writeVectorOfStringsDataset(hid_t loc_id, const std::string& dsetName, const std::vector<std::string>& data)
+herr_t H5Lite::writeVectorOfStringsDataset(hid_t loc_id, const std::string& dsetName, const std::vector<std::string>& data, bool fixedWidth)
+{
+  std::vector<const char*> strings(data.size());
+  for(size_t i = 0; i < data.size(); i++)
+  {
+    strings[i] = data[i].c_str();
+  }
+  return writeVectorOfStringsDataset(loc_id, dsetName, strings, fixedWidth);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+herr_t H5Lite::writeVectorOfStringsDataset(hid_t loc_id, const std::string& dsetName, const std::vector<const char*>& data, bool fixedWidth)
 {
   H5SUPPORT_MUTEX_LOCK()
 
   hid_t sid = -1;
-  hid_t memspace = -1;
   hid_t datatype = -1;
   hid_t did = -1;
   herr_t err = -1;
   herr_t retErr = 0;
 
+  // Fixed width strings are copied into one buffer, padded with nulls to the length of the longest string
+  size_t width = 1;
+  std::vector<char> fixedData;
+  if(fixedWidth)
+  {
+    for(const char* str : data)
+    {
+      width = std::max(width, strlen(str));
+    }
+    fixedData.resize(data.size() * width, 0x00);
+    for(size_t i = 0; i < data.size(); i++)
+    {
+      ::memcpy(fixedData.data() + i * width, data[i], strlen(data[i]));
+    }
+  }
+
   hsize_t dims[1] = {data.size()};
   if((sid = H5Screate_simple(sizeof(dims) / sizeof(*dims), dims, nullptr)) >= 0)
   {
-    dims[0] = 1;
-
-    if((memspace = H5Screate_simple(sizeof(dims) / sizeof(*dims), dims, nullptr)) >= 0)
+    datatype = H5Tcopy(H5T_C_S1);
+    if(fixedWidth)
+    {
+      H5Tset_size(datatype, width);
+      H5Tset_strpad(datatype, H5T_STR_NULLPAD);
+    }
+    else
     {
-
-      datatype = H5Tcopy(H5T_C_S1);
       H5Tset_size(datatype, H5T_VARIABLE);
+    }
 
-      if((did = H5Dcreate(loc_id, dsetName.c_str(), datatype, sid, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) >= 0)
+    if((did = H5Dcreate(loc_id, dsetName.c_str(), datatype, sid, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) >= 0)
+    {
+      // All the strings go out in a single write
+      if(!data.empty())
       {
-
-        //
-        // Select the "memory" to be written out - just 1 record.
-        hsize_t offset[] = {0};
-        hsize_t count[] = {1};
-        H5Sselect_hyperslab(memspace, H5S_SELECT_SET, offset, nullptr, count, nullptr);
-        hsize_t m_pos = 0;
-        for(auto v : data)
+        const void* buffer = fixedWidth ? static_cast<const void*>(fixedData.data()) : static_cast<const void*>(data.data());
+        err = H5Dwrite(did, datatype, H5S_ALL, H5S_ALL, H5P_DEFAULT, buffer);
+        if(err < 0)
         {
-          // Select the file position, 1 record at position 'pos'
-          hsize_t count[] = {1};
-          hsize_t offset[] = {m_pos++};
-          H5Sselect_hyperslab(sid, H5S_SELECT_SET, offset, nullptr, count, nullptr);
-          const char* s = v.c_str();
-          err = H5Dwrite(did, datatype, memspace, sid, H5P_DEFAULT, &s);
-          if(err < 0)
-          {
-            std::cout << "Error Writing String Data: " __FILE__ << "(" << __LINE__ << ")" << std::endl;
-            retErr = err;
-          }
+          std::cout << "Error Writing String Data: " __FILE__ << "(" << __LINE__ << ")" << std::endl;
+          retErr = err;
         }
-        CloseH5D(did, err, retErr);
       }
-      H5Tclose(datatype);
-      CloseH5S(memspace, err, retErr);
+      CloseH5D(did, err, retErr);
     }
-
+    else
+    {
+      retErr = did;
+    }
+    H5Tclose(datatype);
     CloseH5S(sid, err, retErr);
   }
+  else
+  {
+    retErr = sid;
+  }
   return retErr;
 }
 
@@ -881,6 +950,26 @@ herr_t H5Lite::readStringDataset(hid_t loc_id, const std::string& dsetName, char
 //
 // -----------------------------------------------------------------------------
 herr_t H5Lite::readVectorOfStringDataset(hid_t loc_id, const std::string& dsetName, std::vector<std::string>& data)
+{
+  std::vector<char> values;
+  std::vector<size_t> offsets;
+  herr_t err = readPackedStringsDataset(loc_id, dsetName, values, offsets);
+  if(err < 0)
+  {
+    return err;
+  }
+  data.resize(offsets.size());
+  for(size_t i = 0; i < offsets.size(); i++)
+  {
+    data[i] = std::string(values.data() + offsets[i]);
+  }
+  return err;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+herr_t H5Lite::readPackedStringsDataset(hid_t loc_id, const std::string& dsetName, std::vector<char>& values, std::vector<size_t>& offsets)
 {
   H5SUPPORT_MUTEX_LOCK()
 
@@ -892,7 +981,7 @@ herr_t H5Lite::readVectorOfStringDataset(hid_t loc_id, const std::string& dsetNa
   did = H5Dopen(loc_id, dsetName.c_str(), H5P_DEFAULT);
   if(did < 0)
   {
-    std::cout << "H5Lite.cpp::readVectorOfStringDataset(" << __LINE__ << ") Error opening Dataset at loc_id (" << loc_id << ") with object name (" << dsetName << ")" << std::endl;
+    std::cout << "H5Lite.cpp::readPackedStringsDataset(" << __LINE__ << ") Error opening Dataset at loc_id (" << loc_id << ") with object name (" << dsetName << ")" << std::endl;
     return -1;
   }
   /*
@@ -911,54 +1000,87 @@ herr_t H5Lite::readVectorOfStringDataset(hid_t loc_id, const std::string& dsetNa
     {
       CloseH5S(sid, err, retErr);
       CloseH5T(tid, err, retErr);
-      std::cout << "H5Lite.cpp::readVectorOfStringDataset(" << __LINE__ << ") Number of dims should be 1 but it was " << ndims << ". Returning early. Is your data file correct?" << std::endl;
+      CloseH5D(did, err, retErr);
+      std::cout << "H5Lite.cpp::readPackedStringsDataset(" << __LINE__ << ") Number of dims should be 1 but it was " << ndims << ". Returning early. Is your data file correct?" << std::endl;
       return -2;
     }
-    std::vector<char*> rdata(dims[0]);
-    for(int i = 0; i < dims[0]; i++)
-    {
-      rdata[i] = nullptr;
-    }
+    size_t count = static_cast<size_t>(dims[0]);
+    offsets.reserve(offsets.size() + count);
 
-    /*
-    * Create the memory datatype.
-    */
+    htri_t isVariableString = H5Tis_variable_str(tid);
     hid_t memtype = H5Tcopy(H5T_C_S1);
-    herr_t status = H5Tset_size(memtype, H5T_VARIABLE);
-
-    /*
-    * Read the data.
-    */
-    status = H5Dread(did, memtype, H5S_ALL, H5S_ALL, H5P_DEFAULT, &(rdata.front()));
-    if(status < 0)
+    herr_t status = 0;
+    if(isVariableString == 1)
     {
-      status = H5Dvlen_reclaim(memtype, sid, H5P_DEFAULT, &(rdata.front()));
-      CloseH5S(sid, err, retErr);
-      CloseH5T(tid, err, retErr);
-      CloseH5T(memtype, err, retErr);
-      std::cout << "H5Lite.cpp::readVectorOfStringDataset(" << __LINE__ << ") Error reading Dataset at loc_id (" << loc_id << ") with object name (" << dsetName << ")" << std::endl;
-      return -3;
+      /*
+      * Read all the strings at once and then pack them after each other
+      */
+      H5Tset_size(memtype, H5T_VARIABLE);
+      std::vector<char*> rdata(count, nullptr);
+      if(count > 0)
+      {
+        status = H5Dread(did, memtype, H5S_ALL, H5S_ALL, H5P_DEFAULT, rdata.data());
+      }
+      if(status >= 0)
+      {
+        size_t total = 0;
+        for(const char* str : rdata)
+        {
+          total += (nullptr == str) ? 1 : strlen(str) + 1;
+        }
+        values.reserve(values.size() + total);
+        for(const char* str : rdata)
+        {
+          offsets.push_back(values.size());
+          if(nullptr != str)
+          {
+            values.insert(values.end(), str, str + strlen(str));
+          }
+          values.push_back(0x00);
+        }
+      }
+      /*
+      * Note that H5Dvlen_reclaim works for variable-length strings as well as variable-length arrays.
+      */
+      if(count > 0)
+      {
+        H5Dvlen_reclaim(memtype, sid, H5P_DEFAULT, rdata.data());
+      }
     }
-    /*
-    * copy the data into the vector of strings
-    */
-    data.resize(dims[0]);
-    for(int i = 0; i < dims[0]; i++)
+    else
     {
-      // printf("%s[%d]: %s\n", "VlenStrings", i, rdata[i].p);
-      std::string str = std::string(rdata[i]);
-      data[i] = str;
+      /*
+      * Fixed width strings are read as one null padded block and then trimmed
+      */
+      size_t width = H5Tget_size(tid);
+      H5Tset_size(memtype, width);
+      H5Tset_strpad(memtype, H5T_STR_NULLPAD);
+      std::vector<char> rdata(count * width);
+      if(count > 0)
+      {
+        status = H5Dread(did, memtype, H5S_ALL, H5S_ALL, H5P_DEFAULT, rdata.data());
+      }
+      if(status >= 0)
+      {
+        values.reserve(values.size() + rdata.size() + count);
+        for(size_t i = 0; i < count; i++)
+        {
+          const char* str = rdata.data() + i * width;
+          offsets.push_back(values.size());
+          values.insert(values.end(), str, str + strnlen(str, width));
+          values.push_back(0x00);
+        }
+      }
     }
-    /*
-    * Close and release resources.  Note that H5Dvlen_reclaim works
-    * for variable-length strings as well as variable-length arrays.
-    * Also note that we must still free the array of pointers stored
-    * in rdata, as H5Tvlen_reclaim only frees the data these point to.
-    */
-    status = H5Dvlen_reclaim(memtype, sid, H5P_DEFAULT, &(rdata.front()));
     CloseH5S(sid, err, retErr);
     CloseH5T(tid, err, retErr);
     CloseH5T(memtype, err, retErr);
+    if(status < 0)
+    {
+      CloseH5D(did, err, retErr);
+      std::cout << "H5Lite.cpp::readPackedStringsDataset(" << __LINE__ << ") Error reading Dataset at loc_id (" << loc_id << ") with object name (" << dsetName << ")" << std::endl;
+      return -3;
+    }
   }
 
   CloseH5D(did, err, retErr);
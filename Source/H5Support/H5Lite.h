@@ -230,6 +230,19 @@ namespace H5Support_NAMESPACE
        */
       static H5Support_EXPORT bool datasetExists( hid_t loc_id, const std::string& dsetName );
 
+      /**
+       * @brief Creates a dataset creation property list that stores a dataset in chunks of
+       * the given shape and optionally passes those chunks through the shuffle and deflate filters.
+       * The deflate filter is silently skipped if the HDF5 library was built without it.
+       * The caller owns the returned id and must release it with H5Pclose().
+       * @param rank The number of dimensions of the dataset
+       * @param chunkDims The size of a chunk in each dimension. Every value must be > 0.
+       * @param deflateLevel The gzip compression level (0-9). 0 disables compression.
+       * @param shuffle Apply the byte shuffle filter before compressing. Ignored if deflateLevel is 0.
+       * @return The property list id or a negative value on error
+       */
+      static H5Support_EXPORT hid_t createChunkedDatasetProperties(int32_t rank, const hsize_t* chunkDims, int32_t deflateLevel, bool shuffle);
+
       /**
        * @brief Creates a Dataset with the given name at the location defined by loc_id
        *
@@ -325,6 +338,7 @@ namespace H5Support_NAMESPACE
        * @param rank The number of dimensions
        * @param dims The sizes of each dimension
        * @param data The data to be written.
+       * @param dcpl_id Dataset creation property list, for example from createChunkedDatasetProperties()
        * @return Standard hdf5 error condition.
        */
       template <typename T>
@@ -332,7 +346,8 @@ namespace H5Support_NAMESPACE
                                          const std::string& dsetName,
                                          int32_t   rank,
                                          hsize_t* dims,
-                                         T* data)
+                                         T* data,
+                                         hid_t dcpl_id = H5P_DEFAULT)
       {
         H5SUPPORT_MUTEX_LOCK()
 
@@ -363,7 +378,7 @@ namespace H5Support_NAMESPACE
         }
         // Create the Dataset
         // This will fail if dsetName contains a "/"!
-        did = H5Dcreate (loc_id, dsetName.c_str(), dataType, sid, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+        did = H5Dcreate (loc_id, dsetName.c_str(), dataType, sid, H5P_DEFAULT, dcpl_id, H5P_DEFAULT);
         if ( did >= 0 )
         {
           err = H5Dwrite( did, dataType, H5S_ALL, H5S_ALL, H5P_DEFAULT, data );
@@ -410,6 +425,7 @@ namespace H5Support_NAMESPACE
        * @param rank
        * @param dims
        * @param data
+       * @param dcpl_id Dataset creation property list used if the dataset has to be created
        * @return
        */
       template <typename T>
@@ -417,7 +433,8 @@ namespace H5Support_NAMESPACE
                                            const std::string& dsetName,
                                            int32_t   rank,
                                            hsize_t* dims,
-                                           T* data)
+                                           T* data,
+                                           hid_t dcpl_id = H5P_DEFAULT)
       {
         H5SUPPORT_MUTEX_LOCK()
 
@@ -451,7 +468,7 @@ namespace H5Support_NAMESPACE
         HDF_ERROR_HANDLER_ON
         if ( did < 0 ) // dataset does not exist so create it
         {
-          did = H5Dcreate (loc_id, dsetName.c_str(), dataType, sid, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+          did = H5Dcreate (loc_id, dsetName.c_str(), dataType, sid, H5P_DEFAULT, dcpl_id, H5P_DEFAULT);
         }
         if ( did >= 0 )
         {
@@ -652,16 +669,31 @@ namespace H5Support_NAMESPACE
                                                           const char* data);
 
       /**
-      * @brief
-      * @param loc_id
-      * @param dsetName
-      * @param size
-      * @param data
-      * @return
+      * @brief Writes a one dimensional dataset of strings in a single H5Dwrite
+      * @param loc_id The Parent location to write the dataset
+      * @param dsetName The Name to use for the dataset
+      * @param data The strings to write
+      * @param fixedWidth Write fixed width strings padded to the longest string instead of variable length strings
+      * @return Standard HDF5 error conditions
+      */
+      static H5Support_EXPORT herr_t writeVectorOfStringsDataset(hid_t loc_id,
+                                                                 const std::string& dsetName,
+                                                                 const std::vector<std::string>& data,
+                                                                 bool fixedWidth = false);
+
+      /**
+      * @brief Writes a one dimensional dataset of strings in a single H5Dwrite. The pointers may all point into one
+      * packed buffer of null terminated strings, which is then written without copying the strings.
+      * @param loc_id The Parent location to write the dataset
+      * @param dsetName The Name to use for the dataset
+      * @param data Pointers to the null terminated strings to write
+      * @param fixedWidth Write fixed width strings padded to the longest string instead of variable length strings
+      * @return Standard HDF5 error conditions
       */
       static H5Support_EXPORT herr_t writeVectorOfStringsDataset(hid_t loc_id,
                                                                  const std::string& dsetName,
-                                                                 const std::vector<std::string>& data);
+                                                                 const std::vector<const char*>& data,
+                                                                 bool fixedWidth = false);
       /**
        * @brief Writes an Attribute to an HDF5 Object
        * @param loc_id The Parent Location of the HDFobject that is getting the attribute
@@ -1316,6 +1348,21 @@ namespace H5Support_NAMESPACE
       static H5Support_EXPORT herr_t readVectorOfStringDataset(hid_t loc_id,
                                                                const std::string& dsetName,
                                                                std::vector<std::string>& data);
+
+      /**
+       * @brief Reads a one dimensional dataset of variable length or fixed width strings in a single H5Dread. Each
+       * string is appended to values followed by a null terminator, and the position where it starts in values is
+       * appended to offsets.
+       * @param loc_id The parent group that holds the data object to read
+       * @param dsetName The name of the dataset.
+       * @param values The buffer the strings are packed into
+       * @param offsets The start of each string in values
+       * @return Standard HDF error condition
+       */
+      static H5Support_EXPORT herr_t readPackedStringsDataset(hid_t loc_id,
+                                                              const std::string& dsetName,
+                                                              std::vector<char>& values,
+                                                              std::vector<size_t>& offsets);
       /**
        * @brief Reads an Attribute from an HDF5 Object.
        *
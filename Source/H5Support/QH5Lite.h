@@ -212,6 +212,7 @@ namespace H5Support_NAMESPACE
        * @param rank The number of dimensions
        * @param dims The sizes of each dimension
        * @param data The data to be written.
+       * @param dcpl_id Dataset creation property list, for example from H5Lite::createChunkedDatasetProperties()
        * @return Standard hdf5 error condition.
        */
       template <typename T>
@@ -219,9 +220,10 @@ namespace H5Support_NAMESPACE
                                          const QString& dsetName,
                                          int32_t   rank,
                                          hsize_t* dims,
-                                         T* data)
+                                         T* data,
+                                         hid_t dcpl_id = H5P_DEFAULT)
       {
-        return H5Lite::writePointerDataset(loc_id, dsetName.toStdString(), rank, dims, data);
+        return H5Lite::writePointerDataset(loc_id, dsetName.toStdString(), rank, dims, data, dcpl_id);
       }
 
       /**
@@ -231,6 +233,7 @@ namespace H5Support_NAMESPACE
        * @param rank
        * @param dims
        * @param data
+       * @param dcpl_id Dataset creation property list used if the dataset has to be created
        * @return
        */
       template <typename T>
@@ -238,9 +241,10 @@ namespace H5Support_NAMESPACE
                                            const QString& dsetName,
                                            int32_t   rank,
                                            hsize_t* dims,
-                                           T* data)
+                                           T* data,
+                                           hid_t dcpl_id = H5P_DEFAULT)
       {
-        return H5Lite::replacePointerDataset(loc_id, dsetName.toStdString(), rank, dims, data);
+        return H5Lite::replacePointerDataset(loc_id, dsetName.toStdString(), rank, dims, data, dcpl_id);
       }
 
 
@@ -321,16 +325,17 @@ namespace H5Support_NAMESPACE
                                                           const char* data);
 
       /**
-      * @brief
-      * @param loc_id
-      * @param dsetName
-      * @param size
-      * @param data
-      * @return
+      * @brief Writes a one dimensional dataset of strings in a single H5Dwrite
+      * @param loc_id The Parent location to write the dataset
+      * @param dsetName The Name to use for the dataset
+      * @param data The strings to write
+      * @param fixedWidth Write fixed width strings padded to the longest string instead of variable length strings
+      * @return Standard HDF5 error conditions
       */
       static H5Support_EXPORT herr_t writeVectorOfStringsDataset(hid_t loc_id,
                                                                  const QString& dsetName,
-                                                                 const QVector<QString>& data);
+                                                                 const QVector<QString>& data,
+                                                                 bool fixedWidth = false);
       /**
        * @brief Writes an Attribute to an HDF5 Object
        * @param loc_id The Parent Location of the HDFobject that is getting the attribute
@@ -103,6 +103,7 @@ public:
 #if REMOVE_TEST_FILES
     QFile::remove(UnitTest::H5LiteTest::FileName);
     QFile::remove(UnitTest::H5LiteTest::LargeFile);
+    QFile::remove(UnitTest::H5LiteTest::ChunkedFile);
 #endif
   }
 
@@ -1432,13 +1433,109 @@ public:
       QVector<QString> data;
       QH5Lite::readVectorOfStringDataset(file_id, "VlenStrings", data);
       DREAM3D_REQUIRE(data.size() == 5)
+      DREAM3D_REQUIRE(data[1] == "String with a\n   newline")
 
       QH5Utilities::closeFile(file_id);
     }
+
+    // Fixed width strings and packed reads of both kinds of string datasets
+    {
+      hid_t file_id = H5Utilities::createFile(UnitTest::H5LiteTest::VLengthFile.toStdString());
+
+      std::vector<std::string> strings;
+      strings.push_back("Titanium");
+      strings.push_back("");
+      strings.push_back("Nickel");
+      herr_t err = H5Lite::writeVectorOfStringsDataset(file_id, "VlenStrings", strings);
+      DREAM3D_REQUIRE(err >= 0)
+      err = H5Lite::writeVectorOfStringsDataset(file_id, "FixedStrings", strings, true);
+      DREAM3D_REQUIRE(err >= 0)
+      err = H5Lite::writeVectorOfStringsDataset(file_id, "NoStrings", std::vector<std::string>());
+      DREAM3D_REQUIRE(err >= 0)
+
+      std::vector<std::string> data;
+      err = H5Lite::readVectorOfStringDataset(file_id, "FixedStrings", data);
+      DREAM3D_REQUIRE(err >= 0)
+      DREAM3D_REQUIRE(data == strings)
+
+      std::vector<char> values;
+      std::vector<size_t> offsets;
+      err = H5Lite::readPackedStringsDataset(file_id, "VlenStrings", values, offsets);
+      DREAM3D_REQUIRE(err >= 0)
+      err = H5Lite::readPackedStringsDataset(file_id, "FixedStrings", values, offsets);
+      DREAM3D_REQUIRE(err >= 0)
+      err = H5Lite::readPackedStringsDataset(file_id, "NoStrings", values, offsets);
+      DREAM3D_REQUIRE(err >= 0)
+      DREAM3D_REQUIRE(offsets.size() == 6)
+      DREAM3D_REQUIRE(values.size() == 34)
+      for(size_t i = 0; i < offsets.size(); i++)
+      {
+        DREAM3D_REQUIRE(strings[i % 3] == values.data() + offsets[i])
+      }
+
+      H5Utilities::closeFile(file_id);
+    }
   }
 
 #endif
 
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestChunkedDataset()
+  {
+    hid_t file_id = H5Fcreate(UnitTest::H5LiteTest::ChunkedFile.toLatin1().data(), H5F_ACC_TRUNC, H5P_DEFAULT, H5P_DEFAULT);
+    DREAM3D_REQUIRE(file_id > 0);
+
+    // 8 slices of 32 x 16 values that are highly compressible
+    hsize_t dims[3] = {8, 16, 32};
+    hsize_t chunkDims[3] = {1, 16, 32};
+    std::vector<int32_t> data(8 * 16 * 32);
+    for(size_t i = 0; i < data.size(); i++)
+    {
+      data[i] = static_cast<int32_t>(i / 100);
+    }
+
+    hid_t dcpl = H5Lite::createChunkedDatasetProperties(3, chunkDims, 6, true);
+    DREAM3D_REQUIRE(dcpl > 0);
+    herr_t err = H5Lite::writePointerDataset(file_id, "Chunked", 3, dims, data.data(), dcpl);
+    DREAM3D_REQUIRE(err >= 0);
+    err = H5Pclose(dcpl);
+    DREAM3D_REQUIRE(err >= 0);
+
+    // The dataset must be stored chunked with the requested chunk shape
+    hid_t did = H5Dopen(file_id, "Chunked", H5P_DEFAULT);
+    DREAM3D_REQUIRE(did > 0);
+    hid_t plist = H5Dget_create_plist(did);
+    DREAM3D_REQUIRE(H5Pget_layout(plist) == H5D_CHUNKED);
+    hsize_t readChunkDims[3] = {0, 0, 0};
+    DREAM3D_REQUIRE(H5Pget_chunk(plist, 3, readChunkDims) == 3);
+    DREAM3D_REQUIRE(readChunkDims[0] == 1 && readChunkDims[1] == 16 && readChunkDims[2] == 32);
+    if(H5Zfilter_avail(H5Z_FILTER_DEFLATE) > 0)
+    {
+      DREAM3D_REQUIRE(H5Pget_nfilters(plist) == 2);
+      DREAM3D_REQUIRE(H5Dget_storage_size(did) < data.size() * sizeof(int32_t));
+    }
+    H5Pclose(plist);
+    H5Dclose(did);
+
+    // The default property list still writes a contiguous dataset
+    err = H5Lite::writePointerDataset(file_id, "Contiguous", 3, dims, data.data());
+    DREAM3D_REQUIRE(err >= 0);
+    did = H5Dopen(file_id, "Contiguous", H5P_DEFAULT);
+    plist = H5Dget_create_plist(did);
+    DREAM3D_REQUIRE(H5Pget_layout(plist) == H5D_CONTIGUOUS);
+    H5Pclose(plist);
+    H5Dclose(did);
+
+    std::vector<int32_t> readData;
+    err = H5Lite::readVectorDataset(file_id, "Chunked", readData);
+    DREAM3D_REQUIRE(err >= 0);
+    DREAM3D_REQUIRE(readData == data);
+
+    H5Fclose(file_id);
+  }
+
   // -----------------------------------------------------------------------------
   //
   // -----------------------------------------------------------------------------
@@ -1450,6 +1547,7 @@ public:
 
     DREAM3D_REGISTER_TEST(TestTypeDetection())
     DREAM3D_REGISTER_TEST(QH5LiteTest())
+    DREAM3D_REGISTER_TEST(TestChunkedDataset())
     DREAM3D_REGISTER_TEST(RemoveTestFiles())
   }
 
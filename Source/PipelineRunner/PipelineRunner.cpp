@@ -47,6 +47,7 @@
 #include <QtCore/QCoreApplication>
 #include <QtCore/QDir>
 #include <QtCore/QFile>
+#include <QtCore/QSet>
 #include <QtCore/QSettings>
 #include <QtCore/QString>
 #include <QtCore/QtDebug>
@@ -92,10 +93,40 @@ int main(int argc, char* argv[])
                                      "Pipeline File as a JSON file.", "file");
   parser.addOption(pipelineFileArg);
 
+  // An optional limit on the number of threads each filter may use (-t)
+  QCommandLineOption threadsArg(QStringList() << "t"
+                                              << "threads",
+                                "Maximum number of threads each filter may use. Defaults to all available cores.", "count", "0");
+  parser.addOption(threadsArg);
+
+  // Run independent filters at the same time (-c)
+  QCommandLineOption concurrentArg(QStringList() << "c"
+                                                 << "concurrent",
+                                   "Execute filters that do not depend on each other concurrently.");
+  parser.addOption(concurrentArg);
+
+  // Write a JSON report of the time and memory used by each filter (--profile)
+  QCommandLineOption profileArg(QStringList() << "profile", "Write the time and memory used by each filter to a JSON file.", "file");
+  parser.addOption(profileArg);
+
+  // Write checkpoints that a later run can resume from (--checkpoint, --checkpoint-after, --checkpoint-interval)
+  QCommandLineOption checkpointArg(QStringList() << "checkpoint", "Write pipeline checkpoints to this .dream3d file. Requires --checkpoint-after or --checkpoint-interval.", "file");
+  parser.addOption(checkpointArg);
+  QCommandLineOption checkpointAfterArg(QStringList() << "checkpoint-after",
+                                        "Comma separated list of the filters (numbered from 1) after which a checkpoint is written.", "filters");
+  parser.addOption(checkpointAfterArg);
+  QCommandLineOption checkpointIntervalArg(QStringList() << "checkpoint-interval", "Write a checkpoint at most every this many minutes.", "minutes", "0");
+  parser.addOption(checkpointIntervalArg);
+
+  // Continue a pipeline from a checkpoint written by an earlier run (--resume)
+  QCommandLineOption resumeArg(QStringList() << "resume", "Load the data stored in a checkpoint file and continue with the filter after it.", "checkpoint");
+  parser.addOption(resumeArg);
+
   // Process the actual command line arguments given by the user
   parser.process(*app);
 
   QString pipelineFile = parser.value(pipelineFileArg);
+  int maxNumberOfThreads = parser.value(threadsArg).toInt();
 
   std::cout << "PipelineRunner Starting. " << std::endl;
   std::cout << "   " << SIMPLib::Version::PackageComplete().toStdString() << std::endl;
@@ -143,6 +174,40 @@ int main(int argc, char* argv[])
   }
 
   std::cout << "Pipeline Count: " << pipeline->size() << std::endl;
+  pipeline->setMaxNumberOfThreads(maxNumberOfThreads);
+  pipeline->setConcurrentExecution(parser.isSet(concurrentArg));
+  if(parser.isSet(checkpointArg))
+  {
+    bool intervalOk = false;
+    int checkpointInterval = parser.value(checkpointIntervalArg).toInt(&intervalOk);
+    if(!intervalOk || checkpointInterval < 0)
+    {
+      std::cout << "Invalid number of minutes '" << parser.value(checkpointIntervalArg).toStdString() << "' for --checkpoint-interval. Exiting now." << std::endl;
+      return EXIT_FAILURE;
+    }
+    QSet<int> checkpointFilters;
+    QStringList filterNumbers = parser.value(checkpointAfterArg).split(',', QString::SkipEmptyParts);
+    for(const QString& filterNumber : filterNumbers)
+    {
+      bool ok = false;
+      int index = filterNumber.trimmed().toInt(&ok) - 1;
+      if(!ok || index < 0 || index >= static_cast<int>(pipeline->size()))
+      {
+        std::cout << "Invalid filter number '" << filterNumber.toStdString() << "' for --checkpoint-after. Exiting now." << std::endl;
+        return EXIT_FAILURE;
+      }
+      checkpointFilters.insert(index);
+    }
+    // Without either option the pipeline would never write the checkpoint file
+    if(checkpointFilters.empty() && checkpointInterval == 0)
+    {
+      std::cout << "--checkpoint requires --checkpoint-after or a --checkpoint-interval greater than 0. Exiting now." << std::endl;
+      return EXIT_FAILURE;
+    }
+    pipeline->setCheckpointFile(parser.value(checkpointArg));
+    pipeline->setCheckpointFilterIndices(checkpointFilters);
+    pipeline->setCheckpointInterval(checkpointInterval);
+  }
   Observer obs; // Create an Observer to report errors/progress from the executing pipeline
   pipeline->addMessageReceiver(&obs);
   // Preflight the pipeline
@@ -152,9 +217,33 @@ int main(int argc, char* argv[])
     std::cout << "Errors preflighting the pipeline. Exiting Now." << std::endl;
     return EXIT_FAILURE;
   }
+  if(parser.isSet(resumeArg))
+  {
+    QString errorMessage;
+    err = pipeline->resumeFromCheckpoint(parser.value(resumeArg), errorMessage);
+    if(err < 0)
+    {
+      std::cout << "The checkpoint cannot be used to resume this pipeline: " << errorMessage.toStdString() << std::endl;
+      return EXIT_FAILURE;
+    }
+    std::cout << "Resuming from checkpoint " << parser.value(resumeArg).toStdString() << std::endl;
+  }
   // Now actually execute the pipeline
   pipeline->execute();
   err = pipeline->getErrorCondition();
+
+  if(parser.isSet(profileArg))
+  {
+    QString profileFile = parser.value(profileArg);
+    if(pipeline->getExecutionProfile().writeJsonFile(profileFile))
+    {
+      std::cout << "Profile written to " << profileFile.toStdString() << std::endl;
+    }
+    else
+    {
+      std::cout << "The profile file '" << profileFile.toStdString() << "' could not be written" << std::endl;
+    }
+  }
   if(err < 0)
   {
     std::cout << "Error Condition of Pipeline: " << err << std::endl;
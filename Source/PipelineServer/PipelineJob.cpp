@@ -0,0 +1,179 @@
+/* ============================================================================
+* Copyright (c) 2009-2015 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-07-D-5800
+*    United States Air Force Prime Contract FA8650-10-D-5210
+*    United States Prime Contract Navy N00173-07-C-2068
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+
+#include "PipelineJob.h"
+
+#include <QtCore/QJsonDocument>
+#include <QtCore/QMutexLocker>
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+PipelineJob::PipelineJob() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+PipelineJob::~PipelineJob() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PipelineJob::addMessage(const QJsonObject& message)
+{
+  QByteArray line = QJsonDocument(message).toJson(QJsonDocument::Compact) + "\n";
+  QMutexLocker locker(&m_Mutex);
+  m_Messages.push_back(line);
+  m_MessageAdded.wakeAll();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PipelineJob::finish(const QJsonObject& result)
+{
+  QByteArray line = QJsonDocument(result).toJson(QJsonDocument::Compact) + "\n";
+  QMutexLocker locker(&m_Mutex);
+  m_Messages.push_back(line);
+  m_Result = result;
+  m_Finished = true;
+  m_MessageAdded.wakeAll();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QVector<QByteArray> PipelineJob::takeMessages(unsigned long timeout, bool& finished)
+{
+  QVector<QByteArray> messages;
+  QMutexLocker locker(&m_Mutex);
+  if(m_Messages.empty() && !m_Finished)
+  {
+    m_MessageAdded.wait(&m_Mutex, timeout);
+  }
+  messages.swap(m_Messages);
+  finished = m_Finished;
+  return messages;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QJsonObject PipelineJob::waitForResult()
+{
+  QMutexLocker locker(&m_Mutex);
+  while(!m_Finished)
+  {
+    m_MessageAdded.wait(&m_Mutex);
+  }
+  return m_Result;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PipelineJob::setDataContainerArray(const DataContainerArray::Pointer& dca)
+{
+  m_DataContainerArray = dca;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+DataContainerArray::Pointer PipelineJob::getDataContainerArray() const
+{
+  return m_DataContainerArray;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QJsonObject PipelineJob::ToJson(const PipelineMessage& pm)
+{
+  QJsonObject message;
+  switch(pm.getType())
+  {
+  case PipelineMessage::MessageType::Error:
+    message["Type"] = "Error";
+    break;
+  case PipelineMessage::MessageType::Warning:
+    message["Type"] = "Warning";
+    break;
+  case PipelineMessage::MessageType::StatusMessage:
+    message["Type"] = "Status";
+    break;
+  case PipelineMessage::MessageType::StandardOutputMessage:
+    message["Type"] = "StandardOutput";
+    break;
+  case PipelineMessage::MessageType::ProgressValue:
+    message["Type"] = "Progress";
+    break;
+  case PipelineMessage::MessageType::StatusMessageAndProgressValue:
+    message["Type"] = "StatusAndProgress";
+    break;
+  case PipelineMessage::MessageType::UnknownMessageType:
+    message["Type"] = "Unknown";
+    break;
+  }
+  message["Text"] = pm.getPrefix() + pm.getText();
+  message["Code"] = pm.getCode();
+  message["FilterClassName"] = pm.getFilterClassName();
+  message["FilterHumanLabel"] = pm.getFilterHumanLabel();
+  message["PipelineIndex"] = pm.getPipelineIndex();
+  message["ProgressValue"] = pm.getProgressValue();
+  return message;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+PipelineJobObserver::PipelineJobObserver(const PipelineJob::Pointer& job)
+: m_Job(job)
+{
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+PipelineJobObserver::~PipelineJobObserver() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PipelineJobObserver::processPipelineMessage(const PipelineMessage& pm)
+{
+  m_Job->addMessage(PipelineJob::ToJson(pm));
+}
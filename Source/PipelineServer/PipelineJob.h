@@ -0,0 +1,147 @@
+/* ============================================================================
+* Copyright (c) 2009-2015 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-07-D-5800
+*    United States Air Force Prime Contract FA8650-10-D-5210
+*    United States Prime Contract Navy N00173-07-C-2068
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+
+#pragma once
+
+#include <memory>
+
+#include <QtCore/QByteArray>
+#include <QtCore/QJsonObject>
+#include <QtCore/QMutex>
+#include <QtCore/QVector>
+#include <QtCore/QWaitCondition>
+
+#include "SIMPLib/Common/Observer.h"
+#include "SIMPLib/Common/PipelineMessage.h"
+#include "SIMPLib/DataContainers/DataContainerArray.h"
+
+/**
+ * @brief The PipelineJob class collects the messages of a job that runs on a worker thread so that the thread
+ * serving the HTTP request can stream them to the client. Every message is a JSON object; the last one is the
+ * result of the job.
+ */
+class PipelineJob
+{
+  public:
+    using Pointer = std::shared_ptr<PipelineJob>;
+
+    PipelineJob();
+    virtual ~PipelineJob();
+
+    /**
+     * @brief addMessage Queues a message for the client
+     * @param message
+     */
+    void addMessage(const QJsonObject& message);
+
+    /**
+     * @brief finish Queues the result of the job as its last message
+     * @param result
+     */
+    void finish(const QJsonObject& result);
+
+    /**
+     * @brief takeMessages Waits up to the timeout for messages and removes them from the queue
+     * @param timeout In milliseconds
+     * @param finished Set to true once the result has been taken
+     * @return The messages encoded as single lines of JSON
+     */
+    QVector<QByteArray> takeMessages(unsigned long timeout, bool& finished);
+
+    /**
+     * @brief waitForResult Blocks until the job has finished
+     * @return
+     */
+    QJsonObject waitForResult();
+
+    /**
+     * @brief setDataContainerArray Stores data the job produced. Must be called before finish().
+     * @param dca
+     */
+    void setDataContainerArray(const DataContainerArray::Pointer& dca);
+
+    /**
+     * @brief getDataContainerArray Returns the data the job produced once waitForResult() has returned
+     * @return
+     */
+    DataContainerArray::Pointer getDataContainerArray() const;
+
+    /**
+     * @brief ToJson Converts a message emitted by a pipeline or its filters
+     * @param pm
+     * @return
+     */
+    static QJsonObject ToJson(const PipelineMessage& pm);
+
+  private:
+    QMutex m_Mutex;
+    QWaitCondition m_MessageAdded;
+    QVector<QByteArray> m_Messages;
+    QJsonObject m_Result;
+    bool m_Finished = false;
+    DataContainerArray::Pointer m_DataContainerArray;
+
+  public:
+    PipelineJob(const PipelineJob&) = delete;            // Copy Constructor Not Implemented
+    PipelineJob(PipelineJob&&) = delete;                 // Move Constructor Not Implemented
+    PipelineJob& operator=(const PipelineJob&) = delete; // Copy Assignment Not Implemented
+    PipelineJob& operator=(PipelineJob&&) = delete;      // Move Assignment Not Implemented
+};
+
+/**
+ * @brief The PipelineJobObserver class forwards the messages of a FilterPipeline to a PipelineJob. It has to be
+ * created on the thread that executes the pipeline so that the messages are delivered directly.
+ */
+class PipelineJobObserver : public Observer
+{
+    Q_OBJECT
+
+  public:
+    PipelineJobObserver(const PipelineJob::Pointer& job);
+    ~PipelineJobObserver() override;
+
+  public slots:
+    void processPipelineMessage(const PipelineMessage& pm) override;
+
+  private:
+    PipelineJob::Pointer m_Job;
+
+  public:
+    PipelineJobObserver(const PipelineJobObserver&) = delete;            // Copy Constructor Not Implemented
+    PipelineJobObserver(PipelineJobObserver&&) = delete;                 // Move Constructor Not Implemented
+    PipelineJobObserver& operator=(const PipelineJobObserver&) = delete; // Copy Assignment Not Implemented
+    PipelineJobObserver& operator=(PipelineJobObserver&&) = delete;      // Move Assignment Not Implemented
+};
@@ -0,0 +1,409 @@
+/* ============================================================================
+* Copyright (c) 2009-2015 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-07-D-5800
+*    United States Air Force Prime Contract FA8650-10-D-5210
+*    United States Prime Contract Navy N00173-07-C-2068
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+
+#include "PipelineRequestHandler.h"
+
+#include <QtCore/QElapsedTimer>
+#include <QtCore/QFileInfo>
+#include <QtCore/QJsonArray>
+#include <QtCore/QJsonDocument>
+#include <QtCore/QMutexLocker>
+#include <QtCore/QRunnable>
+
+#include "SIMPLib/Common/Constants.h"
+#include "SIMPLib/CoreFilters/DataContainerReader.h"
+#include "SIMPLib/Filtering/FilterPipeline.h"
+#include "SIMPLib/SIMPLibVersion.h"
+
+namespace
+{
+/**
+ * @brief Runs a function on a QThreadPool
+ */
+class FunctionRunnable : public QRunnable
+{
+public:
+  explicit FunctionRunnable(const std::function<void()>& function)
+  : m_Function(function)
+  {
+  }
+  ~FunctionRunnable() override = default;
+
+  void run() override
+  {
+    m_Function();
+  }
+
+private:
+  std::function<void()> m_Function;
+};
+
+// How long the thread serving a request waits for new messages at a time
+const unsigned long k_MessageTimeout = 250;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QByteArray statusDescription(int statusCode)
+{
+  switch(statusCode)
+  {
+  case 200:
+    return "OK";
+  case 400:
+    return "Bad Request";
+  case 404:
+    return "Not Found";
+  case 405:
+    return "Method Not Allowed";
+  default:
+    return "Internal Server Error";
+  }
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+PipelineRequestHandler::PipelineRequestHandler(int numWorkers, int maxNumberOfThreads, QObject* parent)
+: HttpRequestHandler(parent)
+, m_MaxNumberOfThreads(maxNumberOfThreads)
+, m_QueuedJobs(0)
+, m_RunningJobs(0)
+{
+  m_Workers.setMaxThreadCount(numWorkers);
+  // The workers keep running so that every job does not pay for starting a thread
+  m_Workers.setExpiryTimeout(-1);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+PipelineRequestHandler::~PipelineRequestHandler()
+{
+  m_Workers.waitForDone();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PipelineRequestHandler::service(HttpRequest& request, HttpResponse& response)
+{
+  QByteArray path = request.getPath();
+  QByteArray method = request.getMethod();
+  if(path == "/execute" && method == "POST")
+  {
+    executePipeline(request, response);
+  }
+  else if(path == "/cache")
+  {
+    serveCache(request, response);
+  }
+  else if(path == "/status" && method == "GET")
+  {
+    serveStatus(response);
+  }
+  else
+  {
+    WriteError(response, 404, QObject::tr("Unknown request %1 %2").arg(QString(method)).arg(QString(path)));
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PipelineRequestHandler::executePipeline(HttpRequest& request, HttpResponse& response)
+{
+  QJsonParseError parseError;
+  QJsonDocument doc = QJsonDocument::fromJson(request.getBody(), &parseError);
+  if(parseError.error != QJsonParseError::NoError || !doc.isObject())
+  {
+    WriteError(response, 400, QObject::tr("The request body is not a JSON pipeline: %1").arg(parseError.errorString()));
+    return;
+  }
+
+  // The filters are only created on the worker so that they live in the thread that executes them and the
+  // pipeline's queued connections to them are delivered there, not to this thread while it streams messages
+  QJsonObject pipelineJson = doc.object();
+  if(pipelineJson[SIMPL::Settings::PipelineBuilderGroup].toObject()[SIMPL::Settings::NumFilters].toInt() <= 0)
+  {
+    WriteError(response, 400, QObject::tr("The request body does not hold any filters"));
+    return;
+  }
+
+  DataContainerArray::Pointer input;
+  QString inputName = QString::fromUtf8(request.getParameter("input"));
+  if(!inputName.isEmpty())
+  {
+    QMutexLocker locker(&m_InputsMutex);
+    if(!m_Inputs.contains(inputName))
+    {
+      locker.unlock();
+      WriteError(response, 404, QObject::tr("There is no cached input named '%1'").arg(inputName));
+      return;
+    }
+    input = m_Inputs[inputName];
+  }
+  QByteArray concurrent = request.getParameter("concurrent");
+  bool concurrentExecution = (concurrent == "1" || concurrent == "true");
+
+  PipelineJob::Pointer job = std::make_shared<PipelineJob>();
+  runJob(job, [this, job, pipelineJson, input, concurrentExecution]() {
+    QElapsedTimer timer;
+    timer.start();
+
+    FilterPipeline::Pointer pipeline;
+    {
+      // Reading a pipeline registers a filter factory with the FilterManager, so only one is read at a time
+      QMutexLocker locker(&m_PipelineMutex);
+      pipeline = FilterPipeline::FromJson(pipelineJson);
+    }
+    QJsonObject result;
+    result["Type"] = "Result";
+    if(nullptr == pipeline.get() || pipeline->size() == 0)
+    {
+      QJsonObject error;
+      error["Type"] = "Error";
+      error["Text"] = QObject::tr("The request body does not hold any filters");
+      job->addMessage(error);
+      result["ErrorCondition"] = -1;
+      job->finish(result);
+      return;
+    }
+    if(nullptr != input.get())
+    {
+      pipeline->setInputDataContainerArray(input);
+    }
+    pipeline->setConcurrentExecution(concurrentExecution);
+    pipeline->setMaxNumberOfThreads(m_MaxNumberOfThreads);
+
+    // Created on the worker so that the pipeline delivers its messages directly
+    PipelineJobObserver observer(job);
+    pipeline->addMessageReceiver(&observer);
+    int err = pipeline->preflightPipeline();
+    if(err >= 0)
+    {
+      pipeline->execute();
+      err = pipeline->getErrorCondition();
+    }
+
+    result["ErrorCondition"] = err;
+    result["WallTime"] = static_cast<double>(timer.nsecsElapsed()) * 1.0E-9;
+    result["Profile"] = pipeline->getExecutionProfile().toJson();
+    job->finish(result);
+  });
+
+  // Each message is sent as soon as it arrives, one JSON object per line
+  response.setHeader("Content-Type", "application/x-ndjson");
+  bool finished = false;
+  while(!finished)
+  {
+    QVector<QByteArray> messages = job->takeMessages(k_MessageTimeout, finished);
+    for(const QByteArray& message : messages)
+    {
+      response.write(message);
+    }
+    if(!messages.empty())
+    {
+      response.flush();
+    }
+  }
+  response.write(QByteArray(), true);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PipelineRequestHandler::serveCache(HttpRequest& request, HttpResponse& response)
+{
+  QByteArray method = request.getMethod();
+  QString name = QString::fromUtf8(request.getParameter("name"));
+  if(method == "GET")
+  {
+    QJsonObject json;
+    json["Inputs"] = QJsonArray::fromStringList(getInputNames());
+    WriteJson(response, 200, json);
+  }
+  else if(method == "POST")
+  {
+    QString filePath = QString::fromUtf8(request.getParameter("file"));
+    if(name.isEmpty() || filePath.isEmpty())
+    {
+      WriteError(response, 400, QObject::tr("Caching an input requires the name and file parameters"));
+      return;
+    }
+    QString errorMessage;
+    if(loadInput(name, filePath, errorMessage) < 0)
+    {
+      WriteError(response, 500, errorMessage);
+      return;
+    }
+    QJsonObject json;
+    json["Name"] = name;
+    json["File"] = filePath;
+    WriteJson(response, 200, json);
+  }
+  else if(method == "DELETE")
+  {
+    QMutexLocker locker(&m_InputsMutex);
+    int count = m_Inputs.remove(name);
+    locker.unlock();
+    if(count == 0)
+    {
+      WriteError(response, 404, QObject::tr("There is no cached input named '%1'").arg(name));
+      return;
+    }
+    QJsonObject json;
+    json["Name"] = name;
+    WriteJson(response, 200, json);
+  }
+  else
+  {
+    WriteError(response, 405, QObject::tr("Unsupported method %1 for /cache").arg(QString(method)));
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PipelineRequestHandler::serveStatus(HttpResponse& response)
+{
+  QJsonObject json;
+  json["Version"] = SIMPLib::Version::PackageComplete();
+  json["Workers"] = m_Workers.maxThreadCount();
+  json["RunningJobs"] = m_RunningJobs.load();
+  json["QueuedJobs"] = m_QueuedJobs.load();
+  json["Inputs"] = QJsonArray::fromStringList(getInputNames());
+  WriteJson(response, 200, json);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int PipelineRequestHandler::loadInput(const QString& name, const QString& filePath, QString& errorMessage)
+{
+  if(!QFileInfo(filePath).exists())
+  {
+    errorMessage = QObject::tr("The input file '%1' does not exist").arg(filePath);
+    return -1;
+  }
+
+  // The file is read on a worker like any other job so that the number of jobs using HDF5 stays bounded
+  PipelineJob::Pointer job = std::make_shared<PipelineJob>();
+  runJob(job, [job, filePath]() {
+    DataContainerReader::Pointer reader = DataContainerReader::New();
+    reader->setInputFile(filePath);
+    DataContainerArrayProxy proxy = reader->readDataContainerArrayStructure(filePath);
+    proxy.setFlags(Qt::Checked);
+    reader->setInputFileDataContainerArrayProxy(proxy);
+    reader->setDataContainerArray(DataContainerArray::New());
+    reader->execute();
+
+    if(reader->getErrorCondition() >= 0)
+    {
+      job->setDataContainerArray(reader->getDataContainerArray());
+    }
+    QJsonObject result;
+    result["Type"] = "Result";
+    result["ErrorCondition"] = reader->getErrorCondition();
+    job->finish(result);
+  });
+
+  QJsonObject result = job->waitForResult();
+  int err = result["ErrorCondition"].toInt();
+  if(err < 0)
+  {
+    errorMessage = QObject::tr("Error %1 reading the input file '%2'").arg(err).arg(filePath);
+    return err;
+  }
+
+  QMutexLocker locker(&m_InputsMutex);
+  m_Inputs[name] = job->getDataContainerArray();
+  return 0;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QStringList PipelineRequestHandler::getInputNames()
+{
+  QMutexLocker locker(&m_InputsMutex);
+  return m_Inputs.keys();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PipelineRequestHandler::runJob(const PipelineJob::Pointer& job, const std::function<void()>& function)
+{
+  m_QueuedJobs++;
+  QJsonObject queued;
+  queued["Type"] = "Status";
+  queued["Text"] = QObject::tr("Queued while %1 jobs are running").arg(m_RunningJobs.load());
+  job->addMessage(queued);
+
+  m_Workers.start(new FunctionRunnable([this, job, function]() {
+    m_QueuedJobs--;
+    m_RunningJobs++;
+    QJsonObject started;
+    started["Type"] = "Status";
+    started["Text"] = QObject::tr("Started");
+    job->addMessage(started);
+    function();
+    m_RunningJobs--;
+  }));
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PipelineRequestHandler::WriteJson(HttpResponse& response, int statusCode, const QJsonObject& json)
+{
+  response.setStatus(statusCode, statusDescription(statusCode));
+  response.setHeader("Content-Type", "application/json");
+  response.write(QJsonDocument(json).toJson(QJsonDocument::Compact) + "\n", true);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PipelineRequestHandler::WriteError(HttpResponse& response, int statusCode, const QString& errorMessage)
+{
+  QJsonObject json;
+  json["Type"] = "Error";
+  json["Text"] = errorMessage;
+  WriteJson(response, statusCode, json);
+}
@@ -0,0 +1,155 @@
+/* ============================================================================
+* Copyright (c) 2009-2015 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-07-D-5800
+*    United States Air Force Prime Contract FA8650-10-D-5210
+*    United States Prime Contract Navy N00173-07-C-2068
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+
+#pragma once
+
+#include <atomic>
+#include <functional>
+
+#include <QtCore/QMap>
+#include <QtCore/QMutex>
+#include <QtCore/QString>
+#include <QtCore/QThreadPool>
+
+#include "QtWebApp/httpserver/httprequesthandler.h"
+
+#include "SIMPLib/DataContainers/DataContainerArray.h"
+
+#include "PipelineJob.h"
+
+/**
+ * @brief The PipelineRequestHandler class serves the HTTP interface of the PipelineServer:
+ *
+ * POST /execute[?input=name][&concurrent=1] executes the JSON pipeline in the request body and streams its
+ * messages back as one JSON object per line; the last line is the result. With input the pipeline starts from
+ * a copy of the cached DataContainerArray of that name instead of an empty one.
+ *
+ * POST /cache?name=name&file=path reads every DataContainer of a .dream3d file into the cache,
+ * DELETE /cache?name=name removes it again and GET /cache lists the cached names.
+ *
+ * GET /status reports the number of running and queued jobs.
+ *
+ * Jobs run on a worker pool of a fixed size; requests that find every worker busy wait in a queue.
+ */
+class PipelineRequestHandler : public HttpRequestHandler
+{
+    Q_OBJECT
+
+  public:
+    /**
+     * @brief PipelineRequestHandler
+     * @param numWorkers The number of jobs that may run at the same time
+     * @param maxNumberOfThreads The maximum number of threads each filter may use, see FilterPipeline
+     * @param parent
+     */
+    PipelineRequestHandler(int numWorkers, int maxNumberOfThreads, QObject* parent = nullptr);
+    ~PipelineRequestHandler() override;
+
+    /**
+     * @brief service Reimplemented from @see HttpRequestHandler class
+     */
+    void service(HttpRequest& request, HttpResponse& response) override;
+
+    /**
+     * @brief loadInput Reads every DataContainer of a .dream3d file on a worker and caches them under the name
+     * @param name
+     * @param filePath
+     * @param errorMessage Describes the error if one occurred
+     * @return Integer error value
+     */
+    int loadInput(const QString& name, const QString& filePath, QString& errorMessage);
+
+    /**
+     * @brief getInputNames Returns the names of the cached DataContainerArrays
+     * @return
+     */
+    QStringList getInputNames();
+
+  protected:
+    /**
+     * @brief executePipeline Serves POST /execute
+     */
+    void executePipeline(HttpRequest& request, HttpResponse& response);
+
+    /**
+     * @brief serveCache Serves the /cache requests
+     */
+    void serveCache(HttpRequest& request, HttpResponse& response);
+
+    /**
+     * @brief serveStatus Serves GET /status
+     */
+    void serveStatus(HttpResponse& response);
+
+    /**
+     * @brief runJob Queues the function on the worker pool. The job counts as queued until a worker starts it.
+     * @param job Receives a status message when a worker starts the function
+     * @param function
+     */
+    void runJob(const PipelineJob::Pointer& job, const std::function<void()>& function);
+
+    /**
+     * @brief WriteJson Sends a complete JSON response
+     * @param response
+     * @param statusCode
+     * @param json
+     */
+    static void WriteJson(HttpResponse& response, int statusCode, const QJsonObject& json);
+
+    /**
+     * @brief WriteError Sends a JSON response holding an error message
+     * @param response
+     * @param statusCode
+     * @param errorMessage
+     */
+    static void WriteError(HttpResponse& response, int statusCode, const QString& errorMessage);
+
+  private:
+    QThreadPool m_Workers;
+    int m_MaxNumberOfThreads;
+    std::atomic<int> m_QueuedJobs;
+    std::atomic<int> m_RunningJobs;
+
+    QMutex m_PipelineMutex;
+    QMutex m_InputsMutex;
+    QMap<QString, DataContainerArray::Pointer> m_Inputs;
+
+  public:
+    PipelineRequestHandler(const PipelineRequestHandler&) = delete;            // Copy Constructor Not Implemented
+    PipelineRequestHandler(PipelineRequestHandler&&) = delete;                 // Move Constructor Not Implemented
+    PipelineRequestHandler& operator=(const PipelineRequestHandler&) = delete; // Copy Assignment Not Implemented
+    PipelineRequestHandler& operator=(PipelineRequestHandler&&) = delete;      // Move Assignment Not Implemented
+};
@@ -0,0 +1,178 @@
+/* ============================================================================
+* Copyright (c) 2009-2015 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-07-D-5800
+*    United States Air Force Prime Contract FA8650-10-D-5210
+*    United States Prime Contract Navy N00173-07-C-2068
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+// C Includes
+#include <cstdlib>
+
+// C++ Includes
+#include <algorithm>
+#include <iostream>
+
+// Qt Includes
+#include <QtCore/QCommandLineOption>
+#include <QtCore/QCommandLineParser>
+#include <QtCore/QCoreApplication>
+#include <QtCore/QSettings>
+#include <QtCore/QString>
+#include <QtCore/QTextStream>
+#include <QtCore/QThread>
+
+#include <hdf5.h>
+
+#include "QtWebApp/httpserver/httplistener.h"
+
+// DREAM3DLib includes
+#include "SIMPLib/Filtering/FilterManager.h"
+#include "SIMPLib/Filtering/QMetaObjectUtilities.h"
+#include "SIMPLib/Plugin/SIMPLibPluginLoader.h"
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/SIMPLibVersion.h"
+
+#include "PipelineRequestHandler.h"
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int main(int argc, char* argv[])
+{
+  // Instantiate the QCoreApplication that we need to get the current path and load plugins.
+  QCoreApplication* app = new QCoreApplication(argc, argv);
+  QCoreApplication::setOrganizationName("BlueQuartz Software");
+  QCoreApplication::setOrganizationDomain("bluequartz.net");
+  QCoreApplication::setApplicationName("PipelineServer");
+  QCoreApplication::setApplicationVersion(SIMPLib::Version::Major() + "." + SIMPLib::Version::Minor() + "." + SIMPLib::Version::Patch());
+
+  QCommandLineParser parser;
+  QString str;
+  QTextStream ss(&str);
+  ss << "Pipeline Server (" << SIMPLib::Version::Major() << "." << SIMPLib::Version::Minor() << "." << SIMPLib::Version::Patch()
+     << "): This application keeps the filters loaded and executes JSON formatted pipelines that are sent to it over HTTP. ";
+  parser.setApplicationDescription(str);
+  parser.addHelpOption();
+  parser.addVersionOption();
+
+  // The address and port to listen on (--host, --port)
+  QCommandLineOption hostArg(QStringList() << "host", "The address to listen on. Defaults to the local host only.", "address", "127.0.0.1");
+  parser.addOption(hostArg);
+  QCommandLineOption portArg(QStringList() << "port", "The port to listen on.", "port", "8095");
+  parser.addOption(portArg);
+
+  // The number of pipelines that may execute at the same time (-w)
+  QCommandLineOption workersArg(QStringList() << "w"
+                                              << "workers",
+                                "Number of pipelines that may execute at the same time. Defaults to the number of cores.", "count",
+                                QString::number(QThread::idealThreadCount()));
+  parser.addOption(workersArg);
+
+  // An optional limit on the number of threads each filter may use (-t)
+  QCommandLineOption threadsArg(QStringList() << "t"
+                                              << "threads",
+                                "Maximum number of threads each filter may use. Defaults to all available cores.", "count", "0");
+  parser.addOption(threadsArg);
+
+  // Inputs that are read once and kept in memory (-i)
+  QCommandLineOption inputArg(QStringList() << "i"
+                                            << "input",
+                              "Read a .dream3d file into memory under a name that pipelines can start from. May be given several times.", "name=file");
+  parser.addOption(inputArg);
+
+  // Process the actual command line arguments given by the user
+  parser.process(*app);
+
+  int numWorkers = std::max(parser.value(workersArg).toInt(), 1);
+  int maxNumberOfThreads = parser.value(threadsArg).toInt();
+#ifndef H5_HAVE_THREADSAFE
+  // Pipelines that read or write files would use HDF5 from several threads
+  if(numWorkers > 1)
+  {
+    std::cout << "The HDF5 library was not built thread safe, so only one pipeline executes at a time." << std::endl;
+    numWorkers = 1;
+  }
+#endif
+
+  std::cout << "PipelineServer Starting. " << std::endl;
+  std::cout << "   " << SIMPLib::Version::PackageComplete().toStdString() << std::endl;
+
+  // Register all the filters including trying to load those from Plugins. This happens once and is shared by
+  // every pipeline that the server executes.
+  FilterManager* fm = FilterManager::Instance();
+  SIMPLibPluginLoader::LoadPluginFilters(fm);
+
+  QMetaObjectUtilities::RegisterMetaTypes();
+
+  PipelineRequestHandler* requestHandler = new PipelineRequestHandler(numWorkers, maxNumberOfThreads, app);
+
+  QStringList inputs = parser.values(inputArg);
+  for(const QString& input : inputs)
+  {
+    int separator = input.indexOf('=');
+    if(separator <= 0)
+    {
+      std::cout << "Invalid input '" << input.toStdString() << "'. Expected name=file. Exiting now." << std::endl;
+      return EXIT_FAILURE;
+    }
+    QString name = input.left(separator);
+    QString filePath = input.mid(separator + 1);
+    QString errorMessage;
+    if(requestHandler->loadInput(name, filePath, errorMessage) < 0)
+    {
+      std::cout << errorMessage.toStdString() << ". Exiting now." << std::endl;
+      return EXIT_FAILURE;
+    }
+    std::cout << "Cached input '" << name.toStdString() << "' from " << filePath.toStdString() << std::endl;
+  }
+
+  // Configure and start the TCP listener
+  QSettings* listenerSettings = new QSettings(app);
+  listenerSettings->beginGroup("listener");
+  listenerSettings->setValue("host", parser.value(hostArg));
+  listenerSettings->setValue("port", parser.value(portArg));
+  listenerSettings->setValue("minThreads", "4");
+  listenerSettings->setValue("maxThreads", "100");
+  listenerSettings->setValue("readTimeout", "60000");
+  listenerSettings->setValue("maxRequestSize", "64000000");
+  listenerSettings->setValue("maxMultiPartSize", "100000000");
+  HttpListener* httpListener = new HttpListener(listenerSettings, requestHandler, app);
+  if(!httpListener->isListening())
+  {
+    std::cout << "Unable to listen on " << parser.value(hostArg).toStdString() << ":" << parser.value(portArg).toStdString() << ". Exiting now." << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  std::cout << "Listening on http://" << parser.value(hostArg).toStdString() << ":" << parser.value(portArg).toStdString() << " with " << numWorkers << " workers"
+            << std::endl;
+
+  return app->exec();
+}
@@ -0,0 +1,221 @@
+/* ============================================================================
+* Copyright (c) 2009-2015 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-07-D-5800
+*    United States Air Force Prime Contract FA8650-10-D-5210
+*    United States Prime Contract Navy N00173-07-C-2068
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+
+#include "BenchmarkSupport.h"
+
+#include <algorithm>
+#include <chrono>
+#include <numeric>
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+BenchmarkState::BenchmarkState(size_t size, int repetitions, int maxNumberOfThreads, const QString& tempDir)
+: m_Size(size)
+, m_Repetitions(repetitions)
+, m_MaxNumberOfThreads(maxNumberOfThreads)
+, m_TempDir(tempDir)
+{
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+BenchmarkState::~BenchmarkState() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t BenchmarkState::getSize() const
+{
+  return m_Size;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int BenchmarkState::getMaxNumberOfThreads() const
+{
+  return m_MaxNumberOfThreads;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString BenchmarkState::getTempDir() const
+{
+  return m_TempDir;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool BenchmarkState::nextRepetition()
+{
+  if(hasFailed() || m_Repetition >= m_Repetitions)
+  {
+    return false;
+  }
+  m_Repetition++;
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void BenchmarkState::time(const std::function<void()>& func)
+{
+  std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+  func();
+  std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+  m_Samples.push_back(std::chrono::duration<double>(end - start).count());
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void BenchmarkState::setItemsProcessed(size_t items)
+{
+  m_ItemsProcessed = items;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void BenchmarkState::setBytesProcessed(size_t bytes)
+{
+  m_BytesProcessed = bytes;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void BenchmarkState::fail(const QString& message)
+{
+  m_ErrorMessage = message;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool BenchmarkState::hasFailed() const
+{
+  return !m_ErrorMessage.isEmpty();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QJsonObject BenchmarkState::toJson() const
+{
+  QJsonObject json;
+  json["Size"] = static_cast<double>(m_Size);
+  json["Repetitions"] = static_cast<int>(m_Samples.size());
+  if(hasFailed())
+  {
+    json["Error"] = m_ErrorMessage;
+    return json;
+  }
+  if(m_Samples.empty())
+  {
+    return json;
+  }
+
+  std::vector<double> sorted = m_Samples;
+  std::sort(sorted.begin(), sorted.end());
+  size_t mid = sorted.size() / 2;
+  double median = (sorted.size() % 2 == 1) ? sorted[mid] : 0.5 * (sorted[mid - 1] + sorted[mid]);
+  double mean = std::accumulate(sorted.begin(), sorted.end(), 0.0) / static_cast<double>(sorted.size());
+
+  json["MinSeconds"] = sorted.front();
+  json["MedianSeconds"] = median;
+  json["MeanSeconds"] = mean;
+  json["MaxSeconds"] = sorted.back();
+  json["ItemsProcessed"] = static_cast<double>(m_ItemsProcessed);
+  json["BytesProcessed"] = static_cast<double>(m_BytesProcessed);
+  if(median > 0.0)
+  {
+    json["ItemsPerSecond"] = static_cast<double>(m_ItemsProcessed) / median;
+    json["BytesPerSecond"] = static_cast<double>(m_BytesProcessed) / median;
+  }
+  return json;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+BenchmarkRegistry::BenchmarkRegistry() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+BenchmarkRegistry::~BenchmarkRegistry() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void BenchmarkRegistry::add(const QString& name, const BenchmarkFunction& func)
+{
+  m_Benchmarks.push_back(std::make_pair(name, func));
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QStringList BenchmarkRegistry::getNames() const
+{
+  QStringList names;
+  for(const auto& benchmark : m_Benchmarks)
+  {
+    names.push_back(benchmark.first);
+  }
+  return names;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+BenchmarkRegistry::BenchmarkFunction BenchmarkRegistry::getBenchmark(const QString& name) const
+{
+  for(const auto& benchmark : m_Benchmarks)
+  {
+    if(benchmark.first == name)
+    {
+      return benchmark.second;
+    }
+  }
+  return BenchmarkFunction();
+}
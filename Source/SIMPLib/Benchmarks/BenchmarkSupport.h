@@ -0,0 +1,159 @@
+/* ============================================================================
+* Copyright (c) 2009-2015 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-07-D-5800
+*    United States Air Force Prime Contract FA8650-10-D-5210
+*    United States Prime Contract Navy N00173-07-C-2068
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+
+#pragma once
+
+#include <functional>
+#include <vector>
+
+#include <QtCore/QJsonObject>
+#include <QtCore/QString>
+#include <QtCore/QStringList>
+
+/**
+ * @brief The BenchmarkState class is handed to every benchmark. A benchmark prepares its input, then
+ * calls nextRepetition() in a loop and wraps only the work it measures in time(). Input that a
+ * repetition consumes (an array that gets erased, a file that gets written) is rebuilt inside the loop
+ * but outside of time().
+ */
+class BenchmarkState
+{
+  public:
+    BenchmarkState(size_t size, int repetitions, int maxNumberOfThreads, const QString& tempDir);
+    virtual ~BenchmarkState();
+
+    /**
+     * @brief Returns the problem size requested on the command line. Each benchmark documents what it scales with it.
+     */
+    size_t getSize() const;
+
+    /**
+     * @brief Returns the thread limit filters should be given, zero means every core
+     */
+    int getMaxNumberOfThreads() const;
+
+    /**
+     * @brief Returns a directory the benchmark may write scratch files to
+     */
+    QString getTempDir() const;
+
+    /**
+     * @brief Returns true while another repetition should be measured
+     */
+    bool nextRepetition();
+
+    /**
+     * @brief Measures one call of func and records it as the sample of the current repetition
+     */
+    void time(const std::function<void()>& func);
+
+    /**
+     * @brief Sets the number of items (tuples, elements, lines) one repetition processes
+     */
+    void setItemsProcessed(size_t items);
+
+    /**
+     * @brief Sets the number of bytes of data one repetition processes
+     */
+    void setBytesProcessed(size_t bytes);
+
+    /**
+     * @brief Marks the benchmark as failed. No further repetitions are run.
+     */
+    void fail(const QString& message);
+
+    bool hasFailed() const;
+
+    /**
+     * @brief Returns the measurements as a JSON object. Throughputs are computed from the median sample.
+     */
+    QJsonObject toJson() const;
+
+  private:
+    size_t m_Size;
+    int m_Repetitions;
+    int m_MaxNumberOfThreads;
+    QString m_TempDir;
+    int m_Repetition = 0;
+    size_t m_ItemsProcessed = 0;
+    size_t m_BytesProcessed = 0;
+    QString m_ErrorMessage;
+    std::vector<double> m_Samples;
+
+  public:
+    BenchmarkState(const BenchmarkState&) = delete; // Copy Constructor Not Implemented
+    BenchmarkState(BenchmarkState&&) = delete;      // Move Constructor Not Implemented
+    BenchmarkState& operator=(const BenchmarkState&) = delete; // Copy Assignment Not Implemented
+    BenchmarkState& operator=(BenchmarkState&&) = delete;      // Move Assignment Not Implemented
+};
+
+/**
+ * @brief The BenchmarkRegistry class holds every benchmark of the SIMPLibBenchmarks executable under a
+ * "Group/Name" name.
+ */
+class BenchmarkRegistry
+{
+  public:
+    using BenchmarkFunction = std::function<void(BenchmarkState&)>;
+
+    BenchmarkRegistry();
+    virtual ~BenchmarkRegistry();
+
+    void add(const QString& name, const BenchmarkFunction& func);
+
+    QStringList getNames() const;
+
+    BenchmarkFunction getBenchmark(const QString& name) const;
+
+  private:
+    std::vector<std::pair<QString, BenchmarkFunction>> m_Benchmarks;
+
+  public:
+    BenchmarkRegistry(const BenchmarkRegistry&) = delete; // Copy Constructor Not Implemented
+    BenchmarkRegistry(BenchmarkRegistry&&) = delete;      // Move Constructor Not Implemented
+    BenchmarkRegistry& operator=(const BenchmarkRegistry&) = delete; // Copy Assignment Not Implemented
+    BenchmarkRegistry& operator=(BenchmarkRegistry&&) = delete;      // Move Assignment Not Implemented
+};
+
+/**
+ * @brief DataArray, NeighborList and GeometryHelpers::Connectivity benchmarks
+ */
+void RegisterDataStructureBenchmarks(BenchmarkRegistry& registry);
+
+/**
+ * @brief ArrayCalculator, MultiThresholdObjects2, ReadASCIIData and DataContainerWriter/Reader benchmarks
+ */
+void RegisterFilterBenchmarks(BenchmarkRegistry& registry);
@@ -0,0 +1,396 @@
+/* ============================================================================
+* Copyright (c) 2009-2015 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-07-D-5800
+*    United States Air Force Prime Contract FA8650-10-D-5210
+*    United States Prime Contract Navy N00173-07-C-2068
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+
+#include <QtCore/QDir>
+#include <QtCore/QFile>
+
+#include "H5Support/QH5Utilities.h"
+
+#include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/DataArrays/NeighborList.hpp"
+#include "SIMPLib/Geometry/TriangleGeom.h"
+
+#include "SIMPLib/Benchmarks/BenchmarkSupport.h"
+
+namespace
+{
+const std::mt19937_64::result_type k_Seed = 5489u;
+
+// -----------------------------------------------------------------------------
+// DataArray: getSize() is the number of tuples
+// -----------------------------------------------------------------------------
+void DataArrayAllocate(BenchmarkState& state)
+{
+  size_t numTuples = state.getSize();
+  state.setItemsProcessed(numTuples);
+  state.setBytesProcessed(numTuples * sizeof(float));
+  while(state.nextRepetition())
+  {
+    FloatArrayType::Pointer array;
+    // Writing the array makes sure the pages are actually mapped
+    state.time([&] {
+      array = FloatArrayType::CreateArray(numTuples, "Data", true);
+      array->initializeWithValue(1.0f);
+    });
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void DataArrayResize(BenchmarkState& state)
+{
+  size_t numTuples = state.getSize();
+  state.setItemsProcessed(numTuples);
+  state.setBytesProcessed(numTuples * sizeof(float));
+  while(state.nextRepetition())
+  {
+    FloatArrayType::Pointer array = FloatArrayType::CreateArray(numTuples / 2, "Data", true);
+    array->initializeWithValue(1.0f);
+    state.time([&] { array->resize(numTuples); });
+    if(array->getNumberOfTuples() != numTuples)
+    {
+      state.fail("The array was not resized");
+    }
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void DataArrayEraseTuples(BenchmarkState& state)
+{
+  size_t numTuples = state.getSize();
+  QVector<size_t> cDims(1, 3);
+  state.setItemsProcessed(numTuples);
+  state.setBytesProcessed(numTuples * 3 * sizeof(float));
+  while(state.nextRepetition())
+  {
+    FloatArrayType::Pointer array = FloatArrayType::CreateArray(numTuples, cDims, "Data", true);
+    array->initializeWithValue(1.0f);
+    // Remove every tenth tuple
+    QVector<size_t> idxs;
+    idxs.reserve(static_cast<int>(numTuples / 10 + 1));
+    for(size_t i = 0; i < numTuples; i += 10)
+    {
+      idxs.push_back(i);
+    }
+    int err = 0;
+    state.time([&] { err = array->eraseTuples(idxs); });
+    if(err < 0)
+    {
+      state.fail(QString("eraseTuples returned %1").arg(err));
+    }
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void DataArrayCopyFromArray(BenchmarkState& state)
+{
+  size_t numTuples = state.getSize();
+  QVector<size_t> cDims(1, 3);
+  state.setItemsProcessed(numTuples);
+  state.setBytesProcessed(numTuples * 3 * sizeof(float));
+
+  FloatArrayType::Pointer source = FloatArrayType::CreateArray(numTuples, cDims, "Source", true);
+  source->initializeWithValue(2.0f);
+  FloatArrayType::Pointer destination = FloatArrayType::CreateArray(numTuples, cDims, "Destination", true);
+  destination->initializeWithZeros();
+  while(state.nextRepetition())
+  {
+    bool ok = false;
+    state.time([&] { ok = destination->copyFromArray(0, source, 0, numTuples); });
+    if(!ok)
+    {
+      state.fail("copyFromArray failed");
+    }
+  }
+}
+
+// -----------------------------------------------------------------------------
+// NeighborList: getSize() is the total number of entries, spread over getSize() / 8 lists of 0 to 15 entries
+// -----------------------------------------------------------------------------
+Int32NeighborListType::Pointer CreateNeighborList(size_t numEntries, size_t& totalEntries)
+{
+  size_t numLists = std::max<size_t>(numEntries / 8, 1);
+  Int32NeighborListType::Pointer neighborList = Int32NeighborListType::CreateArray(numLists, "NeighborList", true);
+  neighborList->setNumNeighborsArrayName("NumNeighbors");
+
+  std::mt19937_64 generator(k_Seed);
+  std::uniform_int_distribution<int32_t> distribution(0, static_cast<int32_t>(numLists - 1));
+  totalEntries = 0;
+  for(size_t i = 0; i < numLists; i++)
+  {
+    Int32NeighborListType::SharedVectorType list(new std::vector<int32_t>(i % 16));
+    for(int32_t& value : *list)
+    {
+      value = distribution(generator);
+    }
+    totalEntries += list->size();
+    neighborList->setList(static_cast<int>(i), list);
+  }
+  return neighborList;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void NeighborListWriteH5(BenchmarkState& state)
+{
+  size_t totalEntries = 0;
+  Int32NeighborListType::Pointer neighborList = CreateNeighborList(state.getSize(), totalEntries);
+  QVector<size_t> tDims(1, neighborList->getNumberOfTuples());
+  QString filePath = QDir(state.getTempDir()).filePath("NeighborListBenchmark.h5");
+  state.setItemsProcessed(totalEntries);
+  state.setBytesProcessed(totalEntries * sizeof(int32_t) + tDims[0] * sizeof(int32_t));
+
+  while(state.nextRepetition())
+  {
+    QFile::remove(filePath);
+    int err = 0;
+    state.time([&] {
+      hid_t fileId = QH5Utilities::createFile(filePath);
+      if(fileId < 0)
+      {
+        err = -1;
+        return;
+      }
+      err = neighborList->writeH5Data(fileId, tDims);
+      QH5Utilities::closeFile(fileId);
+    });
+    if(err < 0)
+    {
+      state.fail(QString("Error %1 writing '%2'").arg(err).arg(filePath));
+    }
+  }
+  QFile::remove(filePath);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void NeighborListReadH5(BenchmarkState& state)
+{
+  size_t totalEntries = 0;
+  QString filePath = QDir(state.getTempDir()).filePath("NeighborListBenchmark.h5");
+  size_t numLists = 0;
+  {
+    Int32NeighborListType::Pointer neighborList = CreateNeighborList(state.getSize(), totalEntries);
+    numLists = neighborList->getNumberOfTuples();
+    hid_t fileId = QH5Utilities::createFile(filePath);
+    int err = (fileId < 0) ? -1 : neighborList->writeH5Data(fileId, QVector<size_t>(1, numLists));
+    if(fileId >= 0)
+    {
+      QH5Utilities::closeFile(fileId);
+    }
+    if(err < 0)
+    {
+      state.fail(QString("Error %1 writing '%2'").arg(err).arg(filePath));
+      return;
+    }
+  }
+  state.setItemsProcessed(totalEntries);
+  state.setBytesProcessed(totalEntries * sizeof(int32_t) + numLists * sizeof(int32_t));
+
+  while(state.nextRepetition())
+  {
+    Int32NeighborListType::Pointer neighborList = Int32NeighborListType::CreateArray(numLists, "NeighborList", false);
+    neighborList->setNumNeighborsArrayName("NumNeighbors");
+    int err = 0;
+    state.time([&] {
+      hid_t fileId = QH5Utilities::openFile(filePath, true);
+      if(fileId < 0)
+      {
+        err = -1;
+        return;
+      }
+      err = neighborList->readH5Data(fileId);
+      QH5Utilities::closeFile(fileId);
+    });
+    if(err < 0 || neighborList->getNumberOfTuples() != numLists)
+    {
+      state.fail(QString("Error %1 reading '%2'").arg(err).arg(filePath));
+    }
+  }
+  QFile::remove(filePath);
+}
+
+// -----------------------------------------------------------------------------
+// Connectivity: getSize() is the approximate number of triangles of a regular planar mesh
+// -----------------------------------------------------------------------------
+TriangleGeom::Pointer CreateTriangleMesh(size_t numTriangles)
+{
+  int64_t n = std::max<int64_t>(static_cast<int64_t>(std::sqrt(static_cast<double>(numTriangles) / 2.0)), 1);
+  int64_t numVerts = (n + 1) * (n + 1);
+  SharedVertexList::Pointer vertices = TriangleGeom::CreateSharedVertexList(numVerts, true);
+  float* vert = vertices->getPointer(0);
+  for(int64_t y = 0; y <= n; y++)
+  {
+    for(int64_t x = 0; x <= n; x++)
+    {
+      int64_t v = y * (n + 1) + x;
+      vert[3 * v] = static_cast<float>(x);
+      vert[3 * v + 1] = static_cast<float>(y);
+      vert[3 * v + 2] = 0.0f;
+    }
+  }
+
+  TriangleGeom::Pointer triangleGeom = TriangleGeom::CreateGeometry(2 * n * n, vertices, "Triangles", true);
+  int64_t* tris = triangleGeom->getTriPointer(0);
+  for(int64_t y = 0; y < n; y++)
+  {
+    for(int64_t x = 0; x < n; x++)
+    {
+      int64_t v0 = y * (n + 1) + x;
+      int64_t v1 = v0 + 1;
+      int64_t v2 = v0 + n + 1;
+      int64_t v3 = v2 + 1;
+      int64_t* tri = tris + 6 * (y * n + x);
+      tri[0] = v0;
+      tri[1] = v1;
+      tri[2] = v3;
+      tri[3] = v0;
+      tri[4] = v3;
+      tri[5] = v2;
+    }
+  }
+  return triangleGeom;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ConnectivityElementsContainingVert(BenchmarkState& state)
+{
+  TriangleGeom::Pointer triangleGeom = CreateTriangleMesh(state.getSize());
+  state.setItemsProcessed(static_cast<size_t>(triangleGeom->getNumberOfTris()));
+  state.setBytesProcessed(static_cast<size_t>(triangleGeom->getNumberOfTris()) * 3 * sizeof(int64_t));
+  while(state.nextRepetition())
+  {
+    triangleGeom->deleteElementsContainingVert();
+    int err = 0;
+    state.time([&] { err = triangleGeom->findElementsContainingVert(); });
+    if(err < 0)
+    {
+      state.fail(QString("findElementsContainingVert returned %1").arg(err));
+    }
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ConnectivityElementNeighbors(BenchmarkState& state)
+{
+  TriangleGeom::Pointer triangleGeom = CreateTriangleMesh(state.getSize());
+  triangleGeom->findElementsContainingVert();
+  state.setItemsProcessed(static_cast<size_t>(triangleGeom->getNumberOfTris()));
+  state.setBytesProcessed(static_cast<size_t>(triangleGeom->getNumberOfTris()) * 3 * sizeof(int64_t));
+  while(state.nextRepetition())
+  {
+    triangleGeom->deleteElementNeighbors();
+    int err = 0;
+    state.time([&] { err = triangleGeom->findElementNeighbors(); });
+    if(err < 0)
+    {
+      state.fail(QString("findElementNeighbors returned %1").arg(err));
+    }
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ConnectivityEdges(BenchmarkState& state)
+{
+  TriangleGeom::Pointer triangleGeom = CreateTriangleMesh(state.getSize());
+  state.setItemsProcessed(static_cast<size_t>(triangleGeom->getNumberOfTris()));
+  state.setBytesProcessed(static_cast<size_t>(triangleGeom->getNumberOfTris()) * 3 * sizeof(int64_t));
+  while(state.nextRepetition())
+  {
+    triangleGeom->deleteEdges();
+    int err = 0;
+    state.time([&] { err = triangleGeom->findEdges(); });
+    if(err < 0)
+    {
+      state.fail(QString("findEdges returned %1").arg(err));
+    }
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ConnectivityUnsharedEdges(BenchmarkState& state)
+{
+  TriangleGeom::Pointer triangleGeom = CreateTriangleMesh(state.getSize());
+  state.setItemsProcessed(static_cast<size_t>(triangleGeom->getNumberOfTris()));
+  state.setBytesProcessed(static_cast<size_t>(triangleGeom->getNumberOfTris()) * 3 * sizeof(int64_t));
+  while(state.nextRepetition())
+  {
+    triangleGeom->deleteUnsharedEdges();
+    int err = 0;
+    state.time([&] { err = triangleGeom->findUnsharedEdges(); });
+    if(err < 0)
+    {
+      state.fail(QString("findUnsharedEdges returned %1").arg(err));
+    }
+  }
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void RegisterDataStructureBenchmarks(BenchmarkRegistry& registry)
+{
+  registry.add("DataArray/Allocate", DataArrayAllocate);
+  registry.add("DataArray/Resize", DataArrayResize);
+  registry.add("DataArray/EraseTuples", DataArrayEraseTuples);
+  registry.add("DataArray/CopyFromArray", DataArrayCopyFromArray);
+  registry.add("NeighborList/WriteH5", NeighborListWriteH5);
+  registry.add("NeighborList/ReadH5", NeighborListReadH5);
+  registry.add("Connectivity/FindElementsContainingVert", ConnectivityElementsContainingVert);
+  registry.add("Connectivity/FindElementNeighbors", ConnectivityElementNeighbors);
+  registry.add("Connectivity/FindEdges", ConnectivityEdges);
+  registry.add("Connectivity/FindUnsharedEdges", ConnectivityUnsharedEdges);
+}
@@ -0,0 +1,346 @@
+/* ============================================================================
+* Copyright (c) 2009-2015 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-07-D-5800
+*    United States Air Force Prime Contract FA8650-10-D-5210
+*    United States Prime Contract Navy N00173-07-C-2068
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+
+#include <random>
+
+#include <QtCore/QDir>
+#include <QtCore/QFile>
+#include <QtCore/QFileInfo>
+#include <QtCore/QTextStream>
+
+#include "SIMPLib/Common/Constants.h"
+#include "SIMPLib/CoreFilters/ArrayCalculator.h"
+#include "SIMPLib/CoreFilters/DataContainerReader.h"
+#include "SIMPLib/CoreFilters/DataContainerWriter.h"
+#include "SIMPLib/CoreFilters/MultiThresholdObjects2.h"
+#include "SIMPLib/CoreFilters/ReadASCIIData.h"
+#include "SIMPLib/CoreFilters/util/ASCIIWizardData.hpp"
+#include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/DataContainers/DataContainerArray.h"
+#include "SIMPLib/Filtering/ComparisonInputsAdvanced.h"
+#include "SIMPLib/Geometry/ImageGeom.h"
+
+#include "SIMPLib/Benchmarks/BenchmarkSupport.h"
+
+namespace
+{
+const std::mt19937_64::result_type k_Seed = 5489u;
+const QString k_DataContainerName("DataContainer");
+const QString k_CellAttributeMatrixName("CellData");
+const QString k_ConfidenceName("Confidence");
+const QString k_PhasesName("Phases");
+const QString k_NormalsName("Normals");
+const QString k_ResultName("Result");
+
+// -----------------------------------------------------------------------------
+// Every benchmark in this file processes a single ImageGeom DataContainer whose
+// cell AttributeMatrix holds getSize() tuples of a float, an int32 and a 3 component
+// float array filled with seeded random values.
+// -----------------------------------------------------------------------------
+DataContainerArray::Pointer CreateDataContainerArray(size_t numTuples)
+{
+  DataContainerArray::Pointer dca = DataContainerArray::New();
+  DataContainer::Pointer dc = DataContainer::New(k_DataContainerName);
+  ImageGeom::Pointer imageGeom = ImageGeom::CreateGeometry(SIMPL::Geometry::ImageGeometry);
+  imageGeom->setDimensions(numTuples, 1, 1);
+  dc->setGeometry(imageGeom);
+
+  QVector<size_t> tDims(1, numTuples);
+  AttributeMatrix::Pointer am = AttributeMatrix::New(tDims, k_CellAttributeMatrixName, AttributeMatrix::Type::Cell);
+  FloatArrayType::Pointer confidence = FloatArrayType::CreateArray(tDims, QVector<size_t>(1, 1), k_ConfidenceName, true);
+  Int32ArrayType::Pointer phases = Int32ArrayType::CreateArray(tDims, QVector<size_t>(1, 1), k_PhasesName, true);
+  FloatArrayType::Pointer normals = FloatArrayType::CreateArray(tDims, QVector<size_t>(1, 3), k_NormalsName, true);
+
+  std::mt19937_64 generator(k_Seed);
+  std::uniform_real_distribution<float> realDistribution(0.0f, 1.0f);
+  std::uniform_int_distribution<int32_t> intDistribution(0, 99);
+  for(size_t i = 0; i < numTuples; i++)
+  {
+    confidence->setValue(i, realDistribution(generator));
+    phases->setValue(i, intDistribution(generator));
+    normals->setComponent(i, 0, realDistribution(generator));
+    normals->setComponent(i, 1, realDistribution(generator));
+    normals->setComponent(i, 2, realDistribution(generator));
+  }
+  am->addAttributeArray(k_ConfidenceName, confidence);
+  am->addAttributeArray(k_PhasesName, phases);
+  am->addAttributeArray(k_NormalsName, normals);
+  dc->addAttributeMatrix(k_CellAttributeMatrixName, am);
+  dca->addDataContainer(dc);
+  return dca;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t GetArrayBytes(const DataContainerArray::Pointer& dca)
+{
+  size_t bytes = 0;
+  AttributeMatrix::Pointer am = dca->getAttributeMatrix(DataArrayPath(k_DataContainerName, k_CellAttributeMatrixName, ""));
+  for(const QString& name : am->getAttributeArrayNames())
+  {
+    IDataArray::Pointer array = am->getAttributeArray(name);
+    bytes += array->getNumberOfBytes();
+  }
+  return bytes;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void RunArrayCalculator(BenchmarkState& state, bool compiled)
+{
+  size_t numTuples = state.getSize();
+  DataContainerArray::Pointer dca = CreateDataContainerArray(numTuples);
+  AttributeMatrix::Pointer am = dca->getAttributeMatrix(DataArrayPath(k_DataContainerName, k_CellAttributeMatrixName, ""));
+  state.setItemsProcessed(numTuples);
+  state.setBytesProcessed(numTuples * (sizeof(float) + sizeof(int32_t) + sizeof(double)));
+
+  ArrayCalculator::Pointer filter = ArrayCalculator::New();
+  filter->setDataContainerArray(dca);
+  filter->setMaxNumberOfThreads(state.getMaxNumberOfThreads());
+  filter->setSelectedAttributeMatrix(DataArrayPath(k_DataContainerName, k_CellAttributeMatrixName, ""));
+  filter->setCalculatedArray(DataArrayPath(k_DataContainerName, k_CellAttributeMatrixName, k_ResultName));
+  filter->setInfixEquation(QString("%1 * 2 + sqrt(%2) - abs(%1 - 0.5)").arg(k_ConfidenceName).arg(k_PhasesName));
+  filter->setUseCompiledEvaluation(compiled);
+  while(state.nextRepetition())
+  {
+    am->removeAttributeArray(k_ResultName);
+    state.time([&] { filter->execute(); });
+    if(filter->getErrorCondition() < 0)
+    {
+      state.fail(QString("ArrayCalculator failed with error %1").arg(filter->getErrorCondition()));
+    }
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ArrayCalculatorCompiled(BenchmarkState& state)
+{
+  RunArrayCalculator(state, true);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ArrayCalculatorInterpreted(BenchmarkState& state)
+{
+  RunArrayCalculator(state, false);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void MultiThreshold(BenchmarkState& state)
+{
+  size_t numTuples = state.getSize();
+  DataContainerArray::Pointer dca = CreateDataContainerArray(numTuples);
+  AttributeMatrix::Pointer am = dca->getAttributeMatrix(DataArrayPath(k_DataContainerName, k_CellAttributeMatrixName, ""));
+  state.setItemsProcessed(numTuples);
+  state.setBytesProcessed(numTuples * (sizeof(float) + sizeof(int32_t) + sizeof(bool)));
+
+  ComparisonInputsAdvanced thresholds;
+  thresholds.setDataContainerName(k_DataContainerName);
+  thresholds.setAttributeMatrixName(k_CellAttributeMatrixName);
+  thresholds.addInput(SIMPL::Union::Operator_And, k_ConfidenceName, SIMPL::Comparison::Operator_GreaterThan, 0.1);
+  thresholds.addInput(SIMPL::Union::Operator_And, k_PhasesName, SIMPL::Comparison::Operator_NotEqual, 0.0);
+  thresholds.addInput(SIMPL::Union::Operator_Or, k_ConfidenceName, SIMPL::Comparison::Operator_GreaterThan, 0.9);
+
+  MultiThresholdObjects2::Pointer filter = MultiThresholdObjects2::New();
+  filter->setDataContainerArray(dca);
+  filter->setMaxNumberOfThreads(state.getMaxNumberOfThreads());
+  filter->setSelectedThresholds(thresholds);
+  filter->setDestinationArrayName(k_ResultName);
+  while(state.nextRepetition())
+  {
+    am->removeAttributeArray(k_ResultName);
+    state.time([&] { filter->execute(); });
+    if(filter->getErrorCondition() < 0)
+    {
+      state.fail(QString("MultiThresholdObjects2 failed with error %1").arg(filter->getErrorCondition()));
+    }
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ReadASCII(BenchmarkState& state)
+{
+  size_t numLines = state.getSize();
+  QString filePath = QDir(state.getTempDir()).filePath("ReadASCIIDataBenchmark.csv");
+  {
+    QFile file(filePath);
+    if(!file.open(QIODevice::WriteOnly | QIODevice::Text))
+    {
+      state.fail(QString("Could not create '%1'").arg(filePath));
+      return;
+    }
+    QTextStream out(&file);
+    std::mt19937_64 generator(k_Seed);
+    std::uniform_real_distribution<double> realDistribution(-1000.0, 1000.0);
+    std::uniform_int_distribution<int32_t> intDistribution(0, 99);
+    for(size_t i = 0; i < numLines; i++)
+    {
+      out << realDistribution(generator) << "," << realDistribution(generator) << "," << intDistribution(generator) << "\n";
+    }
+  }
+  state.setItemsProcessed(numLines);
+  state.setBytesProcessed(static_cast<size_t>(QFileInfo(filePath).size()));
+
+  ASCIIWizardData data;
+  data.inputFilePath = filePath;
+  data.beginIndex = 1;
+  data.numberOfLines = static_cast<int>(numLines);
+  data.dataHeaders << "X"
+                   << "Y"
+                   << "Phase";
+  data.dataTypes << SIMPL::TypeNames::Double << SIMPL::TypeNames::Double << SIMPL::TypeNames::Int32;
+  data.delimiters.push_back(',');
+  data.tupleDims = QVector<size_t>(1, numLines);
+  data.selectedPath = DataArrayPath(k_DataContainerName, k_CellAttributeMatrixName, "");
+  data.automaticAM = false;
+
+  while(state.nextRepetition())
+  {
+    DataContainerArray::Pointer dca = DataContainerArray::New();
+    DataContainer::Pointer dc = DataContainer::New(k_DataContainerName);
+    dc->addAttributeMatrix(k_CellAttributeMatrixName, AttributeMatrix::New(data.tupleDims, k_CellAttributeMatrixName, AttributeMatrix::Type::Cell));
+    dca->addDataContainer(dc);
+
+    ReadASCIIData::Pointer filter = ReadASCIIData::New();
+    filter->setDataContainerArray(dca);
+    filter->setMaxNumberOfThreads(state.getMaxNumberOfThreads());
+    filter->setWizardData(data);
+    state.time([&] { filter->execute(); });
+    if(filter->getErrorCondition() < 0)
+    {
+      state.fail(QString("ReadASCIIData failed with error %1").arg(filter->getErrorCondition()));
+    }
+  }
+  QFile::remove(filePath);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int WriteDataContainers(const DataContainerArray::Pointer& dca, const QString& filePath, int maxNumberOfThreads)
+{
+  DataContainerWriter::Pointer writer = DataContainerWriter::New();
+  writer->setDataContainerArray(dca);
+  writer->setMaxNumberOfThreads(maxNumberOfThreads);
+  writer->setOutputFile(filePath);
+  writer->setWriteXdmfFile(false);
+  writer->execute();
+  return writer->getErrorCondition();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void DataContainerWrite(BenchmarkState& state)
+{
+  DataContainerArray::Pointer dca = CreateDataContainerArray(state.getSize());
+  QString filePath = QDir(state.getTempDir()).filePath("DataContainerBenchmark.dream3d");
+  state.setItemsProcessed(state.getSize());
+  state.setBytesProcessed(GetArrayBytes(dca));
+  while(state.nextRepetition())
+  {
+    QFile::remove(filePath);
+    int err = 0;
+    state.time([&] { err = WriteDataContainers(dca, filePath, state.getMaxNumberOfThreads()); });
+    if(err < 0)
+    {
+      state.fail(QString("DataContainerWriter failed with error %1").arg(err));
+    }
+  }
+  QFile::remove(filePath);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void DataContainerRead(BenchmarkState& state)
+{
+  QString filePath = QDir(state.getTempDir()).filePath("DataContainerBenchmark.dream3d");
+  {
+    DataContainerArray::Pointer dca = CreateDataContainerArray(state.getSize());
+    state.setBytesProcessed(GetArrayBytes(dca));
+    QFile::remove(filePath);
+    int err = WriteDataContainers(dca, filePath, state.getMaxNumberOfThreads());
+    if(err < 0)
+    {
+      state.fail(QString("DataContainerWriter failed with error %1").arg(err));
+      return;
+    }
+  }
+  state.setItemsProcessed(state.getSize());
+
+  while(state.nextRepetition())
+  {
+    DataContainerReader::Pointer reader = DataContainerReader::New();
+    reader->setDataContainerArray(DataContainerArray::New());
+    reader->setMaxNumberOfThreads(state.getMaxNumberOfThreads());
+    reader->setInputFile(filePath);
+    state.time([&] {
+      DataContainerArrayProxy proxy = reader->readDataContainerArrayStructure(filePath);
+      proxy.setFlags(Qt::Checked);
+      reader->setInputFileDataContainerArrayProxy(proxy);
+      reader->execute();
+    });
+    if(reader->getErrorCondition() < 0)
+    {
+      state.fail(QString("DataContainerReader failed with error %1").arg(reader->getErrorCondition()));
+    }
+  }
+  QFile::remove(filePath);
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void RegisterFilterBenchmarks(BenchmarkRegistry& registry)
+{
+  registry.add("ArrayCalculator/Compiled", ArrayCalculatorCompiled);
+  registry.add("ArrayCalculator/Interpreted", ArrayCalculatorInterpreted);
+  registry.add("MultiThresholdObjects2/ThreeComparisons", MultiThreshold);
+  registry.add("ReadASCIIData/ThreeColumnCSV", ReadASCII);
+  registry.add("DataContainerWriter/ImageGeom", DataContainerWrite);
+  registry.add("DataContainerReader/ImageGeom", DataContainerRead);
+}
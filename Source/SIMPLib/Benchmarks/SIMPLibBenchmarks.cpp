@@ -0,0 +1,217 @@
+/* ============================================================================
+* Copyright (c) 2009-2015 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-07-D-5800
+*    United States Air Force Prime Contract FA8650-10-D-5210
+*    United States Prime Contract Navy N00173-07-C-2068
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+
+#include <cstdlib>
+#include <iostream>
+
+#include <QtCore/QCommandLineOption>
+#include <QtCore/QCommandLineParser>
+#include <QtCore/QCoreApplication>
+#include <QtCore/QDateTime>
+#include <QtCore/QDir>
+#include <QtCore/QFile>
+#include <QtCore/QJsonArray>
+#include <QtCore/QJsonDocument>
+#include <QtCore/QRegularExpression>
+
+#include "SIMPLib/Filtering/QMetaObjectUtilities.h"
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/SIMPLibVersion.h"
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+#include <tbb/task_arena.h>
+#endif
+
+#include "SIMPLib/Benchmarks/BenchmarkSupport.h"
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int main(int argc, char* argv[])
+{
+  QCoreApplication app(argc, argv);
+  QCoreApplication::setOrganizationName("BlueQuartz Software");
+  QCoreApplication::setOrganizationDomain("bluequartz.net");
+  QCoreApplication::setApplicationName("SIMPLibBenchmarks");
+  QCoreApplication::setApplicationVersion(SIMPLib::Version::Major() + "." + SIMPLib::Version::Minor() + "." + SIMPLib::Version::Patch());
+
+  QCommandLineParser parser;
+  parser.setApplicationDescription("SIMPLib Benchmarks: Times SIMPLib data structures and filters on synthetic data and reports the results as JSON.");
+  parser.addHelpOption();
+  parser.addVersionOption();
+
+  QCommandLineOption sizeArg(QStringList() << "s"
+                                           << "size",
+                             "Problem size (tuples, list entries, triangles or lines) of every benchmark.", "count", "1000000");
+  parser.addOption(sizeArg);
+  QCommandLineOption repetitionsArg(QStringList() << "r"
+                                                  << "repetitions",
+                                    "Number of timed repetitions of every benchmark.", "count", "5");
+  parser.addOption(repetitionsArg);
+  QCommandLineOption threadsArg(QStringList() << "t"
+                                              << "threads",
+                                "Maximum number of threads the benchmarks may use. Defaults to all available cores.", "count", "0");
+  parser.addOption(threadsArg);
+  QCommandLineOption filterArg(QStringList() << "f"
+                                             << "filter",
+                               "Only run the benchmarks whose name matches this regular expression.", "regex");
+  parser.addOption(filterArg);
+  QCommandLineOption outputArg(QStringList() << "o"
+                                             << "output",
+                               "Write the JSON results to this file instead of the standard output.", "file");
+  parser.addOption(outputArg);
+  QCommandLineOption tempDirArg(QStringList() << "temp-dir", "Directory for the scratch files of the I/O benchmarks.", "directory", QDir::tempPath());
+  parser.addOption(tempDirArg);
+  QCommandLineOption listArg(QStringList() << "l"
+                                           << "list",
+                             "List the names of the benchmarks and exit.");
+  parser.addOption(listArg);
+
+  parser.process(app);
+
+  BenchmarkRegistry registry;
+  RegisterDataStructureBenchmarks(registry);
+  RegisterFilterBenchmarks(registry);
+
+  QStringList names = registry.getNames();
+  if(parser.isSet(filterArg))
+  {
+    QRegularExpression regex(parser.value(filterArg));
+    if(!regex.isValid())
+    {
+      std::cerr << "Invalid --filter expression: " << regex.errorString().toStdString() << std::endl;
+      return EXIT_FAILURE;
+    }
+    names = names.filter(regex);
+  }
+  if(parser.isSet(listArg))
+  {
+    for(const QString& name : names)
+    {
+      std::cout << name.toStdString() << std::endl;
+    }
+    return EXIT_SUCCESS;
+  }
+
+  bool ok = false;
+  qulonglong size = parser.value(sizeArg).toULongLong(&ok);
+  if(!ok || size == 0)
+  {
+    std::cerr << "--size must be a positive integer" << std::endl;
+    return EXIT_FAILURE;
+  }
+  int repetitions = parser.value(repetitionsArg).toInt(&ok);
+  if(!ok || repetitions < 1)
+  {
+    std::cerr << "--repetitions must be a positive integer" << std::endl;
+    return EXIT_FAILURE;
+  }
+  int maxNumberOfThreads = parser.value(threadsArg).toInt(&ok);
+  if(!ok)
+  {
+    std::cerr << "--threads must be an integer" << std::endl;
+    return EXIT_FAILURE;
+  }
+  QString tempDir = parser.value(tempDirArg);
+  if(!QDir().mkpath(tempDir))
+  {
+    std::cerr << "Could not create the directory '" << tempDir.toStdString() << "'" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  QMetaObjectUtilities::RegisterMetaTypes();
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  tbb::task_arena arena(maxNumberOfThreads > 0 ? maxNumberOfThreads : static_cast<int>(tbb::task_arena::automatic), 0);
+#endif
+
+  int numFailed = 0;
+  QJsonArray results;
+  for(const QString& name : names)
+  {
+    std::cerr << "Running " << name.toStdString() << "..." << std::endl;
+    BenchmarkState state(static_cast<size_t>(size), repetitions, maxNumberOfThreads, tempDir);
+    BenchmarkRegistry::BenchmarkFunction benchmark = registry.getBenchmark(name);
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+    arena.execute([&] { benchmark(state); });
+#else
+    benchmark(state);
+#endif
+    if(state.hasFailed())
+    {
+      numFailed++;
+    }
+    QJsonObject json = state.toJson();
+    json["Name"] = name;
+    results.push_back(json);
+  }
+
+  QJsonObject root;
+  root["SIMPLibVersion"] = SIMPLib::Version::Complete();
+  root["Date"] = QDateTime::currentDateTimeUtc().toString(Qt::ISODate);
+  root["Size"] = static_cast<double>(size);
+  root["Repetitions"] = repetitions;
+  root["MaxNumberOfThreads"] = maxNumberOfThreads;
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  root["ParallelAlgorithms"] = true;
+#else
+  root["ParallelAlgorithms"] = false;
+#endif
+  root["Benchmarks"] = results;
+  QByteArray json = QJsonDocument(root).toJson(QJsonDocument::Indented);
+
+  if(parser.isSet(outputArg))
+  {
+    QFile file(parser.value(outputArg));
+    if(!file.open(QIODevice::WriteOnly))
+    {
+      std::cerr << "Could not write the results to '" << file.fileName().toStdString() << "'" << std::endl;
+      return EXIT_FAILURE;
+    }
+    file.write(json);
+  }
+  else
+  {
+    std::cout << json.constData();
+  }
+
+  if(numFailed > 0)
+  {
+    std::cerr << numFailed << " benchmark(s) failed" << std::endl;
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}
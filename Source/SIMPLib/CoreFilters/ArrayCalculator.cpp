@@ -35,10 +35,16 @@
 
 #include "ArrayCalculator.h"
 
+#include <algorithm>
+
 #include <QtCore/QMapIterator>
 #include <QtCore/QRegularExpression>
 #include <QtCore/QVectorIterator>
 
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+#include <tbb/task_arena.h>
+#endif
+
 #include "SIMPLib/Common/Constants.h"
 #include "SIMPLib/Common/TemplateHelpers.h"
 #include "SIMPLib/FilterParameters/AbstractFilterParametersReader.h"
@@ -54,6 +60,8 @@
 #include "util/ATanOperator.h"
 #include "util/AdditionOperator.h"
 #include "util/CalculatorArray.hpp"
+#include "util/CalculatorParallel.hpp"
+#include "util/CalculatorProgram.h"
 #include "util/CeilOperator.h"
 #include "util/CommaSeparator.h"
 #include "util/CosOperator.h"
@@ -140,6 +148,7 @@ ArrayCalculator::ArrayCalculator()
 , m_CalculatedArray("", "", "Output")
 , m_Units(Radians)
 , m_ScalarType(SIMPL::ScalarTypes::Type::Double)
+, m_UseCompiledEvaluation(true)
 {
 
   createSymbolMap();
@@ -279,7 +288,7 @@ void ArrayCalculator::dataCheck()
       ICalculatorArray::Pointer array1 = std::dynamic_pointer_cast<ICalculatorArray>(item1);
       if (item1->isArray())
       {
-        if(!cDims.isEmpty() && resultType == ICalculatorArray::ValueType::Array && cDims != array1->getArray()->getComponentDimensions())
+        if(!cDims.isEmpty() && resultType == ICalculatorArray::ValueType::Array && cDims != array1->getComponentDimensions())
         {
           QString ss = QObject::tr("Attribute Array symbols in the infix expression have mismatching component dimensions");
           setErrorCondition(static_cast<int>(CalculatorItem::ErrorCode::INCONSISTENT_COMP_DIMS));
@@ -288,12 +297,12 @@ void ArrayCalculator::dataCheck()
         }
 
         resultType = ICalculatorArray::ValueType::Array;
-        cDims = array1->getArray()->getComponentDimensions();
+        cDims = array1->getComponentDimensions();
       }
       else if (resultType == ICalculatorArray::ValueType::Unknown)
       {
         resultType = ICalculatorArray::ValueType::Number;
-        cDims = array1->getArray()->getComponentDimensions();
+        cDims = array1->getComponentDimensions();
       }
     }
   }
@@ -394,6 +403,15 @@ void ArrayCalculator::preflight()
   setInPreflight(false);
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool ArrayCalculator::getSupportsConcurrentExecution()
+{
+  // Only creates new data from the selected arrays
+  return true;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -414,6 +432,50 @@ void ArrayCalculator::execute()
   // Convert the parsed infix expression into RPN
   QVector<CalculatorItem::Pointer> rpn = toRPN(parsedInfix);
 
+  IDataArray::Pointer resultTypeArray = IDataArray::NullPointer();
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  // Every parallel loop of the evaluation runs inside this arena, which limits the number of threads
+  // to the value set by the pipeline. A concurrently executing pipeline runs this filter inside its own
+  // arena, which the nested arena never exceeds.
+  int maxThreads = tbb::this_task_arena::max_concurrency();
+  if(getMaxNumberOfThreads() > 0)
+  {
+    maxThreads = std::min(maxThreads, getMaxNumberOfThreads());
+  }
+  tbb::task_arena arena(maxThreads);
+  arena.execute([&] { resultTypeArray = m_UseCompiledEvaluation ? executeCompiled(rpn) : executeInterpreted(rpn); });
+#else
+  if(m_UseCompiledEvaluation)
+  {
+    resultTypeArray = executeCompiled(rpn);
+  }
+  else
+  {
+    resultTypeArray = executeInterpreted(rpn);
+  }
+#endif
+
+  if(getErrorCondition() < 0 || getCancel() || nullptr == resultTypeArray)
+  {
+    return;
+  }
+
+  DataArrayPath createdAMPath(m_CalculatedArray.getDataContainerName(), m_CalculatedArray.getAttributeMatrixName(), "");
+  AttributeMatrix::Pointer createdAM = getDataContainerArray()->getAttributeMatrix(createdAMPath);
+  if(nullptr != createdAM)
+  {
+    resultTypeArray->setName(m_CalculatedArray.getDataArrayName());
+    createdAM->addAttributeArray(resultTypeArray->getName(), resultTypeArray);
+  }
+
+  notifyStatusMessage(getHumanLabel(), "Complete");
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+IDataArray::Pointer ArrayCalculator::executeInterpreted(const QVector<CalculatorItem::Pointer>& rpn)
+{
   // Execute the RPN expression
   int totalItems = rpn.size();
   for(int rpnCount = 0; rpnCount < totalItems; rpnCount++)
@@ -435,13 +497,13 @@ void ArrayCalculator::execute()
       rpnOperator->calculate(this, m_CalculatedArray, m_ExecutionStack);
       if(getErrorCondition() < 0)
       {
-        return;
+        return IDataArray::NullPointer();
       }
     }
 
     if(getCancel())
     {
-      return;
+      return IDataArray::NullPointer();
     }
   }
 
@@ -452,39 +514,78 @@ void ArrayCalculator::execute()
     QString ss = QObject::tr("The chosen infix equation is not a valid equation.");
     setErrorCondition(static_cast<int>(CalculatorItem::ErrorCode::INVALID_EQUATION));
     notifyErrorMessage(getHumanLabel(), ss, getErrorCondition());
-    return;
+    return IDataArray::NullPointer();
   }
   if(!m_ExecutionStack.isEmpty())
   {
     arrayItem = m_ExecutionStack.pop();
   }
 
-  if(arrayItem != ICalculatorArray::NullPointer())
+  if(arrayItem == ICalculatorArray::NullPointer())
   {
-    IDataArray::Pointer resultArray = IDataArray::NullPointer();
-    resultArray = arrayItem->getArray();
+    QString ss = QObject::tr("Unexpected output item from chosen infix expression; the output item must be an array\n"
+                             "Please contact the DREAM.3D developers for more information");
+    setErrorCondition(static_cast<int>(CalculatorItem::ErrorCode::UNEXPECTED_OUTPUT));
+    notifyErrorMessage(getHumanLabel(), ss, getErrorCondition());
+    return IDataArray::NullPointer();
+  }
 
-    IDataArray::Pointer resultTypeArray = IDataArray::NullPointer();
-    resultTypeArray = convertArrayType(resultArray, m_ScalarType);
+  IDataArray::Pointer resultArray = arrayItem->getArray();
+  return convertArrayType(resultArray, m_ScalarType);
+}
 
-    DataArrayPath createdAMPath(m_CalculatedArray.getDataContainerName(), m_CalculatedArray.getAttributeMatrixName(), "");
-    AttributeMatrix::Pointer createdAM = getDataContainerArray()->getAttributeMatrix(createdAMPath);
-    if(nullptr != createdAM)
-    {
-      resultTypeArray->setName(m_CalculatedArray.getDataArrayName());
-      createdAM->addAttributeArray(resultTypeArray->getName(), resultTypeArray);
-    }
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+IDataArray::Pointer ArrayCalculator::executeCompiled(const QVector<CalculatorItem::Pointer>& rpn)
+{
+  notifyStatusMessage(getMessagePrefix(), getHumanLabel(), "Compiling Expression");
+
+  QString errMsg;
+  CalculatorProgram::Pointer program = CalculatorProgram::Compile(rpn, m_Units == Degrees, errMsg);
+  if(nullptr == program)
+  {
+    setErrorCondition(static_cast<int>(CalculatorItem::ErrorCode::INVALID_EQUATION));
+    notifyErrorMessage(getHumanLabel(), errMsg, getErrorCondition());
+    return IDataArray::NullPointer();
   }
-  else
+
+  IDataArray::Pointer resultArray = program->createOutputArray(m_ScalarType, m_CalculatedArray.getDataArrayName());
+  if(nullptr == resultArray)
   {
-    QString ss = QObject::tr("Unexpected output item from chosen infix expression; the output item must be an array\n"
-                             "Please contact the DREAM.3D developers for more information");
-    setErrorCondition(static_cast<int>(CalculatorItem::ErrorCode::UNEXPECTED_OUTPUT));
+    QString ss = QObject::tr("The output array type is not valid.  No DataArray could be created.");
+    setErrorCondition(static_cast<int>(CalculatorItem::ErrorCode::InvalidOutputArrayType));
     notifyErrorMessage(getHumanLabel(), ss, getErrorCondition());
-    return;
+    return IDataArray::NullPointer();
+  }
+
+  // Evaluate in chunks so that progress can be reported and the filter can be canceled. Each chunk is
+  // split into tile aligned blocks that are evaluated concurrently; the program is const and every block
+  // writes a disjoint range of the output array.
+  const size_t blockSize = 16 * CalculatorProgram::k_TileSize;
+  const size_t blocksPerChunk = 64;
+  size_t numValues = program->getNumberOfValues();
+  size_t numBlocks = (numValues + blockSize - 1) / blockSize;
+  size_t numChunks = (numBlocks + blocksPerChunk - 1) / blocksPerChunk;
+  for(size_t chunk = 0; chunk < numChunks; chunk++)
+  {
+    size_t firstBlock = chunk * blocksPerChunk;
+    size_t chunkBlocks = std::min(blocksPerChunk, numBlocks - firstBlock);
+    CalculatorParallel::ForEachRange(chunkBlocks, 1, [&](size_t startBlock, size_t endBlock) {
+      size_t start = (firstBlock + startBlock) * blockSize;
+      size_t end = std::min((firstBlock + endBlock) * blockSize, numValues);
+      program->evaluate(resultArray, start, end);
+    });
+
+    if(getCancel())
+    {
+      return IDataArray::NullPointer();
+    }
+
+    notifyStatusMessage(getMessagePrefix(), getHumanLabel(), "Computing Values " + QString::number(chunk + 1) + "/" + QString::number(numChunks));
   }
 
-  notifyStatusMessage(getHumanLabel(), "Complete");
+  return resultArray;
 }
 
 // -----------------------------------------------------------------------------
@@ -497,17 +598,19 @@ template<typename T> IDataArray::Pointer convertArray(DoubleArrayType::Pointer i
     return nullptr;
   }
 
-  double* rawInputarray = inputArray->getPointer(0);
+  const double* rawInputarray = inputArray->getConstPointer(0);
 
   typename DataArray<T>::Pointer convertedArrayPtr = DataArray<T>::CreateArray(inputArray->getNumberOfTuples(), inputArray->getComponentDimensions(), inputArray->getName());
   T* rawOutputArray = convertedArrayPtr->getPointer(0);
 
-  int count = inputArray->getSize();
-  for(int i = 0; i < count; i++)
-  {
-    double val = rawInputarray[i];
-    rawOutputArray[i] = val;
-  }
+  size_t count = inputArray->getSize();
+  CalculatorParallel::ForEachRange(count, [rawInputarray, rawOutputArray](size_t start, size_t end) {
+    for(size_t i = start; i < end; i++)
+    {
+      double val = rawInputarray[i];
+      rawOutputArray[i] = val;
+    }
+  });
 
   return convertedArrayPtr;
 }
@@ -853,21 +956,25 @@ bool ArrayCalculator::parseIndexOperator(QString token, QVector<CalculatorItem::
   }
 
   ICalculatorArray::Pointer calcArray = std::dynamic_pointer_cast<ICalculatorArray>(parsedInfix.back());
-  if(nullptr != calcArray && index >= calcArray->getArray()->getNumberOfComponents())
+  if(nullptr != calcArray && index >= calcArray->getSourceArray()->getNumberOfComponents())
   {
-    QString ss = QObject::tr("'%1' has an component index that is out of range").arg(calcArray->getArray()->getName());
+    QString ss = QObject::tr("'%1' has an component index that is out of range").arg(calcArray->getSourceArray()->getName());
     setErrorCondition(static_cast<int>(CalculatorItem::ErrorCode::COMPONENT_OUT_OF_RANGE));
     notifyErrorMessage(getHumanLabel(), ss, getErrorCondition());
     return false;
   }
 
-  parsedInfix.pop_back();
-
-  DoubleArrayType::Pointer reducedArray = calcArray->reduceToOneComponent(index, !getInPreflight());
-  CalculatorItem::Pointer itemPtr;
+  // Select the component as a view of the source array so that no reduced copy is made until it is needed
+  ICalculatorArray::Pointer componentArray = calcArray->selectComponent(index, !getInPreflight());
+  if(nullptr == componentArray)
+  {
+    setErrorCondition(errCode);
+    notifyErrorMessage(getHumanLabel(), errorMsg, getErrorCondition());
+    return false;
+  }
 
-  CREATE_CALCULATOR_ARRAY(itemPtr, reducedArray)
-  parsedInfix.push_back(itemPtr);
+  parsedInfix.pop_back();
+  parsedInfix.push_back(componentArray);
 
   QString ss = QObject::tr("Item '%1' in the infix expression is the name of an array in the selected Attribute Matrix, but it is currently being used as an indexing operator").arg(token);
   checkForAmbiguousArrayName(token, ss);
@@ -1073,6 +1180,7 @@ AbstractFilter::Pointer ArrayCalculator::newFilterInstance(bool copyFilterParame
     copyFilterParameterInstanceVariables(filter.get());
   }
   filter->setUnits(getUnits());
+  filter->setUseCompiledEvaluation(getUseCompiledEvaluation());
   return filter;
 }
 
@@ -86,6 +86,14 @@ class SIMPLib_EXPORT ArrayCalculator : public AbstractFilter
     SIMPL_FILTER_PARAMETER(SIMPL::ScalarTypes::Type, ScalarType)
     Q_PROPERTY(SIMPL::ScalarTypes::Type ScalarType READ getScalarType WRITE setScalarType)
 
+    /**
+     * @brief UseCompiledEvaluation When true (the default) the expression is compiled into a
+     * CalculatorProgram and evaluated in a single fused pass.  When false the reference
+     * interpreter that runs one operator at a time over full size arrays is used.
+     */
+    SIMPL_INSTANCE_PROPERTY(bool, UseCompiledEvaluation)
+    Q_PROPERTY(bool UseCompiledEvaluation READ getUseCompiledEvaluation WRITE setUseCompiledEvaluation)
+
     ~ArrayCalculator() override;
 
     /**
@@ -165,6 +173,11 @@ class SIMPLib_EXPORT ArrayCalculator : public AbstractFilter
     */
     void preflight() override;
 
+    /**
+     * @brief getSupportsConcurrentExecution Reimplemented from @see AbstractFilter class
+     */
+    bool getSupportsConcurrentExecution() override;
+
   signals:
     /**
      * @brief updateFilterParameters Emitted when the Filter requests all the latest Filter parameters
@@ -208,6 +221,20 @@ class SIMPLib_EXPORT ArrayCalculator : public AbstractFilter
      */
     IDataArray::Pointer convertArrayType(IDataArray::Pointer inputArray, SIMPL::ScalarTypes::Type scalarType);
 
+    /**
+     * @brief Evaluates the RPN expression with the reference interpreter and returns the result
+     * @param rpn
+     * @return
+     */
+    IDataArray::Pointer executeInterpreted(const QVector<CalculatorItem::Pointer>& rpn);
+
+    /**
+     * @brief Compiles the RPN expression into a CalculatorProgram, evaluates it and returns the result
+     * @param rpn
+     * @return
+     */
+    IDataArray::Pointer executeCompiled(const QVector<CalculatorItem::Pointer>& rpn);
+
 
   private:
     QMap<QString, CalculatorItem::Pointer>                      m_SymbolMap;
@@ -71,12 +71,12 @@ public:
   {
     typename DataArrayType::Pointer outputDataPtr = std::dynamic_pointer_cast<DataArrayType>(outputIDataArray);
 
-    std::vector<DataType*> inputArrays;
+    std::vector<const DataType*> inputArrays;
     int32_t numArrays = inputIDataArrays.size();
 
     for(int32_t i = 0; i < numArrays; i++)
     {
-      DataType* inputData = (std::dynamic_pointer_cast<DataArrayType>(inputIDataArrays.at(i).lock()))->getPointer(0);
+      const DataType* inputData = (std::dynamic_pointer_cast<DataArrayType>(inputIDataArrays.at(i).lock()))->getConstPointer(0);
       inputArrays.push_back(inputData);
     }
     DataType* outputData = static_cast<DataType*>(outputDataPtr->getPointer(0));
@@ -285,7 +285,7 @@ template <typename T> void copyData(IDataArray::Pointer fromData, IDataArray::Po
   typename DataArray<T>::Pointer tData = std::dynamic_pointer_cast<DataArray<T>>(toData);
 
   // only wanting to grab data from tuple 1 to numTuples of the fromData array,since the zeroth slot is a placeholder the first AM should already have
-  T* src = fData->getPointer(1 * fromData->getNumberOfComponents());
+  const T* src = fData->getConstPointer(1 * fromData->getNumberOfComponents());
   T* dest = tData->getPointer(location * toData->getNumberOfComponents());
   size_t bytes = sizeof(T) * (fromData->getNumberOfTuples() - 1) * fromData->getNumberOfComponents();
   ::memcpy(dest, src, bytes);
@@ -67,6 +67,7 @@ void ConditionalSetValue::setupFilterParameters()
   parameters.push_back(SIMPL_NEW_DOUBLE_FP("New Value", ReplaceValue, FilterParameter::Parameter, ConditionalSetValue));
   {
     DataArraySelectionFilterParameter::RequirementType req = DataArraySelectionFilterParameter::CreateCategoryRequirement(SIMPL::TypeNames::Bool, 1, AttributeMatrix::Category::Any);
+    req.daTypes.push_back(SIMPL::TypeNames::BitArray);
     parameters.push_back(SIMPL_NEW_DA_SELECTION_FP("Conditional Array", ConditionalArrayPath, FilterParameter::RequiredArray, ConditionalSetValue, req));
   }
   {
@@ -123,16 +124,27 @@ template <typename T> void checkValuesFloatDouble(AbstractFilter* filter, double
 //
 // -----------------------------------------------------------------------------
 
-template <typename T> void replaceValue(AbstractFilter* filter, IDataArray::Pointer inDataPtr, BoolArrayType::Pointer condDataPtr, double replaceValue)
+template <typename T>
+void replaceValue(AbstractFilter* filter, IDataArray::Pointer inDataPtr, BoolArrayType::Pointer condDataPtr, BitArray::Pointer condBitsPtr, double replaceValue)
 {
   typename DataArray<T>::Pointer inputArrayPtr = std::dynamic_pointer_cast<DataArray<T>>(inDataPtr);
 
   T replaceVal = static_cast<T>(replaceValue);
 
   T* inData = inputArrayPtr->getPointer(0);
-  bool* condData = condDataPtr->getPointer(0);
   size_t numTuples = inputArrayPtr->getNumberOfTuples();
 
+  if(nullptr != condBitsPtr.get())
+  {
+    // Jump straight between the set bits instead of testing every tuple
+    for(size_t iter = condBitsPtr->findFirstTrue(); iter < numTuples; iter = condBitsPtr->findNextTrue(iter + 1))
+    {
+      inData[iter] = replaceVal;
+    }
+    return;
+  }
+
+  const bool* condData = condDataPtr->getConstPointer(0);
   for(size_t iter = 0; iter < numTuples; iter++)
   {
     if(condData[iter])
@@ -179,13 +191,23 @@ void ConditionalSetValue::dataCheck()
     return;
   }
 
-  QVector<size_t> cDims(1, 1);
-  m_ConditionalArrayPtr = getDataContainerArray()->getPrereqArrayFromPath<DataArray<bool>, AbstractFilter>(this, getConditionalArrayPath(),
-                                                                                                           cDims); /* Assigns the shared_ptr<> to an instance variable that is a weak_ptr<> */
-  if(nullptr != m_ConditionalArrayPtr.lock())                                                                      /* Validate the Weak Pointer wraps a non-nullptr pointer to a DataArray<T> object */
+  // The conditional array may either be a bool array or a bit packed mask
+  IDataArray::Pointer conditionalArrayPtr = getDataContainerArray()->getPrereqIDataArrayFromPath<IDataArray, AbstractFilter>(this, getConditionalArrayPath());
+  if(getErrorCondition() < 0)
+  {
+    return;
+  }
+  m_ConditionalBitArrayPtr = std::dynamic_pointer_cast<BitArray>(conditionalArrayPtr);
+  if(nullptr == m_ConditionalBitArrayPtr.lock())
   {
-    m_ConditionalArray = m_ConditionalArrayPtr.lock()->getPointer(0);
-  } /* Now assign the raw pointer to data from the DataArray<T> object */
+    QVector<size_t> cDims(1, 1);
+    m_ConditionalArrayPtr = getDataContainerArray()->getPrereqArrayFromPath<DataArray<bool>, AbstractFilter>(this, getConditionalArrayPath(),
+                                                                                                             cDims); /* Assigns the shared_ptr<> to an instance variable that is a weak_ptr<> */
+    if(nullptr != m_ConditionalArrayPtr.lock())                                                                      /* Validate the Weak Pointer wraps a non-nullptr pointer to a DataArray<T> object */
+    {
+      m_ConditionalArray = m_ConditionalArrayPtr.lock()->getPointer(0);
+    } /* Now assign the raw pointer to data from the DataArray<T> object */
+  }
   if(getErrorCondition() >= 0)
   {
     dataArrayPaths.push_back(getConditionalArrayPath());
@@ -275,7 +297,7 @@ void ConditionalSetValue::execute()
     return;
   }
 
-  EXECUTE_FUNCTION_TEMPLATE(this, replaceValue, m_ArrayPtr.lock(), this, m_ArrayPtr.lock(), m_ConditionalArrayPtr.lock(), m_ReplaceValue)
+  EXECUTE_FUNCTION_TEMPLATE(this, replaceValue, m_ArrayPtr.lock(), this, m_ArrayPtr.lock(), m_ConditionalArrayPtr.lock(), m_ConditionalBitArrayPtr.lock(), m_ReplaceValue)
 
   /* Let the GUI know we are done with this filter */
   notifyStatusMessage(getHumanLabel(), "Complete");
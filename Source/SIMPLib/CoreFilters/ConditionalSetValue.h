@@ -37,6 +37,7 @@
 #pragma once
 
 #include "SIMPLib/Common/SIMPLibSetGetMacros.h"
+#include "SIMPLib/DataArrays/BitArray.h"
 #include "SIMPLib/Filtering/AbstractFilter.h"
 #include "SIMPLib/SIMPLib.h"
 
@@ -172,6 +173,7 @@ class SIMPLib_EXPORT ConditionalSetValue : public AbstractFilter
   private:
     IDataArray::WeakPointer m_ArrayPtr;
     DEFINE_DATAARRAY_VARIABLE(bool, ConditionalArray)
+    BitArray::WeakPointer m_ConditionalBitArrayPtr;
 
   public:
     ConditionalSetValue(const ConditionalSetValue&) = delete; // Copy Constructor Not Implemented
@@ -331,6 +331,15 @@ void ConvertData::preflight()
   setInPreflight(false);
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool ConvertData::getSupportsConcurrentExecution()
+{
+  // Only creates new data from the selected arrays
+  return true;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -132,6 +132,11 @@ class SIMPLib_EXPORT ConvertData : public AbstractFilter
     */
     void preflight() override;
 
+    /**
+     * @brief getSupportsConcurrentExecution Reimplemented from @see AbstractFilter class
+     */
+    bool getSupportsConcurrentExecution() override;
+
   signals:
     /**
      * @brief updateFilterParameters Emitted when the Filter requests all the latest Filter parameters
@@ -35,6 +35,10 @@
 
 #include "CopyFeatureArrayToElementArray.h"
 
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+
 #include "SIMPLib/Common/Constants.h"
 #include "SIMPLib/Common/TemplateHelpers.h"
 #include "SIMPLib/FilterParameters/AbstractFilterParametersReader.h"
@@ -43,6 +47,8 @@
 #include "SIMPLib/FilterParameters/StringFilterParameter.h"
 #include "SIMPLib/SIMPLibVersion.h"
 
+#include "SIMPLib/CoreFilters/util/CalculatorParallel.hpp"
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -156,7 +162,16 @@ void CopyFeatureArrayToElementArray::preflight()
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-template <typename T> IDataArray::Pointer copyData(IDataArray::Pointer inputData, size_t totalPoints, int32_t* featureIds)
+bool CopyFeatureArrayToElementArray::getSupportsConcurrentExecution()
+{
+  // Only creates new data from the selected arrays
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+template <typename T> IDataArray::Pointer copyData(IDataArray::Pointer inputData, size_t totalPoints, int32_t* featureIds, int32_t& largestFeature)
 {
   QString cellArrayName = inputData->getName();
 
@@ -169,24 +184,42 @@ template <typename T> IDataArray::Pointer copyData(IDataArray::Pointer inputData
   QVector<size_t> cDims = inputData->getComponentDimensions();
   typename DataArray<T>::Pointer cell = DataArray<T>::CreateArray(totalPoints, cDims, cellArrayName);
 
-  T* fPtr = feature->getPointer(0);
+  const T* fPtr = feature->getConstPointer(0);
   T* cPtr = cell->getPointer(0);
 
-  int32_t numComp = feature->getNumberOfComponents();
-  int32_t featureIdx = 0;
+  size_t numComp = feature->getNumberOfComponents();
+  size_t numFeatures = feature->getNumberOfTuples();
 
-  for(size_t i = 0; i < totalPoints; ++i)
-  {
-    // Get the feature id (or what ever the user has selected as their "Feature" identifier
-    featureIdx = featureIds[i];
-    // Now get the pointer to the start of the tuple for the Feature Array at the given Feature Id Index value
-    T* fSourcePtr = fPtr + (numComp * featureIdx);
-    // Now get the pointer to the start of the tuple for the Cell Array at the proper index
-    T* cDestPtr = cPtr + (numComp * i);
-
-    // Now just raw copy the bytes from the source to the destination
-    ::memcpy(cDestPtr, fSourcePtr, sizeof(T) * numComp);
-  }
+  // The largest Feature Id is found while copying. Each range keeps its own maximum and the maxima are merged at the end.
+  std::atomic<int32_t> maxFeatureId(0);
+  CalculatorParallel::ForEachRange(totalPoints, [&maxFeatureId, fPtr, cPtr, featureIds, numComp, numFeatures](size_t start, size_t end) {
+    int32_t rangeMax = 0;
+    for(size_t i = start; i < end; ++i)
+    {
+      // Get the feature id (or what ever the user has selected as their "Feature" identifier
+      int32_t featureIdx = featureIds[i];
+      rangeMax = std::max(rangeMax, featureIdx);
+      // Now get the pointer to the start of the tuple for the Cell Array at the proper index
+      T* cDestPtr = cPtr + (numComp * i);
+      if(featureIdx < 0 || static_cast<size_t>(featureIdx) >= numFeatures)
+      {
+        // Out of range ids are reported by the caller through the largest Feature Id
+        std::fill(cDestPtr, cDestPtr + numComp, static_cast<T>(0));
+        continue;
+      }
+      // Now get the pointer to the start of the tuple for the Feature Array at the given Feature Id Index value
+      const T* fSourcePtr = fPtr + (numComp * featureIdx);
+
+      // Now just raw copy the bytes from the source to the destination
+      ::memcpy(cDestPtr, fSourcePtr, sizeof(T) * numComp);
+    }
+
+    int32_t currentMax = maxFeatureId.load(std::memory_order_relaxed);
+    while(rangeMax > currentMax && !maxFeatureId.compare_exchange_weak(currentMax, rangeMax, std::memory_order_relaxed))
+    {
+    }
+  });
+  largestFeature = maxFeatureId.load();
   return cell;
 }
 
@@ -203,94 +236,82 @@ void CopyFeatureArrayToElementArray::execute()
     return;
   }
 
-  // Validate that the selected InArray has tuples equal to the largest
-  // Feature Id; the filter would not crash otherwise, but the user should
-  // be notified of unanticipated behavior ; this cannot be done in the dataCheck since
-  // we don't have acces to the data yet
-  int32_t numFeatures = static_cast<int32_t>(m_InArrayPtr.lock()->getNumberOfTuples());
-  bool mismatchedFeatures = false;
-  int32_t largestFeature = 0;
   size_t totalPoints = m_FeatureIdsPtr.lock()->getNumberOfTuples();
-  for(size_t i = 0; i < totalPoints; i++)
-  {
-    if(m_FeatureIds[i] > largestFeature)
-    {
-      largestFeature = m_FeatureIds[i];
-      if(largestFeature >= numFeatures)
-      {
-        mismatchedFeatures = true;
-        break;
-      }
-    }
-  }
-
-  if(mismatchedFeatures)
-  {
-    QString ss = QObject::tr("The largest Feature Id (%1) in the FeatureIds array is larger than the number of Features in the InArray array (%2)").arg(largestFeature).arg(numFeatures);
-    setErrorCondition(-5555);
-    notifyErrorMessage(getHumanLabel(), ss, getErrorCondition());
-    return;
-  }
-
-  if(largestFeature != (numFeatures - 1))
-  {
-    QString ss = QObject::tr("The number of Features in the InArray array (%1) does not match the largest Feature Id in the FeatureIds array").arg(numFeatures);
-    setErrorCondition(-5555);
-    notifyErrorMessage(getHumanLabel(), ss, getErrorCondition());
-    return;
-  }
+  int32_t largestFeature = 0;
 
   IDataArray::Pointer p = IDataArray::NullPointer();
 
   if(TemplateHelpers::CanDynamicCast<Int8ArrayType>()(m_InArrayPtr.lock()))
   {
-    p = copyData<int8_t>(m_InArrayPtr.lock(), totalPoints, m_FeatureIds);
+    p = copyData<int8_t>(m_InArrayPtr.lock(), totalPoints, m_FeatureIds, largestFeature);
   }
   else if(TemplateHelpers::CanDynamicCast<UInt8ArrayType>()(m_InArrayPtr.lock()))
   {
-    p = copyData<uint8_t>(m_InArrayPtr.lock(), totalPoints, m_FeatureIds);
+    p = copyData<uint8_t>(m_InArrayPtr.lock(), totalPoints, m_FeatureIds, largestFeature);
   }
   else if(TemplateHelpers::CanDynamicCast<Int16ArrayType>()(m_InArrayPtr.lock()))
   {
-    p = copyData<int16_t>(m_InArrayPtr.lock(), totalPoints, m_FeatureIds);
+    p = copyData<int16_t>(m_InArrayPtr.lock(), totalPoints, m_FeatureIds, largestFeature);
   }
   else if(TemplateHelpers::CanDynamicCast<UInt16ArrayType>()(m_InArrayPtr.lock()))
   {
-    p = copyData<uint16_t>(m_InArrayPtr.lock(), totalPoints, m_FeatureIds);
+    p = copyData<uint16_t>(m_InArrayPtr.lock(), totalPoints, m_FeatureIds, largestFeature);
   }
   else if(TemplateHelpers::CanDynamicCast<Int32ArrayType>()(m_InArrayPtr.lock()))
   {
-    p = copyData<int32_t>(m_InArrayPtr.lock(), totalPoints, m_FeatureIds);
+    p = copyData<int32_t>(m_InArrayPtr.lock(), totalPoints, m_FeatureIds, largestFeature);
   }
   else if(TemplateHelpers::CanDynamicCast<UInt32ArrayType>()(m_InArrayPtr.lock()))
   {
-    p = copyData<uint32_t>(m_InArrayPtr.lock(), totalPoints, m_FeatureIds);
+    p = copyData<uint32_t>(m_InArrayPtr.lock(), totalPoints, m_FeatureIds, largestFeature);
   }
   else if(TemplateHelpers::CanDynamicCast<Int64ArrayType>()(m_InArrayPtr.lock()))
   {
-    p = copyData<int64_t>(m_InArrayPtr.lock(), totalPoints, m_FeatureIds);
+    p = copyData<int64_t>(m_InArrayPtr.lock(), totalPoints, m_FeatureIds, largestFeature);
   }
   else if(TemplateHelpers::CanDynamicCast<UInt64ArrayType>()(m_InArrayPtr.lock()))
   {
-    p = copyData<uint64_t>(m_InArrayPtr.lock(), totalPoints, m_FeatureIds);
+    p = copyData<uint64_t>(m_InArrayPtr.lock(), totalPoints, m_FeatureIds, largestFeature);
   }
   else if(TemplateHelpers::CanDynamicCast<FloatArrayType>()(m_InArrayPtr.lock()))
   {
-    p = copyData<float>(m_InArrayPtr.lock(), totalPoints, m_FeatureIds);
+    p = copyData<float>(m_InArrayPtr.lock(), totalPoints, m_FeatureIds, largestFeature);
   }
   else if(TemplateHelpers::CanDynamicCast<DoubleArrayType>()(m_InArrayPtr.lock()))
   {
-    p = copyData<double>(m_InArrayPtr.lock(), totalPoints, m_FeatureIds);
+    p = copyData<double>(m_InArrayPtr.lock(), totalPoints, m_FeatureIds, largestFeature);
   }
   else if(TemplateHelpers::CanDynamicCast<BoolArrayType>()(m_InArrayPtr.lock()))
   {
-    p = copyData<bool>(m_InArrayPtr.lock(), totalPoints, m_FeatureIds);
+    p = copyData<bool>(m_InArrayPtr.lock(), totalPoints, m_FeatureIds, largestFeature);
   }
   else
   {
     QString ss = QObject::tr("The selected array was of unsupported type. The path is %1").arg(m_SelectedFeatureArrayPath.serialize());
     setErrorCondition(-14000);
     notifyErrorMessage(getHumanLabel(), ss, getErrorCondition());
+    return;
+  }
+
+  // Validate that the selected InArray has tuples equal to the largest
+  // Feature Id; the filter would not crash otherwise, but the user should
+  // be notified of unanticipated behavior ; this cannot be done in the dataCheck since
+  // we don't have acces to the data yet. The largest Feature Id is found while copying.
+  int32_t numFeatures = static_cast<int32_t>(m_InArrayPtr.lock()->getNumberOfTuples());
+  if(largestFeature >= numFeatures)
+  {
+    QString ss = QObject::tr("The largest Feature Id (%1) in the FeatureIds array is larger than the number of Features in the InArray array (%2)").arg(largestFeature).arg(numFeatures);
+    setErrorCondition(-5555);
+    notifyErrorMessage(getHumanLabel(), ss, getErrorCondition());
+    return;
+  }
+
+  if(largestFeature != (numFeatures - 1))
+  {
+    QString ss = QObject::tr("The number of Features in the InArray array (%1) does not match the largest Feature Id in the FeatureIds array").arg(numFeatures);
+    setErrorCondition(-5555);
+    notifyErrorMessage(getHumanLabel(), ss, getErrorCondition());
+    return;
   }
 
   if(p.get() != nullptr)
@@ -422,6 +422,15 @@ void CreateDataArray::preflight()
   setInPreflight(false);
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool CreateDataArray::getSupportsConcurrentExecution()
+{
+  // Only creates a new array
+  return true;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
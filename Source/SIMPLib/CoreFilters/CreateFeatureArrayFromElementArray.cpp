@@ -35,6 +35,12 @@
 
 #include "CreateFeatureArrayFromElementArray.h"
 
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <limits>
+#include <memory>
+
 #include "SIMPLib/Common/Constants.h"
 #include "SIMPLib/Common/TemplateHelpers.h"
 #include "SIMPLib/FilterParameters/AbstractFilterParametersReader.h"
@@ -44,6 +50,8 @@
 #include "SIMPLib/FilterParameters/StringFilterParameter.h"
 #include "SIMPLib/SIMPLibVersion.h"
 
+#include "SIMPLib/CoreFilters/util/CalculatorParallel.hpp"
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -154,6 +162,15 @@ void CreateFeatureArrayFromElementArray::preflight()
   setInPreflight(false);
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool CreateFeatureArrayFromElementArray::getSupportsConcurrentExecution()
+{
+  // Only creates new data from the selected arrays
+  return true;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -171,50 +188,93 @@ template <typename T> IDataArray::Pointer copyCellData(AbstractFilter* filter, I
   typename DataArray<T>::Pointer feature = DataArray<T>::CreateArray(features, dims, createdArrayName);
 
   T* fPtr = feature->getPointer(0);
-  T* cPtr = cell->getPointer(0);
-
-  int32_t numComp = cell->getNumberOfComponents();
-  int32_t featureIdx = 0;
+  const T* cPtr = cell->getConstPointer(0);
 
+  size_t numComp = cell->getNumberOfComponents();
+  size_t numFeatures = static_cast<size_t>(features);
   size_t cells = inputData->getNumberOfTuples();
 
-  QMap<int32_t, T*> featureMap;
-  bool warningThrown = false;
+  // Feature ids are dense, so the first (or last) cell of every feature is tracked in a flat array indexed by the
+  // feature id. Threads race to update an entry, so it is only replaced through a compare and swap.
+  const size_t k_NotFound = std::numeric_limits<size_t>::max();
+  std::unique_ptr<std::atomic<size_t>[]> sourceCell(new std::atomic<size_t>[numFeatures]);
+  auto findSourceCells = [&sourceCell, featureIds, numFeatures, cells, k_NotFound](bool keepLast) {
+    CalculatorParallel::ForEachRange(numFeatures, [&sourceCell, k_NotFound](size_t start, size_t end) {
+      for(size_t i = start; i < end; i++)
+      {
+        sourceCell[i].store(k_NotFound, std::memory_order_relaxed);
+      }
+    });
+    CalculatorParallel::ForEachRange(cells, [&sourceCell, featureIds, numFeatures, k_NotFound, keepLast](size_t start, size_t end) {
+      for(size_t i = start; i < end; i++)
+      {
+        size_t featureIdx = static_cast<size_t>(featureIds[i]);
+        if(featureIds[i] < 0 || featureIdx >= numFeatures)
+        {
+          continue;
+        }
+        std::atomic<size_t>& current = sourceCell[featureIdx];
+        size_t currentCell = current.load(std::memory_order_relaxed);
+        while((currentCell == k_NotFound || (keepLast ? i > currentCell : i < currentCell)) && !current.compare_exchange_weak(currentCell, i, std::memory_order_relaxed))
+        {
+        }
+      }
+    });
+  };
+  findSourceCells(false);
+
+  // Check that every cell holds the same values as the first cell of its feature. Each range stops at its first
+  // mismatch and the earliest mismatching cell over all ranges is kept.
+  std::atomic<size_t> firstMismatch(k_NotFound);
+  CalculatorParallel::ForEachRange(cells, [&sourceCell, &firstMismatch, cPtr, featureIds, numFeatures, numComp](size_t start, size_t end) {
+    for(size_t i = start; i < end; i++)
+    {
+      size_t featureIdx = static_cast<size_t>(featureIds[i]);
+      if(featureIds[i] < 0 || featureIdx >= numFeatures)
+      {
+        continue;
+      }
+      const T* cSourcePtr = cPtr + (numComp * i);
+      const T* firstDataPtr = cPtr + (numComp * sourceCell[featureIdx].load(std::memory_order_relaxed));
+      if(!std::equal(cSourcePtr, cSourcePtr + numComp, firstDataPtr))
+      {
+        size_t mismatch = firstMismatch.load(std::memory_order_relaxed);
+        while(i < mismatch && !firstMismatch.compare_exchange_weak(mismatch, i, std::memory_order_relaxed))
+        {
+        }
+        break;
+      }
+    }
+  });
 
-  for(size_t i = 0; i < cells; ++i)
+  size_t mismatch = firstMismatch.load();
+  if(mismatch != k_NotFound)
   {
-    // Get the feature id (or what ever the user has selected as their "Feature" identifier
-    featureIdx = featureIds[i];
-
-    // Now get the pointer to the start of the tuple for the Cell Array at the given Feature Id Index value
-    T* cSourcePtr = cPtr + (numComp * i);
+    // The values are inconsistent with the first values for this feature id, so throw a warning
+    filter->setWarningCondition(-1000);
+    QString ss = QObject::tr("Elements from Feature %1 do not all have the same value. The last value copied into Feature %1 will be used").arg(featureIds[mismatch]);
+    filter->notifyWarningMessage(filter->getHumanLabel(), ss, filter->getWarningCondition());
 
-    // Store the first value(s) with this feature id in the map
-    if(featureMap.contains(featureIdx) == false)
-    {
-      featureMap.insert(featureIdx, cSourcePtr);
-    }
+    // The last cell of each feature wins, as if the cells had been copied in order
+    findSourceCells(true);
+  }
 
-    // Check that the values that are currently being pointed to by the source pointer match the first values
-    T* currentDataPtr = featureMap.value(featureIdx);
-    for(int j = 0; j < numComp; j++)
+  // Gather the values of every feature from its source cell. Features without any cells are set to zero.
+  CalculatorParallel::ForEachRange(numFeatures, [&sourceCell, cPtr, fPtr, numComp, k_NotFound](size_t start, size_t end) {
+    for(size_t featureIdx = start; featureIdx < end; featureIdx++)
     {
-      if(currentDataPtr[j] != cSourcePtr[j] && !warningThrown)
+      T* fDestPtr = fPtr + (numComp * featureIdx);
+      size_t cellIdx = sourceCell[featureIdx].load(std::memory_order_relaxed);
+      if(cellIdx == k_NotFound)
+      {
+        std::fill(fDestPtr, fDestPtr + numComp, static_cast<T>(0));
+      }
+      else
       {
-        // The values are inconsistent with the first values for this feature id, so throw a warning
-        filter->setWarningCondition(-1000);
-        QString ss = QObject::tr("Elements from Feature %1 do not all have the same value. The last value copied into Feature %1 will be used").arg(featureIdx);
-        filter->notifyWarningMessage(filter->getHumanLabel(), ss, filter->getWarningCondition());
-        warningThrown = true;
+        ::memcpy(fDestPtr, cPtr + (numComp * cellIdx), sizeof(T) * numComp);
       }
     }
-
-    // Now get the pointer to the start of the tuple for the Feature Array at the proper index
-    T* fDestPtr = fPtr + (numComp * featureIdx);
-
-    // Now just raw copy the bytes from the source to the destination
-    ::memcpy(fDestPtr, cSourcePtr, sizeof(T) * numComp);
-  }
+  });
   return feature;
 }
 
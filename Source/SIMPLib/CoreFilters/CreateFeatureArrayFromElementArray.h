@@ -136,6 +136,11 @@ class SIMPLib_EXPORT CreateFeatureArrayFromElementArray : public AbstractFilter
     */
     void preflight() override;
 
+    /**
+     * @brief getSupportsConcurrentExecution Reimplemented from @see AbstractFilter class
+     */
+    bool getSupportsConcurrentExecution() override;
+
   signals:
     /**
      * @brief updateFilterParameters Emitted when the Filter requests all the latest Filter parameters
@@ -216,7 +216,7 @@ void CropVertexGeometry::preflight()
 template <typename T> void copyDataToCroppedGeometry(IDataArray::Pointer inDataPtr, IDataArray::Pointer outDataPtr, std::vector<int64_t>& croppedPoints)
 {
   typename DataArray<T>::Pointer inputDataPtr = std::dynamic_pointer_cast<DataArray<T>>(inDataPtr);
-  T* inputData = static_cast<T*>(inputDataPtr->getPointer(0));
+  const T* inputData = inputDataPtr->getConstPointer(0);
   typename DataArray<T>::Pointer croppedDataPtr = std::dynamic_pointer_cast<DataArray<T>>(outDataPtr);
   T* croppedData = static_cast<T*>(croppedDataPtr->getPointer(0));
 
@@ -252,7 +252,8 @@ void CropVertexGeometry::execute()
   DataContainer::Pointer dc = getDataContainerArray()->getDataContainer(getCroppedDataContainerName());
   VertexGeom::Pointer vertices = getDataContainerArray()->getDataContainer(getDataContainerName())->getGeometryAs<VertexGeom>();
   int64_t numVerts = vertices->getNumberOfVertices();
-  float* allVerts = vertices->getVertexPointer(0);
+  // Read through the const pointer so the scan does not invalidate the geometry's spatial indexes
+  const float* allVerts = vertices->getVertices()->getConstPointer(0);
   std::vector<int64_t> croppedPoints;
   croppedPoints.reserve(numVerts);
 
@@ -41,13 +41,16 @@
 #include "H5Support/QH5Utilities.h"
 
 #include "SIMPLib/Common/Constants.h"
+#include "SIMPLib/DataContainers/AttributeMatrixProxy.h"
 #include "SIMPLib/DataContainers/DataContainer.h"
 #include "SIMPLib/DataContainers/DataContainerBundle.h"
+#include "SIMPLib/DataContainers/DataContainerProxy.h"
 #include "SIMPLib/FilterParameters/AbstractFilterParametersReader.h"
 #include "SIMPLib/FilterParameters/BooleanFilterParameter.h"
 #include "SIMPLib/FilterParameters/DataContainerReaderFilterParameter.h"
 #include "SIMPLib/FilterParameters/H5FilterParametersReader.h"
 #include "SIMPLib/Filtering/FilterManager.h"
+#include "SIMPLib/HDF5/H5BackgroundWriter.h"
 #include "SIMPLib/SIMPLibVersion.h"
 #include "SIMPLib/Utilities/SIMPLH5DataReader.h"
 #include "SIMPLib/Utilities/SIMPLH5DataReaderRequirements.h"
@@ -58,6 +61,7 @@
 DataContainerReader::DataContainerReader()
 : m_InputFile("")
 , m_OverwriteExistingDataContainers(false)
+, m_ReadArraysOnDemand(false)
 , m_LastFileRead("")
 , m_LastRead(QDateTime::currentDateTime())
 {
@@ -77,6 +81,7 @@ void DataContainerReader::setupFilterParameters()
   FilterParameterVector parameters;
 
   parameters.push_back(SIMPL_NEW_BOOL_FP("Overwrite Existing Data Containers", OverwriteExistingDataContainers, FilterParameter::Parameter, DataContainerReader));
+  parameters.push_back(SIMPL_NEW_BOOL_FP("Read Arrays On Demand", ReadArraysOnDemand, FilterParameter::Parameter, DataContainerReader));
   {
     DataContainerReaderFilterParameter::Pointer parameter = DataContainerReaderFilterParameter::New();
     parameter->setHumanLabel("Select Arrays from Input File");
@@ -101,6 +106,7 @@ void DataContainerReader::readFilterParameters(AbstractFilterParametersReader* r
   setInputFileDataContainerArrayProxy(reader->readDataContainerArrayProxy("InputFileDataContainerArrayProxy", getInputFileDataContainerArrayProxy()));
   syncProxies(); // Sync the file proxy and currently cached proxy together into one proxy
   setOverwriteExistingDataContainers(reader->readValue("OverwriteExistingDataContainers", getOverwriteExistingDataContainers()));
+  setReadArraysOnDemand(reader->readValue("ReadArraysOnDemand", getReadArraysOnDemand()));
   reader->closeFilterGroup();
 }
 
@@ -237,6 +243,9 @@ void DataContainerReader::preflight()
 // -----------------------------------------------------------------------------
 void DataContainerReader::execute()
 {
+  // An earlier filter may still be writing the file in the background
+  H5BackgroundWriter::Instance()->waitForFile(getInputFile());
+
   /* In this VERY Special circumstance, the data check will actually read the data from the
    * file and move those DataContainer objects into the existing DataContainerArray. Error messages
    * will be passed up the chain if something goes wrong.
@@ -265,7 +274,28 @@ DataContainerArray::Pointer DataContainerReader::readData(DataContainerArrayProx
     return DataContainerArray::New();
   }
 
-  DataContainerArray::Pointer dca = simplReader->readSIMPLDataUsingProxy(proxy, getInPreflight());
+  // In on demand mode the arrays only get their dimensions here. Their values are read through a
+  // separate handle to the file the first time a filter accesses them.
+  H5DeferredArrayLoader::Pointer deferredLoader;
+  if(!getInPreflight())
+  {
+    m_DeferredArrays.reset();
+    m_NumReportedFailures = 0;
+  }
+  if(!getInPreflight() && getReadArraysOnDemand())
+  {
+    m_DeferredArrays = std::make_shared<H5DeferredArrayLoader::ArrayRecord>();
+    deferredLoader = H5DeferredArrayLoader::New(getInputFile(), m_DeferredArrays);
+    if(!deferredLoader->isOpen())
+    {
+      setErrorCondition(-152);
+      QString ss = QObject::tr("Error opening input file '%1' for reading arrays on demand").arg(getInputFile());
+      notifyErrorMessage(getHumanLabel(), ss, getErrorCondition());
+      return DataContainerArray::New();
+    }
+  }
+
+  DataContainerArray::Pointer dca = simplReader->readSIMPLDataUsingProxy(proxy, getInPreflight(), deferredLoader);
   if(dca == DataContainerArray::NullPointer())
   {
     return DataContainerArray::New();
@@ -459,6 +489,86 @@ bool DataContainerReader::syncProxies()
   return true;
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QVector<DataArrayPath> DataContainerReader::getMaterializedArrayPaths() const
+{
+  if(nullptr == m_DeferredArrays.get())
+  {
+    return QVector<DataArrayPath>();
+  }
+  return m_DeferredArrays->getMaterializedPaths();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool DataContainerReader::finishBackgroundWork(bool /*wait*/)
+{
+  if(nullptr == m_DeferredArrays.get())
+  {
+    return false;
+  }
+  QVector<DataArrayPath> failedPaths = m_DeferredArrays->getFailedPaths();
+  if(failedPaths.size() <= m_NumReportedFailures)
+  {
+    return false;
+  }
+
+  QStringList arrayPaths;
+  for(int i = m_NumReportedFailures; i < failedPaths.size(); i++)
+  {
+    arrayPaths << failedPaths[i].serialize("/");
+  }
+  m_NumReportedFailures = failedPaths.size();
+  setErrorCondition(-153);
+  QString ss = QObject::tr("The values of the arrays %1 could not be read on demand from '%2'").arg(arrayPaths.join(", ")).arg(getInputFile());
+  notifyErrorMessage(getHumanLabel(), ss, getErrorCondition());
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int DataContainerReader::pruneUnusedArrays()
+{
+  if(nullptr == m_DeferredArrays.get())
+  {
+    return 0;
+  }
+
+  int count = 0;
+  QVector<DataArrayPath> deferredPaths = m_DeferredArrays->getDeferredPaths();
+  for(const DataArrayPath& path : deferredPaths)
+  {
+    if(m_DeferredArrays->isMaterialized(path))
+    {
+      continue;
+    }
+    if(!m_InputFileDataContainerArrayProxy.dataContainers.contains(path.getDataContainerName()))
+    {
+      continue;
+    }
+    DataContainerProxy& dcProxy = m_InputFileDataContainerArrayProxy.dataContainers[path.getDataContainerName()];
+    if(!dcProxy.attributeMatricies.contains(path.getAttributeMatrixName()))
+    {
+      continue;
+    }
+    AttributeMatrixProxy& amProxy = dcProxy.attributeMatricies[path.getAttributeMatrixName()];
+    if(amProxy.dataArrays.contains(path.getDataArrayName()) && amProxy.dataArrays[path.getDataArrayName()].flag != SIMPL::Unchecked)
+    {
+      amProxy.dataArrays[path.getDataArrayName()].flag = SIMPL::Unchecked;
+      count++;
+    }
+  }
+  if(count > 0)
+  {
+    emit parametersChanged();
+  }
+  return count;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -42,6 +42,7 @@
 #include "SIMPLib/DataContainers/DataContainerArrayProxy.h"
 #include "SIMPLib/Filtering/AbstractFilter.h"
 #include "SIMPLib/Filtering/FilterPipeline.h"
+#include "SIMPLib/HDF5/H5DeferredArrayLoader.h"
 #include "SIMPLib/Utilities/SIMPLH5DataReader.h"
 #include "SIMPLib/SIMPLib.h"
 
@@ -58,11 +59,14 @@ class SIMPLib_EXPORT DataContainerReader : public AbstractFilter
     PYB11_CREATE_BINDINGS(DataContainerReader SUPERCLASS AbstractFilter)
     PYB11_PROPERTY(QString InputFile READ getInputFile WRITE setInputFile)
     PYB11_PROPERTY(bool OverwriteExistingDataContainers READ getOverwriteExistingDataContainers WRITE setOverwriteExistingDataContainers)
+    PYB11_PROPERTY(bool ReadArraysOnDemand READ getReadArraysOnDemand WRITE setReadArraysOnDemand)
     PYB11_PROPERTY(QString LastFileRead READ getLastFileRead WRITE setLastFileRead)
     PYB11_PROPERTY(QDateTime LastRead READ getLastRead WRITE setLastRead)
     PYB11_PROPERTY(DataContainerArrayProxy InputFileDataContainerArrayProxy READ getInputFileDataContainerArrayProxy WRITE setInputFileDataContainerArrayProxy)
 
     PYB11_METHOD(DataContainerArrayProxy readDataContainerArrayStructure ARGS path)
+    PYB11_METHOD(QVector<DataArrayPath> getMaterializedArrayPaths)
+    PYB11_METHOD(int pruneUnusedArrays)
   
   public:
     SIMPL_SHARED_POINTERS(DataContainerReader)
@@ -77,6 +81,9 @@ class SIMPLib_EXPORT DataContainerReader : public AbstractFilter
     SIMPL_FILTER_PARAMETER(bool, OverwriteExistingDataContainers)
     Q_PROPERTY(bool OverwriteExistingDataContainers READ getOverwriteExistingDataContainers WRITE setOverwriteExistingDataContainers)
 
+    SIMPL_FILTER_PARAMETER(bool, ReadArraysOnDemand)
+    Q_PROPERTY(bool ReadArraysOnDemand READ getReadArraysOnDemand WRITE setReadArraysOnDemand)
+
     SIMPL_FILTER_PARAMETER(QString, LastFileRead)
     Q_PROPERTY(QString LastFileRead READ getLastFileRead WRITE setLastFileRead)
 
@@ -199,6 +206,28 @@ class SIMPLib_EXPORT DataContainerReader : public AbstractFilter
     */
     bool syncProxies();
 
+    /**
+     * @brief getMaterializedArrayPaths Returns the arrays of the last execution whose values were read
+     * from the file. This is only tracked when ReadArraysOnDemand is on; otherwise the list is empty.
+     * @return
+     */
+    QVector<DataArrayPath> getMaterializedArrayPaths() const;
+
+    /**
+     * @brief pruneUnusedArrays Unchecks the arrays in InputFileDataContainerArrayProxy that were read on
+     * demand during the last execution but never accessed, so the next run does not read them at all.
+     * @return The number of arrays that were unchecked
+     */
+    int pruneUnusedArrays();
+
+    /**
+     * @brief finishBackgroundWork Reimplemented from @see AbstractFilter class. Reports the arrays read on
+     * demand whose values could not be read since the last call.
+     * @param wait
+     * @return
+     */
+    bool finishBackgroundWork(bool wait) override;
+
   signals:
     /**
      * @brief updateFilterParameters Emitted when the Filter requests all the latest Filter parameters
@@ -249,6 +278,8 @@ class SIMPLib_EXPORT DataContainerReader : public AbstractFilter
 
   private:
     FilterPipeline::Pointer                     m_PipelineFromFile;
+    H5DeferredArrayLoader::ArrayRecordPointer   m_DeferredArrays;
+    int                                         m_NumReportedFailures = 0;
 
   public:
     DataContainerReader(const DataContainerReader&) = delete; // Copy Constructor Not Implemented
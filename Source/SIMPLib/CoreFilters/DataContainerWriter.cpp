@@ -36,6 +36,7 @@
 #include "DataContainerWriter.h"
 
 #include <QtCore/QDir>
+#include <QtCore/QElapsedTimer>
 
 #include "H5Support/H5Utilities.h"
 #include "H5Support/QH5Utilities.h"
@@ -45,7 +46,11 @@
 #include "SIMPLib/FilterParameters/AbstractFilterParametersReader.h"
 #include "SIMPLib/FilterParameters/BooleanFilterParameter.h"
 #include "SIMPLib/FilterParameters/H5FilterParametersWriter.h"
+#include "SIMPLib/FilterParameters/IntFilterParameter.h"
 #include "SIMPLib/FilterParameters/OutputFileFilterParameter.h"
+#include "SIMPLib/Filtering/PipelineProfile.h"
+#include "SIMPLib/HDF5/H5DataArrayWriter.hpp"
+#include "SIMPLib/HDF5/H5DeferredArrayLoader.h"
 #include "SIMPLib/SIMPLibVersion.h"
 #include "SIMPLib/Utilities/FileSystemPathHelper.h"
 
@@ -65,6 +70,11 @@ DataContainerWriter::DataContainerWriter()
 , m_WritePipeline(true)
 , m_WriteXdmfFile(true)
 , m_WriteTimeSeries(false)
+, m_CompressionLevel(0)
+, m_ShuffleData(false)
+, m_ChunkTupleCount(0)
+, m_MinimumChunkedArraySize(65536)
+, m_WriteInBackground(false)
 , m_AppendToExisting(false)
 , m_FileId(-1)
 {
@@ -75,6 +85,11 @@ DataContainerWriter::DataContainerWriter()
 // -----------------------------------------------------------------------------
 DataContainerWriter::~DataContainerWriter()
 {
+  // The background write uses this filter's settings until it is done
+  if(nullptr != m_BackgroundWrite.get())
+  {
+    m_BackgroundWrite->wait();
+  }
   closeFile();
 }
 
@@ -88,6 +103,11 @@ void DataContainerWriter::setupFilterParameters()
   parameters.push_back(SIMPL_NEW_OUTPUT_FILE_FP("Output File", OutputFile, FilterParameter::Parameter, DataContainerWriter, "*.dream3d", ""));
   parameters.push_back(SIMPL_NEW_BOOL_FP("Write Xdmf File", WriteXdmfFile, FilterParameter::Parameter, DataContainerWriter));
   parameters.push_back(SIMPL_NEW_BOOL_FP("Include Xdmf Time Markers", WriteTimeSeries, FilterParameter::Parameter, DataContainerWriter));
+  parameters.push_back(SIMPL_NEW_INTEGER_FP("Compression Level (0-9)", CompressionLevel, FilterParameter::Parameter, DataContainerWriter));
+  parameters.push_back(SIMPL_NEW_BOOL_FP("Shuffle Data Before Compressing", ShuffleData, FilterParameter::Parameter, DataContainerWriter));
+  parameters.push_back(SIMPL_NEW_INTEGER_FP("Tuples per Chunk (0 = Automatic)", ChunkTupleCount, FilterParameter::Parameter, DataContainerWriter));
+  parameters.push_back(SIMPL_NEW_INTEGER_FP("Minimum Chunked Array Size (Bytes)", MinimumChunkedArraySize, FilterParameter::Parameter, DataContainerWriter));
+  parameters.push_back(SIMPL_NEW_BOOL_FP("Write in Background", WriteInBackground, FilterParameter::Parameter, DataContainerWriter));
 
   setFilterParameters(parameters);
 }
@@ -100,6 +120,11 @@ void DataContainerWriter::readFilterParameters(AbstractFilterParametersReader* r
   reader->openFilterGroup(this, index);
   setOutputFile(reader->readString("OutputFile", getOutputFile()));
   setWriteXdmfFile(reader->readValue("WriteXdmfFile", getWriteXdmfFile()));
+  setCompressionLevel(reader->readValue("CompressionLevel", getCompressionLevel()));
+  setShuffleData(reader->readValue("ShuffleData", getShuffleData()));
+  setChunkTupleCount(reader->readValue("ChunkTupleCount", getChunkTupleCount()));
+  setMinimumChunkedArraySize(reader->readValue("MinimumChunkedArraySize", getMinimumChunkedArraySize()));
+  setWriteInBackground(reader->readValue("WriteInBackground", getWriteInBackground()));
   reader->closeFilterGroup();
 }
 
@@ -127,6 +152,24 @@ void DataContainerWriter::dataCheck()
   }
   FileSystemPathHelper::CheckOutputFile(this, "Output File Path", getOutputFile(), true);
 
+  if(m_CompressionLevel < 0 || m_CompressionLevel > 9)
+  {
+    ss = QObject::tr("The compression level must be between 0 and 9. The current value is %1").arg(m_CompressionLevel);
+    setErrorCondition(-11114);
+    notifyErrorMessage(getHumanLabel(), ss, getErrorCondition());
+  }
+  if(m_ChunkTupleCount < 0)
+  {
+    ss = QObject::tr("The number of tuples per chunk must be 0 or greater");
+    setErrorCondition(-11115);
+    notifyErrorMessage(getHumanLabel(), ss, getErrorCondition());
+  }
+  if(m_MinimumChunkedArraySize < 0)
+  {
+    ss = QObject::tr("The minimum chunked array size must be 0 or greater");
+    setErrorCondition(-11116);
+    notifyErrorMessage(getHumanLabel(), ss, getErrorCondition());
+  }
 }
 
 // -----------------------------------------------------------------------------
@@ -142,11 +185,83 @@ void DataContainerWriter::preflight()
   setInPreflight(false);
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool DataContainerWriter::getSupportsConcurrentExecution()
+{
+  // The HDF5 library may only be used from several threads when it was built thread safe
+#ifdef H5_HAVE_THREADSAFE
+  return true;
+#else
+  return false;
+#endif
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QStringList DataContainerWriter::getOutputFiles()
+{
+  QStringList outputFiles;
+  outputFiles << getOutputFile();
+  if(getWriteXdmfFile())
+  {
+    QFileInfo ofFi(getOutputFile());
+    outputFiles << ofFi.path() + "/" + ofFi.completeBaseName() + ".xdmf";
+  }
+  return outputFiles;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QVector<DataArrayPath> DataContainerWriter::getInputPaths()
+{
+  // Every DataContainer is written to the file
+  QVector<DataArrayPath> inputPaths;
+  inputPaths.push_back(DataArrayPath());
+  return inputPaths;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool DataContainerWriter::finishBackgroundWork(bool wait)
+{
+  if(nullptr == m_BackgroundWrite.get() || (!wait && !m_BackgroundWrite->isFinished()))
+  {
+    return false;
+  }
+
+  H5BackgroundWriter::Result result = m_BackgroundWrite->wait();
+  m_BackgroundWrite.reset();
+  if(result.errorCode < 0)
+  {
+    setErrorCondition(result.errorCode);
+    notifyErrorMessage(getHumanLabel(), result.errorMessage, getErrorCondition());
+    return true;
+  }
+
+  double megaBytes = static_cast<double>(result.bytesWritten) / (1024.0 * 1024.0);
+  double throughput = result.seconds > 0.0 ? megaBytes / result.seconds : 0.0;
+  QString ss = QObject::tr("Background write of '%1' complete: %2 MB of array data in %3 s (%4 MB/s)")
+                   .arg(m_OutputFile)
+                   .arg(megaBytes, 0, 'f', 1)
+                   .arg(result.seconds, 0, 'f', 2)
+                   .arg(throughput, 0, 'f', 1);
+  notifyStatusMessage(getMessagePrefix(), getHumanLabel(), ss);
+  return true;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
 void DataContainerWriter::execute()
 {
+  // A background write from a previous execution is reported before anything else happens
+  finishBackgroundWork(true);
+
   setErrorCondition(0);
   setWarningCondition(0);
   dataCheck();
@@ -170,6 +285,29 @@ void DataContainerWriter::execute()
     return;
   }
 
+  bool writeInBackground = m_WriteInBackground;
+#ifndef H5_HAVE_THREADSAFE
+  if(writeInBackground)
+  {
+    QString ss = QObject::tr("The HDF5 library was not built thread safe, so the file is written before the pipeline continues");
+    setWarningCondition(-11117);
+    notifyWarningMessage(getHumanLabel(), ss, getWarningCondition());
+    writeInBackground = false;
+  }
+#endif
+
+  // Arrays that were read on demand from the same file need their values before it is truncated
+  if(!H5DeferredArrayLoader::ReadDeferredArrays(m_OutputFile))
+  {
+    QString ss = QObject::tr("The arrays that were read on demand from '%1' could not be read before the file is overwritten").arg(m_OutputFile);
+    setErrorCondition(-11118);
+    notifyErrorMessage(getHumanLabel(), ss, getErrorCondition());
+    return;
+  }
+
+  // Background writes of the same file that are still queued have to finish before it is opened again
+  H5BackgroundWriter::Instance()->waitForFile(m_OutputFile);
+
   err = openFile(m_AppendToExisting); // Do NOT append to any existing file
   if(err < 0)
   {
@@ -186,11 +324,97 @@ void DataContainerWriter::execute()
   // Write our File Version string to the Root "/" group
   QH5Lite::writeStringAttribute(m_FileId, "/", SIMPL::HDF5::FileVersionName, SIMPL::HDF5::FileVersion);
   QH5Lite::writeStringAttribute(m_FileId, "/", SIMPL::HDF5::DREAM3DVersion, SIMPLib::Version::Complete());
+
+  // Write the Pipeline to the File
+  err = writePipeline();
+
+  // Write the Data ContainerBundles
+  err = writeDataContainerBundles(m_FileId);
+  if(err < 0)
+  {
+    QString ss = QObject::tr("Error writing DataContainerBundles");
+    setErrorCondition(-11113);
+    notifyErrorMessage(getHumanLabel(), ss, getErrorCondition());
+    return;
+  }
+
+  // Every DataArray written from the writing thread picks up the chunking and compression options
+  H5DataArrayWriter::ChunkSettings chunkSettings;
+  chunkSettings.compressionLevel = m_CompressionLevel;
+  chunkSettings.shuffle = m_ShuffleData;
+  chunkSettings.chunkTupleCount = static_cast<size_t>(m_ChunkTupleCount);
+  chunkSettings.minimumChunkedArrayBytes = static_cast<size_t>(m_MinimumChunkedArraySize);
+
+  if(!writeInBackground)
+  {
+    H5DataArrayWriter::ScopedChunkSettings scopedChunkSettings(chunkSettings);
+    QString errorMessage;
+    err = writeDataContainers(m_FileId, getDataContainerArray(), errorMessage);
+    if(err < 0)
+    {
+      setErrorCondition(err);
+      notifyErrorMessage(getHumanLabel(), errorMessage, getErrorCondition());
+      return;
+    }
+
+    notifyStatusMessage(getHumanLabel(), "Complete");
+    return;
+  }
+
+  // The copy shares the values of the DataArrays instead of duplicating them. A later filter that modifies
+  // one of those arrays gets its own copy of the values first, so it never changes what is being written.
+  DataContainerArray::Pointer dcaCopy = getDataContainerArray()->deepCopy(false);
+
+  // The I/O thread takes over the open file and closes it when it is done
+  hid_t fileId = m_FileId;
+  m_FileId = -1;
+  m_BackgroundWrite = H5BackgroundWriter::Instance()->enqueue(m_OutputFile, [this, fileId, dcaCopy, chunkSettings]() mutable {
+    H5BackgroundWriter::Result result;
+    QElapsedTimer timer;
+    timer.start();
+    {
+      H5ScopedFileSentinel fileSentinel(&fileId, true);
+      H5DataArrayWriter::ScopedChunkSettings scopedChunkSettings(chunkSettings);
+      result.errorCode = writeDataContainers(fileId, dcaCopy, result.errorMessage);
+    }
+    result.seconds = static_cast<double>(timer.nsecsElapsed()) * 1.0E-9;
+
+    for(const DataContainer::Pointer& dc : dcaCopy->getDataContainers())
+    {
+      for(const AttributeMatrix::Pointer& attrMat : dc->getAttributeMatrices())
+      {
+        for(const QString& arrayName : attrMat->getAttributeArrayNames())
+        {
+          result.bytesWritten += PipelineProfile::GetArrayBytes(attrMat->getAttributeArray(arrayName));
+        }
+      }
+    }
+    return result;
+  });
+
+  notifyStatusMessage(getHumanLabel(), "Writing in the background");
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int DataContainerWriter::writeDataContainers(hid_t fileId, const DataContainerArray::Pointer& dca, QString& errorMessage)
+{
+  int err = H5Utilities::createGroupsFromPath(SIMPL::StringConstants::DataContainerGroupName.toLatin1().data(), fileId);
+  if(err < 0)
+  {
+    errorMessage = QObject::tr("Error creating HDF5 Group '%1'").arg(SIMPL::StringConstants::DataContainerGroupName);
+    return -60;
+  }
+  hid_t dcaGid = H5Gopen(fileId, SIMPL::StringConstants::DataContainerGroupName.toLatin1().data(), H5P_DEFAULT);
+  H5ScopedGroupSentinel dcaSentinel(&dcaGid, false);
+
   QFile xdmfFile;
   QTextStream xdmfOut(&xdmfFile);
   if(m_WriteXdmfFile)
   {
     QFileInfo ofFi(m_OutputFile);
+    QString parentPath = ofFi.path();
     QString name = ofFi.completeBaseName();
     if(parentPath.isEmpty())
     {
@@ -207,32 +431,16 @@ void DataContainerWriter::execute()
     }
   }
 
-  // Write the Pipeline to the File
-  err = writePipeline();
-
-  err = H5Utilities::createGroupsFromPath(SIMPL::StringConstants::DataContainerGroupName.toLatin1().data(), m_FileId);
-  if(err < 0)
-  {
-    QString ss = QObject::tr("Error creating HDF5 Group '%1'").arg(SIMPL::StringConstants::DataContainerGroupName);
-    setErrorCondition(-60);
-    notifyErrorMessage(getHumanLabel(), ss, getErrorCondition());
-    return;
-  }
-  hid_t dcaGid = H5Gopen(m_FileId, SIMPL::StringConstants::DataContainerGroupName.toLatin1().data(), H5P_DEFAULT);
-  scopedFileSentinel.addGroupId(&dcaGid);
-
-  QList<QString> dcNames = getDataContainerArray()->getDataContainerNames();
-  for(int iter = 0; iter < getDataContainerArray()->getNumDataContainers(); iter++)
+  QList<QString> dcNames = dca->getDataContainerNames();
+  for(int iter = 0; iter < dca->getNumDataContainers(); iter++)
   {
-    DataContainer::Pointer dc = getDataContainerArray()->getDataContainer(dcNames[iter]);
+    DataContainer::Pointer dc = dca->getDataContainer(dcNames[iter]);
     IGeometry::Pointer geometry = dc->getGeometry();
     err = H5Utilities::createGroupsFromPath(dcNames[iter].toLatin1().data(), dcaGid);
     if(err < 0)
     {
-      QString ss = QObject::tr("Error creating HDF5 Group '%1'").arg(dcNames[iter]);
-      setErrorCondition(-60);
-      notifyErrorMessage(getHumanLabel(), ss, getErrorCondition());
-      return;
+      errorMessage = QObject::tr("Error creating HDF5 Group '%1'").arg(dcNames[iter]);
+      return -60;
     }
 
     hid_t dcGid = H5Gopen(dcaGid, dcNames[iter].toLatin1().data(), H5P_DEFAULT);
@@ -243,14 +451,14 @@ void DataContainerWriter::execute()
     err = dc->writeAttributeMatricesToHDF5(dcGid);
     if(err < 0)
     {
-      notifyErrorMessage(getHumanLabel(), "Error writing DataContainer AttributeMatrices", -803);
-      return;
+      errorMessage = QObject::tr("Error writing DataContainer AttributeMatrices");
+      return -803;
     }
     err = dc->writeMeshToHDF5(dcGid, m_WriteXdmfFile);
     if(err < 0)
     {
-      notifyErrorMessage(getHumanLabel(), "Error writing DataContainer Geometry", -804);
-      return;
+      errorMessage = QObject::tr("Error writing DataContainer Geometry");
+      return -804;
     }
     if(m_WriteXdmfFile && geometry.get() != nullptr)
     {
@@ -265,37 +473,23 @@ void DataContainerWriter::execute()
       dc->getGeometry()->setTemporalDataPath(DataArrayPath(dc->getName(), SIMPL::StringConstants::MetaData, "Step #"));
 #endif
 
-      QString hdfFileName = QH5Utilities::fileNameFromFileId(m_FileId);
+      QString hdfFileName = QH5Utilities::fileNameFromFileId(fileId);
       err = dc->writeXdmf(xdmfOut, hdfFileName);
       if(err < 0)
       {
-        notifyErrorMessage(getHumanLabel(), "Error writing Xdmf File", -805);
-        return;
+        errorMessage = QObject::tr("Error writing Xdmf File");
+        return -805;
       }
     }
   }
 
-  // Write the Data ContainerBundles
-  err = writeDataContainerBundles(m_FileId);
-  if(err < 0)
-  {
-    QString ss = QObject::tr("Error writing DataContainerBundles");
-    setErrorCondition(-11113);
-    notifyErrorMessage(getHumanLabel(), ss, getErrorCondition());
-    return;
-  }
-
   // Write the XDMF File
   if(m_WriteXdmfFile)
   {
     writeXdmfFooter(xdmfOut);
   }
 
-  H5Gclose(dcaGid);
-
-  dcaGid = -1;
-
-  notifyStatusMessage(getHumanLabel(), "Complete");
+  return 0;
 }
 
 // -----------------------------------------------------------------------------
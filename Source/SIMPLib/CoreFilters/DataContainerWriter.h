@@ -38,6 +38,7 @@
 
 #include "SIMPLib/Common/SIMPLibSetGetMacros.h"
 #include "SIMPLib/Filtering/AbstractFilter.h"
+#include "SIMPLib/HDF5/H5BackgroundWriter.h"
 #include "SIMPLib/SIMPLib.h"
 
 /**
@@ -52,6 +53,11 @@ class SIMPLib_EXPORT DataContainerWriter : public AbstractFilter
     PYB11_PROPERTY(QString OutputFile READ getOutputFile WRITE setOutputFile)
     PYB11_PROPERTY(bool WriteXdmfFile READ getWriteXdmfFile WRITE setWriteXdmfFile)
     PYB11_PROPERTY(bool WriteTimeSeries READ getWriteTimeSeries WRITE setWriteTimeSeries)
+    PYB11_PROPERTY(int CompressionLevel READ getCompressionLevel WRITE setCompressionLevel)
+    PYB11_PROPERTY(bool ShuffleData READ getShuffleData WRITE setShuffleData)
+    PYB11_PROPERTY(int ChunkTupleCount READ getChunkTupleCount WRITE setChunkTupleCount)
+    PYB11_PROPERTY(int MinimumChunkedArraySize READ getMinimumChunkedArraySize WRITE setMinimumChunkedArraySize)
+    PYB11_PROPERTY(bool WriteInBackground READ getWriteInBackground WRITE setWriteInBackground)
 
   public:
     SIMPL_SHARED_POINTERS(DataContainerWriter)
@@ -71,6 +77,21 @@ class SIMPLib_EXPORT DataContainerWriter : public AbstractFilter
     SIMPL_FILTER_PARAMETER(bool, WriteTimeSeries)
     Q_PROPERTY(bool WriteTimeSeries READ getWriteTimeSeries WRITE setWriteTimeSeries)
 
+    SIMPL_FILTER_PARAMETER(int, CompressionLevel)
+    Q_PROPERTY(int CompressionLevel READ getCompressionLevel WRITE setCompressionLevel)
+
+    SIMPL_FILTER_PARAMETER(bool, ShuffleData)
+    Q_PROPERTY(bool ShuffleData READ getShuffleData WRITE setShuffleData)
+
+    SIMPL_FILTER_PARAMETER(int, ChunkTupleCount)
+    Q_PROPERTY(int ChunkTupleCount READ getChunkTupleCount WRITE setChunkTupleCount)
+
+    SIMPL_FILTER_PARAMETER(int, MinimumChunkedArraySize)
+    Q_PROPERTY(int MinimumChunkedArraySize READ getMinimumChunkedArraySize WRITE setMinimumChunkedArraySize)
+
+    SIMPL_FILTER_PARAMETER(bool, WriteInBackground)
+    Q_PROPERTY(bool WriteInBackground READ getWriteInBackground WRITE setWriteInBackground)
+
     SIMPL_INSTANCE_PROPERTY(bool, AppendToExisting)
 
     /**
@@ -138,6 +159,26 @@ class SIMPLib_EXPORT DataContainerWriter : public AbstractFilter
     */
     void preflight() override;
 
+    /**
+     * @brief getSupportsConcurrentExecution Reimplemented from @see AbstractFilter class
+     */
+    bool getSupportsConcurrentExecution() override;
+
+    /**
+     * @brief getOutputFiles Reimplemented from @see AbstractFilter class
+     */
+    QStringList getOutputFiles() override;
+
+    /**
+     * @brief getInputPaths Reimplemented from @see AbstractFilter class
+     */
+    QVector<DataArrayPath> getInputPaths() override;
+
+    /**
+     * @brief finishBackgroundWork Reports the outcome and the throughput of a write that runs in the background
+     */
+    bool finishBackgroundWork(bool wait) override;
+
   signals:
     /**
      * @brief updateFilterParameters Emitted when the Filter requests all the latest Filter parameters
@@ -200,6 +241,16 @@ class SIMPLib_EXPORT DataContainerWriter : public AbstractFilter
      */
     int writeDataContainerBundles(hid_t fileId);
 
+    /**
+     * @brief writeDataContainers Writes the DataContainers and the Xdmf file. This does not emit any messages
+     * so that it can run on the background I/O thread.
+     * @param fileId The open HDF5 file
+     * @param dca The DataContainers to write
+     * @param errorMessage Describes the error if one occurred
+     * @return Integer error value
+     */
+    int writeDataContainers(hid_t fileId, const DataContainerArray::Pointer& dca, QString& errorMessage);
+
     /**
      * @brief writeXdmfHeader Writes the Xdmf header
      * @param out QTextStream for output
@@ -214,6 +265,7 @@ class SIMPLib_EXPORT DataContainerWriter : public AbstractFilter
 
   private:
     hid_t m_FileId;
+    H5BackgroundWriter::Job::Pointer m_BackgroundWrite;
 
   public:
     DataContainerWriter(const DataContainerWriter&) = delete; // Copy Constructor Not Implemented
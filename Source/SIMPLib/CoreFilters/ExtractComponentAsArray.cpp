@@ -167,6 +167,15 @@ void ExtractComponentAsArray::preflight()
   setInPreflight(false);
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool ExtractComponentAsArray::getSupportsConcurrentExecution()
+{
+  // Only creates new data from the selected arrays
+  return true;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -180,7 +189,7 @@ template <typename T> void extractComponent(IDataArray::Pointer inputData, IData
     return;
   }
 
-  T* inputArray = inputArrayPtr->getPointer(0);
+  const T* inputArray = inputArrayPtr->getConstPointer(0);
   T* newArray = newArrayPtr->getPointer(0);
   size_t numPoints = inputArrayPtr->getNumberOfTuples();
   size_t numComps = inputArrayPtr->getNumberOfComponents();
@@ -168,6 +168,23 @@ void FeatureDataCSVWriter::preflight()
   setInPreflight(false);
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool FeatureDataCSVWriter::getSupportsConcurrentExecution()
+{
+  // Only writes the selected feature data to a file
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QStringList FeatureDataCSVWriter::getOutputFiles()
+{
+  return QStringList() << getFeatureDataFile();
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
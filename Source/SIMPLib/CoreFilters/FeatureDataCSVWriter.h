@@ -155,6 +155,16 @@ class  SIMPLib_EXPORT FeatureDataCSVWriter : public AbstractFilter
     */
     void preflight() override;
 
+    /**
+     * @brief getSupportsConcurrentExecution Reimplemented from @see AbstractFilter class
+     */
+    bool getSupportsConcurrentExecution() override;
+
+    /**
+     * @brief getOutputFiles Reimplemented from @see AbstractFilter class
+     */
+    QStringList getOutputFiles() override;
+
   signals:
     /**
      * @brief updateFilterParameters Emitted when the Filter requests all the latest Filter parameters
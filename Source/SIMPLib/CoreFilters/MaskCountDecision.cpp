@@ -64,6 +64,7 @@ void MaskCountDecision::setupFilterParameters()
   FilterParameterVector parameters = getFilterParameters();
   DataArraySelectionFilterParameter::RequirementType req =
       DataArraySelectionFilterParameter::CreateRequirement(SIMPL::TypeNames::Bool, 1, AttributeMatrix::Type::Any, IGeometry::Type::Any);
+  req.daTypes.push_back(SIMPL::TypeNames::BitArray);
   parameters.push_back(SIMPL_NEW_DA_SELECTION_FP("Mask", MaskArrayPath, FilterParameter::RequiredArray, MaskCountDecision, req));
   parameters.push_back(SIMPL_NEW_INTEGER_FP("Number of True Instances", NumberOfTrues, FilterParameter::Parameter, MaskCountDecision, 0));
   setFilterParameters(parameters);
@@ -96,6 +97,18 @@ void MaskCountDecision::dataCheck()
   setErrorCondition(0);
   setWarningCondition(0);
 
+  // The mask may either be a bool array or a bit packed mask
+  IDataArray::Pointer maskPtr = getDataContainerArray()->getPrereqIDataArrayFromPath<IDataArray, AbstractFilter>(this, getMaskArrayPath());
+  if(getErrorCondition() < 0)
+  {
+    return;
+  }
+  m_MaskBitArrayPtr = std::dynamic_pointer_cast<BitArray>(maskPtr);
+  if(nullptr != m_MaskBitArrayPtr.lock())
+  {
+    return;
+  }
+
   QVector<size_t> cDims(1, 1);
 
   m_MaskPtr =
@@ -132,22 +145,39 @@ void MaskCountDecision::execute()
     return;
   }
 
-  size_t numTuples = m_MaskPtr.lock()->getNumberOfTuples();
+  BitArray::Pointer maskBits = m_MaskBitArrayPtr.lock();
+  size_t numTuples = nullptr != maskBits.get() ? maskBits->getNumberOfTuples() : m_MaskPtr.lock()->getNumberOfTuples();
 
   int32_t trueCount = 0;
   bool dm = true;
 
   qDebug() << "NumberOfTrues: " << m_NumberOfTrues;
 
+  if(nullptr != maskBits.get() && m_NumberOfTrues > 0)
+  {
+    // A packed mask is counted a whole word at a time
+    if(maskBits->countTrue() >= static_cast<size_t>(m_NumberOfTrues))
+    {
+      dm = false;
+      emit decisionMade(dm);
+      emit targetValue(m_NumberOfTrues);
+      return;
+    }
+    emit decisionMade(dm);
+    notifyStatusMessage(getHumanLabel(), "Complete");
+    return;
+  }
+
   for(size_t i = 0; i < numTuples; i++)
   {
-    if(m_NumberOfTrues < 0 && !m_Mask[i])
+    bool value = nullptr != maskBits.get() ? maskBits->getValue(i) : m_Mask[i];
+    if(m_NumberOfTrues < 0 && !value)
     {
       qDebug() << "First if check: " << dm;
       emit decisionMade(dm);
       return;
     }
-    if(m_Mask[i])
+    if(value)
     {
       trueCount++;
     }
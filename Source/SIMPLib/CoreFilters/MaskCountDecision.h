@@ -37,6 +37,7 @@
 #pragma once
 
 #include "SIMPLib/Common/SIMPLibSetGetMacros.h"
+#include "SIMPLib/DataArrays/BitArray.h"
 #include "SIMPLib/Filtering/AbstractFilter.h"
 #include "SIMPLib/SIMPLib.h"
 
@@ -137,6 +138,7 @@ class SIMPLib_EXPORT MaskCountDecision : public AbstractDecisionFilter
 
   private:
     DEFINE_DATAARRAY_VARIABLE(bool, Mask)
+    BitArray::WeakPointer m_MaskBitArrayPtr;
 
   public:
     MaskCountDecision(const MaskCountDecision&) = delete; // Copy Constructor Not Implemented
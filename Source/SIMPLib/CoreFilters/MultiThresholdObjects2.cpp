@@ -35,19 +35,277 @@
 
 #include "MultiThresholdObjects2.h"
 
+#include <algorithm>
+#include <array>
+#include <memory>
+#include <vector>
+
 #include "SIMPLib/Common/Constants.h"
+#include "SIMPLib/Common/TemplateHelpers.h"
 #include "SIMPLib/FilterParameters/AbstractFilterParametersReader.h"
+#include "SIMPLib/FilterParameters/BooleanFilterParameter.h"
 #include "SIMPLib/FilterParameters/ComparisonSelectionAdvancedFilterParameter.h"
 #include "SIMPLib/FilterParameters/SeparatorFilterParameter.h"
 #include "SIMPLib/FilterParameters/StringFilterParameter.h"
-#include "SIMPLib/Filtering/ThresholdFilterHelper.h"
 #include "SIMPLib/SIMPLibVersion.h"
 
+#include "SIMPLib/CoreFilters/util/CalculatorParallel.hpp"
+
+namespace
+{
+// Number of tuples evaluated at once. The intermediate results of a block stay in cache while the
+// comparison tree is evaluated, so every input array is only streamed through once.
+const size_t k_BlockSize = 4096;
+
+/**
+ * @brief The ThresholdNode class is one node of a compiled comparison tree
+ */
+class ThresholdNode
+{
+public:
+  virtual ~ThresholdNode() = default;
+
+  /**
+   * @brief evaluate Writes the result of this node for the tuples [start, start + count) into output
+   * @param start First tuple
+   * @param count Number of tuples, at most k_BlockSize
+   * @param output
+   */
+  virtual void evaluate(size_t start, size_t count, bool* output) const = 0;
+};
+using ThresholdNodePointer = std::unique_ptr<ThresholdNode>;
+
+/**
+ * @brief The ThresholdValueNode class compares a scalar array of type T against a single value
+ */
+template <typename T> class ThresholdValueNode : public ThresholdNode
+{
+public:
+  ThresholdValueNode(const T* data, size_t numValues, int compOperator, double compValue)
+  : m_Data(data)
+  , m_NumValues(numValues)
+  , m_CompOperator(compOperator)
+  , m_CompValue(static_cast<T>(compValue))
+  {
+  }
+
+  void evaluate(size_t start, size_t count, bool* output) const override
+  {
+    size_t numValid = (start < m_NumValues) ? std::min(count, m_NumValues - start) : 0;
+    const T* data = m_Data + start;
+    const T v = m_CompValue;
+    switch(m_CompOperator)
+    {
+    case SIMPL::Comparison::Operator_LessThan:
+      for(size_t i = 0; i < numValid; i++)
+      {
+        output[i] = (data[i] < v);
+      }
+      break;
+    case SIMPL::Comparison::Operator_GreaterThan:
+      for(size_t i = 0; i < numValid; i++)
+      {
+        output[i] = (data[i] > v);
+      }
+      break;
+    case SIMPL::Comparison::Operator_Equal:
+      for(size_t i = 0; i < numValid; i++)
+      {
+        output[i] = (data[i] == v);
+      }
+      break;
+    case SIMPL::Comparison::Operator_NotEqual:
+      for(size_t i = 0; i < numValid; i++)
+      {
+        output[i] = (data[i] != v);
+      }
+      break;
+    default:
+      numValid = 0;
+      break;
+    }
+    std::fill(output + numValid, output + count, false);
+  }
+
+private:
+  const T* m_Data;
+  size_t m_NumValues;
+  int m_CompOperator;
+  T m_CompValue;
+};
+
+/**
+ * @brief The ThresholdSetNode class combines its children in order with their union operators
+ * and optionally inverts the result. The union operator of the first child is ignored.
+ */
+class ThresholdSetNode : public ThresholdNode
+{
+public:
+  explicit ThresholdSetNode(bool invert)
+  : m_Invert(invert)
+  {
+  }
+
+  void addChild(int unionOperator, ThresholdNodePointer child)
+  {
+    m_UnionOperators.push_back(unionOperator);
+    m_Children.push_back(std::move(child));
+  }
+
+  void evaluate(size_t start, size_t count, bool* output) const override
+  {
+    if(m_Children.empty())
+    {
+      std::fill(output, output + count, false);
+    }
+    else
+    {
+      m_Children[0]->evaluate(start, count, output);
+      std::array<bool, k_BlockSize> childOutput;
+      for(size_t c = 1; c < m_Children.size(); c++)
+      {
+        m_Children[c]->evaluate(start, count, childOutput.data());
+        if(SIMPL::Union::Operator_Or == m_UnionOperators[c])
+        {
+          for(size_t i = 0; i < count; i++)
+          {
+            output[i] = output[i] || childOutput[i];
+          }
+        }
+        else
+        {
+          for(size_t i = 0; i < count; i++)
+          {
+            output[i] = output[i] && childOutput[i];
+          }
+        }
+      }
+    }
+
+    if(m_Invert)
+    {
+      for(size_t i = 0; i < count; i++)
+      {
+        output[i] = !output[i];
+      }
+    }
+  }
+
+private:
+  bool m_Invert;
+  std::vector<int> m_UnionOperators;
+  std::vector<ThresholdNodePointer> m_Children;
+};
+
+/**
+ * @brief CreateValueNode Returns a node comparing the DataArray<T> input against the comparison value
+ */
+template <typename T> ThresholdNodePointer CreateValueNode(const IDataArray::Pointer& input, ComparisonValue::Pointer comparisonValue)
+{
+  typename DataArray<T>::Pointer array = std::dynamic_pointer_cast<DataArray<T>>(input);
+  return ThresholdNodePointer(new ThresholdValueNode<T>(array->getConstPointer(0), array->getNumberOfTuples(), comparisonValue->getCompOperator(), comparisonValue->getCompValue()));
+}
+
+/**
+ * @brief CompileValue Creates the typed node for a single comparison. Returns nullptr if the array does not exist or has an unsupported type.
+ */
+ThresholdNodePointer CompileValue(const AttributeMatrix::Pointer& am, ComparisonValue::Pointer comparisonValue)
+{
+  IDataArray::Pointer input = am->getAttributeArray(comparisonValue->getAttributeArrayName());
+  if(TemplateHelpers::CanDynamicCast<FloatArrayType>()(input))
+  {
+    return CreateValueNode<float>(input, comparisonValue);
+  }
+  else if(TemplateHelpers::CanDynamicCast<DoubleArrayType>()(input))
+  {
+    return CreateValueNode<double>(input, comparisonValue);
+  }
+  else if(TemplateHelpers::CanDynamicCast<Int8ArrayType>()(input))
+  {
+    return CreateValueNode<int8_t>(input, comparisonValue);
+  }
+  else if(TemplateHelpers::CanDynamicCast<UInt8ArrayType>()(input))
+  {
+    return CreateValueNode<uint8_t>(input, comparisonValue);
+  }
+  else if(TemplateHelpers::CanDynamicCast<Int16ArrayType>()(input))
+  {
+    return CreateValueNode<int16_t>(input, comparisonValue);
+  }
+  else if(TemplateHelpers::CanDynamicCast<UInt16ArrayType>()(input))
+  {
+    return CreateValueNode<uint16_t>(input, comparisonValue);
+  }
+  else if(TemplateHelpers::CanDynamicCast<Int32ArrayType>()(input))
+  {
+    return CreateValueNode<int32_t>(input, comparisonValue);
+  }
+  else if(TemplateHelpers::CanDynamicCast<UInt32ArrayType>()(input))
+  {
+    return CreateValueNode<uint32_t>(input, comparisonValue);
+  }
+  else if(TemplateHelpers::CanDynamicCast<Int64ArrayType>()(input))
+  {
+    return CreateValueNode<int64_t>(input, comparisonValue);
+  }
+  else if(TemplateHelpers::CanDynamicCast<UInt64ArrayType>()(input))
+  {
+    return CreateValueNode<uint64_t>(input, comparisonValue);
+  }
+  else if(TemplateHelpers::CanDynamicCast<BoolArrayType>()(input))
+  {
+    return CreateValueNode<bool>(input, comparisonValue);
+  }
+  return ThresholdNodePointer();
+}
+
+/**
+ * @brief CompileSet Compiles a list of comparisons into a single tree that is evaluated in one pass over the tuples
+ * @param am Attribute Matrix holding the compared arrays
+ * @param comparisons
+ * @param invert Whether the combined result is flipped
+ * @param failedArrayName Set to the name of the array that could not be compared if nullptr is returned
+ * @return
+ */
+ThresholdNodePointer CompileSet(const AttributeMatrix::Pointer& am, const QVector<AbstractComparison::Pointer>& comparisons, bool invert, QString& failedArrayName)
+{
+  std::unique_ptr<ThresholdSetNode> setNode(new ThresholdSetNode(invert));
+  for(const AbstractComparison::Pointer& comparison : comparisons)
+  {
+    ThresholdNodePointer child;
+    if(ComparisonSet::Pointer childSet = std::dynamic_pointer_cast<ComparisonSet>(comparison))
+    {
+      child = CompileSet(am, childSet->getComparisons(), childSet->getInvertComparison(), failedArrayName);
+    }
+    else if(ComparisonValue::Pointer childValue = std::dynamic_pointer_cast<ComparisonValue>(comparison))
+    {
+      child = CompileValue(am, childValue);
+      if(nullptr == child)
+      {
+        failedArrayName = childValue->getAttributeArrayName();
+      }
+    }
+    else
+    {
+      continue;
+    }
+
+    if(nullptr == child)
+    {
+      return ThresholdNodePointer();
+    }
+    setNode->addChild(comparison->getUnionOperator(), std::move(child));
+  }
+  return ThresholdNodePointer(setNode.release());
+}
+} // namespace
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
 MultiThresholdObjects2::MultiThresholdObjects2()
 : m_DestinationArrayName(SIMPL::GeneralData::Mask)
+, m_BitPackedOutput(false)
 {
 }
 
@@ -73,6 +331,7 @@ void MultiThresholdObjects2::setupFilterParameters()
     parameter->setGetterCallback(SIMPL_BIND_GETTER(MultiThresholdObjects2, this, SelectedThresholds));
     parameters.push_back(parameter);
   }
+  parameters.push_back(SIMPL_NEW_BOOL_FP("Bit Packed Output", BitPackedOutput, FilterParameter::Parameter, MultiThresholdObjects2));
   parameters.push_back(SIMPL_NEW_STRING_FP("Output Attribute Array", DestinationArrayName, FilterParameter::CreatedArray, MultiThresholdObjects2));
   setFilterParameters(parameters);
 }
@@ -85,6 +344,7 @@ void MultiThresholdObjects2::readFilterParameters(AbstractFilterParametersReader
   reader->openFilterGroup(this, index);
   setDestinationArrayName(reader->readString("DestinationArrayName", getDestinationArrayName()));
   setSelectedThresholds(reader->readComparisonInputsAdvanced("SelectedThresholds", getSelectedThresholds()));
+  setBitPackedOutput(reader->readValue("BitPackedOutput", getBitPackedOutput()));
   reader->closeFilterGroup();
 }
 
@@ -133,12 +393,19 @@ void MultiThresholdObjects2::dataCheck()
     //AbstractComparison::Pointer comp = m_SelectedThresholds[0];
     QVector<size_t> cDims(1, 1);
     DataArrayPath tempPath(dcName, amName, getDestinationArrayName());
-    m_DestinationPtr = getDataContainerArray()->createNonPrereqArrayFromPath<DataArray<bool>, AbstractFilter, bool>(this, tempPath, true,
-                                                                                                                    cDims); /* Assigns the shared_ptr<> to an instance variable that is a weak_ptr<> */
-    if(nullptr != m_DestinationPtr.lock()) /* Validate the Weak Pointer wraps a non-nullptr pointer to a DataArray<T> object */
+    if(getBitPackedOutput())
     {
-      m_Destination = m_DestinationPtr.lock()->getPointer(0);
-    } /* Now assign the raw pointer to data from the DataArray<T> object */
+      m_DestinationBitsPtr = getDataContainerArray()->createNonPrereqArrayFromPath<BitArray, AbstractFilter, bool>(this, tempPath, true, cDims);
+    }
+    else
+    {
+      m_DestinationPtr = getDataContainerArray()->createNonPrereqArrayFromPath<DataArray<bool>, AbstractFilter, bool>(this, tempPath, true,
+                                                                                                                      cDims); /* Assigns the shared_ptr<> to an instance variable that is a weak_ptr<> */
+      if(nullptr != m_DestinationPtr.lock()) /* Validate the Weak Pointer wraps a non-nullptr pointer to a DataArray<T> object */
+      {
+        m_Destination = m_DestinationPtr.lock()->getPointer(0);
+      } /* Now assign the raw pointer to data from the DataArray<T> object */
+    }
 
     // Do not allow non-scalar arrays
     for(size_t i = 0; i < comparisonValues.size(); ++i)
@@ -213,223 +480,50 @@ void MultiThresholdObjects2::execute()
     return;
   }
 
-    bool invert = m_SelectedThresholds.shouldInvert();
-
-    int64_t thresholdSize;
-    BoolArrayType::Pointer thresholdArray;
-
-    createBoolArray(thresholdSize, thresholdArray);
-    bool firstValueFound = false;
-
-    // Loop on the remaining Comparison objects updating our final result array as we go
-    for(int32_t i = 0; i < m_SelectedThresholds.size() && err >= 0; ++i)
-    {
-      if (std::dynamic_pointer_cast<ComparisonSet>(m_SelectedThresholds[i]))
-      {
-        ComparisonSet::Pointer comparisonSet = std::dynamic_pointer_cast<ComparisonSet>(m_SelectedThresholds[i]);
-        thresholdSet(comparisonSet, thresholdArray, err, !firstValueFound, false);
-        firstValueFound = true;
-      }
-      else if(std::dynamic_pointer_cast<ComparisonValue>(m_SelectedThresholds[i]))
-      {
-        ComparisonValue::Pointer comparisonValue = std::dynamic_pointer_cast<ComparisonValue>(m_SelectedThresholds[i]);
-        thresholdValue(comparisonValue, thresholdArray, err, !firstValueFound, false);
-        firstValueFound = true;
-      }
-    }
-
-    if (invert)
-    {
-      invertThreshold(thresholdSize, thresholdArray);
-    }
-
-    bool* threshold = thresholdArray->getPointer(0);
-    for (int64_t p = 0; p < thresholdSize; p++)
-    {
-      m_Destination[p] = threshold[p];
-    }
-
-  /* Let the GUI know we are done with this filter */
-  notifyStatusMessage(getHumanLabel(), "Complete");
-}
-
-// -----------------------------------------------------------------------------
-//
-// -----------------------------------------------------------------------------
-void MultiThresholdObjects2::createBoolArray(int64_t& totalTuples, BoolArrayType::Pointer& thresholdArrayPtr)
-{
-  // Get the names of the Data Container and AttributeMatrix for later
-  QString dcName = m_SelectedThresholds.getDataContainerName();
-  QString amName = m_SelectedThresholds.getAttributeMatrixName();
-
-  DataContainerArray::Pointer dca = getDataContainerArray();
-  DataContainer::Pointer m = dca->getDataContainer(dcName);
-
-  // Get the total number of tuples, create and initialize an array to use for these results
-  totalTuples = static_cast<int64_t>(m->getAttributeMatrix(amName)->getNumberOfTuples());
-  thresholdArrayPtr = BoolArrayType::CreateArray(totalTuples, "_INTERNAL_USE_ONLY_TEMP");
-
-  // Initialize the array to false
-  thresholdArrayPtr->initializeWithZeros();
-}
-
-// -----------------------------------------------------------------------------
-//
-// -----------------------------------------------------------------------------
-void MultiThresholdObjects2::insertThreshold(int64_t numItems, BoolArrayType::Pointer currentArrayPtr, int unionOperator, const BoolArrayType::Pointer newArrayPtr, bool inverse)
-{
-  bool* newArray = newArrayPtr->getPointer(0);
-  bool* currentArray = currentArrayPtr->getPointer(0);
-
-  for (int64_t i = 0; i < numItems; i++)
-  {
-    // invert the current comparison if necessary
-    if (inverse)
-    {
-      newArray[i] = !newArray[i];
-    }
-
-    if (SIMPL::Union::Operator_Or == unionOperator)
-    {
-      currentArray[i] = currentArray[i] || newArray[i];
-    }
-    else if(!currentArray[i] || !newArray[i])
-    {
-      currentArray[i] = false;
-    }
-  }
-}
-
-// -----------------------------------------------------------------------------
-//
-// -----------------------------------------------------------------------------
-void MultiThresholdObjects2::invertThreshold(int64_t numItems, BoolArrayType::Pointer thresholdArray)
-{
-  bool* threshold = thresholdArray->getPointer(0);
-
-  for (int64_t i = 0; i < numItems; i++)
-  {
-    threshold[i] = !threshold[i];
-  }
-}
-
-// -----------------------------------------------------------------------------
-//
-// -----------------------------------------------------------------------------
-void MultiThresholdObjects2::thresholdSet(ComparisonSet::Pointer comparisonSet, BoolArrayType::Pointer& currentThreshold, int32_t &err, bool replaceInput, bool inverse)
-{
-  if (nullptr == comparisonSet)
+  // Compile the comparisons into a single typed tree, then evaluate it block by block straight into the destination
+  AttributeMatrix::Pointer am = m->getAttributeMatrix(amName);
+  QString failedArrayName;
+  ThresholdNodePointer thresholdTree = CompileSet(am, m_SelectedThresholds.getInputs(), m_SelectedThresholds.shouldInvert(), failedArrayName);
+  if(nullptr == thresholdTree)
   {
+    DataArrayPath tempPath(dcName, amName, failedArrayName);
+    QString ss = QObject::tr("Error Executing threshold filter on array. The path is %1").arg(tempPath.serialize());
+    setErrorCondition(-13002);
+    notifyErrorMessage(getHumanLabel(), ss, getErrorCondition());
     return;
   }
 
-  if (inverse)
-  {
-    inverse = !comparisonSet->getInvertComparison();
-  }
-  else
-  {
-    inverse = comparisonSet->getInvertComparison();
-  }
-
-  int64_t setArraySize;
-  BoolArrayType::Pointer setThresholdArray;
-
-  createBoolArray(setArraySize, setThresholdArray);
-  bool firstValueFound = false;
-
-  QVector<AbstractComparison::Pointer> comparisons = comparisonSet->getComparisons();
-  for (int i = 0; i < comparisons.size(); i++)
-  {
-    // Check all contents of child Comparison Sets
-    if (std::dynamic_pointer_cast<ComparisonSet>(comparisons.at(i)))
-    { 
-      ComparisonSet::Pointer childSet = std::dynamic_pointer_cast<ComparisonSet>(comparisons.at(i));
-      thresholdSet(childSet, setThresholdArray, err, !firstValueFound, false);
-      firstValueFound = true;
-    }
-    // Check Comparison Values
-    if (std::dynamic_pointer_cast<ComparisonValue>(comparisons.at(i)))
-    {
-      ComparisonValue::Pointer childValue = std::dynamic_pointer_cast<ComparisonValue>(comparisons.at(i));
-      thresholdValue(childValue, setThresholdArray, err, !firstValueFound, false);
-      firstValueFound = true;
-    }
-
-    if (err < 0)
-    {
-      return;
-    }
-  }
-
-  if (replaceInput)
-  {
-    if (inverse)
-    {
-      invertThreshold(setArraySize, setThresholdArray);
-    }
-    currentThreshold.swap(setThresholdArray);
-  }
-  else
-  {
-    // insert into current threshold
-    insertThreshold(setArraySize, currentThreshold, comparisonSet->getUnionOperator(), setThresholdArray, inverse);
-  }
-}
-
-// -----------------------------------------------------------------------------
-//
-// -----------------------------------------------------------------------------
-void MultiThresholdObjects2::thresholdValue(ComparisonValue::Pointer comparisonValue, BoolArrayType::Pointer& inputThreshold, int32_t &err, bool replaceInput, bool inverse)
-{
-  if (nullptr == comparisonValue)
+  size_t totalTuples = am->getNumberOfTuples();
+  const ThresholdNode* root = thresholdTree.get();
+  if(getBitPackedOutput())
   {
+    // Blocks start on word boundaries so each task owns whole words of the packed output
+    BitArray* destinationBits = m_DestinationBitsPtr.lock().get();
+    size_t numBlocks = (totalTuples + k_BlockSize - 1) / k_BlockSize;
+    CalculatorParallel::ForEachRange(numBlocks, 1, [root, destinationBits, totalTuples](size_t start, size_t end) {
+      std::array<bool, k_BlockSize> values;
+      for(size_t block = start; block < end; block++)
+      {
+        size_t blockStart = block * k_BlockSize;
+        size_t count = std::min(k_BlockSize, totalTuples - blockStart);
+        root->evaluate(blockStart, count, values.data());
+        destinationBits->packValues(blockStart, values.data(), count);
+      }
+    });
+    notifyStatusMessage(getHumanLabel(), "Complete");
     return;
   }
 
-  // Get the names of the Data Container and AttributeMatrix for later
-  QString dcName = m_SelectedThresholds.getDataContainerName();
-  QString amName = m_SelectedThresholds.getAttributeMatrixName();
-
-  DataContainerArray::Pointer dca = getDataContainerArray();
-  DataContainer::Pointer m = dca->getDataContainer(dcName);
-
-  // Get the total number of tuples, create and initialize an array to use for these results
-  int64_t totalTuples = static_cast<int64_t>(m->getAttributeMatrix(amName)->getNumberOfTuples());
-  BoolArrayType::Pointer currentArrayPtr = BoolArrayType::CreateArray(totalTuples, "_INTERNAL_USE_ONLY_TEMP");
-
-  // Initialize the array to false
-  currentArrayPtr->initializeWithZeros();
-
-  //bool* currentArray = currentArrayPtr->getPointer(0);
-  int compOperator = comparisonValue->getCompOperator();
-  double compValue = comparisonValue->getCompValue();
-
-  ThresholdFilterHelper filter(static_cast<SIMPL::Comparison::Enumeration>(compOperator), compValue, currentArrayPtr.get());
-
-  err = filter.execute(m->getAttributeMatrix(amName)->getAttributeArray(comparisonValue->getAttributeArrayName()).get(), currentArrayPtr.get());
-  if (err < 0)
-  {
-    DataArrayPath tempPath(m_SelectedThresholds.getDataContainerName(), m_SelectedThresholds.getAttributeMatrixName(), comparisonValue->getAttributeArrayName());
-    QString ss = QObject::tr("Error Executing threshold filter on array. The path is %1").arg(tempPath.serialize());
-    setErrorCondition(-13002);
-    notifyErrorMessage(getHumanLabel(), ss, getErrorCondition());
-    return;
-  }
-  
-  if (replaceInput)
-  {
-    if (inverse)
+  bool* destination = m_Destination;
+  CalculatorParallel::ForEachRange(totalTuples, k_BlockSize, [root, destination](size_t start, size_t end) {
+    for(size_t blockStart = start; blockStart < end; blockStart += k_BlockSize)
     {
-      invertThreshold(totalTuples, currentArrayPtr);
+      root->evaluate(blockStart, std::min(k_BlockSize, end - blockStart), destination + blockStart);
     }
-    inputThreshold.swap(currentArrayPtr);
-  }
-  else 
-  {
-    // insert into current threshold
-    insertThreshold(totalTuples, inputThreshold, comparisonValue->getUnionOperator(), currentArrayPtr, inverse);
-  }
+  });
+
+  /* Let the GUI know we are done with this filter */
+  notifyStatusMessage(getHumanLabel(), "Complete");
 }
 
 // -----------------------------------------------------------------------------
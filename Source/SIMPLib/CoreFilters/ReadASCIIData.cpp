@@ -4,13 +4,18 @@
 
 #include "ReadASCIIData.h"
 
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <utility>
+#include <vector>
+
 #include <QtCore/QFileInfo>
 
 #include "SIMPLib/Common/Constants.h"
 #include "SIMPLib/DataArrays/StringDataArray.h"
 #include "SIMPLib/FilterParameters/AbstractFilterParametersReader.h"
 #include "SIMPLib/FilterParameters/AttributeMatrixSelectionFilterParameter.h"
-#include "SIMPLib/Utilities/StringOperations.h"
 
 #include "SIMPLib/FilterParameters/ReadASCIIDataFilterParameter.h"
 
@@ -18,8 +23,177 @@
 
 #include "SIMPLib/CoreFilters/util/AbstractDataParser.hpp"
 
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#include <tbb/partitioner.h>
+#include <tbb/task_arena.h>
+#endif
+
 namespace {
    const QString k_Skip("Skip");
+
+   // Size of the blocks read from the input file and of the chunks each block is split into for parsing
+   const qint64 k_BlockSize = 64 * 1024 * 1024;
+   const qint64 k_ChunkSize = 1024 * 1024;
+
+/**
+ * @brief normalizeLineEndings Replaces the "\r\n" and lone '\r' line endings in data with '\n', as
+ * QTextStream::readLine() accepts all three. A '\r' at the end of one block is remembered in pendingCR so
+ * that a '\n' at the start of the next block is dropped.
+ */
+void normalizeLineEndings(QByteArray& data, bool& pendingCR)
+{
+  if(data.isEmpty() || (!pendingCR && data.indexOf('\r') < 0))
+  {
+    return;
+  }
+  char* begin = data.data();
+  char* end = begin + data.size();
+  char* out = begin;
+  for(char* c = begin; c < end; c++)
+  {
+    if(*c == '\n' && pendingCR)
+    {
+      pendingCR = false;
+      continue;
+    }
+    pendingCR = (*c == '\r');
+    *out++ = pendingCR ? '\n' : *c;
+  }
+  data.truncate(static_cast<int>(out - begin));
+}
+
+/**
+ * @brief The ParseError struct holds the first error found in a chunk of lines. An errorCode of 0 means no error.
+ */
+struct ParseError
+{
+  int lineNum = 0;
+  int errorCode = 0;
+  QString message;
+};
+
+/**
+ * @brief The ASCIIChunkParser class tokenizes and parses a range of complete lines straight from the bytes of the input
+ * file, producing the same tokens as StringOperations::TokenizeString. Chunks cover disjoint lines and so write disjoint
+ * tuples, which allows several chunks to be parsed at once as long as every array takes writes to different tuples
+ * from several threads. StringDataArray does not, as all its values share one buffer.
+ */
+class ASCIIChunkParser
+{
+public:
+  ASCIIChunkParser(const QList<AbstractDataParser::Pointer>& dataParsers, const QList<char>& delimiters, int numColumns, int beginIndex, int numLines)
+  : m_DataParsers(dataParsers)
+  , m_NumColumns(numColumns)
+  , m_BeginIndex(beginIndex)
+  , m_NumLines(numLines)
+  {
+    m_Delimiters.fill(false);
+    for(char delimiter : delimiters)
+    {
+      m_Delimiters[static_cast<uint8_t>(delimiter)] = true;
+    }
+    m_HasDelimiters = !delimiters.isEmpty();
+  }
+
+  /**
+   * @brief parse Parses the lines in [begin, end), which must end with a '\n'. Lines outside of the
+   * [beginIndex, numLines] range are skipped.
+   * @param firstLineNum The 1 based line number of the first line in the range
+   * @return The first error found, if any
+   */
+  ParseError parse(const char* begin, const char* end, int firstLineNum) const
+  {
+    ParseError error;
+    std::vector<std::pair<const char*, const char*>> tokens;
+    tokens.reserve(static_cast<size_t>(m_NumColumns));
+
+    int lineNum = firstLineNum;
+    for(const char* lineBegin = begin; lineBegin < end && lineNum <= m_NumLines; lineNum++)
+    {
+      const char* lineEnd = static_cast<const char*>(std::memchr(lineBegin, '\n', static_cast<size_t>(end - lineBegin)));
+      const char* next = lineEnd + 1;
+      if(lineNum < m_BeginIndex)
+      {
+        lineBegin = next;
+        continue;
+      }
+      if(lineEnd > lineBegin && *(lineEnd - 1) == '\r')
+      {
+        lineEnd--;
+      }
+
+      tokenize(lineBegin, lineEnd, tokens);
+      if(static_cast<int>(tokens.size()) != m_NumColumns)
+      {
+        error.lineNum = lineNum;
+        error.errorCode = ReadASCIIData::INCONSISTENT_COLS;
+        error.message = "Line " + QString::number(lineNum) + " has an inconsistent number of columns.\n";
+        QTextStream out(&error.message);
+        out << "Expecting " << m_NumColumns << " but found " << tokens.size() << "\n";
+        out << "Input line was:\n";
+        out << QString::fromUtf8(lineBegin, static_cast<int>(lineEnd - lineBegin));
+        return error;
+      }
+
+      size_t insertIndex = static_cast<size_t>(lineNum - m_BeginIndex);
+      for(const AbstractDataParser::Pointer& parser : m_DataParsers)
+      {
+        int index = parser->getColumnIndex();
+        ParserFunctor::ErrorObject obj = parser->parse(tokens[index].first, tokens[index].second, insertIndex);
+        if(!obj.ok)
+        {
+          error.lineNum = lineNum;
+          error.errorCode = ReadASCIIData::CONVERSION_FAILURE;
+          error.message = obj.errorMessage + "(line " + QString::number(lineNum) + ", column " + QString::number(index) + ").";
+          return error;
+        }
+      }
+      lineBegin = next;
+    }
+    return error;
+  }
+
+private:
+  QList<AbstractDataParser::Pointer> m_DataParsers;
+  std::array<bool, 256> m_Delimiters;
+  bool m_HasDelimiters = false;
+  int m_NumColumns = 0;
+  int m_BeginIndex = 0;
+  int m_NumLines = 0;
+
+  /**
+   * @brief tokenize Splits a line into its non empty runs of non delimiter characters. Empty tokens are always
+   * dropped, so the "consecutive delimiters" setting does not change the result. A line is a single token
+   * when there are no delimiters.
+   */
+  void tokenize(const char* begin, const char* end, std::vector<std::pair<const char*, const char*>>& tokens) const
+  {
+    tokens.clear();
+    if(!m_HasDelimiters)
+    {
+      tokens.emplace_back(begin, end);
+      return;
+    }
+    const char* tokenBegin = begin;
+    for(const char* c = begin; c < end; c++)
+    {
+      if(m_Delimiters[static_cast<uint8_t>(*c)])
+      {
+        if(c > tokenBegin)
+        {
+          tokens.emplace_back(tokenBegin, c);
+        }
+        tokenBegin = c + 1;
+      }
+    }
+    if(end > tokenBegin)
+    {
+      tokens.emplace_back(tokenBegin, end);
+    }
+  }
+};
 }
 
 // -----------------------------------------------------------------------------
@@ -443,7 +617,6 @@ void ReadASCIIData::execute()
   QStringList headers = wizardData.dataHeaders;
   QStringList dataTypes = wizardData.dataTypes;
   QList<char> delimiters = wizardData.delimiters;
-  bool consecutiveDelimiters = wizardData.consecutiveDelimiters;
   int numLines = wizardData.numberOfLines;
   int beginIndex = wizardData.beginIndex;
 
@@ -521,65 +694,129 @@ void ReadASCIIData::execute()
     }
   }
 
-  int insertIndex = 0;
-
   QFile inputFile(inputFilePath);
   if(inputFile.open(QIODevice::ReadOnly))
   {
-    QTextStream in(&inputFile);
-
-    for(int i = 1; i < beginIndex; i++)
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+    // The parallel loops run inside this arena, which limits the number of threads to the value set by the pipeline
+    int maxThreads = tbb::this_task_arena::max_concurrency();
+    if(getMaxNumberOfThreads() > 0)
     {
-      // Skip to the first data line
-      in.readLine();
+      maxThreads = std::min(maxThreads, getMaxNumberOfThreads());
     }
+    tbb::task_arena arena(maxThreads);
+    bool doParallel = true;
+    // StringDataArray::setValue() appends to a buffer shared by every tuple, so string columns are parsed on one thread
+    bool doParallelParse = !dataTypes.contains(SIMPL::TypeNames::String);
+#endif
 
-    float threshold = 0.0f;
+    ASCIIChunkParser chunkParser(dataParsers, delimiters, dataTypes.size(), beginIndex, numLines);
     size_t numTuples = numLines - beginIndex + 1;
 
-    for(int lineNum = beginIndex; lineNum <= numLines; lineNum++)
-    {
-      QString line = in.readLine();
-      QStringList tokens = StringOperations::TokenizeString(line, delimiters, consecutiveDelimiters);
+    // The file is read in large blocks and each block is split at line boundaries into chunks that are parsed
+    // independently. The partial line at the end of a block is carried over into the next block.
+    QByteArray block;
+    int firstLineNum = 1;
+    bool firstBlock = true;
+    bool pendingCR = false;
+    while(firstLineNum <= numLines)
+    {
+      QByteArray data = inputFile.read(k_BlockSize);
+      bool atEnd = data.isEmpty() || inputFile.atEnd();
+      normalizeLineEndings(data, pendingCR);
+      block.append(data);
+      if(firstBlock && block.startsWith("\xEF\xBB\xBF"))
+      {
+        // Skip the UTF-8 byte order mark
+        block.remove(0, 3);
+      }
+      firstBlock = false;
+      if(atEnd && !block.isEmpty() && !block.endsWith('\n'))
+      {
+        block.append('\n');
+      }
 
-      if(dataTypes.size() != tokens.size())
+      const char* blockBegin = block.constData();
+      const char* blockEnd = blockBegin + block.lastIndexOf('\n') + 1;
+      std::vector<const char*> chunkBounds(1, blockBegin);
+      while(chunkBounds.back() < blockEnd)
       {
-        QString ss = "Line " + QString::number(lineNum) + " has an inconsistent number of columns.\n";
-        QTextStream out(&ss);
-        out << "Expecting " << dataTypes.size() << " but found " << tokens.size() << "\n";
-        out << "Input line was:\n";
-        out << line;
-        setErrorCondition(INCONSISTENT_COLS);
-        notifyErrorMessage(getHumanLabel(), ss, getErrorCondition());
-        return;
+        const char* chunkEnd = chunkBounds.back() + std::min(k_ChunkSize, static_cast<qint64>(blockEnd - chunkBounds.back())) - 1;
+        chunkEnd = static_cast<const char*>(std::memchr(chunkEnd, '\n', static_cast<size_t>(blockEnd - chunkEnd))) + 1;
+        chunkBounds.push_back(chunkEnd);
       }
+      size_t numChunks = chunkBounds.size() - 1;
 
-      for(int i = 0; i < dataParsers.size(); i++)
+      // Number the lines of every chunk before parsing them
+      std::vector<int> chunkFirstLine(numChunks + 1, 0);
+      auto countLines = [&chunkBounds, &chunkFirstLine](size_t start, size_t end) {
+        for(size_t i = start; i < end; i++)
+        {
+          chunkFirstLine[i + 1] = static_cast<int>(std::count(chunkBounds[i], chunkBounds[i + 1], '\n'));
+        }
+      };
+      std::vector<ParseError> errors(numChunks);
+      auto parseChunks = [&chunkParser, &chunkBounds, &chunkFirstLine, &errors, numLines](size_t start, size_t end) {
+        for(size_t i = start; i < end; i++)
+        {
+          if(chunkFirstLine[i] <= numLines)
+          {
+            errors[i] = chunkParser.parse(chunkBounds[i], chunkBounds[i + 1], chunkFirstLine[i]);
+          }
+        }
+      };
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+      if(doParallel)
       {
-        AbstractDataParser::Pointer parser = dataParsers[i];
-        int index = parser->getColumnIndex();
+        arena.execute([&] {
+          tbb::parallel_for(tbb::blocked_range<size_t>(0, numChunks), [&countLines](const tbb::blocked_range<size_t>& r) { countLines(r.begin(), r.end()); }, tbb::auto_partitioner());
+        });
+      }
+      else
+#endif
+      {
+        countLines(0, numChunks);
+      }
+      chunkFirstLine[0] = firstLineNum;
+      for(size_t i = 0; i < numChunks; i++)
+      {
+        chunkFirstLine[i + 1] += chunkFirstLine[i];
+      }
 
-        ParserFunctor::ErrorObject obj = parser->parse(tokens[index], insertIndex);
-        if(!obj.ok)
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+      if(doParallel && doParallelParse)
+      {
+        arena.execute([&] {
+          tbb::parallel_for(tbb::blocked_range<size_t>(0, numChunks), [&parseChunks](const tbb::blocked_range<size_t>& r) { parseChunks(r.begin(), r.end()); }, tbb::auto_partitioner());
+        });
+      }
+      else
+#endif
+      {
+        parseChunks(0, numChunks);
+      }
+
+      // Chunks are in line order, so the first chunk with an error holds the earliest bad line
+      for(const ParseError& error : errors)
+      {
+        if(error.errorCode < 0)
         {
-          QString errorMessage = obj.errorMessage;
-          QString ss = errorMessage + "(line " + QString::number(lineNum) + ", column " + QString::number(index) + ").";
-          setErrorCondition(CONVERSION_FAILURE);
-          notifyErrorMessage(getHumanLabel(), ss, getErrorCondition());
+          setErrorCondition(error.errorCode);
+          notifyErrorMessage(getHumanLabel(), error.message, getErrorCondition());
           return;
         }
       }
 
-      if((static_cast<float>(lineNum) / numTuples) * 100.0f > threshold)
+      firstLineNum = chunkFirstLine[numChunks];
+      block.remove(0, static_cast<int>(blockEnd - blockBegin));
+
+      if(firstLineNum > beginIndex)
       {
         // Print the status of the import
-        QString ss = QObject::tr("Importing ASCII Data || %1% Complete").arg((static_cast<float>(lineNum) / numTuples) * 100.0f, 0, 'f', 0);
+        float percent = std::min(static_cast<float>(firstLineNum - beginIndex) / numTuples, 1.0f) * 100.0f;
+        QString ss = QObject::tr("Importing ASCII Data || %1% Complete").arg(percent, 0, 'f', 0);
         notifyStatusMessage(getMessagePrefix(), getHumanLabel(), ss);
-        threshold = threshold + 5.0f;
-        if(threshold < (static_cast<float>(lineNum) / numTuples) * 100.0f)
-        {
-          threshold = (static_cast<float>(lineNum) / numTuples) * 100.0f;
-        }
       }
 
       if(getCancel())
@@ -587,9 +824,25 @@ void ReadASCIIData::execute()
         return;
       }
 
-      insertIndex++;
+      if(atEnd)
+      {
+        break;
+      }
     }
     inputFile.close();
+
+    // The file ended before the expected number of lines; treat the missing lines as empty lines
+    const char emptyLine[] = "\n";
+    for(; firstLineNum <= numLines; firstLineNum++)
+    {
+      ParseError error = chunkParser.parse(emptyLine, emptyLine + 1, firstLineNum);
+      if(error.errorCode < 0)
+      {
+        setErrorCondition(error.errorCode);
+        notifyErrorMessage(getHumanLabel(), error.message, getErrorCondition());
+        return;
+      }
+    }
   }
 
   notifyStatusMessage(getHumanLabel(), "Complete");
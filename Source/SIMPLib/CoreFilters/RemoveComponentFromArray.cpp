@@ -199,7 +199,7 @@ template <typename T> void extractComponent(IDataArray::Pointer inputData, IData
     return;
   }
 
-  T* inputArray = inputArrayPtr->getPointer(0);
+  const T* inputArray = inputArrayPtr->getConstPointer(0);
   T* newArray = newArrayPtr->getPointer(0);
   T* reducedArray = reducedArrayPtr->getPointer(0);
 
@@ -239,7 +239,7 @@ template <typename T> void reduceArrayOnly(IDataArray::Pointer inputData, IDataA
     return;
   }
 
-  T* inputArray = inputArrayPtr->getPointer(0);
+  const T* inputArray = inputArrayPtr->getConstPointer(0);
   T* reducedArray = reducedArrayPtr->getPointer(0);
 
   size_t numPoints = inputArrayPtr->getNumberOfTuples();
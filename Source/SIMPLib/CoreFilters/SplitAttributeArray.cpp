@@ -164,7 +164,7 @@ void SplitAttributeArray::preflight()
 template <typename T> void splitMulticomponentArray(IDataArray::Pointer inputArray, std::vector<IDataArray::Pointer>& splitArrays)
 {
   typename DataArray<T>::Pointer inputPtr = std::dynamic_pointer_cast<DataArray<T>>(inputArray);
-  T* iPtr = inputPtr->getPointer(0);
+  const T* iPtr = inputPtr->getConstPointer(0);
   std::vector<T*> downcastPtrs;
 
   for(auto&& ptr : splitArrays)
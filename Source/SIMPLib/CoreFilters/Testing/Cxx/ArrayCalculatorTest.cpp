@@ -919,6 +919,158 @@ public:
     }
   }
 
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  DoubleArrayType::Pointer evaluateEquation(QString equation, DataArrayPath targetArrayPath, bool useCompiledEvaluation, ArrayCalculator::AngleUnits units)
+  {
+    AbstractFilter::Pointer filter = createArrayCalculatorFilter(targetArrayPath);
+
+    bool propWasSet = filter->setProperty("InfixEquation", equation);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true);
+    propWasSet = filter->setProperty("Units", units);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true);
+    propWasSet = filter->setProperty("UseCompiledEvaluation", useCompiledEvaluation);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true);
+    filter->execute();
+    DREAM3D_REQUIRE_EQUAL(filter->getErrorCondition(), static_cast<int>(CalculatorItem::ErrorCode::SUCCESS));
+
+    DoubleArrayType::Pointer arrayPtr = filter->getDataContainerArray()->getPrereqIDataArrayFromPath<DoubleArrayType, AbstractFilter>(filter.get(), targetArrayPath);
+    DREAM3D_REQUIRE_VALID_POINTER(arrayPtr.get());
+    return arrayPtr;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void CompiledEvaluationTest()
+  {
+    DataArrayPath arrayPath("DataContainer", "AttributeMatrix", "NewArray");
+    DataArrayPath numericArrayPath("DataContainer", "NumericMatrix", "NewArray");
+
+    QStringList equations;
+    equations << "InputArray1 + InputArray2 * 3"
+              << "MultiComponent Array1 + MultiComponent Array2"
+              << "MultiComponent Array1[1] * -MultiComponent Array2[2] / 7"
+              << "sin(MultiComponent Array1[0]) + cos(InputArray2) - tan(4)"
+              << "log(2, MultiComponent Array2[0] + 1) + root(InputArray2, 3) + sqrt(abs(InputArray1))"
+              << "asin(0.5) + acos(0.25) * atan(InputArray1)"
+              << "floor(InputArray1 / 7) + ceil(InputArray2 / 3) + exp(1) + ln(InputArray2) + log10(InputArray2)"
+              << "\"Spaced Array\" ^ 2 - (12 + 6) * InputArray1";
+
+    QVector<ArrayCalculator::AngleUnits> unitsList = {ArrayCalculator::Radians, ArrayCalculator::Degrees};
+    for(ArrayCalculator::AngleUnits units : unitsList)
+    {
+      for(const QString& equation : equations)
+      {
+        std::cout << "Comparing evaluation modes for equation: " << equation.toStdString() << std::endl;
+        DoubleArrayType::Pointer interpreted = evaluateEquation(equation, arrayPath, false, units);
+        DoubleArrayType::Pointer compiled = evaluateEquation(equation, arrayPath, true, units);
+
+        DREAM3D_REQUIRE(compiled->getNumberOfTuples() == interpreted->getNumberOfTuples());
+        DREAM3D_REQUIRE(compiled->getNumberOfComponents() == interpreted->getNumberOfComponents());
+        for(size_t i = 0; i < interpreted->getSize(); i++)
+        {
+          double expected = interpreted->getValue(i);
+          double actual = compiled->getValue(i);
+          DREAM3D_REQUIRE(actual == expected || (std::isnan(actual) && std::isnan(expected)));
+        }
+      }
+    }
+
+    // Constant expressions are folded into a single value by the compiled evaluation
+    {
+      DoubleArrayType::Pointer interpreted = evaluateEquation("sin( abs( cos( abs(3)/4) + 7)^2)", numericArrayPath, false, ArrayCalculator::Radians);
+      DoubleArrayType::Pointer compiled = evaluateEquation("sin( abs( cos( abs(3)/4) + 7)^2)", numericArrayPath, true, ArrayCalculator::Radians);
+      DREAM3D_REQUIRE(compiled->getNumberOfTuples() == 1);
+      DREAM3D_REQUIRE(compiled->getValue(0) == interpreted->getValue(0));
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  DataContainerArray::Pointer createLargeDataContainerArray(size_t numTuples)
+  {
+    DataContainerArray::Pointer dca = DataContainerArray::New();
+    DataContainer::Pointer dc = DataContainer::New("DataContainer");
+    AttributeMatrix::Pointer am = AttributeMatrix::New(QVector<size_t>(1, numTuples), "AttributeMatrix", AttributeMatrix::Type::Cell);
+
+    FloatArrayType::Pointer floatArray = FloatArrayType::CreateArray(QVector<size_t>(1, numTuples), QVector<size_t>(1, 3), "FloatArray");
+    for(size_t i = 0; i < floatArray->getSize(); i++)
+    {
+      floatArray->setValue(i, static_cast<float>(i % 1000) * 0.37f - 150.0f);
+    }
+
+    UInt32ArrayType::Pointer intArray = UInt32ArrayType::CreateArray(numTuples, "IntArray");
+    for(size_t i = 0; i < numTuples; i++)
+    {
+      intArray->setValue(i, static_cast<uint32_t>(i % 97));
+    }
+
+    am->addAttributeArray(floatArray->getName(), floatArray);
+    am->addAttributeArray(intArray->getName(), intArray);
+    dc->addAttributeMatrix(am->getName(), am);
+    dca->addDataContainer(dc);
+
+    return dca;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  DoubleArrayType::Pointer evaluateLargeEquation(QString equation, bool useCompiledEvaluation, int maxNumberOfThreads)
+  {
+    DataArrayPath arrayPath("DataContainer", "AttributeMatrix", "NewArray");
+    AbstractFilter::Pointer filter = createArrayCalculatorFilter(arrayPath);
+    filter->setDataContainerArray(createLargeDataContainerArray(100000));
+    filter->setMaxNumberOfThreads(maxNumberOfThreads);
+
+    bool propWasSet = filter->setProperty("InfixEquation", equation);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true);
+    propWasSet = filter->setProperty("UseCompiledEvaluation", useCompiledEvaluation);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true);
+    filter->execute();
+    DREAM3D_REQUIRE_EQUAL(filter->getErrorCondition(), static_cast<int>(CalculatorItem::ErrorCode::SUCCESS));
+
+    DoubleArrayType::Pointer arrayPtr = filter->getDataContainerArray()->getPrereqIDataArrayFromPath<DoubleArrayType, AbstractFilter>(filter.get(), arrayPath);
+    DREAM3D_REQUIRE_VALID_POINTER(arrayPtr.get());
+    return arrayPtr;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void ParallelEvaluationTest()
+  {
+    QStringList equations;
+    equations << "FloatArray * 2 + FloatArray / 7 - 1"
+              << "sin(FloatArray[1]) * -cos(IntArray) + sqrt(abs(FloatArray[2]))"
+              << "log(3, IntArray + 1) - root(abs(FloatArray[0]), 3) ^ 2";
+
+    for(const QString& equation : equations)
+    {
+      std::cout << "Comparing thread counts for equation: " << equation.toStdString() << std::endl;
+      DoubleArrayType::Pointer serial = evaluateLargeEquation(equation, false, 1);
+
+      QVector<int> threadCounts = {1, 3, 0};
+      for(int useCompiled = 0; useCompiled < 2; useCompiled++)
+      {
+        for(int threadCount : threadCounts)
+        {
+          DoubleArrayType::Pointer result = evaluateLargeEquation(equation, useCompiled == 1, threadCount);
+          DREAM3D_REQUIRE(result->getSize() == serial->getSize());
+          for(size_t i = 0; i < serial->getSize(); i++)
+          {
+            double expected = serial->getValue(i);
+            double actual = result->getValue(i);
+            DREAM3D_REQUIRE(actual == expected || (std::isnan(actual) && std::isnan(expected)));
+          }
+        }
+      }
+    }
+  }
+
   // -----------------------------------------------------------------------------
   //
   // -----------------------------------------------------------------------------
@@ -928,6 +1080,8 @@ public:
     int err = EXIT_SUCCESS;
     DREAM3D_REGISTER_TEST(SingleComponentArrayCalculatorTest())
     DREAM3D_REGISTER_TEST(MultiComponentArrayCalculatorTest())
+    DREAM3D_REGISTER_TEST(CompiledEvaluationTest())
+    DREAM3D_REGISTER_TEST(ParallelEvaluationTest())
   }
 
 private:
@@ -160,6 +160,10 @@ public:
         DREAM3D_REQUIRE_EQUAL(propWasSet, true)
 
         createFeatureArrayFromElementArrayFilter->execute();
+        int err = createFeatureArrayFromElementArrayFilter->getErrorCondition();
+        DREAM3D_REQUIRE_EQUAL(err, 0);
+        int warning = createFeatureArrayFromElementArrayFilter->getWarningCondition();
+        DREAM3D_REQUIRE_EQUAL(warning, -1000);
       }
       else
       {
@@ -251,6 +255,10 @@ public:
         DREAM3D_REQUIRE_EQUAL(propWasSet, true)
 
         createFeatureArrayFromElementArrayFilter->execute();
+        int err = createFeatureArrayFromElementArrayFilter->getErrorCondition();
+        DREAM3D_REQUIRE_EQUAL(err, 0);
+        int warning = createFeatureArrayFromElementArrayFilter->getWarningCondition();
+        DREAM3D_REQUIRE_EQUAL(warning, -1000);
       }
       else
       {
@@ -330,6 +338,16 @@ public:
         createFeatureArrayFromElementArrayFilter->execute();
         int err = createFeatureArrayFromElementArrayFilter->getErrorCondition();
         DREAM3D_REQUIRE_EQUAL(err, 0);
+        int warning = createFeatureArrayFromElementArrayFilter->getWarningCondition();
+        DREAM3D_REQUIRE_EQUAL(warning, 0);
+
+        // Every feature takes the Feature Id of its cells; feature 0 has no cells and is zeroed
+        DataArray<int32_t>::Pointer createdArray = featureAttr->getAttributeArrayAs<DataArray<int32_t>>(createdName);
+        DREAM3D_REQUIRE_VALID_POINTER(createdArray.get())
+        for(int32_t i = 0; i < 5; i++)
+        {
+          DREAM3D_REQUIRE_EQUAL(createdArray->getValue(i), i);
+        }
       }
       else
       {
@@ -36,11 +36,13 @@
 
 #include <QtCore/QCoreApplication>
 #include <QtCore/QFile>
+#include <QtCore/QFileInfo>
 #include <QtCore/QTextStream>
 
 #include "SIMPLib/Common/SIMPLibSetGetMacros.h"
 
 #include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/DataArrays/StringDataArray.h"
 #include "SIMPLib/Filtering/FilterFactory.hpp"
 #include "SIMPLib/Filtering/FilterManager.h"
 #include "SIMPLib/Filtering/FilterPipeline.h"
@@ -410,6 +412,175 @@ public:
     }
   }
 
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void WriteLines(const QString& filePath, const QStringList& lines, const QString& lineEnding)
+  {
+    QFile data(filePath);
+    if(data.open(QFile::WriteOnly))
+    {
+      QTextStream out(&data);
+      for(const QString& line : lines)
+      {
+        out << line << lineEnding;
+      }
+      data.close();
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestMultipleColumns()
+  {
+    const int numTuples = 5000;
+
+    ASCIIWizardData data;
+    data.automaticAM = false;
+    data.beginIndex = 2;
+    data.consecutiveDelimiters = true;
+    data.dataHeaders << "Ints" << "Floats" << "Strings";
+    data.dataTypes << SIMPL::TypeNames::Int32 << SIMPL::TypeNames::Double << SIMPL::TypeNames::String;
+    data.delimiters << ',' << ' ';
+    data.inputFilePath = UnitTest::ReadASCIIDataTest::TestFile1;
+    data.numberOfLines = numTuples + 1;
+    data.selectedPath = DataArrayPath(DataContainerName, AttributeMatrixName, "");
+    data.tupleDims = QVector<size_t>(1, numTuples);
+
+    QStringList lines;
+    lines << "Ints, Floats, Strings";
+    for(int i = 0; i < numTuples; i++)
+    {
+      lines << QString("%1,  %2 ,name_%3").arg(i - 100).arg(i * 0.25 - 3.5e-3).arg(i);
+    }
+
+    // Windows, classic Mac and Unix line endings, with the data starting on the second line
+    QStringList lineEndings = {"\r\n", "\r", "\n"};
+    for(const QString& lineEnding : lineEndings)
+    {
+      WriteLines(UnitTest::ReadASCIIDataTest::TestFile1, lines, lineEnding);
+
+      AbstractFilter::Pointer importASCIIData = PrepFilter(data);
+      DREAM3D_REQUIRE_VALID_POINTER(importASCIIData.get())
+
+      importASCIIData->execute();
+      int err = importASCIIData->getErrorCondition();
+      DREAM3D_REQUIRE_EQUAL(err, 0)
+
+      AttributeMatrix::Pointer am = importASCIIData->getDataContainerArray()->getAttributeMatrix(DataArrayPath(DataContainerName, AttributeMatrixName, ""));
+      Int32ArrayType::Pointer ints = std::dynamic_pointer_cast<Int32ArrayType>(am->getAttributeArray("Ints"));
+      DoubleArrayType::Pointer floats = std::dynamic_pointer_cast<DoubleArrayType>(am->getAttributeArray("Floats"));
+      StringDataArray::Pointer strings = std::dynamic_pointer_cast<StringDataArray>(am->getAttributeArray("Strings"));
+      DREAM3D_REQUIRE_VALID_POINTER(ints.get())
+      DREAM3D_REQUIRE_VALID_POINTER(floats.get())
+      DREAM3D_REQUIRE_VALID_POINTER(strings.get())
+
+      for(int i = 0; i < numTuples; i++)
+      {
+        DREAM3D_REQUIRE_EQUAL(ints->getValue(i), i - 100)
+        DREAM3D_REQUIRE_EQUAL(floats->getValue(i), QString::number(i * 0.25 - 3.5e-3).toDouble())
+        DREAM3D_REQUIRE_EQUAL(strings->getValue(i), QString("name_%1").arg(i))
+      }
+    }
+
+    // A line with a missing column
+    {
+      QStringList badLines = lines;
+      badLines[4001] = "17, 2.5";
+      WriteLines(UnitTest::ReadASCIIDataTest::TestFile1, badLines, "\n");
+
+      AbstractFilter::Pointer importASCIIData = PrepFilter(data);
+      DREAM3D_REQUIRE_VALID_POINTER(importASCIIData.get())
+
+      importASCIIData->execute();
+      int err = importASCIIData->getErrorCondition();
+      DREAM3D_REQUIRE_EQUAL(err, ReadASCIIData::INCONSISTENT_COLS)
+    }
+
+    // A value that can not be converted
+    {
+      QStringList badLines = lines;
+      badLines[2500] = "17, 2.5x, name";
+      WriteLines(UnitTest::ReadASCIIDataTest::TestFile1, badLines, "\n");
+
+      AbstractFilter::Pointer importASCIIData = PrepFilter(data);
+      DREAM3D_REQUIRE_VALID_POINTER(importASCIIData.get())
+
+      importASCIIData->execute();
+      int err = importASCIIData->getErrorCondition();
+      DREAM3D_REQUIRE_EQUAL(err, ReadASCIIData::CONVERSION_FAILURE)
+    }
+
+    // The file ends before the expected number of lines
+    {
+      QStringList shortLines = lines.mid(0, numTuples - 10);
+      WriteLines(UnitTest::ReadASCIIDataTest::TestFile1, shortLines, "\n");
+
+      AbstractFilter::Pointer importASCIIData = PrepFilter(data);
+      DREAM3D_REQUIRE_VALID_POINTER(importASCIIData.get())
+
+      importASCIIData->execute();
+      int err = importASCIIData->getErrorCondition();
+      DREAM3D_REQUIRE_EQUAL(err, ReadASCIIData::INCONSISTENT_COLS)
+    }
+
+    RemoveTestFiles();
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestLargeFileWithStrings()
+  {
+    // Several MB, so the file is split into many chunks
+    const int numTuples = 300000;
+
+    ASCIIWizardData data;
+    data.automaticAM = false;
+    data.beginIndex = 1;
+    data.consecutiveDelimiters = false;
+    data.dataHeaders << "Ints" << "Strings" << "Floats";
+    data.dataTypes << SIMPL::TypeNames::Int32 << SIMPL::TypeNames::String << SIMPL::TypeNames::Float;
+    data.delimiters << ',';
+    data.inputFilePath = UnitTest::ReadASCIIDataTest::TestFile1;
+    data.numberOfLines = numTuples;
+    data.selectedPath = DataArrayPath(DataContainerName, AttributeMatrixName, "");
+    data.tupleDims = QVector<size_t>(1, numTuples);
+
+    QStringList lines;
+    for(int i = 0; i < numTuples; i++)
+    {
+      lines << QString("%1,grain_name_%2_of_the_large_file,%3").arg(i).arg(i * 7).arg(i % 1000);
+    }
+    WriteLines(UnitTest::ReadASCIIDataTest::TestFile1, lines, "\n");
+    DREAM3D_REQUIRE(QFileInfo(UnitTest::ReadASCIIDataTest::TestFile1).size() > 4 * 1024 * 1024)
+
+    AbstractFilter::Pointer importASCIIData = PrepFilter(data);
+    DREAM3D_REQUIRE_VALID_POINTER(importASCIIData.get())
+
+    importASCIIData->execute();
+    int err = importASCIIData->getErrorCondition();
+    DREAM3D_REQUIRE_EQUAL(err, 0)
+
+    AttributeMatrix::Pointer am = importASCIIData->getDataContainerArray()->getAttributeMatrix(DataArrayPath(DataContainerName, AttributeMatrixName, ""));
+    Int32ArrayType::Pointer ints = std::dynamic_pointer_cast<Int32ArrayType>(am->getAttributeArray("Ints"));
+    StringDataArray::Pointer strings = std::dynamic_pointer_cast<StringDataArray>(am->getAttributeArray("Strings"));
+    FloatArrayType::Pointer floats = std::dynamic_pointer_cast<FloatArrayType>(am->getAttributeArray("Floats"));
+    DREAM3D_REQUIRE_VALID_POINTER(ints.get())
+    DREAM3D_REQUIRE_VALID_POINTER(strings.get())
+    DREAM3D_REQUIRE_VALID_POINTER(floats.get())
+
+    for(int i = 0; i < numTuples; i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(ints->getValue(i), i)
+      DREAM3D_REQUIRE_EQUAL(strings->getValue(i), QString("grain_name_%1_of_the_large_file").arg(i * 7))
+      DREAM3D_REQUIRE_EQUAL(floats->getValue(i), static_cast<float>(i % 1000))
+    }
+
+    RemoveTestFiles();
+  }
+
   // -----------------------------------------------------------------------------
   //
   // -----------------------------------------------------------------------------
@@ -426,6 +597,9 @@ public:
     ConvertType<float>();
     ConvertType<double>();
 
+    TestMultipleColumns();
+    TestLargeFileWithStrings();
+
     return EXIT_SUCCESS;
   }
 
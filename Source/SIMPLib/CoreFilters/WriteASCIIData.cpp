@@ -280,6 +280,24 @@ void WriteASCIIData::preflight()
   setInPreflight(false);
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool WriteASCIIData::getSupportsConcurrentExecution()
+{
+  // Only writes the selected arrays to files
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QStringList WriteASCIIData::getOutputFiles()
+{
+  // Every selected array is written to its own file inside the output directory
+  return QStringList() << getOutputPath();
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -164,6 +164,34 @@ void WriteTriangleGeometry::preflight()
   setInPreflight(false);
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool WriteTriangleGeometry::getSupportsConcurrentExecution()
+{
+  // Only writes the selected geometry to files
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QStringList WriteTriangleGeometry::getOutputFiles()
+{
+  return QStringList() << getOutputNodesFile() << getOutputTrianglesFile();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QVector<DataArrayPath> WriteTriangleGeometry::getInputPaths()
+{
+  // The data container is selected by name rather than by a DataArrayPath property
+  QVector<DataArrayPath> inputPaths;
+  inputPaths.push_back(DataArrayPath(getDataContainerSelection(), "", ""));
+  return inputPaths;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
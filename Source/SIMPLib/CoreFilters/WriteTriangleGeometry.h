@@ -142,6 +142,21 @@ class SIMPLib_EXPORT WriteTriangleGeometry : public AbstractFilter
     */
     void preflight() override;
 
+    /**
+     * @brief getSupportsConcurrentExecution Reimplemented from @see AbstractFilter class
+     */
+    bool getSupportsConcurrentExecution() override;
+
+    /**
+     * @brief getOutputFiles Reimplemented from @see AbstractFilter class
+     */
+    QStringList getOutputFiles() override;
+
+    /**
+     * @brief getInputPaths Reimplemented from @see AbstractFilter class
+     */
+    QVector<DataArrayPath> getInputPaths() override;
+
   signals:
     /**
      * @brief updateFilterParameters Emitted when the Filter requests all the latest Filter parameters
@@ -29,6 +29,9 @@
  * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 #pragma once
 
+#include <type_traits>
+#include <utility>
+
 #include <QtCore/QString>
 
 #include "SIMPLib/Common/SIMPLibSetGetMacros.h"
@@ -66,6 +69,15 @@ public:
 
   virtual ParserFunctor::ErrorObject parse(const QString& token, size_t index) = 0;
 
+  /**
+   * @brief parse Parses the token held in the byte range [begin, end), which is expected to be UTF-8 encoded.
+   * Subclasses may override this to avoid building a QString for every token.
+   */
+  virtual ParserFunctor::ErrorObject parse(const char* begin, const char* end, size_t index)
+  {
+    return parse(QString::fromUtf8(begin, static_cast<int>(end - begin)), index);
+  }
+
 protected:
   AbstractDataParser() :
   m_ColumnIndex(0)
@@ -86,6 +98,7 @@ template <typename ArrayType, class F> class Parser : public AbstractDataParser
 {
 public:
   typedef Parser<ArrayType, F> SelfType;
+  using ValueType = typename std::decay<decltype(std::declval<F>()(std::declval<const QString&>(), std::declval<ParserFunctor::ErrorObject&>()))>::type;
 
   SIMPL_SHARED_POINTERS(SelfType)
   SIMPL_TYPE_MACRO(SelfType)
@@ -122,6 +135,19 @@ public:
     return obj;
   }
 
+  ParserFunctor::ErrorObject parse(const char* begin, const char* end, size_t index) override
+  {
+    ValueType value;
+    if(FastParsers::Parse(begin, end, value))
+    {
+      ParserFunctor::ErrorObject obj;
+      obj.ok = true;
+      (*m_Ptr).setValue(index, value);
+      return obj;
+    }
+    return parse(QString::fromUtf8(begin, static_cast<int>(end - begin)), index);
+  }
+
 protected:
   Parser(typename ArrayType::Pointer ptr, const QString& name, int index)
   {
@@ -81,17 +81,18 @@ class SIMPLib_EXPORT BinaryOperator : public CalculatorOperator
       newArray = DoubleArrayType::CreateArray(array2->getArray()->getNumberOfTuples(), array2->getArray()->getComponentDimensions(), calculatedArrayPath.getDataArrayName());                          \
     }                                                                                                                                                                                                  \
                                                                                                                                                                                                        \
-    int numComps = newArray->getNumberOfComponents();                                                                                                                                                  \
-    for(int i = 0; i < newArray->getNumberOfTuples(); i++)                                                                                                                                             \
-    {                                                                                                                                                                                                  \
-      for(int c = 0; c < newArray->getNumberOfComponents(); c++)                                                                                                                                       \
+    /* Both operands must be converted before their values are read from several threads */                                                                                                            \
+    array1->getArray();                                                                                                                                                                                \
+    array2->getArray();                                                                                                                                                                                \
+    size_t numValues = newArray->getSize();                                                                                                                                                            \
+    CalculatorParallel::ForEachRange(numValues, [&](size_t start, size_t end) {                                                                                                                        \
+      for(size_t index = start; index < end; index++)                                                                                                                                                  \
       {                                                                                                                                                                                                \
-        int index = numComps * i + c;                                                                                                                                                                  \
         double num1 = array1->getValue(index);                                                                                                                                                         \
         double num2 = array2->getValue(index);                                                                                                                                                         \
         newArray->setValue(index, num2 op num1);                                                                                                                                                       \
       }                                                                                                                                                                                                \
-    }                                                                                                                                                                                                  \
+    });                                                                                                                                                                                                \
                                                                                                                                                                                                        \
     if(array1->getType() == ICalculatorArray::Array || array2->getType() == ICalculatorArray::Array)                                                                                                   \
     {                                                                                                                                                                                                  \
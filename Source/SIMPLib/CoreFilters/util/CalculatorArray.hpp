@@ -40,6 +40,7 @@
 #include "SIMPLib/DataArrays/DataArray.hpp"
 #include "SIMPLib/SIMPLib.h"
 
+#include "CalculatorParallel.hpp"
 #include "ICalculatorArray.h"
 
 template <typename T>
@@ -50,20 +51,31 @@ class SIMPLib_EXPORT CalculatorArray : public ICalculatorArray
 
     static Pointer New(typename DataArray<T>::Pointer dataArray, ValueType type, bool allocate)
     {
-      return Pointer(new CalculatorArray(dataArray, type, allocate));
+      return Pointer(new CalculatorArray(dataArray, type, allocate, -1));
+    }
+
+    static Pointer New(typename DataArray<T>::Pointer dataArray, ValueType type, bool allocate, int component)
+    {
+      return Pointer(new CalculatorArray(dataArray, type, allocate, component));
     }
 
     ~CalculatorArray() override = default;
 
-    IDataArray::Pointer getArray() override { return m_Array; }
+    IDataArray::Pointer getArray() override
+    {
+      convertSourceArray();
+      return m_Array;
+    }
 
-    void setValue(int i, double val) override
+    void setValue(size_t i, double val) override
     {
+      convertSourceArray();
       m_Array->setValue(i, val);
     }
 
-    double getValue(int i) override
+    double getValue(size_t i) override
     {
+      convertSourceArray();
       if (m_Array->getNumberOfTuples() > 1)
       {
         return static_cast<double>(m_Array->getValue(i));
@@ -86,6 +98,7 @@ class SIMPLib_EXPORT CalculatorArray : public ICalculatorArray
 
     DoubleArrayType::Pointer reduceToOneComponent(int c, bool allocate = true) override
     {
+      convertSourceArray();
       if(c >= 0 && c <= m_Array->getNumberOfComponents())
       {
         if(m_Array->getNumberOfComponents() > 1)
@@ -93,10 +106,12 @@ class SIMPLib_EXPORT CalculatorArray : public ICalculatorArray
           DoubleArrayType::Pointer newArray = DoubleArrayType::CreateArray(m_Array->getNumberOfTuples(), QVector<size_t>(1, 1), m_Array->getName(), allocate);
           if(allocate)
           {
-            for(int i = 0; i < m_Array->getNumberOfTuples(); i++)
-            {
-              newArray->setComponent(i, 0, m_Array->getComponent(i, c));
-            }
+            CalculatorParallel::ForEachRange(m_Array->getNumberOfTuples(), [this, newArray, c](size_t start, size_t end) {
+              for(size_t i = start; i < end; i++)
+              {
+                newArray->setComponent(i, 0, m_Array->getComponent(i, c));
+              }
+            });
           }
 
           return newArray;
@@ -106,6 +121,40 @@ class SIMPLib_EXPORT CalculatorArray : public ICalculatorArray
       return DoubleArrayType::NullPointer();
     }
 
+    size_t getNumberOfTuples() override
+    {
+      return m_SourceArray->getNumberOfTuples();
+    }
+
+    QVector<size_t> getComponentDimensions() override
+    {
+      if(m_Component >= 0)
+      {
+        return QVector<size_t>(1, 1);
+      }
+      return m_SourceArray->getComponentDimensions();
+    }
+
+    IDataArray::Pointer getSourceArray() override
+    {
+      return m_SourceArray;
+    }
+
+    int getSourceComponent() override
+    {
+      return m_Component;
+    }
+
+    ICalculatorArray::Pointer selectComponent(int c, bool allocate = true) override
+    {
+      if(c < 0 || c >= m_SourceArray->getNumberOfComponents() || m_Component >= 0)
+      {
+        return ICalculatorArray::NullPointer();
+      }
+
+      return CalculatorArray<T>::New(m_SourceArray, m_Type, allocate, c);
+    }
+
     CalculatorItem::ErrorCode checkValidity(QVector<CalculatorItem::Pointer> infixVector, int currentIndex, QString& msg) override
     {
       Q_UNUSED(infixVector)
@@ -117,25 +166,62 @@ class SIMPLib_EXPORT CalculatorArray : public ICalculatorArray
   protected:
     CalculatorArray() = default;
 
-    CalculatorArray(typename DataArray<T>::Pointer dataArray, ValueType type, bool allocate) :
+    CalculatorArray(typename DataArray<T>::Pointer dataArray, ValueType type, bool allocate, int component) :
       ICalculatorArray(),
-      m_Type(type)
+      m_SourceArray(dataArray),
+      m_Type(type),
+      m_Component(component),
+      m_Allocate(allocate)
+    {
+    }
+
+    /**
+     * @brief Converts the source array (or the selected component of it) into the double
+     * array used by the interpreted operators.  The conversion is deferred until the values
+     * are requested so that the compiled evaluation path can read the source array directly.
+     */
+    void convertSourceArray()
     {
-      m_Array = DoubleArrayType::CreateArray(dataArray->getNumberOfTuples(), dataArray->getComponentDimensions(), dataArray->getName(), allocate);
-      if (allocate == true)
+      if(nullptr != m_Array)
       {
-        for (int i = 0; i < dataArray->getSize(); i++)
-        {
-          m_Array->setValue(i, static_cast<double>(dataArray->getValue(i)));
-        }
+        return;
+      }
+
+      size_t numTuples = m_SourceArray->getNumberOfTuples();
+      m_Array = DoubleArrayType::CreateArray(numTuples, getComponentDimensions(), m_SourceArray->getName(), m_Allocate);
+      if(!m_Allocate)
+      {
+        return;
+      }
+
+      if(m_Component >= 0)
+      {
+        CalculatorParallel::ForEachRange(numTuples, [this](size_t start, size_t end) {
+          for(size_t i = start; i < end; i++)
+          {
+            m_Array->setValue(i, static_cast<double>(m_SourceArray->getComponent(i, m_Component)));
+          }
+        });
+      }
+      else
+      {
+        size_t numValues = m_SourceArray->getSize();
+        CalculatorParallel::ForEachRange(numValues, [this](size_t start, size_t end) {
+          for(size_t i = start; i < end; i++)
+          {
+            m_Array->setValue(i, static_cast<double>(m_SourceArray->getValue(i)));
+          }
+        });
       }
     }
 
   private:
+    typename DataArray<T>::Pointer                            m_SourceArray;
     DoubleArrayType::Pointer                                  m_Array;
     ValueType                                                 m_Type;
+    int                                                       m_Component = -1;
+    bool                                                      m_Allocate = true;
 
     CalculatorArray(const CalculatorArray&); // Copy Constructor Not Implemented
     void operator=(const CalculatorArray&);  // Move assignment Not Implemented
 };
-
@@ -42,6 +42,7 @@
 #include "SIMPLib/SIMPLib.h"
 
 #include "CalculatorArray.hpp"
+#include "CalculatorParallel.hpp"
 #include "SIMPLib/DataArrays/IDataArray.h"
 #include "SIMPLib/DataContainers/DataArrayPath.h"
 #include "SIMPLib/Filtering/AbstractFilter.h"
@@ -117,17 +118,18 @@ class SIMPLib_EXPORT CalculatorOperator : public CalculatorItem
       newArray = DoubleArrayType::CreateArray(array2->getArray()->getNumberOfTuples(), array2->getArray()->getComponentDimensions(), calculatedArrayPath.getDataArrayName());                          \
     }                                                                                                                                                                                                  \
                                                                                                                                                                                                        \
-    int numComps = newArray->getNumberOfComponents();                                                                                                                                                  \
-    for(int i = 0; i < static_cast<int>(newArray->getNumberOfTuples()); i++)                                                                                                                           \
-    {                                                                                                                                                                                                  \
-      for(int c = 0; c < newArray->getNumberOfComponents(); c++)                                                                                                                                       \
+    /* Both operands must be converted before their values are read from several threads */                                                                                                            \
+    array1->getArray();                                                                                                                                                                                \
+    array2->getArray();                                                                                                                                                                                \
+    size_t numValues = newArray->getSize();                                                                                                                                                            \
+    CalculatorParallel::ForEachRange(numValues, [&](size_t start, size_t end) {                                                                                                                        \
+      for(size_t index = start; index < end; index++)                                                                                                                                                  \
       {                                                                                                                                                                                                \
-        int index = numComps * i + c;                                                                                                                                                                  \
         double num1 = array1->getValue(index);                                                                                                                                                         \
         double num2 = array2->getValue(index);                                                                                                                                                         \
         newArray->setValue(index, func(num2, num1));                                                                                                                                                   \
       }                                                                                                                                                                                                \
-    }                                                                                                                                                                                                  \
+    });                                                                                                                                                                                                \
                                                                                                                                                                                                        \
     if(array1->getType() == ICalculatorArray::Array || array2->getType() == ICalculatorArray::Array)                                                                                                   \
     {                                                                                                                                                                                                  \
@@ -0,0 +1,82 @@
+/* ============================================================================
+* Copyright (c) 2009-2015 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-07-D-5800
+*    United States Air Force Prime Contract FA8650-10-D-5210
+*    United States Prime Contract Navy N00173-07-C-2068
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+
+#pragma once
+
+#include "SIMPLib/SIMPLib.h"
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#include <tbb/partitioner.h>
+#endif
+
+namespace CalculatorParallel
+{
+/**
+ * @brief The default number of values handed to a single task by the interpreted operators
+ */
+const size_t k_GrainSize = 16384;
+
+/**
+ * @brief Calls func(start, end) over disjoint sub-ranges that together cover [0, count). When parallel
+ * algorithms are enabled the sub-ranges are scheduled on the current TBB task arena, so the number of
+ * threads is limited by the arena the ArrayCalculator executes in. Each value is computed by the same
+ * code as in a serial loop, so the results do not depend on the number of threads.
+ * @param count Number of items in the range
+ * @param grainSize Minimum number of items handed to a single task
+ * @param func Callable taking (size_t start, size_t end)
+ */
+template <typename Func> void ForEachRange(size_t count, size_t grainSize, const Func& func)
+{
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  if(count > grainSize)
+  {
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, count, grainSize), [&func](const tbb::blocked_range<size_t>& r) { func(r.begin(), r.end()); }, tbb::auto_partitioner());
+    return;
+  }
+#endif
+  func(0, count);
+}
+
+/**
+ * @brief Convenience overload that uses the default grain size
+ */
+template <typename Func> void ForEachRange(size_t count, const Func& func)
+{
+  ForEachRange(count, k_GrainSize, func);
+}
+}
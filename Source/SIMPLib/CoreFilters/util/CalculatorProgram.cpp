@@ -0,0 +1,880 @@
+/* ============================================================================
+* Copyright (c) 2009-2015 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-07-D-5800
+*    United States Air Force Prime Contract FA8650-10-D-5210
+*    United States Prime Contract Navy N00173-07-C-2068
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "CalculatorProgram.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "SIMPLib/Common/TemplateHelpers.h"
+#include "SIMPLib/Math/SIMPLibMath.h"
+
+#include "ABSOperator.h"
+#include "ACosOperator.h"
+#include "ASinOperator.h"
+#include "ATanOperator.h"
+#include "AdditionOperator.h"
+#include "CeilOperator.h"
+#include "CosOperator.h"
+#include "DivisionOperator.h"
+#include "ExpOperator.h"
+#include "FloorOperator.h"
+#include "LnOperator.h"
+#include "Log10Operator.h"
+#include "LogOperator.h"
+#include "MultiplicationOperator.h"
+#include "NegativeOperator.h"
+#include "PowOperator.h"
+#include "RootOperator.h"
+#include "SinOperator.h"
+#include "SqrtOperator.h"
+#include "SubtractionOperator.h"
+#include "TanOperator.h"
+
+namespace
+{
+/* The scalar functions below must produce exactly the same values as the interpreted
+ * operators (see CREATE_NEW_ARRAY_STANDARD_BINARY and friends) so that both evaluation
+ * modes are interchangeable. The left hand value is the deeper item on the RPN stack. */
+struct AddFunctor
+{
+  static double apply(double lhs, double rhs)
+  {
+    return lhs + rhs;
+  }
+};
+
+struct SubtractFunctor
+{
+  static double apply(double lhs, double rhs)
+  {
+    return lhs - rhs;
+  }
+};
+
+struct MultiplyFunctor
+{
+  static double apply(double lhs, double rhs)
+  {
+    return lhs * rhs;
+  }
+};
+
+struct DivideFunctor
+{
+  static double apply(double lhs, double rhs)
+  {
+    return lhs / rhs;
+  }
+};
+
+struct PowFunctor
+{
+  static double apply(double lhs, double rhs)
+  {
+    return pow(lhs, rhs);
+  }
+};
+
+struct RootFunctor
+{
+  static double apply(double lhs, double rhs)
+  {
+    if(rhs == 0)
+    {
+      return std::numeric_limits<double>::infinity();
+    }
+    return pow(lhs, 1 / rhs);
+  }
+};
+
+struct LogFunctor
+{
+  static double apply(double lhs, double rhs)
+  {
+    return log(rhs) / log(lhs);
+  }
+};
+
+struct NegateFunctor
+{
+  static double apply(double value)
+  {
+    return -1 * value;
+  }
+};
+
+#define CALCULATOR_UNARY_FUNCTOR(name, func)                                                                                                                                                           \
+  struct name                                                                                                                                                                                          \
+  {                                                                                                                                                                                                    \
+    static double apply(double value)                                                                                                                                                                  \
+    {                                                                                                                                                                                                  \
+      return func(value);                                                                                                                                                                              \
+    }                                                                                                                                                                                                  \
+  };
+
+CALCULATOR_UNARY_FUNCTOR(AbsFunctor, fabs)
+CALCULATOR_UNARY_FUNCTOR(SqrtFunctor, sqrt)
+CALCULATOR_UNARY_FUNCTOR(ExpFunctor, exp)
+CALCULATOR_UNARY_FUNCTOR(LnFunctor, log)
+CALCULATOR_UNARY_FUNCTOR(Log10Functor, log10)
+CALCULATOR_UNARY_FUNCTOR(FloorFunctor, floor)
+CALCULATOR_UNARY_FUNCTOR(CeilFunctor, ceil)
+CALCULATOR_UNARY_FUNCTOR(SinFunctor, sin)
+CALCULATOR_UNARY_FUNCTOR(CosFunctor, cos)
+CALCULATOR_UNARY_FUNCTOR(TanFunctor, tan)
+CALCULATOR_UNARY_FUNCTOR(ASinFunctor, asin)
+CALCULATOR_UNARY_FUNCTOR(ACosFunctor, acos)
+CALCULATOR_UNARY_FUNCTOR(ATanFunctor, atan)
+CALCULATOR_UNARY_FUNCTOR(ToRadiansFunctor, CalculatorOperator::toRadians)
+CALCULATOR_UNARY_FUNCTOR(ToDegreesFunctor, CalculatorOperator::toDegrees)
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+template <typename Functor> void unaryKernel(const double* src, double* dst, size_t count)
+{
+  for(size_t k = 0; k < count; k++)
+  {
+    dst[k] = Functor::apply(src[k]);
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+template <typename Functor> void binaryKernel(const double* lhs, const double* rhs, double* dst, size_t count)
+{
+  for(size_t k = 0; k < count; k++)
+  {
+    dst[k] = Functor::apply(lhs[k], rhs[k]);
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+double applyScalar(CalculatorProgram::OpCode op, double lhs, double rhs)
+{
+  using OpCode = CalculatorProgram::OpCode;
+  switch(op)
+  {
+  case OpCode::Add:
+    return AddFunctor::apply(lhs, rhs);
+  case OpCode::Subtract:
+    return SubtractFunctor::apply(lhs, rhs);
+  case OpCode::Multiply:
+    return MultiplyFunctor::apply(lhs, rhs);
+  case OpCode::Divide:
+    return DivideFunctor::apply(lhs, rhs);
+  case OpCode::Pow:
+    return PowFunctor::apply(lhs, rhs);
+  case OpCode::Root:
+    return RootFunctor::apply(lhs, rhs);
+  case OpCode::Log:
+    return LogFunctor::apply(lhs, rhs);
+  case OpCode::Negate:
+    return NegateFunctor::apply(lhs);
+  case OpCode::Abs:
+    return AbsFunctor::apply(lhs);
+  case OpCode::Sqrt:
+    return SqrtFunctor::apply(lhs);
+  case OpCode::Exp:
+    return ExpFunctor::apply(lhs);
+  case OpCode::Ln:
+    return LnFunctor::apply(lhs);
+  case OpCode::Log10:
+    return Log10Functor::apply(lhs);
+  case OpCode::Floor:
+    return FloorFunctor::apply(lhs);
+  case OpCode::Ceil:
+    return CeilFunctor::apply(lhs);
+  case OpCode::Sin:
+    return SinFunctor::apply(lhs);
+  case OpCode::Cos:
+    return CosFunctor::apply(lhs);
+  case OpCode::Tan:
+    return TanFunctor::apply(lhs);
+  case OpCode::ASin:
+    return ASinFunctor::apply(lhs);
+  case OpCode::ACos:
+    return ACosFunctor::apply(lhs);
+  case OpCode::ATan:
+    return ATanFunctor::apply(lhs);
+  case OpCode::ToRadians:
+    return ToRadiansFunctor::apply(lhs);
+  case OpCode::ToDegrees:
+    return ToDegreesFunctor::apply(lhs);
+  default:
+    break;
+  }
+  return 0.0;
+}
+
+/**
+ * @brief The CalculatorLeaf class reads a natively typed input array (or one component of it)
+ * into a tile of doubles
+ */
+template <typename T> class CalculatorLeaf : public CalculatorProgram::ILeaf
+{
+public:
+  CalculatorLeaf(typename DataArray<T>::Pointer array, int component)
+  : m_Array(array)
+  , m_Data(array->getConstPointer(0))
+  , m_Stride(1)
+  , m_Offset(0)
+  , m_NumValues(array->getSize())
+  {
+    if(component >= 0)
+    {
+      m_Stride = static_cast<size_t>(array->getNumberOfComponents());
+      m_Offset = static_cast<size_t>(component);
+      m_NumValues = array->getNumberOfTuples();
+    }
+  }
+  ~CalculatorLeaf() override = default;
+
+  void load(size_t start, size_t count, double* tile) const override
+  {
+    const T* src = m_Data + start * m_Stride + m_Offset;
+    if(m_Stride == 1)
+    {
+      for(size_t k = 0; k < count; k++)
+      {
+        tile[k] = static_cast<double>(src[k]);
+      }
+    }
+    else
+    {
+      for(size_t k = 0; k < count; k++)
+      {
+        tile[k] = static_cast<double>(src[k * m_Stride]);
+      }
+    }
+  }
+
+  size_t getNumberOfValues() const override
+  {
+    return m_NumValues;
+  }
+
+private:
+  typename DataArray<T>::Pointer m_Array;
+  const T* m_Data;
+  size_t m_Stride;
+  size_t m_Offset;
+  size_t m_NumValues;
+};
+
+/**
+ * @brief The StackEntry struct describes one item on the RPN stack while the program is being lowered
+ */
+struct StackEntry
+{
+  bool constant = false;
+  double value = 0.0;
+  size_t numTuples = 0;
+  QVector<size_t> cDims;
+  ICalculatorArray::ValueType type = ICalculatorArray::Unknown;
+};
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+template <typename T> bool createLeaf(const ICalculatorArray::Pointer& item, std::shared_ptr<CalculatorProgram::ILeaf>& leaf, StackEntry& entry)
+{
+  typename DataArray<T>::Pointer array = std::dynamic_pointer_cast<DataArray<T>>(item->getSourceArray());
+  if(nullptr == array)
+  {
+    return false;
+  }
+
+  int component = item->getSourceComponent();
+  if(array->getNumberOfTuples() <= 1)
+  {
+    // Single tuple items are broadcast to every value, just like ICalculatorArray::getValue
+    entry.constant = true;
+    entry.value = 0.0;
+    if(array->getNumberOfTuples() == 1)
+    {
+      entry.value = static_cast<double>(array->getValue(component >= 0 ? component : 0));
+    }
+    return true;
+  }
+
+  leaf = std::shared_ptr<CalculatorProgram::ILeaf>(new CalculatorLeaf<T>(array, component));
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool createLeaf(const ICalculatorArray::Pointer& item, std::shared_ptr<CalculatorProgram::ILeaf>& leaf, StackEntry& entry)
+{
+  return createLeaf<float>(item, leaf, entry) || createLeaf<double>(item, leaf, entry) || createLeaf<int8_t>(item, leaf, entry) || createLeaf<uint8_t>(item, leaf, entry) ||
+         createLeaf<int16_t>(item, leaf, entry) || createLeaf<uint16_t>(item, leaf, entry) || createLeaf<int32_t>(item, leaf, entry) || createLeaf<uint32_t>(item, leaf, entry) ||
+         createLeaf<int64_t>(item, leaf, entry) || createLeaf<uint64_t>(item, leaf, entry) || createLeaf<bool>(item, leaf, entry);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+template <typename OperatorType> bool isOperator(const CalculatorItem::Pointer& item)
+{
+  return (nullptr != std::dynamic_pointer_cast<OperatorType>(item));
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool getOpCode(const CalculatorItem::Pointer& item, CalculatorProgram::OpCode& op, int& numArguments)
+{
+  using OpCode = CalculatorProgram::OpCode;
+
+  numArguments = 2;
+  if(isOperator<AdditionOperator>(item))
+  {
+    op = OpCode::Add;
+  }
+  else if(isOperator<SubtractionOperator>(item))
+  {
+    op = OpCode::Subtract;
+  }
+  else if(isOperator<MultiplicationOperator>(item))
+  {
+    op = OpCode::Multiply;
+  }
+  else if(isOperator<DivisionOperator>(item))
+  {
+    op = OpCode::Divide;
+  }
+  else if(isOperator<PowOperator>(item))
+  {
+    op = OpCode::Pow;
+  }
+  else if(isOperator<RootOperator>(item))
+  {
+    op = OpCode::Root;
+  }
+  else if(isOperator<LogOperator>(item))
+  {
+    op = OpCode::Log;
+  }
+  else
+  {
+    numArguments = 1;
+    if(isOperator<NegativeOperator>(item))
+    {
+      op = OpCode::Negate;
+    }
+    else if(isOperator<ABSOperator>(item))
+    {
+      op = OpCode::Abs;
+    }
+    else if(isOperator<SqrtOperator>(item))
+    {
+      op = OpCode::Sqrt;
+    }
+    else if(isOperator<ExpOperator>(item))
+    {
+      op = OpCode::Exp;
+    }
+    else if(isOperator<LnOperator>(item))
+    {
+      op = OpCode::Ln;
+    }
+    else if(isOperator<Log10Operator>(item))
+    {
+      op = OpCode::Log10;
+    }
+    else if(isOperator<FloorOperator>(item))
+    {
+      op = OpCode::Floor;
+    }
+    else if(isOperator<CeilOperator>(item))
+    {
+      op = OpCode::Ceil;
+    }
+    else if(isOperator<SinOperator>(item))
+    {
+      op = OpCode::Sin;
+    }
+    else if(isOperator<CosOperator>(item))
+    {
+      op = OpCode::Cos;
+    }
+    else if(isOperator<TanOperator>(item))
+    {
+      op = OpCode::Tan;
+    }
+    else if(isOperator<ASinOperator>(item))
+    {
+      op = OpCode::ASin;
+    }
+    else if(isOperator<ACosOperator>(item))
+    {
+      op = OpCode::ACos;
+    }
+    else if(isOperator<ATanOperator>(item))
+    {
+      op = OpCode::ATan;
+    }
+    else
+    {
+      return false;
+    }
+  }
+
+  return true;
+}
+} // namespace
+
+const size_t CalculatorProgram::k_TileSize;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+CalculatorProgram::CalculatorProgram() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+CalculatorProgram::~CalculatorProgram() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+CalculatorProgram::Pointer CalculatorProgram::Compile(const QVector<CalculatorItem::Pointer>& rpn, bool useDegrees, QString& errMsg)
+{
+  CalculatorProgram::Pointer program = CalculatorProgram::Pointer(new CalculatorProgram());
+  std::vector<StackEntry> stack;
+
+  // Loads a constant stack entry into its register before it is used by a non-constant operation
+  auto materialize = [&program, &stack](size_t index) {
+    StackEntry& entry = stack[index];
+    if(entry.constant)
+    {
+      Instruction instr = {OpCode::Fill, static_cast<int>(index), -1, -1, -1, entry.value};
+      program->m_Instructions.push_back(instr);
+      entry.constant = false;
+    }
+  };
+
+  auto emitUnary = [&program](OpCode op, size_t index) {
+    Instruction instr = {op, static_cast<int>(index), static_cast<int>(index), -1, -1, 0.0};
+    program->m_Instructions.push_back(instr);
+  };
+
+  for(const CalculatorItem::Pointer& item : rpn)
+  {
+    ICalculatorArray::Pointer calcArray = std::dynamic_pointer_cast<ICalculatorArray>(item);
+    if(nullptr != calcArray)
+    {
+      StackEntry entry;
+      entry.numTuples = calcArray->getNumberOfTuples();
+      entry.cDims = calcArray->getComponentDimensions();
+      entry.type = calcArray->getType();
+
+      std::shared_ptr<ILeaf> leaf;
+      if(!createLeaf(calcArray, leaf, entry))
+      {
+        errMsg = QObject::tr("The array '%1' has a type that is not supported by the compiled evaluation").arg(calcArray->getSourceArray()->getName());
+        return CalculatorProgram::NullPointer();
+      }
+
+      if(nullptr != leaf)
+      {
+        Instruction instr = {OpCode::Load, static_cast<int>(stack.size()), -1, -1, static_cast<int>(program->m_Leaves.size()), 0.0};
+        program->m_Instructions.push_back(instr);
+        program->m_Leaves.push_back(leaf);
+      }
+
+      stack.push_back(entry);
+      program->m_NumRegisters = std::max(program->m_NumRegisters, static_cast<int>(stack.size()));
+      continue;
+    }
+
+    OpCode op = OpCode::Load;
+    int numArguments = 0;
+    if(!getOpCode(item, op, numArguments))
+    {
+      errMsg = QObject::tr("The item '%1' can not be compiled").arg(item->getInfixToken());
+      return CalculatorProgram::NullPointer();
+    }
+
+    if(stack.size() < static_cast<size_t>(numArguments))
+    {
+      errMsg = QObject::tr("The chosen infix equation is not a valid equation.");
+      return CalculatorProgram::NullPointer();
+    }
+
+    if(numArguments == 2)
+    {
+      size_t rhsIndex = stack.size() - 1;
+      size_t lhsIndex = stack.size() - 2;
+      StackEntry rhs = stack[rhsIndex];
+      StackEntry lhs = stack[lhsIndex];
+
+      // The result takes the shape of the right hand item if it is an array, matching the interpreted operators
+      StackEntry result = (rhs.type == ICalculatorArray::Array) ? rhs : lhs;
+      result.type = (rhs.type == ICalculatorArray::Array || lhs.type == ICalculatorArray::Array) ? ICalculatorArray::Array : ICalculatorArray::Number;
+
+      if(lhs.constant && rhs.constant)
+      {
+        result.constant = true;
+        result.value = applyScalar(op, lhs.value, rhs.value);
+      }
+      else
+      {
+        materialize(lhsIndex);
+        materialize(rhsIndex);
+        Instruction instr = {op, static_cast<int>(lhsIndex), static_cast<int>(lhsIndex), static_cast<int>(rhsIndex), -1, 0.0};
+        program->m_Instructions.push_back(instr);
+        result.constant = false;
+      }
+
+      stack.pop_back();
+      stack.back() = result;
+    }
+    else
+    {
+      size_t index = stack.size() - 1;
+      StackEntry& entry = stack[index];
+
+      bool isTrig = (op == OpCode::Sin || op == OpCode::Cos || op == OpCode::Tan);
+      bool isArcTrig = (op == OpCode::ASin || op == OpCode::ACos || op == OpCode::ATan);
+
+      std::vector<OpCode> ops;
+      if(useDegrees && isTrig)
+      {
+        ops.push_back(OpCode::ToRadians);
+      }
+      ops.push_back(op);
+      if(useDegrees && isArcTrig)
+      {
+        ops.push_back(OpCode::ToDegrees);
+      }
+
+      for(OpCode unaryOp : ops)
+      {
+        if(entry.constant)
+        {
+          entry.value = applyScalar(unaryOp, entry.value, 0.0);
+        }
+        else
+        {
+          emitUnary(unaryOp, index);
+        }
+      }
+    }
+  }
+
+  if(stack.size() != 1)
+  {
+    errMsg = QObject::tr("The chosen infix equation is not a valid equation.");
+    return CalculatorProgram::NullPointer();
+  }
+
+  const StackEntry& result = stack.back();
+  program->m_NumTuples = result.numTuples;
+  program->m_ComponentDims = result.cDims;
+  program->m_ResultType = result.type;
+  program->m_ResultIsConstant = result.constant;
+  program->m_ResultValue = result.value;
+  program->m_ResultRegister = 0;
+
+  // Every array that is read must cover the whole result
+  size_t numValues = program->getNumberOfValues();
+  for(const std::shared_ptr<ILeaf>& leaf : program->m_Leaves)
+  {
+    if(leaf->getNumberOfValues() < numValues)
+    {
+      errMsg = QObject::tr("Arrays in the infix expression have an inconsistent number of values");
+      return CalculatorProgram::NullPointer();
+    }
+  }
+
+  return program;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t CalculatorProgram::getNumberOfTuples() const
+{
+  return m_NumTuples;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QVector<size_t> CalculatorProgram::getComponentDimensions() const
+{
+  return m_ComponentDims;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t CalculatorProgram::getNumberOfValues() const
+{
+  size_t numComps = 1;
+  for(size_t dim : m_ComponentDims)
+  {
+    numComps *= dim;
+  }
+  return m_NumTuples * numComps;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ICalculatorArray::ValueType CalculatorProgram::getResultType() const
+{
+  return m_ResultType;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+IDataArray::Pointer CalculatorProgram::createOutputArray(SIMPL::ScalarTypes::Type scalarType, const QString& name, bool allocate) const
+{
+  switch(scalarType)
+  {
+  case SIMPL::ScalarTypes::Type::Int8:
+    return Int8ArrayType::CreateArray(m_NumTuples, m_ComponentDims, name, allocate);
+  case SIMPL::ScalarTypes::Type::UInt8:
+    return UInt8ArrayType::CreateArray(m_NumTuples, m_ComponentDims, name, allocate);
+  case SIMPL::ScalarTypes::Type::Int16:
+    return Int16ArrayType::CreateArray(m_NumTuples, m_ComponentDims, name, allocate);
+  case SIMPL::ScalarTypes::Type::UInt16:
+    return UInt16ArrayType::CreateArray(m_NumTuples, m_ComponentDims, name, allocate);
+  case SIMPL::ScalarTypes::Type::Int32:
+    return Int32ArrayType::CreateArray(m_NumTuples, m_ComponentDims, name, allocate);
+  case SIMPL::ScalarTypes::Type::UInt32:
+    return UInt32ArrayType::CreateArray(m_NumTuples, m_ComponentDims, name, allocate);
+  case SIMPL::ScalarTypes::Type::Int64:
+    return Int64ArrayType::CreateArray(m_NumTuples, m_ComponentDims, name, allocate);
+  case SIMPL::ScalarTypes::Type::UInt64:
+    return UInt64ArrayType::CreateArray(m_NumTuples, m_ComponentDims, name, allocate);
+  case SIMPL::ScalarTypes::Type::Float:
+    return FloatArrayType::CreateArray(m_NumTuples, m_ComponentDims, name, allocate);
+  case SIMPL::ScalarTypes::Type::Double:
+    return DoubleArrayType::CreateArray(m_NumTuples, m_ComponentDims, name, allocate);
+  case SIMPL::ScalarTypes::Type::Bool:
+    return BoolArrayType::CreateArray(m_NumTuples, m_ComponentDims, name, allocate);
+  default:
+    break;
+  }
+
+  return IDataArray::NullPointer();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void CalculatorProgram::evaluate(IDataArray::Pointer outputArray, size_t start, size_t end) const
+{
+  if(nullptr == outputArray || start >= end)
+  {
+    return;
+  }
+
+  if(TemplateHelpers::CanDynamicCast<Int8ArrayType>()(outputArray))
+  {
+    evaluateRange<int8_t>(outputArray, start, end);
+  }
+  else if(TemplateHelpers::CanDynamicCast<UInt8ArrayType>()(outputArray))
+  {
+    evaluateRange<uint8_t>(outputArray, start, end);
+  }
+  else if(TemplateHelpers::CanDynamicCast<Int16ArrayType>()(outputArray))
+  {
+    evaluateRange<int16_t>(outputArray, start, end);
+  }
+  else if(TemplateHelpers::CanDynamicCast<UInt16ArrayType>()(outputArray))
+  {
+    evaluateRange<uint16_t>(outputArray, start, end);
+  }
+  else if(TemplateHelpers::CanDynamicCast<Int32ArrayType>()(outputArray))
+  {
+    evaluateRange<int32_t>(outputArray, start, end);
+  }
+  else if(TemplateHelpers::CanDynamicCast<UInt32ArrayType>()(outputArray))
+  {
+    evaluateRange<uint32_t>(outputArray, start, end);
+  }
+  else if(TemplateHelpers::CanDynamicCast<Int64ArrayType>()(outputArray))
+  {
+    evaluateRange<int64_t>(outputArray, start, end);
+  }
+  else if(TemplateHelpers::CanDynamicCast<UInt64ArrayType>()(outputArray))
+  {
+    evaluateRange<uint64_t>(outputArray, start, end);
+  }
+  else if(TemplateHelpers::CanDynamicCast<FloatArrayType>()(outputArray))
+  {
+    evaluateRange<float>(outputArray, start, end);
+  }
+  else if(TemplateHelpers::CanDynamicCast<DoubleArrayType>()(outputArray))
+  {
+    evaluateRange<double>(outputArray, start, end);
+  }
+  else if(TemplateHelpers::CanDynamicCast<BoolArrayType>()(outputArray))
+  {
+    evaluateRange<bool>(outputArray, start, end);
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+template <typename T> void CalculatorProgram::evaluateRange(IDataArray::Pointer outputArray, size_t start, size_t end) const
+{
+  T* output = std::dynamic_pointer_cast<DataArray<T>>(outputArray)->getPointer(0);
+  if(m_ResultIsConstant)
+  {
+    std::fill(output + start, output + end, static_cast<T>(m_ResultValue));
+    return;
+  }
+
+  std::vector<double> registers(static_cast<size_t>(m_NumRegisters) * k_TileSize);
+  const double* result = registers.data() + static_cast<size_t>(m_ResultRegister) * k_TileSize;
+
+  for(size_t tileStart = start; tileStart < end; tileStart += k_TileSize)
+  {
+    size_t count = std::min(k_TileSize, end - tileStart);
+    for(const Instruction& instr : m_Instructions)
+    {
+      executeInstruction(instr, tileStart, count, registers.data());
+    }
+
+    T* dst = output + tileStart;
+    for(size_t k = 0; k < count; k++)
+    {
+      dst[k] = static_cast<T>(result[k]);
+    }
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void CalculatorProgram::executeInstruction(const Instruction& instr, size_t start, size_t count, double* registers) const
+{
+  double* dst = registers + static_cast<size_t>(instr.dest) * k_TileSize;
+  const double* lhs = (instr.lhs >= 0) ? registers + static_cast<size_t>(instr.lhs) * k_TileSize : nullptr;
+  const double* rhs = (instr.rhs >= 0) ? registers + static_cast<size_t>(instr.rhs) * k_TileSize : nullptr;
+
+  switch(instr.op)
+  {
+  case OpCode::Load:
+    m_Leaves[instr.leaf]->load(start, count, dst);
+    break;
+  case OpCode::Fill:
+    std::fill(dst, dst + count, instr.value);
+    break;
+  case OpCode::Add:
+    binaryKernel<AddFunctor>(lhs, rhs, dst, count);
+    break;
+  case OpCode::Subtract:
+    binaryKernel<SubtractFunctor>(lhs, rhs, dst, count);
+    break;
+  case OpCode::Multiply:
+    binaryKernel<MultiplyFunctor>(lhs, rhs, dst, count);
+    break;
+  case OpCode::Divide:
+    binaryKernel<DivideFunctor>(lhs, rhs, dst, count);
+    break;
+  case OpCode::Pow:
+    binaryKernel<PowFunctor>(lhs, rhs, dst, count);
+    break;
+  case OpCode::Root:
+    binaryKernel<RootFunctor>(lhs, rhs, dst, count);
+    break;
+  case OpCode::Log:
+    binaryKernel<LogFunctor>(lhs, rhs, dst, count);
+    break;
+  case OpCode::Negate:
+    unaryKernel<NegateFunctor>(lhs, dst, count);
+    break;
+  case OpCode::Abs:
+    unaryKernel<AbsFunctor>(lhs, dst, count);
+    break;
+  case OpCode::Sqrt:
+    unaryKernel<SqrtFunctor>(lhs, dst, count);
+    break;
+  case OpCode::Exp:
+    unaryKernel<ExpFunctor>(lhs, dst, count);
+    break;
+  case OpCode::Ln:
+    unaryKernel<LnFunctor>(lhs, dst, count);
+    break;
+  case OpCode::Log10:
+    unaryKernel<Log10Functor>(lhs, dst, count);
+    break;
+  case OpCode::Floor:
+    unaryKernel<FloorFunctor>(lhs, dst, count);
+    break;
+  case OpCode::Ceil:
+    unaryKernel<CeilFunctor>(lhs, dst, count);
+    break;
+  case OpCode::Sin:
+    unaryKernel<SinFunctor>(lhs, dst, count);
+    break;
+  case OpCode::Cos:
+    unaryKernel<CosFunctor>(lhs, dst, count);
+    break;
+  case OpCode::Tan:
+    unaryKernel<TanFunctor>(lhs, dst, count);
+    break;
+  case OpCode::ASin:
+    unaryKernel<ASinFunctor>(lhs, dst, count);
+    break;
+  case OpCode::ACos:
+    unaryKernel<ACosFunctor>(lhs, dst, count);
+    break;
+  case OpCode::ATan:
+    unaryKernel<ATanFunctor>(lhs, dst, count);
+    break;
+  case OpCode::ToRadians:
+    unaryKernel<ToRadiansFunctor>(lhs, dst, count);
+    break;
+  case OpCode::ToDegrees:
+    unaryKernel<ToDegreesFunctor>(lhs, dst, count);
+    break;
+  }
+}
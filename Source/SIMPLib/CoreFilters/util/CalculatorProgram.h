@@ -0,0 +1,190 @@
+/* ============================================================================
+* Copyright (c) 2009-2015 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-07-D-5800
+*    United States Air Force Prime Contract FA8650-10-D-5210
+*    United States Prime Contract Navy N00173-07-C-2068
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include <QtCore/QString>
+#include <QtCore/QVector>
+
+#include "SIMPLib/Common/Constants.h"
+#include "SIMPLib/SIMPLib.h"
+
+#include "ICalculatorArray.h"
+
+/**
+ * @brief The CalculatorProgram class is the compiled form of an ArrayCalculator RPN expression.
+ * The RPN vector is lowered once into a flat list of instructions that operate on small, fixed
+ * size tiles of values.  Every input array is read in its native type directly into a tile, all
+ * operators are applied tile by tile and the final tile is converted straight into the output
+ * array, so no full size intermediate arrays are created and every operator runs as a tight loop
+ * over contiguous doubles.  Constant sub-expressions are folded while the program is compiled.
+ */
+class SIMPLib_EXPORT CalculatorProgram
+{
+  public:
+    SIMPL_SHARED_POINTERS(CalculatorProgram)
+
+    /**
+     * @brief The number of values that are evaluated together by every instruction
+     */
+    static const size_t k_TileSize = 1024;
+
+    enum class OpCode : int
+    {
+      Load,
+      Fill,
+      Add,
+      Subtract,
+      Multiply,
+      Divide,
+      Pow,
+      Root,
+      Log,
+      Negate,
+      Abs,
+      Sqrt,
+      Exp,
+      Ln,
+      Log10,
+      Floor,
+      Ceil,
+      Sin,
+      Cos,
+      Tan,
+      ASin,
+      ACos,
+      ATan,
+      ToRadians,
+      ToDegrees
+    };
+
+    /**
+     * @brief Lowers the RPN expression into a program.
+     * @param rpn The RPN expression created by the ArrayCalculator filter
+     * @param useDegrees Whether trigonometric operators take and return degrees
+     * @param errMsg Set to a description of the problem if the expression can not be compiled
+     * @return The program or a null pointer if the expression can not be compiled
+     */
+    static Pointer Compile(const QVector<CalculatorItem::Pointer>& rpn, bool useDegrees, QString& errMsg);
+
+    virtual ~CalculatorProgram();
+
+    /**
+     * @brief Returns the number of tuples of the result
+     */
+    size_t getNumberOfTuples() const;
+
+    /**
+     * @brief Returns the component dimensions of the result
+     */
+    QVector<size_t> getComponentDimensions() const;
+
+    /**
+     * @brief Returns the total number of values (tuples * components) of the result
+     */
+    size_t getNumberOfValues() const;
+
+    /**
+     * @brief Returns whether the result is an array or a single number
+     */
+    ICalculatorArray::ValueType getResultType() const;
+
+    /**
+     * @brief Creates an output array of the given scalar type that has the shape of the result
+     * @param scalarType
+     * @param name
+     * @param allocate
+     * @return The array or a null pointer if the scalar type is not supported
+     */
+    IDataArray::Pointer createOutputArray(SIMPL::ScalarTypes::Type scalarType, const QString& name, bool allocate = true) const;
+
+    /**
+     * @brief Evaluates the values [start, end) of the result and stores them into the output
+     * array.  Evaluation only reads the input arrays, so disjoint ranges may be evaluated concurrently.
+     * @param outputArray An array created by createOutputArray
+     * @param start
+     * @param end
+     */
+    void evaluate(IDataArray::Pointer outputArray, size_t start, size_t end) const;
+
+    /**
+     * @brief The ILeaf class loads values of an input array into a tile
+     */
+    class ILeaf
+    {
+      public:
+        virtual ~ILeaf() = default;
+        virtual void load(size_t start, size_t count, double* tile) const = 0;
+        virtual size_t getNumberOfValues() const = 0;
+    };
+
+    struct Instruction
+    {
+      OpCode op;
+      int dest;
+      int lhs;
+      int rhs;
+      int leaf;
+      double value;
+    };
+
+  protected:
+    CalculatorProgram();
+
+  private:
+    std::vector<Instruction> m_Instructions;
+    std::vector<std::shared_ptr<ILeaf>> m_Leaves;
+    int m_NumRegisters = 0;
+    int m_ResultRegister = -1;
+    bool m_ResultIsConstant = false;
+    double m_ResultValue = 0.0;
+    size_t m_NumTuples = 0;
+    QVector<size_t> m_ComponentDims;
+    ICalculatorArray::ValueType m_ResultType = ICalculatorArray::Unknown;
+
+    template <typename T> void evaluateRange(IDataArray::Pointer outputArray, size_t start, size_t end) const;
+
+    void executeInstruction(const Instruction& instr, size_t start, size_t count, double* registers) const;
+
+  public:
+    CalculatorProgram(const CalculatorProgram&) = delete; // Copy Constructor Not Implemented
+    CalculatorProgram(CalculatorProgram&&) = delete;      // Move Constructor Not Implemented
+    CalculatorProgram& operator=(const CalculatorProgram&) = delete; // Copy Assignment Not Implemented
+    CalculatorProgram& operator=(CalculatorProgram&&) = delete;      // Move Assignment Not Implemented
+};
+
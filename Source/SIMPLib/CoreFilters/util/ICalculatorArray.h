@@ -57,12 +57,41 @@ class SIMPLib_EXPORT ICalculatorArray : public CalculatorItem
     ~ICalculatorArray() override;
 
     virtual IDataArray::Pointer getArray() = 0;
-    virtual double getValue(int i) = 0;
-    virtual void setValue(int i, double value) = 0;
+    virtual double getValue(size_t i) = 0;
+    virtual void setValue(size_t i, double value) = 0;
     virtual ValueType getType() = 0;
 
     virtual DoubleArrayType::Pointer reduceToOneComponent(int c, bool allocate = true) = 0;
 
+    /**
+     * @brief Returns the number of tuples of this item without converting the source array
+     */
+    virtual size_t getNumberOfTuples() = 0;
+
+    /**
+     * @brief Returns the component dimensions of this item without converting the source array
+     */
+    virtual QVector<size_t> getComponentDimensions() = 0;
+
+    /**
+     * @brief Returns the natively typed array that backs this item
+     */
+    virtual IDataArray::Pointer getSourceArray() = 0;
+
+    /**
+     * @brief Returns the component of the source array that this item views, or -1
+     * if every component of the source array is used
+     */
+    virtual int getSourceComponent() = 0;
+
+    /**
+     * @brief Creates a single component item that views component c of this item's source array
+     * @param c
+     * @param allocate
+     * @return
+     */
+    virtual ICalculatorArray::Pointer selectComponent(int c, bool allocate = true) = 0;
+
   protected:
     ICalculatorArray();
 
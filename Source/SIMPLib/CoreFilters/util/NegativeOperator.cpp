@@ -41,6 +41,7 @@
 
 #include "BinaryOperator.h"
 #include "CalculatorArray.hpp"
+#include "CalculatorParallel.hpp"
 #include "LeftParenthesisItem.h"
 
 // -----------------------------------------------------------------------------
@@ -68,16 +69,14 @@ void NegativeOperator::calculate(AbstractFilter* filter, DataArrayPath calculate
 
     DoubleArrayType::Pointer newArray = DoubleArrayType::CreateArray(arrayPtr->getArray()->getNumberOfTuples(), arrayPtr->getArray()->getComponentDimensions(), calculatedArrayPath.getDataArrayName());
 
-    int numComps = newArray->getNumberOfComponents();
-    for(int i = 0; i < newArray->getNumberOfTuples(); i++)
-    {
-      for(int c = 0; c < newArray->getNumberOfComponents(); c++)
+    size_t numValues = newArray->getSize();
+    CalculatorParallel::ForEachRange(numValues, [&](size_t start, size_t end) {
+      for(size_t index = start; index < end; index++)
       {
-        int index = numComps * i + c;
         double num = arrayPtr->getValue(index);
         newArray->setValue(index, -1 * num);
       }
-    }
+    });
 
     executionStack.push(CalculatorArray<double>::New(newArray, arrayPtr->getType(), true));
     return;
@@ -30,6 +30,10 @@
 
 #pragma once
 
+#include <cmath>
+#include <cstdint>
+#include <limits>
+
 #include <QtCore/QByteArray>
 #include <QtCore/QString>
 
@@ -430,3 +434,223 @@ public:
   }
 };
 
+// -----------------------------------------------------------------------------
+// Byte level parsers used by ReadASCIIData. Each one only accepts the plain forms of a
+// number it can convert to exactly the value the matching functor above would produce,
+// and returns false for anything else (white space, hex or octal prefixes, out of range
+// values, long mantissas, ...) so that the caller can fall back to the functor.
+// -----------------------------------------------------------------------------
+namespace FastParsers
+{
+/**
+ * @brief ParseDigits Accumulates the decimal digits in [begin, end) into value. Returns false if any
+ * character is not a digit, the range is empty or the value overflows uint64_t.
+ */
+inline bool ParseDigits(const char* begin, const char* end, uint64_t& value)
+{
+  if(begin == end)
+  {
+    return false;
+  }
+  value = 0;
+  for(const char* c = begin; c < end; c++)
+  {
+    uint64_t digit = static_cast<uint64_t>(*c - '0');
+    if(digit > 9 || value > (std::numeric_limits<uint64_t>::max() - digit) / 10)
+    {
+      return false;
+    }
+    value = value * 10 + digit;
+  }
+  return true;
+}
+
+/**
+ * @brief ParseSigned
+ * @param begin
+ * @param end
+ * @param value
+ * @param allowLeadingZeros False for parsers that read "0" prefixed tokens as octal
+ * @return
+ */
+template <typename T> bool ParseSigned(const char* begin, const char* end, T& value, bool allowLeadingZeros)
+{
+  bool negative = false;
+  if(begin < end && (*begin == '-' || *begin == '+'))
+  {
+    negative = (*begin == '-');
+    begin++;
+  }
+  if(!allowLeadingZeros && end - begin > 1 && *begin == '0')
+  {
+    return false;
+  }
+  uint64_t magnitude = 0;
+  if(!ParseDigits(begin, end, magnitude))
+  {
+    return false;
+  }
+  uint64_t limit = negative ? static_cast<uint64_t>(std::numeric_limits<T>::max()) + 1 : static_cast<uint64_t>(std::numeric_limits<T>::max());
+  if(magnitude > limit)
+  {
+    return false;
+  }
+  value = negative ? static_cast<T>(-static_cast<int64_t>(magnitude - 1) - 1) : static_cast<T>(magnitude);
+  return true;
+}
+
+/**
+ * @brief ParseUnsigned Signed tokens are left to the functors, which report negative values as out of range
+ */
+template <typename T> bool ParseUnsigned(const char* begin, const char* end, T& value)
+{
+  uint64_t magnitude = 0;
+  if(!ParseDigits(begin, end, magnitude) || magnitude > static_cast<uint64_t>(std::numeric_limits<T>::max()))
+  {
+    return false;
+  }
+  value = static_cast<T>(magnitude);
+  return true;
+}
+
+/**
+ * @brief ParseDouble Converts [+-]digits[.digits][(e|E)[+-]digits] when the decimal mantissa fits in 53 bits and
+ * the decimal exponent is at most 22. In that range a single multiplication or division by an exact power of ten
+ * gives the correctly rounded result, so the value is identical to QString::toDouble.
+ */
+inline bool ParseDouble(const char* begin, const char* end, double& value)
+{
+  static const double k_Powers[] = {1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+                                    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+  const char* c = begin;
+  bool negative = false;
+  if(c < end && (*c == '-' || *c == '+'))
+  {
+    negative = (*c == '-');
+    c++;
+  }
+
+  uint64_t mantissa = 0;
+  int64_t exponent = 0;
+  int numDigits = 0;
+  int numSignificant = 0;
+  for(; c < end && *c >= '0' && *c <= '9'; c++, numDigits++)
+  {
+    if(mantissa != 0 || *c != '0')
+    {
+      numSignificant++;
+    }
+    mantissa = mantissa * 10 + static_cast<uint64_t>(*c - '0');
+    if(numSignificant > 18)
+    {
+      return false;
+    }
+  }
+  if(numDigits == 0)
+  {
+    return false;
+  }
+  if(c < end && *c == '.')
+  {
+    c++;
+    numDigits = 0;
+    for(; c < end && *c >= '0' && *c <= '9'; c++, numDigits++)
+    {
+      if(mantissa != 0 || *c != '0')
+      {
+        numSignificant++;
+      }
+      mantissa = mantissa * 10 + static_cast<uint64_t>(*c - '0');
+      exponent--;
+      if(numSignificant > 18)
+      {
+        return false;
+      }
+    }
+  }
+  if(numDigits == 0)
+  {
+    return false;
+  }
+  if(c < end && (*c == 'e' || *c == 'E'))
+  {
+    c++;
+    bool negativeExp = false;
+    if(c < end && (*c == '-' || *c == '+'))
+    {
+      negativeExp = (*c == '-');
+      c++;
+    }
+    uint64_t exp = 0;
+    if(!ParseDigits(c, end, exp) || exp > 1000)
+    {
+      return false;
+    }
+    exponent += negativeExp ? -static_cast<int64_t>(exp) : static_cast<int64_t>(exp);
+    c = end;
+  }
+  if(c != end || mantissa > (static_cast<uint64_t>(1) << 53) || exponent < -22 || exponent > 22)
+  {
+    return false;
+  }
+
+  value = static_cast<double>(mantissa);
+  value = (exponent < 0) ? value / k_Powers[-exponent] : value * k_Powers[exponent];
+  value = negative ? -value : value;
+  return true;
+}
+
+// Int8Functor converts with base 0, which reads "0" prefixed tokens as octal
+inline bool Parse(const char* begin, const char* end, int8_t& value)
+{
+  return ParseSigned(begin, end, value, false);
+}
+inline bool Parse(const char* begin, const char* end, int16_t& value)
+{
+  return ParseSigned(begin, end, value, true);
+}
+inline bool Parse(const char* begin, const char* end, int32_t& value)
+{
+  return ParseSigned(begin, end, value, true);
+}
+inline bool Parse(const char* begin, const char* end, int64_t& value)
+{
+  return ParseSigned(begin, end, value, true);
+}
+inline bool Parse(const char* begin, const char* end, uint8_t& value)
+{
+  return ParseUnsigned(begin, end, value);
+}
+inline bool Parse(const char* begin, const char* end, uint16_t& value)
+{
+  return ParseUnsigned(begin, end, value);
+}
+inline bool Parse(const char* begin, const char* end, uint32_t& value)
+{
+  return ParseUnsigned(begin, end, value);
+}
+inline bool Parse(const char* begin, const char* end, uint64_t& value)
+{
+  return ParseUnsigned(begin, end, value);
+}
+inline bool Parse(const char* begin, const char* end, double& value)
+{
+  return ParseDouble(begin, end, value);
+}
+inline bool Parse(const char* begin, const char* end, float& value)
+{
+  double dValue = 0.0;
+  if(!ParseDouble(begin, end, dValue))
+  {
+    return false;
+  }
+  // QString::toFloat rejects values that overflow or underflow a float
+  value = static_cast<float>(dValue);
+  return std::fabs(dValue) <= std::numeric_limits<float>::max() && (dValue == 0.0 || value != 0.0f);
+}
+inline bool Parse(const char* begin, const char* end, QString& value)
+{
+  value = QString::fromUtf8(begin, static_cast<int>(end - begin));
+  return true;
+}
+} // namespace FastParsers
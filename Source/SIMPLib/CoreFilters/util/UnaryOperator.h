@@ -80,16 +80,14 @@ class SIMPLib_EXPORT UnaryOperator : public CalculatorOperator
     DoubleArrayType::Pointer newArray =                                                                                                                                                                \
         DoubleArrayType::CreateArray(arrayPtr->getArray()->getNumberOfTuples(), arrayPtr->getArray()->getComponentDimensions(), calculatedArrayPath.getDataArrayName());                               \
                                                                                                                                                                                                        \
-    int numComps = newArray->getNumberOfComponents();                                                                                                                                                  \
-    for(int i = 0; i < newArray->getNumberOfTuples(); i++)                                                                                                                                             \
-    {                                                                                                                                                                                                  \
-      for(int c = 0; c < newArray->getNumberOfComponents(); c++)                                                                                                                                       \
+    size_t numValues = newArray->getSize();                                                                                                                                                            \
+    CalculatorParallel::ForEachRange(numValues, [&](size_t start, size_t end) {                                                                                                                        \
+      for(size_t index = start; index < end; index++)                                                                                                                                                  \
       {                                                                                                                                                                                                \
-        int index = numComps * i + c;                                                                                                                                                                  \
         double num = arrayPtr->getValue(index);                                                                                                                                                        \
         newArray->setValue(index, func(num));                                                                                                                                                          \
       }                                                                                                                                                                                                \
-    }                                                                                                                                                                                                  \
+    });                                                                                                                                                                                                \
                                                                                                                                                                                                        \
     executionStack.push(CalculatorArray<double>::New(newArray, arrayPtr->getType(), true));                                                                                                            \
     return;                                                                                                                                                                                            \
@@ -105,15 +103,14 @@ class SIMPLib_EXPORT UnaryOperator : public CalculatorOperator
     DoubleArrayType::Pointer newArray =                                                                                                                                                                \
         DoubleArrayType::CreateArray(arrayPtr->getArray()->getNumberOfTuples(), arrayPtr->getArray()->getComponentDimensions(), calculatedArrayPath.getDataArrayName());                               \
                                                                                                                                                                                                        \
-    int numComps = newArray->getNumberOfComponents();                                                                                                                                                  \
-    for(int i = 0; i < newArray->getNumberOfTuples(); i++)                                                                                                                                             \
-    {                                                                                                                                                                                                  \
-      for(int c = 0; c < newArray->getNumberOfComponents(); c++)                                                                                                                                       \
+    bool useDegrees = (calculatorFilter->getUnits() == ArrayCalculator::Degrees);                                                                                                                      \
+    size_t numValues = newArray->getSize();                                                                                                                                                            \
+    CalculatorParallel::ForEachRange(numValues, [&](size_t start, size_t end) {                                                                                                                        \
+      for(size_t index = start; index < end; index++)                                                                                                                                                  \
       {                                                                                                                                                                                                \
-        int index = numComps * i + c;                                                                                                                                                                  \
         double num = arrayPtr->getValue(index);                                                                                                                                                        \
                                                                                                                                                                                                        \
-        if(calculatorFilter->getUnits() == ArrayCalculator::Degrees)                                                                                                                                   \
+        if(useDegrees)                                                                                                                                                                                 \
         {                                                                                                                                                                                              \
           newArray->setValue(index, func(toRadians(num)));                                                                                                                                             \
         }                                                                                                                                                                                              \
@@ -122,7 +119,7 @@ class SIMPLib_EXPORT UnaryOperator : public CalculatorOperator
           newArray->setValue(index, func(num));                                                                                                                                                        \
         }                                                                                                                                                                                              \
       }                                                                                                                                                                                                \
-    }                                                                                                                                                                                                  \
+    });                                                                                                                                                                                                \
                                                                                                                                                                                                        \
     executionStack.push(CalculatorArray<double>::New(newArray, arrayPtr->getType(), true));                                                                                                            \
     return;                                                                                                                                                                                            \
@@ -138,15 +135,14 @@ class SIMPLib_EXPORT UnaryOperator : public CalculatorOperator
     DoubleArrayType::Pointer newArray =                                                                                                                                                                \
         DoubleArrayType::CreateArray(arrayPtr->getArray()->getNumberOfTuples(), arrayPtr->getArray()->getComponentDimensions(), calculatedArrayPath.getDataArrayName());                               \
                                                                                                                                                                                                        \
-    int numComps = newArray->getNumberOfComponents();                                                                                                                                                  \
-    for(int i = 0; i < newArray->getNumberOfTuples(); i++)                                                                                                                                             \
-    {                                                                                                                                                                                                  \
-      for(int c = 0; c < newArray->getNumberOfComponents(); c++)                                                                                                                                       \
+    bool useDegrees = (calculatorFilter->getUnits() == ArrayCalculator::Degrees);                                                                                                                      \
+    size_t numValues = newArray->getSize();                                                                                                                                                            \
+    CalculatorParallel::ForEachRange(numValues, [&](size_t start, size_t end) {                                                                                                                        \
+      for(size_t index = start; index < end; index++)                                                                                                                                                  \
       {                                                                                                                                                                                                \
-        int index = numComps * i + c;                                                                                                                                                                  \
         double num = arrayPtr->getValue(index);                                                                                                                                                        \
                                                                                                                                                                                                        \
-        if(calculatorFilter->getUnits() == ArrayCalculator::Degrees)                                                                                                                                   \
+        if(useDegrees)                                                                                                                                                                                 \
         {                                                                                                                                                                                              \
           newArray->setValue(index, toDegrees(func(num)));                                                                                                                                             \
         }                                                                                                                                                                                              \
@@ -155,7 +151,7 @@ class SIMPLib_EXPORT UnaryOperator : public CalculatorOperator
           newArray->setValue(index, func(num));                                                                                                                                                        \
         }                                                                                                                                                                                              \
       }                                                                                                                                                                                                \
-    }                                                                                                                                                                                                  \
+    });                                                                                                                                                                                                \
                                                                                                                                                                                                        \
     executionStack.push(CalculatorArray<double>::New(newArray, arrayPtr->getType(), true));                                                                                                            \
     return;                                                                                                                                                                                            \
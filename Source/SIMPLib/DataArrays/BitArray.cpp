@@ -0,0 +1,837 @@
+/* ============================================================================
+* Copyright (c) 2009-2015 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-07-D-5800
+*    United States Air Force Prime Contract FA8650-10-D-5210
+*    United States Prime Contract Navy N00173-07-C-2068
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+
+#include "BitArray.h"
+
+#include <algorithm>
+
+#include <QtCore/QLocale>
+#include <QtCore/QTextStream>
+
+#include "H5Support/QH5Lite.h"
+
+#include "SIMPLib/HDF5/H5DataArrayReader.h"
+#include "SIMPLib/HDF5/H5DataArrayWriter.hpp"
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+namespace
+{
+using WordType = BitArray::WordType;
+
+const WordType k_AllSet = ~WordType(0);
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+inline size_t PopCount(WordType w)
+{
+#if defined(__GNUC__) || defined(__clang__)
+  return static_cast<size_t>(__builtin_popcountll(w));
+#else
+  w = w - ((w >> 1) & 0x5555555555555555ULL);
+  w = (w & 0x3333333333333333ULL) + ((w >> 2) & 0x3333333333333333ULL);
+  w = (w + (w >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+  return static_cast<size_t>((w * 0x0101010101010101ULL) >> 56);
+#endif
+}
+
+// -----------------------------------------------------------------------------
+// w must not be zero
+// -----------------------------------------------------------------------------
+inline size_t CountTrailingZeros(WordType w)
+{
+#if defined(__GNUC__) || defined(__clang__)
+  return static_cast<size_t>(__builtin_ctzll(w));
+#elif defined(_MSC_VER) && defined(_M_X64)
+  unsigned long index = 0;
+  _BitScanForward64(&index, w);
+  return static_cast<size_t>(index);
+#else
+  size_t index = 0;
+  while((w & 1) == 0)
+  {
+    w >>= 1;
+    index++;
+  }
+  return index;
+#endif
+}
+} // namespace
+
+const size_t BitArray::k_BitsPerWord;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+BitArray::BitArray(size_t numTuples, const QString& name, bool allocate)
+: m_Name(name)
+, m_NumTuples(numTuples)
+, m_Words(allocate ? GetNumberOfWords(numTuples) : 0, 0)
+, m_IsAllocated(allocate)
+{
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+BitArray::~BitArray() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+BitArray::Pointer BitArray::CreateArray(size_t numTuples, const QString& name, bool allocate)
+{
+  if(name.isEmpty())
+  {
+    return NullPointer();
+  }
+  Pointer ptr(new BitArray(numTuples, name, allocate));
+  return ptr;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+BitArray::Pointer BitArray::CreateArray(size_t numTuples, QVector<size_t> compDims, const QString& name, bool allocate)
+{
+  return CreateArray(numTuples, name, allocate);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+BitArray::Pointer BitArray::CreateArray(QVector<size_t> tDims, const QString& name, bool allocate)
+{
+  size_t numTuples = 1;
+  for(const auto& dim : tDims)
+  {
+    numTuples *= dim;
+  }
+  return CreateArray(numTuples, name, allocate);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+BitArray::Pointer BitArray::FromBoolArray(const BoolArrayType::Pointer& boolArray)
+{
+  if(nullptr == boolArray.get() || boolArray->getNumberOfComponents() != 1)
+  {
+    return NullPointer();
+  }
+  Pointer ptr = CreateArray(boolArray->getNumberOfTuples(), boolArray->getName());
+  if(nullptr != ptr.get() && ptr->getNumberOfTuples() > 0)
+  {
+    ptr->packValues(0, boolArray->getPointer(0), ptr->getNumberOfTuples());
+  }
+  return ptr;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t BitArray::GetNumberOfWords(size_t numTuples)
+{
+  return (numTuples + k_BitsPerWord - 1) / k_BitsPerWord;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+BoolArrayType::Pointer BitArray::toBoolArray()
+{
+  BoolArrayType::Pointer boolArray = BoolArrayType::CreateArray(m_NumTuples, QVector<size_t>(1, 1), m_Name, true);
+  if(m_NumTuples > 0)
+  {
+    unpackValues(0, m_NumTuples, boolArray->getPointer(0));
+  }
+  return boolArray;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+IDataArray::Pointer BitArray::createNewArray(size_t numElements, int rank, size_t* dims, const QString& name, bool allocate)
+{
+  IDataArray::Pointer p = BitArray::CreateArray(numElements, name, allocate);
+  return p;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+IDataArray::Pointer BitArray::createNewArray(size_t numElements, std::vector<size_t> dims, const QString& name, bool allocate)
+{
+  IDataArray::Pointer p = BitArray::CreateArray(numElements, name, allocate);
+  return p;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+IDataArray::Pointer BitArray::createNewArray(size_t numElements, QVector<size_t> dims, const QString& name, bool allocate)
+{
+  IDataArray::Pointer p = BitArray::CreateArray(numElements, name, allocate);
+  return p;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool BitArray::isAllocated()
+{
+  return m_IsAllocated;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void BitArray::getXdmfTypeAndSize(QString& xdmfTypeName, int& precision)
+{
+  xdmfTypeName = getNameOfClass();
+  precision = 0;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString BitArray::getTypeAsString()
+{
+  return "BitArray";
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void BitArray::setName(const QString& name)
+{
+  m_Name = name;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString BitArray::getName()
+{
+  return m_Name;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void BitArray::takeOwnership()
+{
+  this->_ownsData = true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void BitArray::releaseOwnership()
+{
+  this->_ownsData = false;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void* BitArray::getVoidPointer(size_t i)
+{
+  // Only tuples that start a word have an address of their own
+  if(i >= m_NumTuples || !m_IsAllocated || i % k_BitsPerWord != 0)
+  {
+    return nullptr;
+  }
+  return static_cast<void*>(m_Words.data() + i / k_BitsPerWord);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t BitArray::getNumberOfTuples()
+{
+  return m_NumTuples;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t BitArray::getSize()
+{
+  return m_NumTuples;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int BitArray::getNumberOfComponents()
+{
+  return 1;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QVector<size_t> BitArray::getComponentDimensions()
+{
+  QVector<size_t> dims(1, 1);
+  return dims;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t BitArray::getTypeSize()
+{
+  // There is no addressable type for a single bit so report the unpacked size
+  return sizeof(bool);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t BitArray::getNumberOfBytes()
+{
+  return m_Words.size() * sizeof(WordType);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int BitArray::eraseTuples(QVector<size_t>& idxs)
+{
+  // If nothing is to be erased just return
+  if(idxs.empty())
+  {
+    return 0;
+  }
+  size_t idxs_size = static_cast<size_t>(idxs.size());
+  if(idxs_size >= m_NumTuples)
+  {
+    resize(0);
+    return 0;
+  }
+
+  // Sanity Check the Indices in the vector to make sure we are not trying to remove any indices that are
+  // off the end of the array and return an error code.
+  for(const auto& idx : idxs)
+  {
+    if(idx >= m_NumTuples)
+    {
+      return -100;
+    }
+  }
+
+  std::vector<bool> erase(m_NumTuples, false);
+  for(const auto& idx : idxs)
+  {
+    erase[idx] = true;
+  }
+
+  size_t dest = 0;
+  for(size_t i = 0; i < m_NumTuples; i++)
+  {
+    if(!erase[i])
+    {
+      setValue(dest, getValue(i));
+      dest++;
+    }
+  }
+  resize(dest);
+  return 0;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int BitArray::copyTuple(size_t currentPos, size_t newPos)
+{
+  if(currentPos >= m_NumTuples || newPos >= m_NumTuples)
+  {
+    return -1;
+  }
+  setValue(newPos, getValue(currentPos));
+  return 0;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool BitArray::copyFromArray(size_t destTupleOffset, IDataArray::Pointer sourceArray, size_t srcTupleOffset, size_t totalSrcTuples)
+{
+  if(nullptr == sourceArray.get() || !sourceArray->isAllocated() || sourceArray->getNumberOfComponents() != 1)
+  {
+    return false;
+  }
+  if(srcTupleOffset + totalSrcTuples > sourceArray->getNumberOfTuples())
+  {
+    return false;
+  }
+  if(destTupleOffset + totalSrcTuples > m_NumTuples)
+  {
+    return false;
+  }
+
+  if(Self* source = dynamic_cast<Self*>(sourceArray.get()))
+  {
+    for(size_t i = 0; i < totalSrcTuples; i++)
+    {
+      setValue(destTupleOffset + i, source->getValue(srcTupleOffset + i));
+    }
+    return true;
+  }
+  if(BoolArrayType* source = dynamic_cast<BoolArrayType*>(sourceArray.get()))
+  {
+    const bool* values = source->getConstPointer(0);
+    for(size_t i = 0; i < totalSrcTuples; i++)
+    {
+      setValue(destTupleOffset + i, values[srcTupleOffset + i]);
+    }
+    return true;
+  }
+  return false;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void BitArray::initializeTuple(size_t pos, void* value)
+{
+  setValue(pos, *(reinterpret_cast<bool*>(value)));
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void BitArray::initializeWithZeros()
+{
+  std::fill(m_Words.begin(), m_Words.end(), 0);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void BitArray::initializeWithValue(bool value)
+{
+  std::fill(m_Words.begin(), m_Words.end(), value ? k_AllSet : 0);
+  clearUnusedBits();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+IDataArray::Pointer BitArray::deepCopy(bool forceNoAllocate)
+{
+  BitArray::Pointer daCopy = BitArray::CreateArray(m_NumTuples, getName(), m_IsAllocated && !forceNoAllocate);
+  if(m_IsAllocated && !forceNoAllocate)
+  {
+    daCopy->m_Words = m_Words;
+  }
+  return daCopy;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int32_t BitArray::resizeTotalElements(size_t size)
+{
+  return resize(size);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int32_t BitArray::resize(size_t numTuples)
+{
+  m_Words.resize(GetNumberOfWords(numTuples), 0);
+  m_NumTuples = numTuples;
+  m_IsAllocated = true;
+  clearUnusedBits();
+  return 1;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void BitArray::printTuple(QTextStream& out, size_t i, char delimiter)
+{
+  out << static_cast<int>(getValue(i));
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void BitArray::printComponent(QTextStream& out, size_t i, int j)
+{
+  out << static_cast<int>(getValue(i));
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString BitArray::getFullNameOfClass()
+{
+  return "BitArray";
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int BitArray::writeH5Data(hid_t parentId, QVector<size_t> tDims)
+{
+  if(!m_IsAllocated)
+  {
+    return -85648;
+  }
+  // Serialize byte by byte so the file layout does not depend on the endianness of the machine
+  std::vector<uint8_t> bytes((m_NumTuples + 7) / 8, 0);
+  for(size_t k = 0; k < bytes.size(); k++)
+  {
+    bytes[k] = static_cast<uint8_t>(m_Words[k / sizeof(WordType)] >> (8 * (k % sizeof(WordType))));
+  }
+
+  hsize_t dims = bytes.size();
+  int err = 0;
+  if(!QH5Lite::datasetExists(parentId, getName()))
+  {
+    err = QH5Lite::writePointerDataset(parentId, getName(), 1, &dims, bytes.data());
+  }
+  else
+  {
+    err = QH5Lite::replacePointerDataset(parentId, getName(), 1, &dims, bytes.data());
+  }
+  if(err < 0)
+  {
+    return err;
+  }
+  return H5DataArrayWriter::writeDataArrayAttributes<BitArray>(parentId, this, tDims, getComponentDimensions());
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int BitArray::writeXdmfAttribute(QTextStream& out, int64_t* volDims, const QString& hdfFileName, const QString& groupPath, const QString& labelb)
+{
+  out << "<!-- Xdmf is not supported for " << getNameOfClass() << " with type " << getTypeAsString() << " --> ";
+  return -1;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString BitArray::getInfoString(SIMPL::InfoStringFormat format)
+{
+  QString info;
+  QTextStream ss(&info);
+  if(format == SIMPL::HtmlFormat)
+  {
+    ss << "<html><head></head>\n";
+    ss << "<body>\n";
+    ss << "<table cellpadding=\"4\" cellspacing=\"0\" border=\"0\">\n";
+    ss << "<tbody>\n";
+    ss << "<tr bgcolor=\"#FFFCEA\"><th colspan=2>Attribute Array Info</th></tr>";
+    ss << "<tr bgcolor=\"#FFFCEA\"><th align=\"right\">Name:</th><td>" << getName() << "</td></tr>";
+    ss << "<tr bgcolor=\"#FFFCEA\"><th align=\"right\">Type:</th><td>" << getTypeAsString() << "</td></tr>";
+    QLocale usa(QLocale::English, QLocale::UnitedStates);
+    QString numStr = usa.toString(static_cast<qlonglong>(getNumberOfTuples()));
+    ss << "<tr bgcolor=\"#FFFCEA\"><th align=\"right\">Number of Tuples:</th><td>" << numStr << "</td></tr>";
+    numStr = usa.toString(static_cast<qlonglong>(countTrue()));
+    ss << "<tr bgcolor=\"#FFFCEA\"><th align=\"right\">Number of True Values:</th><td>" << numStr << "</td></tr>";
+    ss << "</tbody></table>\n";
+    ss << "<br/>";
+    ss << "</body></html>";
+  }
+  else
+  {
+  }
+  return info;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int BitArray::readH5Data(hid_t parentId)
+{
+  QString objType;
+  int version = 0;
+  QVector<size_t> tDims;
+  QVector<size_t> cDims;
+  int err = H5DataArrayReader::ReadRequiredAttributes(parentId, getName(), objType, version, tDims, cDims);
+  if(err < 0)
+  {
+    return err;
+  }
+  size_t numTuples = 1;
+  for(const auto& dim : tDims)
+  {
+    numTuples *= dim;
+  }
+
+  QVector<hsize_t> dims;
+  H5T_class_t classType;
+  size_t typeSize = 0;
+  err = QH5Lite::getDatasetInfo(parentId, getName(), dims, classType, typeSize);
+  if(err < 0)
+  {
+    return err;
+  }
+  std::vector<uint8_t> bytes((numTuples + 7) / 8, 0);
+  if(dims.size() != 1 || dims[0] != bytes.size() || typeSize != 1)
+  {
+    return -1;
+  }
+  if(!bytes.empty())
+  {
+    err = QH5Lite::readPointerDataset(parentId, getName(), bytes.data());
+    if(err < 0)
+    {
+      return err;
+    }
+  }
+
+  resize(0);
+  resize(numTuples);
+  for(size_t k = 0; k < bytes.size(); k++)
+  {
+    m_Words[k / sizeof(WordType)] |= static_cast<WordType>(bytes[k]) << (8 * (k % sizeof(WordType)));
+  }
+  clearUnusedBits();
+  return 0;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+BitArray::WordType* BitArray::getWordPointer(size_t i)
+{
+  return m_Words.data() + i;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t BitArray::getNumberOfWords() const
+{
+  return m_Words.size();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void BitArray::packValues(size_t startTuple, const bool* values, size_t count)
+{
+  size_t i = 0;
+  // Leading partial word
+  while(i < count && (startTuple + i) % k_BitsPerWord != 0)
+  {
+    setValue(startTuple + i, values[i]);
+    i++;
+  }
+  // Whole words are assembled in a register and stored once
+  WordType* word = m_Words.data() + (startTuple + i) / k_BitsPerWord;
+  for(; i + k_BitsPerWord <= count; i += k_BitsPerWord)
+  {
+    WordType w = 0;
+    for(size_t b = 0; b < k_BitsPerWord; b++)
+    {
+      w |= static_cast<WordType>(values[i + b]) << b;
+    }
+    *word++ = w;
+  }
+  // Trailing partial word
+  for(; i < count; i++)
+  {
+    setValue(startTuple + i, values[i]);
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void BitArray::unpackValues(size_t startTuple, size_t count, bool* values) const
+{
+  for(size_t i = 0; i < count; i++)
+  {
+    values[i] = getValue(startTuple + i);
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool BitArray::andWith(const BitArray& other)
+{
+  if(other.m_NumTuples != m_NumTuples || other.m_Words.size() != m_Words.size())
+  {
+    return false;
+  }
+  const WordType* src = other.m_Words.data();
+  WordType* dest = m_Words.data();
+  const size_t numWords = m_Words.size();
+  for(size_t w = 0; w < numWords; w++)
+  {
+    dest[w] &= src[w];
+  }
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool BitArray::orWith(const BitArray& other)
+{
+  if(other.m_NumTuples != m_NumTuples || other.m_Words.size() != m_Words.size())
+  {
+    return false;
+  }
+  const WordType* src = other.m_Words.data();
+  WordType* dest = m_Words.data();
+  const size_t numWords = m_Words.size();
+  for(size_t w = 0; w < numWords; w++)
+  {
+    dest[w] |= src[w];
+  }
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool BitArray::xorWith(const BitArray& other)
+{
+  if(other.m_NumTuples != m_NumTuples || other.m_Words.size() != m_Words.size())
+  {
+    return false;
+  }
+  const WordType* src = other.m_Words.data();
+  WordType* dest = m_Words.data();
+  const size_t numWords = m_Words.size();
+  for(size_t w = 0; w < numWords; w++)
+  {
+    dest[w] ^= src[w];
+  }
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void BitArray::invert()
+{
+  WordType* dest = m_Words.data();
+  const size_t numWords = m_Words.size();
+  for(size_t w = 0; w < numWords; w++)
+  {
+    dest[w] = ~dest[w];
+  }
+  clearUnusedBits();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t BitArray::countTrue() const
+{
+  size_t count = 0;
+  for(const auto& w : m_Words)
+  {
+    count += PopCount(w);
+  }
+  return count;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t BitArray::findFirstTrue() const
+{
+  return findNextTrue(0);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t BitArray::findNextTrue(size_t start) const
+{
+  if(start >= m_NumTuples || !m_IsAllocated)
+  {
+    return m_NumTuples;
+  }
+  size_t w = start / k_BitsPerWord;
+  WordType word = m_Words[w] & (k_AllSet << (start % k_BitsPerWord));
+  while(word == 0)
+  {
+    if(++w == m_Words.size())
+    {
+      return m_NumTuples;
+    }
+    word = m_Words[w];
+  }
+  return w * k_BitsPerWord + CountTrailingZeros(word);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t BitArray::findFirstFalse() const
+{
+  for(size_t w = 0; w < m_Words.size(); w++)
+  {
+    WordType word = ~m_Words[w];
+    if(word != 0)
+    {
+      // Bits past the end of the array are zero so they show up here as false values
+      size_t index = w * k_BitsPerWord + CountTrailingZeros(word);
+      return index < m_NumTuples ? index : m_NumTuples;
+    }
+  }
+  return m_NumTuples;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void BitArray::clearUnusedBits()
+{
+  const size_t used = m_NumTuples % k_BitsPerWord;
+  if(used != 0 && !m_Words.empty())
+  {
+    m_Words.back() &= ~(k_AllSet << used);
+  }
+}
@@ -0,0 +1,478 @@
+/* ============================================================================
+* Copyright (c) 2009-2015 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-07-D-5800
+*    United States Air Force Prime Contract FA8650-10-D-5210
+*    United States Prime Contract Navy N00173-07-C-2068
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include <QtCore/QString>
+
+#include "SIMPLib/Common/SIMPLibSetGetMacros.h"
+#include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/DataArrays/IDataArray.h"
+#include "SIMPLib/SIMPLib.h"
+
+/**
+ * @class BitArray BitArray.h SIMPLib/DataArrays/BitArray.h
+ * @brief Stores a scalar boolean mask packed 64 values to a machine word. Tuple i is
+ * bit (i % 64) of word (i / 64); the unused bits of the last word are always kept
+ * at zero so that whole word operations (and, or, popcount, ...) never need masking.
+ *
+ * The array is stored in HDF5 files as a 1D uint8 data set where bit j of byte k holds
+ * tuple 8k + j. The real tuple dimensions are written in the usual TupleDimensions attribute.
+ */
+class SIMPLib_EXPORT BitArray : public IDataArray
+{
+public:
+  SIMPL_SHARED_POINTERS(BitArray)
+  SIMPL_TYPE_MACRO_SUPER(BitArray, IDataArray)
+  SIMPL_CLASS_VERSION(1)
+
+  using WordType = uint64_t;
+  static const size_t k_BitsPerWord = 64;
+
+  /**
+   * @brief CreateArray
+   * @param numTuples
+   * @param name
+   * @param allocate
+   * @return
+   */
+  static Pointer CreateArray(size_t numTuples, const QString& name, bool allocate = true);
+
+  /**
+   * @brief CreateArray
+   * @param numTuples
+   * @param compDims NOT USED. A BitArray always has a single component.
+   * @param name
+   * @param allocate
+   * @return
+   */
+  static Pointer CreateArray(size_t numTuples, QVector<size_t> compDims, const QString& name, bool allocate = true);
+
+  /**
+   * @brief CreateArray
+   * @param tDims
+   * @param name
+   * @param allocate
+   * @return
+   */
+  static Pointer CreateArray(QVector<size_t> tDims, const QString& name, bool allocate = true);
+
+  /**
+   * @brief FromBoolArray Packs a scalar bool array into a new BitArray with the same name
+   * @param boolArray
+   * @return Null Pointer if the input is invalid or has more than one component
+   */
+  static Pointer FromBoolArray(const BoolArrayType::Pointer& boolArray);
+
+  /**
+   * @brief GetNumberOfWords Returns the number of words needed to store numTuples bits
+   * @param numTuples
+   * @return
+   */
+  static size_t GetNumberOfWords(size_t numTuples);
+
+  /**
+   * @brief toBoolArray Unpacks this array into a new scalar bool array with the same name
+   * @return
+   */
+  BoolArrayType::Pointer toBoolArray();
+
+  /**
+   * @brief createNewArray
+   * @param numElements
+   * @param rank NOT USED. It is always 1.
+   * @param dims NOT USED.
+   * @param name
+   * @return
+   */
+  IDataArray::Pointer createNewArray(size_t numElements, int rank, size_t* dims, const QString& name, bool allocate = true) override;
+
+  /**
+   * @brief createNewArray
+   * @param numElements
+   * @param dims
+   * @param name
+   * @param allocate
+   * @return
+   */
+  IDataArray::Pointer createNewArray(size_t numElements, std::vector<size_t> dims, const QString& name, bool allocate = true) override;
+
+  /**
+   * @brief createNewArray
+   * @param numElements
+   * @param dims
+   * @param name
+   * @param allocate
+   * @return
+   */
+  IDataArray::Pointer createNewArray(size_t numElements, QVector<size_t> dims, const QString& name, bool allocate = true) override;
+
+  /**
+   * @brief ~BitArray
+   */
+  ~BitArray() override;
+
+  /**
+   * @brief isAllocated
+   * @return
+   */
+  bool isAllocated() override;
+
+  /**
+   * @brief getXdmfTypeAndSize
+   * @param xdmfTypeName
+   * @param precision
+   */
+  void getXdmfTypeAndSize(QString& xdmfTypeName, int& precision) override;
+
+  /**
+   * @brief getTypeAsString
+   * @return
+   */
+  QString getTypeAsString() override;
+
+  /**
+   * @brief Gives this array a human readable name
+   * @param name The name of this array
+   */
+  void setName(const QString& name) override;
+
+  /**
+   * @brief Returns the human readable name of this array
+   * @return
+   */
+  QString getName() override;
+
+  /**
+   * @brief
+   */
+  void takeOwnership() override;
+
+  /**
+   * @brief
+   */
+  void releaseOwnership() override;
+
+  /**
+   * @brief Returns a void pointer to the packed words starting with the word that holds tuple i.
+   * Single bits are not addressable so i must be a multiple of k_BitsPerWord. Together with
+   * getNumberOfBytes() this describes the packed storage.
+   * @param i The index of the tuple
+   * @return Void Pointer. nullptr if i does not start a word or the array is not allocated.
+   */
+  void* getVoidPointer(size_t i) override;
+
+  /**
+   * @brief Returns the number of Tuples in the array.
+   */
+  size_t getNumberOfTuples() override;
+
+  /**
+   * @brief Return the number of elements in the array
+   * @return
+   */
+  size_t getSize() override;
+
+  int getNumberOfComponents() override;
+
+  QVector<size_t> getComponentDimensions() override;
+
+  /**
+   * @brief Returns the size of an unpacked value, sizeof(bool). Use getNumberOfBytes() for the
+   * size of the packed storage.
+   */
+  size_t getTypeSize() override;
+
+  /**
+   * @brief Returns the number of bytes of packed storage, getNumberOfWords() * sizeof(WordType).
+   * @return
+   */
+  size_t getNumberOfBytes() override;
+
+  /**
+   * @brief Removes Tuples from the Array. If the size of the vector is Zero nothing is done. If the size of the
+   * vector is greater than or Equal to the number of Tuples then the Array is Resized to Zero. If there are
+   * indices that are larger than the size of the original (before erasing operations) then an error code (-100) is
+   * returned from the program.
+   * @param idxs The indices to remove
+   * @return error code.
+   */
+  int eraseTuples(QVector<size_t>& idxs) override;
+
+  /**
+   * @brief Copies a Tuple from one position to another.
+   * @param currentPos The index of the source data
+   * @param newPos The destination index to place the copied data
+   * @return
+   */
+  int copyTuple(size_t currentPos, size_t newPos) override;
+
+  // This line must be here, because we are overloading the copyData pure virtual function in IDataArray.
+  // This is required so that other classes can call this version of copyData from the subclasses.
+  using IDataArray::copyFromArray;
+
+  /**
+   * @brief copyFromArray Copies totalSrcTuples values starting at srcTupleOffset in sourceArray into
+   * this array starting at destTupleOffset. The source may be a BitArray or a bool DataArray.
+   * @param destTupleOffset
+   * @param sourceArray
+   * @param srcTupleOffset
+   * @param totalSrcTuples
+   * @return
+   */
+  bool copyFromArray(size_t destTupleOffset, IDataArray::Pointer sourceArray, size_t srcTupleOffset, size_t totalSrcTuples) override;
+
+  /**
+   * @brief Sets the value at pos from a pointer to a bool
+   * @param pos The index of the Tuple
+   * @param value pointer to a bool
+   */
+  void initializeTuple(size_t pos, void* value) override;
+
+  /**
+   * @brief Sets all the values to false.
+   */
+  void initializeWithZeros() override;
+
+  /**
+   * @brief initializeWithValue
+   * @param value
+   */
+  void initializeWithValue(bool value);
+
+  /**
+   * @brief deepCopy
+   * @param forceNoAllocate
+   * @return
+   */
+  IDataArray::Pointer deepCopy(bool forceNoAllocate = false) override;
+
+  /**
+   * @brief Reseizes the internal array
+   * @param size The new number of bits
+   * @return 1 on success, 0 on failure
+   */
+  int32_t resizeTotalElements(size_t size) override;
+
+  /**
+   * @brief Reseizes the internal array. New values are false.
+   * @param numTuples The new number of tuples
+   * @return 1 on success, 0 on failure
+   */
+  int32_t resize(size_t numTuples) override;
+
+  /**
+   * @brief printTuple
+   * @param out
+   * @param i
+   * @param delimiter
+   */
+  void printTuple(QTextStream& out, size_t i, char delimiter = ',') override;
+
+  /**
+   * @brief printComponent
+   * @param out
+   * @param i
+   * @param j
+   */
+  void printComponent(QTextStream& out, size_t i, int j) override;
+
+  /**
+   * @brief getFullNameOfClass
+   * @return
+   */
+  QString getFullNameOfClass();
+
+  /**
+   * @brief writeH5Data
+   * @param parentId
+   * @param tDims
+   * @return
+   */
+  int writeH5Data(hid_t parentId, QVector<size_t> tDims) override;
+
+  /**
+   * @brief writeXdmfAttribute
+   * @param out
+   * @param volDims
+   * @param hdfFileName
+   * @param groupPath
+   * @return
+   */
+  int writeXdmfAttribute(QTextStream& out, int64_t* volDims, const QString& hdfFileName, const QString& groupPath, const QString& labelb) override;
+
+  /**
+   * @brief getInfoString
+   * @return Returns a formatted string that contains general infomation about
+   * the instance of the object.
+   */
+  QString getInfoString(SIMPL::InfoStringFormat format) override;
+
+  /**
+   * @brief readH5Data
+   * @param parentId
+   * @return
+   */
+  int readH5Data(hid_t parentId) override;
+
+  /**
+   * @brief getValue
+   * @param i
+   * @return
+   */
+  inline bool getValue(size_t i) const
+  {
+    return ((m_Words[i / k_BitsPerWord] >> (i % k_BitsPerWord)) & 1) != 0;
+  }
+
+  /**
+   * @brief setValue Not safe to call concurrently for tuples that share a word.
+   * @param i
+   * @param value
+   */
+  inline void setValue(size_t i, bool value)
+  {
+    const WordType bit = WordType(1) << (i % k_BitsPerWord);
+    if(value)
+    {
+      m_Words[i / k_BitsPerWord] |= bit;
+    }
+    else
+    {
+      m_Words[i / k_BitsPerWord] &= ~bit;
+    }
+  }
+
+  /**
+   * @brief getWordPointer Returns a pointer to the packed storage starting at word index i.
+   * @param i
+   * @return
+   */
+  WordType* getWordPointer(size_t i);
+
+  /**
+   * @brief getNumberOfWords
+   * @return
+   */
+  size_t getNumberOfWords() const;
+
+  /**
+   * @brief packValues Packs count bools into the tuples starting at startTuple. Threads may
+   * pack disjoint ranges concurrently as long as each range starts on a multiple of k_BitsPerWord.
+   * @param startTuple
+   * @param values
+   * @param count
+   */
+  void packValues(size_t startTuple, const bool* values, size_t count);
+
+  /**
+   * @brief unpackValues Writes count bools starting at startTuple into values.
+   * @param startTuple
+   * @param count
+   * @param values
+   */
+  void unpackValues(size_t startTuple, size_t count, bool* values) const;
+
+  /**
+   * @brief andWith, orWith and xorWith combine another mask of the same length into this one
+   * @param other
+   * @return false if the number of tuples do not match
+   */
+  bool andWith(const BitArray& other);
+  bool orWith(const BitArray& other);
+  bool xorWith(const BitArray& other);
+
+  /**
+   * @brief invert Flips every value
+   */
+  void invert();
+
+  /**
+   * @brief countTrue Returns the number of true values
+   * @return
+   */
+  size_t countTrue() const;
+
+  /**
+   * @brief findFirstTrue Returns the index of the first true value or getNumberOfTuples() if there is none
+   * @return
+   */
+  size_t findFirstTrue() const;
+
+  /**
+   * @brief findNextTrue Returns the index of the first true value at or after start or
+   * getNumberOfTuples() if there is none
+   * @param start
+   * @return
+   */
+  size_t findNextTrue(size_t start) const;
+
+  /**
+   * @brief findFirstFalse Returns the index of the first false value or getNumberOfTuples() if there is none
+   * @return
+   */
+  size_t findFirstFalse() const;
+
+protected:
+  /**
+   * @brief Protected Constructor
+   * @param numTuples The number of values in the array.
+   * @param name
+   * @param allocate Will all the memory be allocated at time of construction
+   */
+  BitArray(size_t numTuples, const QString& name, bool allocate);
+
+private:
+  QString m_Name;
+  size_t m_NumTuples = 0;
+  std::vector<WordType> m_Words;
+  bool m_IsAllocated = true;
+  bool _ownsData = true;
+
+  /**
+   * @brief clearUnusedBits Zeroes the bits of the last word that are past the end of the array
+   */
+  void clearUnusedBits();
+
+public:
+  BitArray(const BitArray&) = delete;            // Copy Constructor Not Implemented
+  BitArray(BitArray&&) = delete;                 // Move Constructor Not Implemented
+  BitArray& operator=(const BitArray&) = delete; // Copy Assignment Not Implemented
+  BitArray& operator=(BitArray&&) = delete;      // Move Assignment Not Implemented
+};
@@ -36,8 +36,11 @@
 #pragma once
 
 // STL Includes
-#include <vector>
+#include <atomic>
 #include <cstring>
+#include <memory>
+#include <mutex>
+#include <vector>
 
 #include "SIMPLib/SIMPLib.h"
 #include "SIMPLib/Common/SIMPLibSetGetMacros.h"
@@ -433,12 +436,14 @@ class DataArray : public IDataArray
      */
     bool copyFromArray(size_t destTupleOffset, IDataArray::Pointer sourceArray, size_t srcTupleOffset, size_t totalSrcTuples) override
     {
+      ensureDataLoaded();
+      if(!ensureUniqueData()) { return false; }
       if(!m_IsAllocated) { return false; }
       if(nullptr == m_Array) { return false; }
       if(destTupleOffset > m_MaxId) { return false; }
       if(!sourceArray->isAllocated()) { return false; }
       Self* source = dynamic_cast<Self*>(sourceArray.get());
-      if(nullptr == source->getPointer(0)) { return false; }
+      if(nullptr == source->getConstPointer(0)) { return false; }
 
       if(sourceArray->getNumberOfComponents() != getNumberOfComponents()) { return false; }
 
@@ -454,7 +459,7 @@ class DataArray : public IDataArray
 
       size_t elementStart = destTupleOffset*getNumberOfComponents();
       size_t totalBytes = (totalSrcTuples * sourceArray->getNumberOfComponents()) * sizeof(T);
-      std::memcpy(m_Array + elementStart, source->getPointer(srcTupleOffset * sourceArray->getNumberOfComponents()), totalBytes);
+      std::memcpy(m_Array + elementStart, source->getConstPointer(srcTupleOffset * sourceArray->getNumberOfComponents()), totalBytes);
       return true;
     }
 
@@ -464,6 +469,7 @@ class DataArray : public IDataArray
      */
     bool copyIntoArray(Pointer dest)
     {
+      ensureDataLoaded();
       if(m_IsAllocated  && dest->isAllocated() && m_Array && dest->getPointer(0))
       {
         size_t totalBytes = m_Size * sizeof(T);
@@ -519,7 +525,7 @@ class DataArray : public IDataArray
     ~DataArray() override
     {
       //qDebug() << "~DataArrayTemplate '" << m_Name << "'" ;
-      if ((nullptr != m_Array) && (true == m_OwnsData))
+      if (!releaseSharedData() && (nullptr != m_Array) && (true == m_OwnsData))
       {
         _deallocate();
       }
@@ -563,6 +569,7 @@ class DataArray : public IDataArray
      */
     void takeOwnership() override
     {
+      if(!ensureUniqueData()) { return; }
       m_OwnsData = true;
     }
 
@@ -573,6 +580,7 @@ class DataArray : public IDataArray
      */
     void releaseOwnership() override
     {
+      if(!ensureUniqueData()) { return; }
       m_OwnsData = false;
     }
 
@@ -582,7 +590,8 @@ class DataArray : public IDataArray
      */
     virtual int32_t allocate()
     {
-      if ((nullptr != m_Array) && (true == m_OwnsData))
+      cancelDeferredData();
+      if (!releaseSharedData() && (nullptr != m_Array) && (true == m_OwnsData))
       {
         _deallocate();
       }
@@ -619,7 +628,8 @@ class DataArray : public IDataArray
      */
     virtual void clear()
     {
-      if (nullptr != m_Array && true == m_OwnsData)
+      cancelDeferredData();
+      if (!releaseSharedData() && nullptr != m_Array && true == m_OwnsData)
       {
         _deallocate();
       }
@@ -639,6 +649,8 @@ class DataArray : public IDataArray
      */
     void initializeWithZeros() override
     {
+      ensureDataLoaded();
+      if(!ensureUniqueData()) { return; }
       if(!m_IsAllocated || nullptr == m_Array) { return; }
       size_t typeSize = sizeof(T);
       ::memset(m_Array, 0, m_Size * typeSize);
@@ -649,6 +661,8 @@ class DataArray : public IDataArray
      */
     virtual void initializeWithValue(T initValue, size_t offset = 0)
     {
+      ensureDataLoaded();
+      if(!ensureUniqueData()) { return; }
       if(!m_IsAllocated || nullptr == m_Array) { return; }
       for (size_t i = offset; i < m_Size; i++)
       {
@@ -679,6 +693,7 @@ class DataArray : public IDataArray
         resize(0);
         return 0;
       }
+      ensureDataLoaded();
 
       // Sanity Check the Indices in the vector to make sure we are not trying to remove any indices that are
       // off the end of the array and return an error code.
@@ -717,7 +732,11 @@ class DataArray : public IDataArray
       {
         T* currentSrc = m_Array + (j * m_NumComponents);
         std::memcpy(currentDest, currentSrc, (getNumberOfTuples() - idxs.size()) * m_NumComponents * sizeof(T));
-        _deallocate(); // We are done copying - delete the current m_Array
+        // We are done copying - delete the current m_Array or let go of the shared one
+        if(!releaseSharedData())
+        {
+          _deallocate();
+        }
         m_Size = newSize;
         m_Array = newArray;
         m_OwnsData = true;
@@ -757,8 +776,11 @@ class DataArray : public IDataArray
         std::memcpy(currentDest, currentSrc, bytes);
       }
 
-      // We are done copying - delete the current m_Array
-      _deallocate();
+      // We are done copying - delete the current m_Array or let go of the shared one
+      if(!releaseSharedData())
+      {
+        _deallocate();
+      }
 
       // Allocation was successful.  Save it.
       m_Size = newSize;
@@ -779,6 +801,8 @@ class DataArray : public IDataArray
      */
     int copyTuple(size_t currentPos, size_t newPos) override
     {
+      ensureDataLoaded();
+      if(!ensureUniqueData()) { return -1; }
       size_t max =  ((m_MaxId + 1) / m_NumComponents);
       if (currentPos >= max
           || newPos >= max )
@@ -850,7 +874,11 @@ class DataArray : public IDataArray
     void* getVoidPointer(size_t i) override
     {
       if (i >= m_Size) { return nullptr;}
-
+      ensureDataLoaded();
+      if(!ensureUniqueData() || nullptr == m_Array)
+      {
+        return nullptr;
+      }
       return (void*)(&(m_Array[i]));
     }
 
@@ -858,18 +886,45 @@ class DataArray : public IDataArray
     /**
      * @brief Returns the pointer to a specific index into the array. No checks are made
      * as to the correctness of the index being passed in. If you ask for an index off
-     * then end of the array they you will likely cause your program to abort.
+     * then end of the array they you will likely cause your program to abort. If the
+     * values are shared with a copy made by deepCopy() this array first makes its own copy,
+     * so code that only reads the values should use getConstPointer() instead.
      * @param i The index to return the pointer to.
-     * @return The pointer to the index
+     * @return The pointer to the index. nullptr if the array is not allocated or the shared
+     * values could not be copied.
      */
     virtual T* getPointer(size_t i)
     {
 #ifndef NDEBUG
       if (m_Size > 0) { Q_ASSERT(i < m_Size);}
 #endif
+      ensureDataLoaded();
+      if(!ensureUniqueData() || nullptr == m_Array)
+      {
+        return nullptr;
+      }
       return (T*)(&(m_Array[i]));
     }
 
+    /**
+     * @brief Returns a read only pointer to a specific index into the array. Unlike getPointer()
+     * this never copies values that are shared with a copy made by deepCopy().
+     * @param i The index to return the pointer to.
+     * @return The pointer to the index
+     */
+    const T* getConstPointer(size_t i)
+    {
+#ifndef NDEBUG
+      if (m_Size > 0) { Q_ASSERT(i < m_Size);}
+#endif
+      ensureDataLoaded();
+      if(nullptr == m_Array)
+      {
+        return nullptr;
+      }
+      return m_Array + i;
+    }
+
     /**
      * @brief Returns the value for a given index
      * @param i The index to return the value at
@@ -880,6 +935,7 @@ class DataArray : public IDataArray
 #ifndef NDEBUG
       if (m_Size > 0) { Q_ASSERT(i < m_Size);}
 #endif
+      ensureDataLoaded();
       return m_Array[i];
     }
 
@@ -894,6 +950,8 @@ class DataArray : public IDataArray
       if (m_Size > 0)
       { Q_ASSERT(i < m_Size);}
 #endif
+      ensureDataLoaded();
+      if(!ensureUniqueData()) { return; }
       m_Array[i] = value;
     }
 
@@ -904,6 +962,7 @@ class DataArray : public IDataArray
 #ifndef NDEBUG
       if (m_Size > 0) { Q_ASSERT(i * m_NumComponents + j < m_Size);}
 #endif
+      ensureDataLoaded();
       return m_Array[i * m_NumComponents + j];
     }
 
@@ -918,6 +977,8 @@ class DataArray : public IDataArray
 #ifndef NDEBUG
       if (m_Size > 0) { Q_ASSERT(i * m_NumComponents + j < m_Size);}
 #endif
+      ensureDataLoaded();
+      if(!ensureUniqueData()) { return; }
       m_Array[i * m_NumComponents + j] = c;
     }
 
@@ -931,7 +992,11 @@ class DataArray : public IDataArray
 #ifndef NDEBUG
       if (m_Size > 0) { Q_ASSERT(tupleIndex * m_NumComponents + (m_NumComponents-1)  < m_Size);}
 #endif
-      std::memcpy(getTuplePointer(tupleIndex), data, m_NumComponents * sizeof(T));
+      T* dest = getTuplePointer(tupleIndex);
+      if(nullptr != dest)
+      {
+        std::memcpy(dest, data, m_NumComponents * sizeof(T));
+      }
     }
 
     /**
@@ -944,7 +1009,11 @@ class DataArray : public IDataArray
 #ifndef NDEBUG
       if (m_Size > 0) { Q_ASSERT(tupleIndex * m_NumComponents + (m_NumComponents - 1) < m_Size); }
 #endif
-      std::memcpy(getTuplePointer(tupleIndex), data.data(), m_NumComponents * sizeof(T));
+      T* dest = getTuplePointer(tupleIndex);
+      if(nullptr != dest)
+      {
+        std::memcpy(dest, data.data(), m_NumComponents * sizeof(T));
+      }
     }
 
     /**
@@ -954,6 +1023,8 @@ class DataArray : public IDataArray
      */
     void initializeTuple(size_t i, void* p) override
     {
+      ensureDataLoaded();
+      if(!ensureUniqueData()) { return; }
       if(!m_IsAllocated) { return; }
 #ifndef NDEBUG
       if (m_Size > 0) { Q_ASSERT(i * m_NumComponents < m_Size);}
@@ -975,6 +1046,11 @@ class DataArray : public IDataArray
 #ifndef NDEBUG
       if (m_Size > 0) { Q_ASSERT(tupleIndex * m_NumComponents < m_Size);}
 #endif
+      ensureDataLoaded();
+      if(!ensureUniqueData() || nullptr == m_Array)
+      {
+        return nullptr;
+      }
       return m_Array + (tupleIndex * m_NumComponents);
     }
 
@@ -998,6 +1074,7 @@ class DataArray : public IDataArray
      */
     void printTuple(QTextStream& out, size_t i, char delimiter = ',') override
     {
+      ensureDataLoaded();
       int precision = out.realNumberPrecision();
       T value = static_cast<T>(0x00);
       if (typeid(value) == typeid(float)) { out.setRealNumberPrecision(8); }
@@ -1019,6 +1096,7 @@ class DataArray : public IDataArray
      */
     void printComponent(QTextStream& out, size_t i, int j) override
     {
+      ensureDataLoaded();
       out << m_Array[i * m_NumComponents + j];
     }
 
@@ -1104,16 +1182,26 @@ class DataArray : public IDataArray
     }
 
     /**
-     * @brief deepCopy
+     * @brief deepCopy Copies the array. The values are not duplicated: the copy shares the buffer of this
+     * array and whichever array is modified first makes its own copy of the values. Arrays that wrap memory
+     * they do not own are copied immediately.
      * @param forceNoAllocate
      * @return
      */
     IDataArray::Pointer deepCopy(bool forceNoAllocate = false) override
     {
+      if(m_IsAllocated && !forceNoAllocate)
+      {
+        ensureDataLoaded();
+        if(nullptr != m_Array && (m_OwnsData || m_DataShared.load(std::memory_order_acquire)))
+        {
+          return shareData();
+        }
+      }
       IDataArray::Pointer daCopy = createNewArray(getNumberOfTuples(), getComponentDimensions(), getName(), m_IsAllocated);
       if(m_IsAllocated  && !forceNoAllocate)
       {
-        T* src = getPointer(0);
+        const T* src = getConstPointer(0);
         void* dest = daCopy->getVoidPointer(0);
         size_t totalBytes = (getNumberOfTuples() * getNumberOfComponents() * sizeof(T));
         std::memcpy(dest, src, totalBytes);
@@ -1130,6 +1218,7 @@ class DataArray : public IDataArray
      */
     int writeH5Data(hid_t parentId, QVector<size_t> tDims) override
     {
+      ensureDataLoaded();
       if (m_Array == nullptr)
       { return -85648; }
       return H5DataArrayWriter::writeDataArray<Self>(parentId, this, tDims);
@@ -1144,7 +1233,7 @@ class DataArray : public IDataArray
     int writeXdmfAttribute(QTextStream& out, int64_t* volDims, const QString& hdfFileName,
                                    const QString& groupPath, const QString& label) override
     {
-      if (m_Array == nullptr) { return -85648; }
+      if (m_Array == nullptr && !isDataDeferred()) { return -85648; }
       QString dimStr;
       int precision = 0;
       QString xdmfTypeName;
@@ -1278,6 +1367,8 @@ class DataArray : public IDataArray
      */
     virtual void byteSwapElements()
     {
+      ensureDataLoaded();
+      if(!ensureUniqueData()) { return; }
       char* ptr = (char*)(m_Array);
       char t[8];
       size_t size = getTypeSize();
@@ -1311,9 +1402,72 @@ class DataArray : public IDataArray
     inline T& operator[](size_t i)
     {
       Q_ASSERT(i < m_Size);
+      ensureDataLoaded();
+      ensureUniqueData();
       return m_Array[i];
     }
 
+    /**
+     * @brief setDeferredLoader Reimplemented from @see IDataArray class. The current values are released
+     * and the loader is called from the first accessor that needs the values, e.g. getPointer().
+     * @param loader
+     * @return
+     */
+    bool setDeferredLoader(const DeferredLoader& loader) override
+    {
+      if(!loader || m_Size == 0)
+      {
+        return false;
+      }
+      if (!releaseSharedData() && (nullptr != m_Array) && (true == m_OwnsData))
+      {
+        _deallocate();
+      }
+      std::lock_guard<std::mutex> lock(m_DeferredMutex);
+      m_Array = nullptr;
+      m_OwnsData = true;
+      // The array logically holds its values, they are just not in memory yet
+      m_IsAllocated = true;
+      m_DeferredLoader = loader;
+      m_DeferredLoadFailed = false;
+      m_DataDeferred.store(true, std::memory_order_release);
+      return true;
+    }
+
+    /**
+     * @brief isDataDeferred Reimplemented from @see IDataArray class
+     * @return
+     */
+    bool isDataDeferred() override
+    {
+      return m_DataDeferred.load(std::memory_order_acquire);
+    }
+
+    /**
+     * @brief readDeferredData Reimplemented from @see IDataArray class
+     * @return
+     */
+    bool readDeferredData() override
+    {
+      if(m_DataDeferred.load(std::memory_order_acquire))
+      {
+        loadDeferredData();
+      }
+      // A failed read is remembered until the array gets new values
+      std::lock_guard<std::mutex> lock(m_DeferredMutex);
+      return !m_DeferredLoadFailed || nullptr != m_Array;
+    }
+
+    /**
+     * @brief isDataShared Reimplemented from @see IDataArray class
+     * @return
+     */
+    bool isDataShared() override
+    {
+      std::lock_guard<std::mutex> lock(m_SharedMutex);
+      return (nullptr != m_SharedStorage) && (m_SharedStorage.use_count() > 1);
+    }
+
   protected:
     /**
     * @brief Protected Constructor
@@ -1323,6 +1477,9 @@ class DataArray : public IDataArray
     * @param takeOwnership Will the class clean up the memory. Default=true
     */
     DataArray(size_t numTuples, QVector<size_t> compDims, QString name, bool ownsData = true) :
+      m_DataDeferred(false),
+      m_DeferredLoadFailed(false),
+      m_DataShared(false),
       m_Array(nullptr),
       m_OwnsData(ownsData),
       m_IsAllocated(false),
@@ -1395,6 +1552,7 @@ class DataArray : public IDataArray
         clear();
         return 1;
       }
+      ensureDataLoaded();
       T* ptr = resizeAndExtend(size);
       if ( nullptr != ptr)
       {
@@ -1450,6 +1608,8 @@ class DataArray : public IDataArray
 
         // Copy the data from the old array.
         std::memcpy(newArray, m_Array, (newSize < m_Size ? newSize : m_Size) * sizeof(T));
+        // The old array may have been shared with copies made by deepCopy()
+        releaseSharedData();
       }
       else if (!dontUseRealloc)
       {
@@ -1499,7 +1659,202 @@ class DataArray : public IDataArray
     }
 
 
+    /**
+     * @brief ensureDataLoaded Reads the values of the array if they were deferred with setDeferredLoader()
+     */
+    inline void ensureDataLoaded()
+    {
+      if(m_DataDeferred.load(std::memory_order_acquire))
+      {
+        loadDeferredData();
+      }
+    }
+
+    /**
+     * @brief loadDeferredData Allocates the array and fills it using the deferred loader. Several threads
+     * may ask for the values at the same time so only the first one reads them. If the values can not be
+     * read the array stays unallocated and readDeferredData() returns false from then on.
+     */
+    void loadDeferredData()
+    {
+      std::lock_guard<std::mutex> lock(m_DeferredMutex);
+      if(!m_DataDeferred.load(std::memory_order_relaxed))
+      {
+        return;
+      }
+      DeferredLoader loader = m_DeferredLoader;
+      m_DeferredLoader = DeferredLoader();
+
+      T* buffer = AllocateBuffer(m_Size);
+      if(!loader(buffer, m_Size * sizeof(T)))
+      {
+        FreeBuffer(buffer);
+        buffer = nullptr;
+        m_IsAllocated = false;
+        m_DeferredLoadFailed = true;
+      }
+      m_Array = buffer;
+      m_OwnsData = true;
+      m_DataDeferred.store(false, std::memory_order_release);
+    }
+
+    /**
+     * @brief AllocateBuffer Allocates memory for numElements values the same way allocate() does
+     * @param numElements
+     * @return nullptr if the memory could not be allocated
+     */
+    static T* AllocateBuffer(size_t numElements)
+    {
+#if defined ( AIM_USE_SSE ) && defined ( __SSE2__ )
+      return static_cast<T*>(_mm_malloc(numElements * sizeof(T), 16));
+#else
+      return static_cast<T*>(malloc(numElements * sizeof(T)));
+#endif
+    }
+
+    /**
+     * @brief FreeBuffer Frees memory that was allocated with AllocateBuffer()
+     * @param buffer
+     */
+    static void FreeBuffer(T* buffer)
+    {
+#if defined ( AIM_USE_SSE ) && defined ( __SSE2__ )
+      _mm_free(buffer);
+#else
+      free(buffer);
+#endif
+    }
+
+    /**
+     * @brief cancelDeferredData Drops the deferred loader without reading the values
+     */
+    void cancelDeferredData()
+    {
+      std::lock_guard<std::mutex> lock(m_DeferredMutex);
+      m_DeferredLoadFailed = false;
+      if(m_DataDeferred.load(std::memory_order_relaxed))
+      {
+        m_DeferredLoader = DeferredLoader();
+        m_IsAllocated = false;
+        m_DataDeferred.store(false, std::memory_order_release);
+      }
+    }
+
+    /**
+     * @brief ensureUniqueData Gives this array its own copy of the values if they are shared with a copy
+     * made by deepCopy(). Must be called before the values are modified; read only accessors never call it.
+     * @return false if the copy could not be allocated. The values then stay shared and must not be modified.
+     */
+    inline bool ensureUniqueData()
+    {
+      if(m_DataShared.load(std::memory_order_acquire))
+      {
+        return detachSharedData();
+      }
+      return true;
+    }
+
+    /**
+     * @brief detachSharedData Copies the shared values into a buffer owned by this array. If every other
+     * array already let go of the shared buffer it is taken over without copying.
+     * @return false if the copy could not be allocated
+     */
+    bool detachSharedData()
+    {
+      std::lock_guard<std::mutex> lock(m_SharedMutex);
+      if(!m_DataShared.load(std::memory_order_relaxed))
+      {
+        return true;
+      }
+      if(m_SharedStorage.use_count() == 1)
+      {
+        m_SharedStorage->data = nullptr;
+      }
+      else
+      {
+        T* buffer = AllocateBuffer(m_Size);
+        if(nullptr == buffer)
+        {
+          return false;
+        }
+        std::memcpy(buffer, m_Array, m_Size * sizeof(T));
+        m_Array = buffer;
+      }
+      m_SharedStorage.reset();
+      m_OwnsData = true;
+      m_DataShared.store(false, std::memory_order_release);
+      return true;
+    }
+
+    /**
+     * @brief releaseSharedData Lets go of values that are shared with a copy made by deepCopy(). The
+     * buffer is freed by the last array that references it.
+     * @return true if the values were shared, in which case the internal array is now nullptr
+     */
+    bool releaseSharedData()
+    {
+      if(!m_DataShared.load(std::memory_order_acquire))
+      {
+        return false;
+      }
+      std::lock_guard<std::mutex> lock(m_SharedMutex);
+      m_SharedStorage.reset();
+      m_Array = nullptr;
+      m_DataShared.store(false, std::memory_order_release);
+      return true;
+    }
+
+    /**
+     * @brief shareData Creates a copy of this array that references the same buffer
+     * @return
+     */
+    IDataArray::Pointer shareData()
+    {
+      std::lock_guard<std::mutex> lock(m_SharedMutex);
+      if(nullptr == m_SharedStorage)
+      {
+        // The buffer is handed to a SharedStorage which frees it once no array references it
+        m_SharedStorage = std::make_shared<SharedStorage>();
+        m_SharedStorage->data = m_Array;
+        m_OwnsData = false;
+        m_DataShared.store(true, std::memory_order_release);
+      }
+
+      DataArray* d = new DataArray(m_NumTuples, m_CompDims, m_Name, false);
+      Pointer daCopy(d);
+      d->m_Array = m_Array;
+      d->m_Size = m_Size;
+      d->m_MaxId = m_MaxId;
+      d->m_IsAllocated = true;
+      d->m_OwnsData = false;
+      d->m_InitValue = m_InitValue;
+      d->m_SharedStorage = m_SharedStorage;
+      d->m_DataShared.store(true, std::memory_order_release);
+      return daCopy;
+    }
+
   private:
+    /**
+     * @brief SharedStorage owns a buffer that is referenced by several arrays after deepCopy()
+     */
+    struct SharedStorage
+    {
+      T* data = nullptr;
+
+      ~SharedStorage()
+      {
+        FreeBuffer(data);
+      }
+    };
+
+    std::atomic<bool> m_DataDeferred;
+    std::mutex m_DeferredMutex;
+    DeferredLoader m_DeferredLoader;
+    bool m_DeferredLoadFailed;
+
+    std::atomic<bool> m_DataShared;
+    std::mutex m_SharedMutex;
+    std::shared_ptr<SharedStorage> m_SharedStorage;
 
     //  unsigned long long int MUD_FLAP_0;
     T* m_Array;
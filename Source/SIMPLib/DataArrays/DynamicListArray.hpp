@@ -33,10 +33,14 @@
 *
 * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 
+
 #pragma once
 
+#include <cstring>
 #include <vector>
 
+#include <QtCore/QVector>
+
 //-- DREAM3D Includes
 #include "SIMPLib/Common/SIMPLibSetGetMacros.h"
 #include "SIMPLib/SIMPLib.h"
@@ -44,6 +48,9 @@
 /**
  * @brief The MeshFaceNeighbors class contains arrays of Faces for each Node in the mesh. This allows quick query to the node
  * to determine what Cells the node is a part of.
+ *
+ * The lists are stored in compressed sparse row form: one array of offsets with size() + 1 entries and one contiguous
+ * array holding the values of every list back to back. The values of list i are [offsets[i], offsets[i + 1]).
  */
 template <typename T, typename K> class DynamicListArray
 {
@@ -52,6 +59,10 @@ public:
   SIMPL_STATIC_NEW_MACRO(DynamicListArray)
   SIMPL_TYPE_MACRO(DynamicListArray)
 
+  /**
+   * @brief The ElementList class is a view of a single list. The cells pointer is owned by the DynamicListArray
+   * and is only valid until the array is reallocated.
+   */
   class ElementList
   {
   public:
@@ -59,25 +70,7 @@ public:
     K* cells;
   };
 
-  // -----------------------------------------------------------------------------
-  //
-  // -----------------------------------------------------------------------------
-  virtual ~DynamicListArray()
-  {
-    // This makes sure we deallocate any lists that have been created
-    for(size_t i = 0; i < this->m_Size; i++)
-    {
-      if(this->m_Array[i].cells != nullptr)
-      {
-        delete[] this->m_Array[i].cells;
-      }
-    }
-    // Now delete all the "NeighborLists" structures
-    if(this->m_Array != nullptr)
-    {
-      delete[] this->m_Array;
-    }
-  }
+  virtual ~DynamicListArray() = default;
 
   /**
    * @brief size
@@ -85,7 +78,7 @@ public:
    */
   size_t size()
   {
-    return m_Size;
+    return m_Offsets.empty() ? 0 : m_Offsets.size() - 1;
   }
 
   /**
@@ -96,26 +89,13 @@ public:
   Pointer deepCopy(bool forceNoAllocate = false)
   {
     DynamicListArray::Pointer copy = DynamicListArray::New();
-    std::vector<T> linkCounts(m_Size, 0);
     if(forceNoAllocate)
     {
-      copy->allocateLists(linkCounts);
+      copy->allocate(size());
       return copy;
     }
-
-    // Figure out how many entries, and for each entry, how many cells
-    for(size_t ptId = 0; ptId < m_Size; ptId++)
-    {
-      linkCounts[ptId] = this->m_Array[ptId].ncells;
-    }
-    // Allocate all that in the copy
-    copy->allocateLists(linkCounts);
-    // Copy the data from the original to the new
-    for(size_t ptId = 0; ptId < m_Size; ptId++)
-    {
-      ElementList& elementList = getElementList(ptId);
-      copy->setElementList(ptId, elementList);
-    }
+    copy->m_Offsets = m_Offsets;
+    copy->m_Values = m_Values;
     return copy;
   }
 
@@ -127,7 +107,7 @@ public:
    */
   inline void insertCellReference(size_t ptId, size_t pos, size_t cellId)
   {
-    this->m_Array[ptId].cells[pos] = cellId;
+    this->m_Values[m_Offsets[ptId] + pos] = static_cast<K>(cellId);
   }
 
   /**
@@ -135,13 +115,15 @@ public:
    * @param ptId
    * @return
    */
-  ElementList& getElementList(size_t ptId)
+  ElementList getElementList(size_t ptId)
   {
-    return this->m_Array[ptId];
+    ElementList list = {getNumberOfElements(ptId), getElementListPointer(ptId)};
+    return list;
   }
 
   /**
-   * @brief setElementList
+   * @brief setElementList Replaces the list at ptId. If the size of the list changes every list after
+   * ptId has to move, so lists should be sized with allocateLists() up front wherever possible.
    * @param ptId
    * @param nCells
    * @param data
@@ -149,19 +131,31 @@ public:
    */
   bool setElementList(size_t ptId, T nCells, K* data)
   {
-    if(ptId >= m_Size)
+    if(ptId >= size())
     {
       return false;
     }
-    if(nullptr != m_Array[ptId].cells && m_Array[ptId].ncells > 0)
+    T oldCells = getNumberOfElements(ptId);
+    if(nCells != oldCells)
     {
-      m_Array[ptId].cells = nullptr;
-      m_Array[ptId].ncells = 0;
+      typename std::vector<K>::iterator listEnd = m_Values.begin() + m_Offsets[ptId + 1];
+      if(nCells > oldCells)
+      {
+        m_Values.insert(listEnd, static_cast<size_t>(nCells - oldCells), K(0));
+      }
+      else
+      {
+        m_Values.erase(listEnd - (oldCells - nCells), listEnd);
+      }
+      for(size_t i = ptId + 1; i < m_Offsets.size(); i++)
+      {
+        m_Offsets[i] = m_Offsets[i] + nCells - oldCells;
+      }
+    }
+    if(nCells > 0)
+    {
+      ::memcpy(getElementListPointer(ptId), data, sizeof(K) * nCells);
     }
-    m_Array[ptId].ncells = nCells;
-    // If nCells is huge then there could be problems with this
-    this->m_Array[ptId].cells = new K[nCells];
-    ::memcpy(m_Array[ptId].cells, data, sizeof(K) * nCells);
     return true;
   }
 
@@ -173,22 +167,7 @@ public:
    */
   bool setElementList(size_t ptId, ElementList& list)
   {
-    T nCells = list.ncells;
-    K* data = list.cells;
-    if(ptId >= m_Size)
-    {
-      return false;
-    }
-    if(nullptr != m_Array[ptId].cells && m_Array[ptId].ncells > 0)
-    {
-      m_Array[ptId].cells = nullptr;
-      m_Array[ptId].ncells = 0;
-    }
-    m_Array[ptId].ncells = nCells;
-    // If nCells is huge then there could be problems with this
-    this->m_Array[ptId].cells = new K[nCells];
-    ::memcpy(m_Array[ptId].cells, data, sizeof(K) * nCells);
-    return true;
+    return setElementList(ptId, list.ncells, list.cells);
   }
 
   /**
@@ -198,7 +177,7 @@ public:
    */
   T getNumberOfElements(size_t ptId)
   {
-    return this->m_Array[ptId].ncells;
+    return static_cast<T>(m_Offsets[ptId + 1] - m_Offsets[ptId]);
   }
 
   /**
@@ -208,55 +187,78 @@ public:
    */
   K* getElementListPointer(size_t ptId)
   {
-    return this->m_Array[ptId].cells;
+    return this->m_Values.data() + m_Offsets[ptId];
+  }
+
+  /**
+   * @brief getNumberOfValues Returns the total number of entries over all lists
+   * @return
+   */
+  size_t getNumberOfValues()
+  {
+    return m_Values.size();
+  }
+
+  /**
+   * @brief getValuesPointer Returns the contiguous storage that holds the values of every list
+   * @return
+   */
+  K* getValuesPointer()
+  {
+    return m_Values.data();
+  }
+
+  /**
+   * @brief getOffsetsPointer Returns the size() + 1 offsets into getValuesPointer() where each list starts
+   * @return
+   */
+  const size_t* getOffsetsPointer()
+  {
+    return m_Offsets.data();
   }
 
   /**
    * @brief deserializeLinks
    * @param buffer
    * @param nElements
+   * @return false if the buffer is too small to hold nElements lists
    */
-  void deserializeLinks(QVector<uint8_t>& buffer, size_t nElements)
+  bool deserializeLinks(QVector<uint8_t>& buffer, size_t nElements)
   {
-    size_t offset = 0;
-    allocate(nElements); // Allocate all the links with 0 and nullptr;
-    uint8_t* bufPtr = buffer.data();
-
-    // Walk the array and allocate all the array links to Zero and nullptr
-    T* ncells = nullptr;
-    for(size_t i = 0; i < nElements; ++i)
-    {
-      ncells = reinterpret_cast<T*>(bufPtr + offset);
-      this->m_Array[i].ncells = *ncells; // Set the number of cells in this link
-      offset += 2;
-      this->m_Array[i].cells = new K[(*ncells)];                                // Allocate a new chunk of memory to store the list
-      ::memcpy(this->m_Array[i].cells, bufPtr + offset, (*ncells) * sizeof(K)); // Copy from the buffer into the new list memory
-      offset += (*ncells) * sizeof(K);                                          // Increment the offset
-    }
+    return deserializeLinks(buffer.data(), static_cast<size_t>(buffer.size()), nElements);
   }
 
   /**
    * @brief deserializeLinks
    * @param buffer
    * @param nElements
+   * @return false if the buffer is too small to hold nElements lists
    */
-  void deserializeLinks(std::vector<uint8_t>& buffer, size_t nElements)
+  bool deserializeLinks(std::vector<uint8_t>& buffer, size_t nElements)
   {
-    size_t offset = 0;
-    allocate(nElements); // Allocate all the links with 0 and nullptr;
-    uint8_t* bufPtr = &(buffer.front());
+    return deserializeLinks(buffer.data(), buffer.size(), nElements);
+  }
 
-    // Walk the array and allocate all the array links to Zero and nullptr
-    T* ncells = nullptr;
-    // int32_t* cells = nullptr;
-    for(size_t i = 0; i < nElements; ++i)
+  /**
+   * @brief serializeLinks Writes every list as its count followed by its values, which is the layout
+   * deserializeLinks() reads back
+   * @param buffer
+   */
+  void serializeLinks(std::vector<uint8_t>& buffer)
+  {
+    size_t numLists = size();
+    buffer.resize(numLists * sizeof(T) + m_Values.size() * sizeof(K));
+    uint8_t* bufPtr = buffer.data();
+    for(size_t i = 0; i < numLists; ++i)
     {
-      ncells = reinterpret_cast<T*>(bufPtr + offset);
-      this->m_Array[i].ncells = *ncells; // Set the number of cells in this link
-      offset += 2;
-      this->m_Array[i].cells = new K[(*ncells)];                                // Allocate a new chunk of memory to store the list
-      ::memcpy(this->m_Array[i].cells, bufPtr + offset, (*ncells) * sizeof(K)); // Copy from the buffer into the new list memory
-      offset += (*ncells) * sizeof(K);                                          // Increment the offset
+      // The position of each list follows from its offset, so no running sum is needed
+      uint8_t* listPtr = bufPtr + i * sizeof(T) + m_Offsets[i] * sizeof(K);
+      T ncells = getNumberOfElements(i);
+      ::memcpy(listPtr, &ncells, sizeof(T));
+      if(ncells > 0)
+      {
+        ::memcpy(listPtr + sizeof(T), m_Values.data() + m_Offsets[i], ncells * sizeof(K));
+      }
     }
   }
 
@@ -266,12 +268,7 @@ public:
    */
   void allocateLists(QVector<T>& linkCounts)
   {
-    allocate(linkCounts.size());
-    for(typename std::vector<T>::size_type i = 0; i < linkCounts.size(); i++)
-    {
-      this->m_Array[i].ncells = linkCounts[i];
-      this->m_Array[i].cells = new K[this->m_Array[i].ncells];
-    }
+    allocateLists(linkCounts.data(), static_cast<size_t>(linkCounts.size()));
   }
 
   /**
@@ -280,59 +277,84 @@ public:
    */
   void allocateLists(std::vector<T>& linkCounts)
   {
-    allocate(linkCounts.size());
-    for(typename std::vector<T>::size_type i = 0; i < linkCounts.size(); i++)
+    allocateLists(linkCounts.data(), linkCounts.size());
+  }
+
+  /**
+   * @brief allocateLists Sizes every list from linkCounts. The values are left zeroed.
+   * @param linkCounts
+   * @param numLists
+   */
+  void allocateLists(const T* linkCounts, size_t numLists)
+  {
+    m_Offsets.resize(numLists + 1);
+    m_Offsets[0] = 0;
+    for(size_t i = 0; i < numLists; i++)
     {
-      this->m_Array[i].ncells = linkCounts[i];
-      this->m_Array[i].cells = new K[this->m_Array[i].ncells];
+      m_Offsets[i + 1] = m_Offsets[i] + static_cast<size_t>(linkCounts[i]);
     }
+    m_Values.assign(m_Offsets[numLists], K(0));
   }
 
 protected:
-  DynamicListArray()
-  : m_Array(nullptr)
-  , m_Size(0)
-  {
-  }
+  DynamicListArray() = default;
 
   //----------------------------------------------------------------------------
-  // This will allocate memory to hold all the NeighborList structures where each
-  // structure is initialized to Zero Entries and a nullptr Pointer
-  void allocate(size_t sz, size_t ext = 1000)
+  // This will allocate sz lists that all have zero entries
+  void allocate(size_t sz)
   {
-    static typename DynamicListArray<T, K>::ElementList linkInit = {0, nullptr};
+    m_Offsets.assign(sz + 1, 0);
+    m_Values.clear();
+  }
 
-    // This makes sure we deallocate any lists that have been created
-    for(size_t i = 0; i < this->m_Size; i++)
+  /**
+   * @brief deserializeLinks Reads nElements lists stored as a count of type T followed by that many values of type K
+   * @param bufPtr
+   * @param bufSize
+   * @param nElements
+   * @return false if the buffer is too small to hold nElements lists, in which case every list is empty
+   */
+  bool deserializeLinks(const uint8_t* bufPtr, size_t bufSize, size_t nElements)
+  {
+    // The first pass only reads the counts to size the storage
+    m_Offsets.resize(nElements + 1);
+    m_Offsets[0] = 0;
+    size_t offset = 0;
+    T ncells = 0;
+    for(size_t i = 0; i < nElements; ++i)
     {
-      if(this->m_Array[i].cells != nullptr)
+      if(offset + sizeof(T) > bufSize)
       {
-        delete[] this->m_Array[i].cells;
+        allocate(nElements);
+        return false;
       }
+      ::memcpy(&ncells, bufPtr + offset, sizeof(T));
+      m_Offsets[i + 1] = m_Offsets[i] + static_cast<size_t>(ncells);
+      offset += sizeof(T) + static_cast<size_t>(ncells) * sizeof(K);
     }
-    // Now delete all the "NeighborLists" structures
-    if(this->m_Array != nullptr)
+    if(offset > bufSize)
     {
-      delete[] this->m_Array;
+      allocate(nElements);
+      return false;
     }
 
-    this->m_Size = sz;
-    // Allocate a whole new set of structures
-    this->m_Array = new typename DynamicListArray<T, K>::ElementList[sz];
-
-    // Initialize each structure to have 0 entries and nullptr pointer.
-    for(size_t i = 0; i < sz; i++)
+    m_Values.resize(m_Offsets[nElements]);
+    for(size_t i = 0; i < nElements; ++i)
     {
-      this->m_Array[i] = linkInit;
+      size_t count = m_Offsets[i + 1] - m_Offsets[i];
+      if(count > 0)
+      {
+        ::memcpy(m_Values.data() + m_Offsets[i], bufPtr + i * sizeof(T) + m_Offsets[i] * sizeof(K) + sizeof(T), count * sizeof(K));
+      }
     }
+    return true;
   }
 
 private:
-  ElementList* m_Array; // pointer to data
-  size_t m_Size;
+  std::vector<size_t> m_Offsets; // size() + 1 entries; list i is [m_Offsets[i], m_Offsets[i + 1])
+  std::vector<K> m_Values;       // the values of all lists back to back
 };
 
 typedef DynamicListArray<int32_t, int32_t> Int32Int32DynamicListArray;
 typedef DynamicListArray<uint16_t, int64_t> UInt16Int64DynamicListArray;
 typedef DynamicListArray<int64_t, int64_t> Int64Int64DynamicListArray;
-
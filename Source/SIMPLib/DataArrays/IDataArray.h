@@ -12,6 +12,7 @@
 
 
 //-- C++
+#include <functional>
 #include <vector>
 
 #include <hdf5.h>
@@ -132,6 +133,13 @@ class SIMPLib_EXPORT IDataArray
      */
     virtual size_t getTypeSize() = 0;
 
+    /**
+     * @brief Returns the number of bytes the values take up in memory. The default is getSize() * getTypeSize(),
+     * which start at getVoidPointer(0); arrays that do not store one value per element override it.
+     * @return
+     */
+    virtual size_t getNumberOfBytes();
+
     /**
      * @brief GetTypeName Returns a string representation of the type of data that is stored by this class. This
      * can be a primitive like char, float, int or the name of a class.
@@ -286,6 +294,44 @@ class SIMPLib_EXPORT IDataArray
      */
     virtual QString getInfoString(SIMPL::InfoStringFormat format) = 0;
 
+    /**
+     * @brief A DeferredLoader fills a buffer of numBytes bytes with the values of an array. It returns
+     * false if the values could not be read. The buffer is nullptr if the array could not allocate the
+     * memory for its values, in which case the loader only returns false.
+     */
+    using DeferredLoader = std::function<bool(void* buffer, size_t numBytes)>;
+
+    /**
+     * @brief setDeferredLoader Releases any memory held by the array and postpones reading its values
+     * until the first time they are accessed, at which point the loader is called. The tuple and
+     * component dimensions must already be set. The default implementation does not support deferred
+     * data and returns false.
+     * @param loader
+     * @return true if the array will read its values on demand
+     */
+    virtual bool setDeferredLoader(const DeferredLoader& loader);
+
+    /**
+     * @brief isDataDeferred Returns true if the values of the array have not been read yet
+     * @return
+     */
+    virtual bool isDataDeferred();
+
+    /**
+     * @brief readDeferredData Reads the values of the array now if they were deferred with setDeferredLoader()
+     * @return false if the values were deferred and could not be read, including when an earlier accessor
+     * already tried to read them
+     */
+    virtual bool readDeferredData();
+
+    /**
+     * @brief isDataShared Returns true if the values of the array are shared with a copy made by deepCopy().
+     * Shared values are copied the first time either array is modified. The default implementation does
+     * not share values and returns false.
+     * @return
+     */
+    virtual bool isDataShared();
+
   protected:
 
   private:
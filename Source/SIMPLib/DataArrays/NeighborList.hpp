@@ -36,6 +36,9 @@
 
 #pragma once
 
+#include <algorithm>
+#include <atomic>
+#include <mutex>
 #include <vector>
 
 #include <QtCore/QString>
@@ -52,11 +55,22 @@
 #include "SIMPLib/Common/SIMPLibSetGetMacros.h"
 #include "SIMPLib/DataArrays/IDataArray.h"
 #include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/HDF5/H5DataArrayWriter.hpp"
 
 
 /**
  * @class NeighborList NeighborList.hpp DREAM3DLib/Common/NeighborList.hpp
  * @brief Template class for wrapping raw arrays of data.
+ *
+ * The lists are normally stored packed, in compressed sparse row form: every value of every list sits in one
+ * values buffer and an offsets array marks where each list starts. Lists read from a file, deep copies and lists
+ * built by appending to the last list with addEntry() stay packed. The accessors that hand out a list as a
+ * std::vector (getListReference(), getList(), operator[]) and the calls that modify a list in the middle
+ * (setList(), copyTuple(), addEntry() on an earlier list) first unpack the lists into one vector per list, which is
+ * how this class has always stored them, and release the packed buffers. pack() converts them back. Unpacking is
+ * safe while other threads also call the std::vector accessors, but frees the buffers the other accessors read, so
+ * it must not overlap calls to getValue(), getListSize() or copyOfList() from other threads. Call unpack() before
+ * handing a packed list to several threads that use both kinds of accessors.
  * @author mjackson
  * @date July 3, 2008
  * @version 1.0
@@ -355,7 +369,7 @@ class NeighborList : public IDataArray
         return 0;
       }
 
-      size_t arraySize = m_Array.size();
+      size_t arraySize = getNumberOfListsInternal();
       // Sanity Check the Indices in the vector to make sure we are not trying to remove any indices that are
       // off the end of the array and return an error code.
       for(QVector<size_t>::size_type i = 0; i < idxs.size(); ++i)
@@ -363,6 +377,41 @@ class NeighborList : public IDataArray
         if (idxs[i] >= arraySize) { return -100; }
       }
 
+      if(m_Packed)
+      {
+        // Lists only ever move towards the front so the values can be compacted in place
+        std::vector<size_t> offsets(arraySize - idxsSize + 1, 0);
+        size_t idxsIndex = 0;
+        size_t rIdx = 0;
+        size_t writePos = 0;
+        for(size_t dIdx = 0; dIdx < arraySize; ++dIdx)
+        {
+          if (dIdx != idxs[idxsIndex])
+          {
+            size_t begin = getPackedListBegin(dIdx);
+            size_t count = getPackedListSize(dIdx);
+            if(writePos != begin)
+            {
+              std::move(m_Values.begin() + begin, m_Values.begin() + begin + count, m_Values.begin() + writePos);
+            }
+            offsets[rIdx] = writePos;
+            writePos += count;
+            ++rIdx;
+          }
+          else
+          {
+            ++idxsIndex;
+            if (idxsIndex == idxsSize ) { idxsIndex--;}
+          }
+        }
+        offsets[rIdx] = writePos;
+        m_Values.resize(writePos);
+        m_Offsets.swap(offsets);
+        m_NumberOfLists = arraySize - idxsSize;
+        m_NumTuples = m_NumberOfLists;
+        return err;
+      }
+
       std::vector<SharedVectorType> replacement(arraySize - idxsSize);
 
       size_t idxsIndex = 0;
@@ -393,6 +442,7 @@ class NeighborList : public IDataArray
      */
     int copyTuple(size_t currentPos, size_t newPos) override
     {
+      unpack();
       m_Array[newPos] = m_Array[currentPos];
       return 0;
     }
@@ -423,9 +473,10 @@ class NeighborList : public IDataArray
     bool copyFromArray(size_t destTupleOffset, IDataArray::Pointer sourceArray, size_t srcTupleOffset, size_t totalSrcTuples) override
     {
       if(!m_IsAllocated) { return false; }
-      if(destTupleOffset >= m_Array.size() ) { return false; }
+      if(destTupleOffset >= getNumberOfListsInternal() ) { return false; }
       if(!sourceArray->isAllocated()) { return false; }
       Self* source = dynamic_cast<Self*>(sourceArray.get());
+      if(nullptr == source) { return false; }
 
       if(sourceArray->getNumberOfComponents() != getNumberOfComponents())
       {
@@ -437,14 +488,15 @@ class NeighborList : public IDataArray
         return false;
       }
 
-      if(totalSrcTuples * sourceArray->getNumberOfComponents() + destTupleOffset * getNumberOfComponents() > m_Array.size())
+      if(totalSrcTuples * sourceArray->getNumberOfComponents() + destTupleOffset * getNumberOfComponents() > getNumberOfListsInternal())
       {
         return false;
       }
 
-      for(size_t i = srcTupleOffset; i < srcTupleOffset + totalSrcTuples; i++)
+      unpack();
+      for(size_t i = 0; i < totalSrcTuples; i++)
       {
-        m_Array[destTupleOffset + i] = source->getList(i);
+        m_Array[destTupleOffset + i] = SharedVectorType(new VectorType(source->copyOfList(static_cast<int>(srcTupleOffset + i))));
       }
       return true;
 
@@ -496,10 +548,14 @@ class NeighborList : public IDataArray
      */
     size_t getSize() override
     {
+      if(m_Packed)
+      {
+        return m_Values.size();
+      }
       size_t total = 0;
       for(size_t dIdx = 0; dIdx < m_Array.size(); ++dIdx)
       {
-        total += m_Array[dIdx]->size();
+        total += (nullptr == m_Array[dIdx]) ? 0 : m_Array[dIdx]->size();
       }
       return total;
     }
@@ -548,7 +604,7 @@ class NeighborList : public IDataArray
      * @brief initializeWithZeros
      */
     void initializeWithZeros() override {
-      m_Array.clear();
+      clearStorage();
       m_IsAllocated = false;
     }
 
@@ -560,14 +616,20 @@ class NeighborList : public IDataArray
     {
       typename NeighborList<T>::Pointer daCopyPtr = NeighborList<T>::CreateArray(getNumberOfTuples(), getName(), m_IsAllocated);
 
-      if(forceNoAllocate == false)
+      if(forceNoAllocate == false && m_IsAllocated)
       {
-        size_t count = (m_IsAllocated ? getNumberOfTuples(): 0);
-        for(size_t i = 0; i < count; i++)
+        // The copy is always packed, whatever the storage of this list is
+        if(m_Packed)
         {
-          typename NeighborList<T>::SharedVectorType sharedNeiLst(new std::vector<T>(*(m_Array[i])));
-          daCopyPtr->setList(static_cast<int>(i), sharedNeiLst);
+          daCopyPtr->m_Offsets = m_Offsets;
+          daCopyPtr->m_Values = m_Values;
         }
+        else
+        {
+          buildPackedStorage(daCopyPtr->m_Offsets, daCopyPtr->m_Values);
+        }
+        daCopyPtr->m_NumberOfLists = getNumberOfListsInternal();
+        daCopyPtr->resizeTotalElements(getNumberOfTuples());
       }
       return daCopyPtr;
     }
@@ -580,6 +642,19 @@ class NeighborList : public IDataArray
     int32_t resizeTotalElements(size_t size) override
     {
       //std::cout << "NeighborList::resizeTotalElements(" << size << ")" << std::endl;
+      if(m_Packed)
+      {
+        // Lists past the end of the offsets are empty, so growing only changes the count
+        if(size + 1 < m_Offsets.size())
+        {
+          m_Offsets.resize(size + 1);
+          m_Values.resize(m_Offsets.back());
+        }
+        m_NumberOfLists = size;
+        m_NumTuples = size;
+        m_IsAllocated = (size != 0);
+        return 1;
+      }
       size_t old = m_Array.size();
       m_Array.resize(size);
       m_NumTuples = size;
@@ -603,6 +678,17 @@ class NeighborList : public IDataArray
     //FIXME: These need to be implemented
     void printTuple(QTextStream& out, size_t i, char delimiter = ',') override
     {
+      if(m_Packed)
+      {
+        size_t begin = getPackedListBegin(i);
+        size_t size = getPackedListSize(i);
+        out << size;
+        for(size_t j = 0; j < size; j++)
+        {
+          out << delimiter << m_Values[begin + j];
+        }
+        return;
+      }
       SharedVectorType sharedVec = m_Array[i];
       VectorType* vec = sharedVec.get();
       size_t size = vec->size();
@@ -638,13 +724,15 @@ class NeighborList : public IDataArray
       // can compare this with what is written in the file. If they are
       // different we are going to overwrite what is in the file with what
       // we compute here.
-      Int32ArrayType::Pointer numNeighborsPtr = Int32ArrayType::CreateArray(m_Array.size(), m_NumNeighborsArrayName);
+      size_t numLists = getNumberOfListsInternal();
+      Int32ArrayType::Pointer numNeighborsPtr = Int32ArrayType::CreateArray(numLists, m_NumNeighborsArrayName);
       int32_t* numNeighbors = numNeighborsPtr->getPointer(0);
       size_t total = 0;
-      for(size_t dIdx = 0; dIdx < m_Array.size(); ++dIdx)
+      for(size_t dIdx = 0; dIdx < numLists; ++dIdx)
       {
-        numNeighbors[dIdx] = static_cast<int32_t>(m_Array[dIdx]->size());
-        total += m_Array[dIdx]->size();
+        size_t listSize = m_Packed ? getPackedListSize(dIdx) : ((nullptr == m_Array[dIdx]) ? 0 : m_Array[dIdx]->size());
+        numNeighbors[dIdx] = static_cast<int32_t>(listSize);
+        total += listSize;
       }
 
       // Check to see if the NumNeighbors is already written to the file
@@ -658,7 +746,7 @@ class NeighborList : public IDataArray
       {
         // The NumNeighbors array is in the dream3d file so read it up into memory and compare with what
         // we have in memory.
-        std::vector<int32_t> fileNumNeigh(m_Array.size());
+        std::vector<int32_t> fileNumNeigh(numLists);
         err = QH5Lite::readVectorDataset(parentId, m_NumNeighborsArrayName, fileNumNeigh);
         if (err < 0)
         {
@@ -686,29 +774,10 @@ class NeighborList : public IDataArray
         numNeighborsPtr->writeH5Data(parentId, tDims);
       }
 
-      // Allocate an array of the proper size so we can concatenate all the arrays together into a single array that
-      // can be written to the HDF5 File. This operation can ballon the memory size temporarily until this operation
-      // is complete.
-      QVector<T> flat (total);
-      size_t currentStart = 0;
-      for(size_t dIdx = 0; dIdx < m_Array.size(); ++dIdx)
-      {
-        size_t nEle = m_Array[dIdx]->size();
-        if (nEle == 0) { continue; }
-        T* start = &(m_Array[dIdx]->front()); // get the pointer to the front of the array
-        //    T* end = start + nEle; // get the pointer to the end of the array
-        T* dst = &(flat.front()) + currentStart;
-        ::memcpy(dst, start, nEle * sizeof(T));
-
-        currentStart += m_Array[dIdx]->size();
-      }
-
       // Now we can actually write the actual array data.
-      int32_t rank = 1;
-      hsize_t dims[1] = { total };
       if (total > 0)
       {
-        err = QH5Lite::writePointerDataset(parentId, getName(), rank, dims, &(flat.front()));
+        err = writeValuesDataset(parentId, total);
         if(err < 0)
         {
           return -605;
@@ -838,36 +907,34 @@ class NeighborList : public IDataArray
         return -703;
       }
 
-      std::vector<T> flat;
-      err = QH5Lite::readVectorDataset(parentId, getName(), flat);
+      std::vector<size_t> offsets(numNeighbors.size() + 1, 0);
+      for(size_t dIdx = 0; dIdx < numNeighbors.size(); ++dIdx)
+      {
+        if(numNeighbors[dIdx] < 0)
+        {
+          return -704;
+        }
+        offsets[dIdx + 1] = offsets[dIdx] + static_cast<size_t>(numNeighbors[dIdx]);
+      }
+
+      // The values are read straight into the packed storage, one list after the other
+      std::vector<T> values;
+      err = QH5Lite::readVectorDataset(parentId, getName(), values);
       if (err < 0)
       {
         return err;
       }
-      // Loop over all the entries and make new Vectors to hold the incoming data
-      m_Array.resize(numNeighbors.size());
-      m_IsAllocated = true;
-      size_t currentStart = 0;
-      qint32 count = static_cast<qint32>(numNeighbors.size());
-      for(QVector<int32_t>::size_type dIdx = 0; dIdx < count; ++dIdx)
+      if(values.size() != offsets.back())
       {
-        size_t nEle = numNeighbors[dIdx];
-        if(nEle > 0)
-        {
-          m_Array[dIdx] = SharedVectorType(new VectorType(numNeighbors[dIdx]));
-
-          T* dst = &(m_Array[dIdx]->front()); // get the pointer to the front of the array
-          //    T* end = start + nEle; // get the pointer to the end of the array
-          T* start = &(flat.front()) + currentStart;
-          ::memcpy(dst, start, nEle * sizeof(T));
-          currentStart += nEle;
-        }
-        else
-        {
-          m_Array[dIdx] = SharedVectorType(new VectorType(0));
-        }
+        return -704;
       }
-      m_NumTuples = m_Array.size(); // Sync up the numTuples property with the size of the internal array
+
+      clearStorage();
+      m_Offsets.swap(offsets);
+      m_Values.swap(values);
+      m_NumberOfLists = numNeighbors.size();
+      m_IsAllocated = true;
+      m_NumTuples = m_NumberOfLists; // Sync up the numTuples property with the size of the internal array
       return err;
     }
 
@@ -878,6 +945,27 @@ class NeighborList : public IDataArray
      */
     void addEntry(int grainId, T value)
     {
+      // Appending to the last list that has values, or to any list after it, keeps the lists packed
+      size_t id = static_cast<size_t>(grainId);
+      if(m_Packed && id + 2 >= m_Offsets.size())
+      {
+        if(m_Offsets.empty())
+        {
+          m_Offsets.push_back(0);
+        }
+        if(id + 2 > m_Offsets.size())
+        {
+          m_Offsets.resize(id + 2, m_Values.size());
+        }
+        m_Values.push_back(value);
+        m_Offsets.back()++;
+        m_NumberOfLists = std::max(m_NumberOfLists, id + 1);
+        m_IsAllocated = true;
+        m_NumTuples = m_NumberOfLists;
+        return;
+      }
+
+      unpack();
       if(grainId >= static_cast<int>(m_Array.size()) )
       {
         size_t old = m_Array.size();
@@ -898,7 +986,7 @@ class NeighborList : public IDataArray
      */
     void clearAllLists()
     {
-      m_Array.clear();
+      clearStorage();
       m_IsAllocated = false;
     }
 
@@ -910,6 +998,7 @@ class NeighborList : public IDataArray
      */
     void setList(int grainId, SharedVectorType neighborList)
     {
+      unpack();
       if(grainId >= static_cast<int>(m_Array.size()) )
       {
         size_t old = m_Array.size();
@@ -934,8 +1023,17 @@ class NeighborList : public IDataArray
     T getValue(int grainId, int index, bool& ok)
     {
 #ifndef NDEBUG
-      if (m_Array.size() > 0u) { Q_ASSERT(grainId < static_cast<int>(m_Array.size()));}
+      if (getNumberOfListsInternal() > 0u) { Q_ASSERT(grainId < static_cast<int>(getNumberOfListsInternal()));}
 #endif
+      if(m_Packed)
+      {
+        if(index < 0 || static_cast<size_t>(index) >= getPackedListSize(grainId))
+        {
+          ok = false;
+          return -1;
+        }
+        return m_Values[m_Offsets[grainId] + index];
+      }
       SharedVectorType vec = m_Array[grainId];
       if(index < 0 || static_cast<size_t>(index) >= vec->size())
       {
@@ -951,7 +1049,7 @@ class NeighborList : public IDataArray
      */
     int getNumberOfLists()
     {
-      return static_cast<int>(m_Array.size());
+      return static_cast<int>(getNumberOfListsInternal());
     }
 
     /**
@@ -962,13 +1060,18 @@ class NeighborList : public IDataArray
     int getListSize(int grainId)
     {
 #ifndef NDEBUG
-      if (m_Array.size() > 0u) { Q_ASSERT(grainId < static_cast<int>(m_Array.size()));}
+      if (getNumberOfListsInternal() > 0u) { Q_ASSERT(grainId < static_cast<int>(getNumberOfListsInternal()));}
 #endif
+      if(m_Packed)
+      {
+        return static_cast<int>(getPackedListSize(grainId));
+      }
       return static_cast<int>(m_Array[grainId]->size());
     }
 
     VectorType& getListReference(int grainId)
     {
+      unpack();
 #ifndef NDEBUG
       if (m_Array.size() > 0u) { Q_ASSERT(grainId < static_cast<int>(m_Array.size()));}
 #endif
@@ -982,6 +1085,7 @@ class NeighborList : public IDataArray
      */
     SharedVectorType getList(int grainId)
     {
+      unpack();
 #ifndef NDEBUG
       if (m_Array.size() > 0u) { Q_ASSERT(grainId < static_cast<int>(m_Array.size()));}
 #endif
@@ -996,8 +1100,13 @@ class NeighborList : public IDataArray
     VectorType copyOfList(int grainId)
     {
 #ifndef NDEBUG
-      if (m_Array.size() > 0u) { Q_ASSERT(grainId < static_cast<int>(m_Array.size()));}
+      if (getNumberOfListsInternal() > 0u) { Q_ASSERT(grainId < static_cast<int>(getNumberOfListsInternal()));}
 #endif
+      if(m_Packed)
+      {
+        size_t begin = getPackedListBegin(grainId);
+        return VectorType(m_Values.begin() + begin, m_Values.begin() + begin + getPackedListSize(grainId));
+      }
 
       VectorType copy(*(m_Array[grainId]));
       return copy;
@@ -1010,6 +1119,7 @@ class NeighborList : public IDataArray
      */
     VectorType& operator[](int grainId)
     {
+      unpack();
 #ifndef NDEBUG
       if (m_Array.size() > 0u) { Q_ASSERT(grainId < static_cast<int>(m_Array.size()));}
 #endif
@@ -1023,6 +1133,7 @@ class NeighborList : public IDataArray
      */
     VectorType& operator[](size_t grainId)
     {
+      unpack();
 #ifndef NDEBUG
       if (m_Array.size() > 0ul) { Q_ASSERT(grainId < m_Array.size());}
 #endif
@@ -1030,6 +1141,84 @@ class NeighborList : public IDataArray
 
     }
 
+    /**
+     * @brief Returns true if the lists are held in the packed offsets and values buffers
+     * @return
+     */
+    bool isPacked()
+    {
+      return m_Packed;
+    }
+
+    /**
+     * @brief Moves every list into the packed offsets and values buffers and releases the per list vectors.
+     * Vectors previously handed out by getList() or getListReference() are no longer part of this NeighborList.
+     */
+    void pack()
+    {
+      if(m_Packed)
+      {
+        return;
+      }
+      std::vector<size_t> offsets;
+      std::vector<T> values;
+      buildPackedStorage(offsets, values);
+      size_t numLists = m_Array.size();
+      std::vector<SharedVectorType>().swap(m_Array);
+      m_Offsets.swap(offsets);
+      m_Values.swap(values);
+      m_NumberOfLists = numLists;
+      m_Packed = true;
+    }
+
+    /**
+     * @brief Moves the packed lists into one vector per list and releases the packed buffers. The std::vector
+     * accessors do this on their first use.
+     */
+    void unpack()
+    {
+      if(!m_Packed.load(std::memory_order_acquire))
+      {
+        return;
+      }
+      std::lock_guard<std::mutex> lock(m_UnpackMutex);
+      if(!m_Packed.load(std::memory_order_relaxed))
+      {
+        return;
+      }
+      std::vector<SharedVectorType> lists(m_NumberOfLists);
+      for(size_t i = 0; i < m_NumberOfLists; i++)
+      {
+        size_t begin = getPackedListBegin(i);
+        lists[i] = SharedVectorType(new VectorType(m_Values.begin() + begin, m_Values.begin() + begin + getPackedListSize(i)));
+      }
+      m_Array.swap(lists);
+      std::vector<size_t>().swap(m_Offsets);
+      std::vector<T>().swap(m_Values);
+      m_NumberOfLists = 0;
+      m_Packed.store(false, std::memory_order_release);
+    }
+
+    /**
+     * @brief Replaces all the lists with packed lists. List i holds values[offsets[i]] up to values[offsets[i + 1]].
+     * @param offsets One more entry than there are lists, starting at 0, ascending and ending at values.size()
+     * @param values
+     * @return false if the offsets are invalid, in which case nothing is changed
+     */
+    bool setPackedLists(std::vector<size_t> offsets, std::vector<T> values)
+    {
+      if(offsets.empty() || offsets.front() != 0 || offsets.back() != values.size() || !std::is_sorted(offsets.begin(), offsets.end()))
+      {
+        return false;
+      }
+      clearStorage();
+      m_NumberOfLists = offsets.size() - 1;
+      m_Offsets.swap(offsets);
+      m_Values.swap(values);
+      m_IsAllocated = (m_NumberOfLists != 0);
+      m_NumTuples = m_NumberOfLists;
+      return true;
+    }
 
   protected:
     /**
@@ -1037,13 +1226,177 @@ class NeighborList : public IDataArray
      */
     NeighborList(size_t numTuples, const QString name) :
       m_NumNeighborsArrayName(SIMPL::FeatureData::NumNeighbors),
+      m_Packed(true),
+      m_NumberOfLists(0),
       m_Name(name),
       m_NumTuples(numTuples),
       m_IsAllocated(false)
     {    }
 
   private:
+    // The number of values writeValuesDataset() gathers from unpacked lists before writing them to the file
+    static const size_t k_WriteBufferSize = 1048576;
+
+    /**
+     * @brief Returns the number of lists in either storage
+     */
+    size_t getNumberOfListsInternal()
+    {
+      return m_Packed ? m_NumberOfLists : m_Array.size();
+    }
+
+    /**
+     * @brief Returns the index in m_Values of the first value of a packed list. Lists past the end of
+     * m_Offsets are empty.
+     */
+    size_t getPackedListBegin(size_t grainId)
+    {
+      return (grainId < m_Offsets.size()) ? m_Offsets[grainId] : m_Values.size();
+    }
+
+    /**
+     * @brief Returns the size of a packed list
+     */
+    size_t getPackedListSize(size_t grainId)
+    {
+      return (grainId + 1 < m_Offsets.size()) ? m_Offsets[grainId + 1] - m_Offsets[grainId] : 0;
+    }
+
+    /**
+     * @brief Concatenates the unpacked lists into offsets and values
+     */
+    void buildPackedStorage(std::vector<size_t>& offsets, std::vector<T>& values)
+    {
+      offsets.assign(m_Array.size() + 1, 0);
+      for(size_t i = 0; i < m_Array.size(); i++)
+      {
+        offsets[i + 1] = offsets[i] + ((nullptr == m_Array[i]) ? 0 : m_Array[i]->size());
+      }
+      values.clear();
+      values.reserve(offsets.back());
+      for(const SharedVectorType& list : m_Array)
+      {
+        if(nullptr != list)
+        {
+          values.insert(values.end(), list->begin(), list->end());
+        }
+      }
+    }
+
+    /**
+     * @brief Releases both storages and leaves an empty packed NeighborList
+     */
+    void clearStorage()
+    {
+      std::vector<SharedVectorType>().swap(m_Array);
+      std::vector<size_t>().swap(m_Offsets);
+      std::vector<T>().swap(m_Values);
+      m_NumberOfLists = 0;
+      m_Packed = true;
+    }
+
+    /**
+     * @brief Writes the values of every list as one dataset. Packed values are written directly from their
+     * buffer. Unpacked lists are gathered into a buffer of at most k_WriteBufferSize values that is written as a
+     * hyperslab of the dataset each time it fills up, so the lists are never copied as a whole.
+     * @param parentId
+     * @param total The total number of values
+     * @return
+     */
+    herr_t writeValuesDataset(hid_t parentId, size_t total)
+    {
+      T test = static_cast<T>(0x00);
+      hid_t dataType = QH5Lite::HDFTypeForPrimitive(test);
+      if(dataType < 0)
+      {
+        return -1;
+      }
+      QByteArray name = getName().toLatin1();
+      if(QH5Lite::datasetExists(parentId, getName()))
+      {
+        H5Ldelete(parentId, name.data(), H5P_DEFAULT);
+      }
+
+      hsize_t dims[1] = { total };
+      hid_t sid = H5Screate_simple(1, dims, nullptr);
+      if(sid < 0)
+      {
+        return sid;
+      }
+      hid_t dcpl = H5DataArrayWriter::CreateDatasetProperties(QVector<hsize_t>(1, total), 1, total * sizeof(T));
+      hid_t did = H5Dcreate(parentId, name.data(), dataType, sid, H5P_DEFAULT, dcpl, H5P_DEFAULT);
+      if(dcpl != H5P_DEFAULT)
+      {
+        H5Pclose(dcpl);
+      }
+      if(did < 0)
+      {
+        H5Sclose(sid);
+        return did;
+      }
+
+      herr_t err = 0;
+      if(m_Packed)
+      {
+        err = H5Dwrite(did, dataType, H5S_ALL, H5S_ALL, H5P_DEFAULT, m_Values.data());
+      }
+      else
+      {
+        hsize_t fileOffset = 0;
+        auto writeHyperslab = [&](const T* data, hsize_t count) {
+          if(err < 0 || count == 0)
+          {
+            return;
+          }
+          hsize_t offset[1] = { fileOffset };
+          hsize_t counts[1] = { count };
+          hid_t memSpace = H5Screate_simple(1, counts, nullptr);
+          H5Sselect_hyperslab(sid, H5S_SELECT_SET, offset, nullptr, counts, nullptr);
+          err = H5Dwrite(did, dataType, memSpace, sid, H5P_DEFAULT, data);
+          H5Sclose(memSpace);
+          fileOffset += count;
+        };
+
+        const size_t bufferSize = k_WriteBufferSize;
+        std::vector<T> buffer;
+        buffer.reserve(std::min(total, bufferSize));
+        for(const SharedVectorType& list : m_Array)
+        {
+          if(nullptr == list || list->empty())
+          {
+            continue;
+          }
+          if(buffer.size() + list->size() > bufferSize)
+          {
+            writeHyperslab(buffer.data(), buffer.size());
+            buffer.clear();
+          }
+          if(list->size() >= bufferSize)
+          {
+            writeHyperslab(list->data(), list->size());
+          }
+          else
+          {
+            buffer.insert(buffer.end(), list->begin(), list->end());
+          }
+        }
+        writeHyperslab(buffer.data(), buffer.size());
+      }
+
+      H5Dclose(did);
+      H5Sclose(sid);
+      return err;
+    }
+
+    // Packed storage: list i holds m_Values[m_Offsets[i]] up to m_Values[m_Offsets[i + 1]]. m_Offsets may stop
+    // before the last list, the lists after it are empty.
+    std::vector<size_t> m_Offsets;
+    std::vector<T> m_Values;
+    // Unpacked storage, one vector per list
     std::vector<SharedVectorType> m_Array;
+    std::atomic<bool> m_Packed;
+    std::mutex m_UnpackMutex;
+    size_t m_NumberOfLists;
     QString m_Name;
     size_t m_NumTuples;
     bool m_IsAllocated;
@@ -34,6 +34,9 @@
  * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 #include "StringDataArray.h"
 
+#include <algorithm>
+#include <cstring>
+
 #include "SIMPLib/HDF5/H5DataArrayReader.h"
 #include "SIMPLib/HDF5/H5DataArrayWriter.hpp"
 
@@ -41,8 +44,11 @@
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-StringDataArray::StringDataArray() 
-: m_Name("")
+StringDataArray::StringDataArray()
+: m_WriteFixedWidth(false)
+, m_Name("")
+, m_Values(1, 0x00)
+, m_UnusedBytes(0)
 , _ownsData(false)
 {
 }
@@ -51,13 +57,14 @@ StringDataArray::StringDataArray()
 //
 // -----------------------------------------------------------------------------
 StringDataArray::StringDataArray(size_t numTuples, const QString name, bool allocate)
-: m_Name(name)
+: m_WriteFixedWidth(false)
+, m_Name(name)
+, m_Values(1, 0x00)
+, m_Offsets(numTuples, 0)
+, m_Lengths(numTuples, 0)
+, m_UnusedBytes(0)
 , _ownsData(true)
 {
-  // if (allocate == true)
-  {
-    m_Array.resize(numTuples);
-  }
 }
 
 // -----------------------------------------------------------------------------
@@ -197,7 +204,8 @@ void StringDataArray::releaseOwnership()
 // -----------------------------------------------------------------------------
 void* StringDataArray::getVoidPointer(size_t i)
 {
-  return static_cast<void*>(&(m_Array[i]));
+  Q_UNUSED(i)
+  return nullptr;
 }
 
 // -----------------------------------------------------------------------------
@@ -205,7 +213,7 @@ void* StringDataArray::getVoidPointer(size_t i)
 // -----------------------------------------------------------------------------
 size_t StringDataArray::getNumberOfTuples()
 {
-  return m_Array.size();
+  return m_Offsets.size();
 }
 
 // -----------------------------------------------------------------------------
@@ -213,7 +221,7 @@ size_t StringDataArray::getNumberOfTuples()
 // -----------------------------------------------------------------------------
 size_t StringDataArray::getSize()
 {
-  return m_Array.size();
+  return m_Offsets.size();
 }
 
 // -----------------------------------------------------------------------------
@@ -256,6 +264,14 @@ size_t StringDataArray::getTypeSize()
   return sizeof(QString);
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t StringDataArray::getNumberOfBytes()
+{
+  return m_Values.size() + m_Offsets.size() * (sizeof(size_t) + sizeof(size_t));
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -280,16 +296,17 @@ int StringDataArray::eraseTuples(QVector<size_t>& idxs)
   // off the end of the array and return an error code.
   for(QVector<size_t>::size_type i = 0; i < idxs.size(); ++i)
   {
-    if(idxs[i] >= static_cast<size_t>(m_Array.size()))
+    if(idxs[i] >= m_Offsets.size())
     {
       return -100;
     }
   }
 
   // Create a new Array to copy into
-  std::vector<QString> newArray;
+  std::vector<size_t> newOffsets;
+  std::vector<size_t> newLengths;
   std::vector<size_t>::size_type start = 0;
-  for(QVector<QString>::size_type i = 0; i < m_Array.size(); ++i)
+  for(std::vector<size_t>::size_type i = 0; i < m_Offsets.size(); ++i)
   {
     bool keep = true;
     for(QVector<size_t>::size_type j = start; j < idxs.size(); ++j)
@@ -302,10 +319,16 @@ int StringDataArray::eraseTuples(QVector<size_t>& idxs)
     }
     if(keep)
     {
-      newArray.push_back(m_Array[i]);
+      newOffsets.push_back(m_Offsets[i]);
+      newLengths.push_back(m_Lengths[i]);
+    }
+    else
+    {
+      releaseValue(m_Offsets[i], m_Lengths[i]);
     }
   }
-  m_Array = newArray;
+  m_Offsets.swap(newOffsets);
+  m_Lengths.swap(newLengths);
   return err;
 }
 
@@ -314,16 +337,22 @@ int StringDataArray::eraseTuples(QVector<size_t>& idxs)
 // -----------------------------------------------------------------------------
 int StringDataArray::copyTuple(size_t currentPos, size_t newPos)
 {
-  if(currentPos >= m_Array.size())
+  if(currentPos >= m_Offsets.size())
   {
     return -1;
   }
-  if(newPos >= m_Array.size())
+  if(newPos >= m_Offsets.size())
   {
     return -1;
   }
-  // QString s = m_Array[currentPos];
-  m_Array[newPos] = m_Array[currentPos];
+  // Both tuples share the bytes of the value until one of them is set again
+  if(newPos != currentPos)
+  {
+    releaseValue(m_Offsets[newPos], m_Lengths[newPos]);
+    m_Offsets[newPos] = m_Offsets[currentPos];
+    m_Lengths[newPos] = m_Lengths[currentPos];
+    shareValue(m_Offsets[newPos]);
+  }
   return 0;
 }
 
@@ -332,7 +361,7 @@ int StringDataArray::copyTuple(size_t currentPos, size_t newPos)
 // -----------------------------------------------------------------------------
 bool StringDataArray::copyFromArray(size_t destTupleOffset, IDataArray::Pointer sourceArray, size_t srcTupleOffset, size_t totalSrcTuples)
 {
-  if(destTupleOffset >= m_Array.size())
+  if(destTupleOffset >= m_Offsets.size())
   {
     return false;
   }
@@ -342,19 +371,43 @@ bool StringDataArray::copyFromArray(size_t destTupleOffset, IDataArray::Pointer
   }
 
   Self* source = dynamic_cast<Self*>(sourceArray.get());
+  if(nullptr == source)
+  {
+    return false;
+  }
 
   if(srcTupleOffset + totalSrcTuples > sourceArray->getNumberOfTuples())
   {
     return false;
   }
-  if(totalSrcTuples + destTupleOffset > m_Array.size())
+  if(totalSrcTuples + destTupleOffset > m_Offsets.size())
   {
     return false;
   }
 
-  for(size_t i = srcTupleOffset; i < srcTupleOffset + totalSrcTuples; i++)
+  if(source == this)
+  {
+    // Copy the tuples in the order that leaves every source tuple unchanged until it has been copied
+    if(destTupleOffset < srcTupleOffset)
+    {
+      for(size_t i = 0; i < totalSrcTuples; i++)
+      {
+        copyTuple(srcTupleOffset + i, destTupleOffset + i);
+      }
+    }
+    else
+    {
+      for(size_t i = totalSrcTuples; i > 0; i--)
+      {
+        copyTuple(srcTupleOffset + i - 1, destTupleOffset + i - 1);
+      }
+    }
+    return true;
+  }
+
+  for(size_t i = 0; i < totalSrcTuples; i++)
   {
-    m_Array[destTupleOffset + i] = source->getValue(i);
+    setUtf8Value(destTupleOffset + i, source->getUtf8Value(srcTupleOffset + i), source->getUtf8Size(srcTupleOffset + i));
   }
   return true;
 }
@@ -364,7 +417,7 @@ bool StringDataArray::copyFromArray(size_t destTupleOffset, IDataArray::Pointer
 // -----------------------------------------------------------------------------
 void StringDataArray::initializeTuple(size_t pos, void* value)
 {
-  m_Array[pos] = *(reinterpret_cast<QString*>(value));
+  setValue(pos, *(reinterpret_cast<QString*>(value)));
 }
 
 // -----------------------------------------------------------------------------
@@ -372,7 +425,11 @@ void StringDataArray::initializeTuple(size_t pos, void* value)
 // -----------------------------------------------------------------------------
 void StringDataArray::initializeWithZeros()
 {
-  m_Array.assign(m_Array.size(), QString(""));
+  m_Values.assign(1, 0x00);
+  m_Offsets.assign(m_Offsets.size(), 0);
+  m_Lengths.assign(m_Lengths.size(), 0);
+  m_SharedValues.clear();
+  m_UnusedBytes = 0;
 }
 
 // -----------------------------------------------------------------------------
@@ -380,7 +437,19 @@ void StringDataArray::initializeWithZeros()
 // -----------------------------------------------------------------------------
 void StringDataArray::initializeWithValue(QString value)
 {
-  m_Array.assign(m_Array.size(), value);
+  // Every tuple shares the one copy of the value
+  initializeWithZeros();
+  if(!m_Offsets.empty())
+  {
+    QByteArray bytes = value.toUtf8();
+    setUtf8Value(0, bytes.constData(), static_cast<size_t>(bytes.size()));
+    m_Offsets.assign(m_Offsets.size(), m_Offsets[0]);
+    m_Lengths.assign(m_Lengths.size(), m_Lengths[0]);
+    if(m_Offsets[0] != 0 && m_Offsets.size() > 1)
+    {
+      m_SharedValues[m_Offsets[0]] = m_Offsets.size();
+    }
+  }
 }
 
 // -----------------------------------------------------------------------------
@@ -388,7 +457,7 @@ void StringDataArray::initializeWithValue(QString value)
 // -----------------------------------------------------------------------------
 void StringDataArray::initializeWithValue(const std::string& value)
 {
-  m_Array.assign(m_Array.size(), QString::fromStdString(value));
+  initializeWithValue(QString::fromStdString(value));
 }
 
 // -----------------------------------------------------------------------------
@@ -397,12 +466,14 @@ void StringDataArray::initializeWithValue(const std::string& value)
 IDataArray::Pointer StringDataArray::deepCopy(bool forceNoAllocate)
 {
   StringDataArray::Pointer daCopy = StringDataArray::CreateArray(getNumberOfTuples(), getName());
+  daCopy->setWriteFixedWidth(getWriteFixedWidth());
   if(!forceNoAllocate)
   {
-    for(std::vector<QString>::size_type i = 0; i < m_Array.size(); ++i)
-    {
-      daCopy->setValue(i, m_Array[i]);
-    }
+    daCopy->m_Values = m_Values;
+    daCopy->m_Offsets = m_Offsets;
+    daCopy->m_Lengths = m_Lengths;
+    daCopy->m_SharedValues = m_SharedValues;
+    daCopy->m_UnusedBytes = m_UnusedBytes;
   }
   return daCopy;
 }
@@ -412,7 +483,12 @@ IDataArray::Pointer StringDataArray::deepCopy(bool forceNoAllocate)
 // -----------------------------------------------------------------------------
 int32_t StringDataArray::resizeTotalElements(size_t size)
 {
-  m_Array.resize(size);
+  for(size_t i = size; i < m_Offsets.size(); i++)
+  {
+    releaseValue(m_Offsets[i], m_Lengths[i]);
+  }
+  m_Offsets.resize(size, 0);
+  m_Lengths.resize(size, 0);
   return 1;
 }
 
@@ -421,8 +497,7 @@ int32_t StringDataArray::resizeTotalElements(size_t size)
 // -----------------------------------------------------------------------------
 int32_t StringDataArray::resize(size_t numTuples)
 {
-  m_Array.resize(numTuples);
-  return 1;
+  return resizeTotalElements(numTuples);
 }
 
 // -----------------------------------------------------------------------------
@@ -430,9 +505,13 @@ int32_t StringDataArray::resize(size_t numTuples)
 // -----------------------------------------------------------------------------
 void StringDataArray::initialize()
 {
-  if(!m_Array.empty())
+  if(!m_Offsets.empty())
   {
-    m_Array.clear();
+    std::vector<size_t>().swap(m_Offsets);
+    std::vector<size_t>().swap(m_Lengths);
+    std::vector<char>(1, 0x00).swap(m_Values);
+    m_SharedValues.clear();
+    m_UnusedBytes = 0;
     this->_ownsData = true;
   }
 }
@@ -442,7 +521,7 @@ void StringDataArray::initialize()
 // -----------------------------------------------------------------------------
 void StringDataArray::printTuple(QTextStream& out, size_t i, char delimiter)
 {
-  out << m_Array[i];
+  out << getValue(i);
 }
 
 // -----------------------------------------------------------------------------
@@ -450,7 +529,7 @@ void StringDataArray::printTuple(QTextStream& out, size_t i, char delimiter)
 // -----------------------------------------------------------------------------
 void StringDataArray::printComponent(QTextStream& out, size_t i, int j)
 {
-  out << m_Array[i];
+  out << getValue(i);
 }
 
 // -----------------------------------------------------------------------------
@@ -514,42 +593,171 @@ int StringDataArray::readH5Data(hid_t parentId)
 {
   int err = 0;
   this->resize(0);
-  std::vector<std::string> strings;
-  err = H5Lite::readVectorOfStringDataset(parentId, getName().toStdString(), strings);
+  m_Values.assign(1, 0x00);
+  m_UnusedBytes = 0;
+  // The strings are read in one pass and appended after the shared empty string
+  err = H5Lite::readPackedStringsDataset(parentId, getName().toStdString(), m_Values, m_Offsets);
+  // Strings in HDF5 end at their first null byte
+  m_Lengths.resize(m_Offsets.size());
+  for(size_t i = 0; i < m_Offsets.size(); i++)
+  {
+    m_Lengths[i] = strlen(m_Values.data() + m_Offsets[i]);
+  }
+  return err;
+}
 
-  m_Array.resize(strings.size());
-  for(std::vector<QString>::size_type i = 0; i < strings.size(); i++)
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void StringDataArray::setValue(size_t i, const QString& value)
+{
+  QByteArray bytes = value.toUtf8();
+  setUtf8Value(i, bytes.constData(), static_cast<size_t>(bytes.size()));
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString StringDataArray::getValue(size_t i)
+{
+  return QString::fromUtf8(m_Values.data() + m_Offsets.at(i), static_cast<int>(m_Lengths[i]));
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+const char* StringDataArray::getUtf8Value(size_t i)
+{
+  return m_Values.data() + m_Offsets.at(i);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t StringDataArray::getUtf8Size(size_t i)
+{
+  return m_Lengths.at(i);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void StringDataArray::setUtf8Value(size_t i, const char* value, size_t size)
+{
+  size_t previous = m_Offsets.at(i);
+  size_t previousSize = m_Lengths[i];
+  if(size == 0)
   {
-    m_Array[i] = QString::fromStdString(strings[i]);
+    m_Offsets[i] = 0;
   }
-#if 0
-  IDataArray::Pointer p = H5DataArrayReader::ReadStringDataArray(parentId, getName());
-  if (p.get() == nullptr)
+  else if(value >= m_Values.data() && value < m_Values.data() + m_Values.size())
   {
-    return -1;
+    if(value == m_Values.data() + previous && size == previousSize)
+    {
+      return;
+    }
+    // The value already lives in the buffer. Copy it out first because appending may move the buffer.
+    // copyTuple() is the way to share the value of another tuple.
+    std::string copy(value, size);
+    m_Offsets[i] = m_Values.size();
+    m_Values.insert(m_Values.end(), copy.begin(), copy.end());
+    m_Values.push_back(0x00);
   }
-  StringDataArray::Pointer srcPtr = std::dynamic_pointer_cast<StringDataArray>(p);
-  size_t count = srcPtr->getNumberOfTuples();
-  for (size_t i = 0; i < count; ++i)
+  else
   {
-    m_Array.push_back( srcPtr->getValue(i) );
+    m_Offsets[i] = m_Values.size();
+    m_Values.insert(m_Values.end(), value, value + size);
+    m_Values.push_back(0x00);
+  }
+  m_Lengths[i] = size;
+  releaseValue(previous, previousSize);
+  if(m_UnusedBytes > 4096 && m_UnusedBytes > m_Values.size() / 2)
+  {
+    compact();
   }
-#endif
-  return err;
 }
 
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-void StringDataArray::setValue(size_t i, const QString& value)
+void StringDataArray::shareValue(size_t offset)
+{
+  if(offset == 0)
+  {
+    return;
+  }
+  std::unordered_map<size_t, size_t>::iterator iter = m_SharedValues.find(offset);
+  if(iter == m_SharedValues.end())
+  {
+    m_SharedValues[offset] = 2;
+  }
+  else
+  {
+    iter->second++;
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void StringDataArray::releaseValue(size_t offset, size_t size)
 {
-  m_Array[i] = value;
+  if(offset == 0)
+  {
+    return;
+  }
+  std::unordered_map<size_t, size_t>::iterator iter = m_SharedValues.find(offset);
+  if(iter != m_SharedValues.end())
+  {
+    // Other tuples still use the value
+    iter->second--;
+    if(iter->second == 1)
+    {
+      m_SharedValues.erase(iter);
+    }
+    return;
+  }
+  m_UnusedBytes += size + 1;
 }
 
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-QString StringDataArray::getValue(size_t i)
+void StringDataArray::compact()
 {
-  return m_Array.at(i);
+  // Copy every value that is still in use once, in buffer order, and remember where it moved to
+  std::vector<std::pair<size_t, size_t>> oldValues(m_Offsets.size());
+  for(size_t i = 0; i < m_Offsets.size(); i++)
+  {
+    oldValues[i] = std::make_pair(m_Offsets[i], m_Lengths[i]);
+  }
+  std::sort(oldValues.begin(), oldValues.end());
+  oldValues.erase(std::unique(oldValues.begin(), oldValues.end()), oldValues.end());
+  std::vector<size_t> oldOffsets(oldValues.size());
+  std::vector<size_t> newOffsets(oldValues.size(), 0);
+  std::vector<char> values(1, 0x00);
+  values.reserve(m_Values.size() - std::min(m_UnusedBytes, m_Values.size() - 1));
+  for(size_t j = 0; j < oldValues.size(); j++)
+  {
+    oldOffsets[j] = oldValues[j].first;
+    if(oldOffsets[j] != 0)
+    {
+      const char* value = m_Values.data() + oldOffsets[j];
+      newOffsets[j] = values.size();
+      values.insert(values.end(), value, value + oldValues[j].second + 1);
+    }
+  }
+
+  for(size_t& offset : m_Offsets)
+  {
+    offset = newOffsets[std::lower_bound(oldOffsets.begin(), oldOffsets.end(), offset) - oldOffsets.begin()];
+  }
+  std::unordered_map<size_t, size_t> sharedValues;
+  for(const std::pair<const size_t, size_t>& shared : m_SharedValues)
+  {
+    sharedValues[newOffsets[std::lower_bound(oldOffsets.begin(), oldOffsets.end(), shared.first) - oldOffsets.begin()]] = shared.second;
+  }
+  m_SharedValues.swap(sharedValues);
+  m_Values.swap(values);
+  m_UnusedBytes = 0;
 }
@@ -36,6 +36,7 @@
 #pragma once
 
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include <QtCore/QString>
@@ -48,7 +49,11 @@
 
 /**
  * @class StringDataArray StringDataArray.h DREAM3DLib/Common/StringDataArray.h
- * @brief Stores an array of QString objects
+ * @brief Stores an array of strings
+ *
+ * The strings are stored UTF-8 encoded and null terminated in one byte buffer, with the offset of each string into
+ * that buffer. All empty strings share the null byte at the start of the buffer. Setting a value appends it to the
+ * buffer; the space used by replaced values is reclaimed once it makes up more than half of the buffer.
  *
  * @date Nov 13, 2012
  * @version 1.0
@@ -60,6 +65,12 @@ public:
   SIMPL_TYPE_MACRO_SUPER(StringDataArray, IDataArray)
   SIMPL_CLASS_VERSION(2)
 
+  /**
+   * @brief Write the strings to HDF5 as fixed width strings, padded to the longest string, instead of variable
+   * length strings. Fixed width strings read faster but take more space when the lengths vary a lot.
+   */
+  SIMPL_INSTANCE_PROPERTY(bool, WriteFixedWidth)
+
   /**
    * @brief CreateArray
    * @param numTuples
@@ -164,11 +175,10 @@ public:
    */
   void releaseOwnership() override;
   /**
-   * @brief Returns a void pointer pointing to the index of the array. nullptr
-   * pointers are entirely possible. No checks are performed to make sure
-   * the index is with in the range of the internal data array.
-   * @param i The index to have the returned pointer pointing to.
-   * @return Void Pointer. Possibly nullptr.
+   * @brief The values are not stored as QStrings, or as one block of getTypeSize() bytes per tuple, so there is
+   * no pointer to hand out. Use getUtf8Value() to read the bytes of a value.
+   * @param i
+   * @return nullptr
    */
   void* getVoidPointer(size_t i) override;
 
@@ -207,6 +217,12 @@ public:
    */
   size_t getTypeSize() override;
 
+  /**
+   * @brief Returns the number of bytes used by the UTF-8 buffer and by the offset and size of every tuple
+   * @return
+   */
+  size_t getNumberOfBytes() override;
+
   /**
    * @brief Removes Tuples from the Array. If the size of the vector is Zero nothing is done. If the size of the
    * vector is greater than or Equal to the number of Tuples then the Array is Resized to Zero. If there are
@@ -251,9 +267,9 @@ public:
   bool copyFromArray(size_t destTupleOffset, IDataArray::Pointer sourceArray, size_t srcTupleOffset, size_t totalSrcTuples) override;
 
   /**
-   * @brief Does Nothing
+   * @brief Sets the value of a Tuple
    * @param pos The index of the Tuple
-   * @param value pointer to value
+   * @param value pointer to a QString
    */
   void initializeTuple(size_t pos, void* value) override;
 
@@ -354,7 +370,8 @@ public:
   int readH5Data(hid_t parentId) override;
 
   /**
-   * @brief setValue
+   * @brief Sets the value of a tuple. Every value is appended to one buffer shared by all the tuples, so
+   * setValue() and setUtf8Value() must not be called from several threads at once, even for different tuples.
    * @param i
    * @param value
    */
@@ -367,6 +384,29 @@ public:
    */
   QString getValue(size_t i);
 
+  /**
+   * @brief Returns the null terminated UTF-8 bytes of a value without converting it to a QString
+   * @param i
+   * @return Invalidated by the next change to the array
+   */
+  const char* getUtf8Value(size_t i);
+
+  /**
+   * @brief Returns the number of UTF-8 bytes of a value, not counting the null terminator. Values may contain null bytes.
+   * @param i
+   * @return
+   */
+  size_t getUtf8Size(size_t i);
+
+  /**
+   * @brief Sets a value from UTF-8 bytes without converting them to a QString. The same single thread rule as
+   * for setValue() applies.
+   * @param i
+   * @param value
+   * @param size The number of bytes in value
+   */
+  void setUtf8Value(size_t i, const char* value, size_t size);
+
 protected:
   /**
    * @brief Protected Constructor
@@ -378,9 +418,34 @@ protected:
   StringDataArray();
 
 private:
+  /**
+   * @brief Rewrites the buffer with only the values that are still in use. Tuples that shared a value
+   * still share it afterwards.
+   */
+  void compact();
+
+  /**
+   * @brief Records that one more tuple uses the value at offset, which is already used by at least one tuple
+   * @param offset
+   */
+  void shareValue(size_t offset);
+
+  /**
+   * @brief Records that a tuple no longer uses the value at offset. Its bytes are counted as unused once no
+   * tuple uses it any more.
+   * @param offset
+   * @param size The number of bytes of the value
+   */
+  void releaseValue(size_t offset, size_t size);
+
   QString m_Name;
   QString m_InitValue;
-  std::vector<QString> m_Array;
+  std::vector<char> m_Values;
+  std::vector<size_t> m_Offsets;
+  std::vector<size_t> m_Lengths;
+  // The number of tuples using each value that more than one tuple uses
+  std::unordered_map<size_t, size_t> m_SharedValues;
+  size_t m_UnusedBytes;
   bool _ownsData;
 
 public:
@@ -0,0 +1,347 @@
+/* ============================================================================
+* Copyright (c) 2009-2015 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-07-D-5800
+*    United States Air Force Prime Contract FA8650-10-D-5210
+*    United States Prime Contract Navy N00173-07-C-2068
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+
+#include <stdlib.h>
+
+#include <algorithm>
+#include <iostream>
+#include <vector>
+
+#include <QtCore/QDir>
+#include <QtCore/QFile>
+#include <QtCore/QString>
+#include <QtCore/QVector>
+
+#include "H5Support/QH5Utilities.h"
+
+#include "SIMPLib/DataArrays/BitArray.h"
+#include "SIMPLib/HDF5/H5DataArrayReader.h"
+#include "SIMPLib/SIMPLib.h"
+
+#include "SIMPLib/Testing/SIMPLTestFileLocations.h"
+#include "SIMPLib/Testing/UnitTestSupport.hpp"
+
+class BitArrayTest
+{
+public:
+  // Not a multiple of 64 so the partial last word is exercised
+  const size_t k_ArraySize = 1000;
+
+  BitArrayTest() = default;
+  virtual ~BitArrayTest() = default;
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void RemoveTestFiles()
+  {
+#if REMOVE_TEST_FILES
+    QFile::remove(UnitTest::BitArrayTest::TestFile);
+    QDir tempDir(UnitTest::BitArrayTest::TestDir);
+    tempDir.removeRecursively();
+#endif
+  }
+
+  // -----------------------------------------------------------------------------
+  // Pattern that is neither periodic in 8 nor in 64
+  // -----------------------------------------------------------------------------
+  bool expectedValue(size_t i)
+  {
+    return (i % 3 == 0) || (i % 7 == 2);
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  BitArray::Pointer initializeBitArray()
+  {
+    BitArray::Pointer data = BitArray::CreateArray(k_ArraySize, "Test Mask");
+    DREAM3D_REQUIRE_EQUAL(data->getNumberOfTuples(), k_ArraySize)
+    DREAM3D_REQUIRE_EQUAL(data->getNumberOfComponents(), 1)
+    DREAM3D_REQUIRE_EQUAL(data->getNumberOfWords(), (k_ArraySize + 63) / 64)
+    DREAM3D_REQUIRE_EQUAL(data->getTypeAsString(), QString("BitArray"))
+    DREAM3D_REQUIRE_EQUAL(data->countTrue(), 0)
+    for(size_t i = 0; i < k_ArraySize; i++)
+    {
+      data->setValue(i, expectedValue(i));
+    }
+    return data;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestValues()
+  {
+    BitArray::Pointer data = initializeBitArray();
+    size_t expectedCount = 0;
+    for(size_t i = 0; i < k_ArraySize; i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(data->getValue(i), expectedValue(i))
+      expectedCount += expectedValue(i) ? 1 : 0;
+    }
+    DREAM3D_REQUIRE_EQUAL(data->countTrue(), expectedCount)
+
+    // Walk the set bits and make sure none are skipped
+    size_t i = data->findFirstTrue();
+    size_t visited = 0;
+    size_t previous = 0;
+    for(; i < k_ArraySize; i = data->findNextTrue(i + 1))
+    {
+      DREAM3D_REQUIRE(expectedValue(i))
+      DREAM3D_REQUIRE(visited == 0 || i > previous)
+      previous = i;
+      visited++;
+    }
+    DREAM3D_REQUIRE_EQUAL(i, k_ArraySize)
+    DREAM3D_REQUIRE_EQUAL(visited, expectedCount)
+    DREAM3D_REQUIRE_EQUAL(data->findFirstFalse(), 1)
+
+    data->initializeWithValue(true);
+    DREAM3D_REQUIRE_EQUAL(data->countTrue(), k_ArraySize)
+    DREAM3D_REQUIRE_EQUAL(data->findFirstFalse(), k_ArraySize)
+    data->initializeWithZeros();
+    DREAM3D_REQUIRE_EQUAL(data->findFirstTrue(), k_ArraySize)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestWordOperations()
+  {
+    BitArray::Pointer data = initializeBitArray();
+    BitArray::Pointer other = BitArray::CreateArray(k_ArraySize, "Other");
+    for(size_t i = 0; i < k_ArraySize; i += 2)
+    {
+      other->setValue(i, true);
+    }
+
+    BitArray::Pointer andArray = std::dynamic_pointer_cast<BitArray>(data->deepCopy());
+    BitArray::Pointer orArray = std::dynamic_pointer_cast<BitArray>(data->deepCopy());
+    BitArray::Pointer xorArray = std::dynamic_pointer_cast<BitArray>(data->deepCopy());
+    DREAM3D_REQUIRE(andArray->andWith(*other))
+    DREAM3D_REQUIRE(orArray->orWith(*other))
+    DREAM3D_REQUIRE(xorArray->xorWith(*other))
+    for(size_t i = 0; i < k_ArraySize; i++)
+    {
+      bool a = expectedValue(i);
+      bool b = (i % 2 == 0);
+      DREAM3D_REQUIRE_EQUAL(andArray->getValue(i), a && b)
+      DREAM3D_REQUIRE_EQUAL(orArray->getValue(i), a || b)
+      DREAM3D_REQUIRE_EQUAL(xorArray->getValue(i), a != b)
+    }
+
+    // Inverting must not set the padding bits past the end of the array
+    size_t count = data->countTrue();
+    data->invert();
+    DREAM3D_REQUIRE_EQUAL(data->countTrue(), k_ArraySize - count)
+    for(size_t i = 0; i < k_ArraySize; i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(data->getValue(i), !expectedValue(i))
+    }
+
+    BitArray::Pointer wrongSize = BitArray::CreateArray(k_ArraySize - 1, "Wrong");
+    DREAM3D_REQUIRE_EQUAL(data->andWith(*wrongSize), false)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestPacking()
+  {
+    std::vector<char> values(k_ArraySize);
+    for(size_t i = 0; i < k_ArraySize; i++)
+    {
+      values[i] = expectedValue(i) ? 1 : 0;
+    }
+    const bool* boolValues = reinterpret_cast<const bool*>(values.data());
+
+    // Unaligned start and length
+    BitArray::Pointer data = BitArray::CreateArray(k_ArraySize, "Packed");
+    data->packValues(0, boolValues, 5);
+    data->packValues(5, boolValues + 5, 300);
+    data->packValues(305, boolValues + 305, k_ArraySize - 305);
+    std::vector<char> unpacked(k_ArraySize, 2);
+    data->unpackValues(0, k_ArraySize, reinterpret_cast<bool*>(unpacked.data()));
+    for(size_t i = 0; i < k_ArraySize; i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(data->getValue(i), expectedValue(i))
+      DREAM3D_REQUIRE_EQUAL(unpacked[i], values[i])
+    }
+
+    // Round trip through a bool array
+    BoolArrayType::Pointer boolArray = data->toBoolArray();
+    DREAM3D_REQUIRE_EQUAL(boolArray->getNumberOfTuples(), k_ArraySize)
+    DREAM3D_REQUIRE_EQUAL(boolArray->getName(), data->getName())
+    BitArray::Pointer repacked = BitArray::FromBoolArray(boolArray);
+    DREAM3D_REQUIRE_VALID_POINTER(repacked.get())
+    DREAM3D_REQUIRE(std::equal(data->getWordPointer(0), data->getWordPointer(0) + data->getNumberOfWords(), repacked->getWordPointer(0)))
+
+    BitArray::Pointer copied = BitArray::CreateArray(k_ArraySize, "Copied");
+    DREAM3D_REQUIRE(copied->copyFromArray(10, boolArray, 20, 100))
+    for(size_t i = 0; i < 100; i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(copied->getValue(10 + i), expectedValue(20 + i))
+    }
+    DREAM3D_REQUIRE_EQUAL(copied->copyFromArray(k_ArraySize - 10, data, 0, 100), false)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestResizeAndErase()
+  {
+    BitArray::Pointer data = initializeBitArray();
+    data->initializeWithValue(true);
+
+    // Shrinking then growing must expose false values, not the old bits
+    data->resize(100);
+    DREAM3D_REQUIRE_EQUAL(data->countTrue(), 100)
+    data->resize(k_ArraySize);
+    DREAM3D_REQUIRE_EQUAL(data->countTrue(), 100)
+    DREAM3D_REQUIRE_EQUAL(data->getValue(100), false)
+
+    data = initializeBitArray();
+    QVector<size_t> idxs;
+    idxs.push_back(0);
+    idxs.push_back(500);
+    idxs.push_back(k_ArraySize - 1);
+    int err = data->eraseTuples(idxs);
+    DREAM3D_REQUIRE_EQUAL(err, 0)
+    DREAM3D_REQUIRE_EQUAL(data->getNumberOfTuples(), k_ArraySize - 3)
+    for(size_t i = 0; i < data->getNumberOfTuples(); i++)
+    {
+      size_t original = i + 1 + (i >= 499 ? 1 : 0);
+      DREAM3D_REQUIRE_EQUAL(data->getValue(i), expectedValue(original))
+    }
+
+    idxs.clear();
+    idxs.push_back(k_ArraySize);
+    err = data->eraseTuples(idxs);
+    DREAM3D_REQUIRE_EQUAL(err, -100)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestStorage()
+  {
+    BitArray::Pointer data = initializeBitArray();
+    DREAM3D_REQUIRE(data->isAllocated())
+    DREAM3D_REQUIRE_EQUAL(data->getNumberOfBytes(), data->getNumberOfWords() * sizeof(BitArray::WordType))
+    DREAM3D_REQUIRE(data->getNumberOfBytes() < data->getSize() * data->getTypeSize())
+    DREAM3D_REQUIRE_EQUAL(data->getVoidPointer(0), static_cast<void*>(data->getWordPointer(0)))
+    DREAM3D_REQUIRE_EQUAL(data->getVoidPointer(BitArray::k_BitsPerWord), static_cast<void*>(data->getWordPointer(1)))
+    DREAM3D_REQUIRE(data->getVoidPointer(1) == nullptr)
+    DREAM3D_REQUIRE(data->getVoidPointer(k_ArraySize) == nullptr)
+
+    BitArray::Pointer unallocated = BitArray::CreateArray(k_ArraySize, "Unallocated", false);
+    DREAM3D_REQUIRE_EQUAL(unallocated->isAllocated(), false)
+    DREAM3D_REQUIRE_EQUAL(unallocated->getNumberOfTuples(), k_ArraySize)
+    DREAM3D_REQUIRE_EQUAL(unallocated->getNumberOfBytes(), 0)
+    DREAM3D_REQUIRE(unallocated->getVoidPointer(0) == nullptr)
+    DREAM3D_REQUIRE_EQUAL(unallocated->findFirstTrue(), k_ArraySize)
+    DREAM3D_REQUIRE_EQUAL(data->andWith(*unallocated), false)
+    BitArray::Pointer copy = std::dynamic_pointer_cast<BitArray>(unallocated->deepCopy());
+    DREAM3D_REQUIRE_EQUAL(copy->isAllocated(), false)
+
+    unallocated->resize(k_ArraySize);
+    DREAM3D_REQUIRE(unallocated->isAllocated())
+    DREAM3D_REQUIRE_EQUAL(unallocated->countTrue(), 0)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestHDF5RoundTrip()
+  {
+    QDir dir(UnitTest::BitArrayTest::TestDir);
+    dir.mkpath(".");
+
+    BitArray::Pointer data = initializeBitArray();
+    QVector<size_t> tDims = {10, 100};
+    {
+      hid_t fileId = QH5Utilities::createFile(UnitTest::BitArrayTest::TestFile);
+      DREAM3D_REQUIRE(fileId > 0)
+      int err = data->writeH5Data(fileId, tDims);
+      DREAM3D_REQUIRE(err >= 0)
+      QH5Utilities::closeFile(fileId);
+    }
+
+    hid_t fileId = QH5Utilities::openFile(UnitTest::BitArrayTest::TestFile, true);
+    DREAM3D_REQUIRE(fileId > 0)
+
+    IDataArray::Pointer metaData = H5DataArrayReader::ReadBitArray(fileId, data->getName(), true);
+    DREAM3D_REQUIRE_VALID_POINTER(metaData.get())
+    DREAM3D_REQUIRE_EQUAL(metaData->getNumberOfTuples(), k_ArraySize)
+
+    BitArray::Pointer readBack = std::dynamic_pointer_cast<BitArray>(H5DataArrayReader::ReadBitArray(fileId, data->getName(), false));
+    QH5Utilities::closeFile(fileId);
+    DREAM3D_REQUIRE_VALID_POINTER(readBack.get())
+    DREAM3D_REQUIRE_EQUAL(readBack->getNumberOfTuples(), k_ArraySize)
+    for(size_t i = 0; i < k_ArraySize; i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(readBack->getValue(i), expectedValue(i))
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void operator()()
+  {
+    std::cout << "#### BitArrayTest Starting ####" << std::endl;
+    int err = EXIT_SUCCESS;
+
+#if !REMOVE_TEST_FILES
+    DREAM3D_REGISTER_TEST(RemoveTestFiles())
+#endif
+    DREAM3D_REGISTER_TEST(TestValues())
+    DREAM3D_REGISTER_TEST(TestWordOperations())
+    DREAM3D_REGISTER_TEST(TestPacking())
+    DREAM3D_REGISTER_TEST(TestResizeAndErase())
+    DREAM3D_REGISTER_TEST(TestStorage())
+    DREAM3D_REGISTER_TEST(TestHDF5RoundTrip())
+
+#if REMOVE_TEST_FILES
+    DREAM3D_REGISTER_TEST(RemoveTestFiles())
+#endif
+  }
+
+private:
+  BitArrayTest(const BitArrayTest&); // Copy Constructor Not Implemented
+  void operator=(const BitArrayTest&); // Move assignment Not Implemented
+};
@@ -43,11 +43,16 @@
 #include <QtCore/QString>
 #include <QtCore/QVector>
 
+#include "H5Support/QH5Utilities.h"
+
 #include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/DataArrays/DynamicListArray.hpp"
 #include "SIMPLib/DataArrays/IDataArray.h"
 #include "SIMPLib/DataArrays/NeighborList.hpp"
 #include "SIMPLib/DataArrays/StringDataArray.h"
 #include "SIMPLib/DataContainers/AttributeMatrix.h"
+#include "SIMPLib/Filtering/AbstractFilter.h"
+#include "SIMPLib/HDF5/H5DeferredArrayLoader.h"
 #include "SIMPLib/Math/SIMPLibMath.h"
 #include "SIMPLib/SIMPLib.h"
 
@@ -1215,6 +1220,392 @@ public:
     TestSetTupleForType<double>();
   }
 
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestDeferredLoading()
+  {
+    QVector<size_t> cDims = {3};
+    Int32ArrayType::Pointer array = Int32ArrayType::CreateArray(TEST_SIZE, cDims, "Deferred", false);
+
+    int loadCount = 0;
+    IDataArray::DeferredLoader loader = [&loadCount](void* buffer, size_t numBytes) {
+      loadCount++;
+      int32_t* values = reinterpret_cast<int32_t*>(buffer);
+      size_t count = numBytes / sizeof(int32_t);
+      for(size_t i = 0; i < count; i++)
+      {
+        values[i] = static_cast<int32_t>(i);
+      }
+      return true;
+    };
+
+    // Nothing to load into an empty array
+    Int32ArrayType::Pointer empty = Int32ArrayType::CreateArray(0, cDims, "Empty", false);
+    DREAM3D_REQUIRE_EQUAL(empty->setDeferredLoader(loader), false)
+    DREAM3D_REQUIRE_EQUAL(empty->isDataDeferred(), false)
+
+    DREAM3D_REQUIRE_EQUAL(array->setDeferredLoader(loader), true)
+    DREAM3D_REQUIRE_EQUAL(array->isDataDeferred(), true)
+    DREAM3D_REQUIRE_EQUAL(array->isAllocated(), true)
+    DREAM3D_REQUIRE_EQUAL(array->getNumberOfTuples(), TEST_SIZE)
+    DREAM3D_REQUIRE_EQUAL(loadCount, 0)
+
+    int32_t* ptr = array->getPointer(0);
+    DREAM3D_REQUIRE_VALID_POINTER(ptr)
+    DREAM3D_REQUIRE_EQUAL(loadCount, 1)
+    DREAM3D_REQUIRE_EQUAL(array->isDataDeferred(), false)
+    for(size_t i = 0; i < TEST_SIZE * 3; i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(ptr[i], static_cast<int32_t>(i))
+    }
+
+    // Values are only read once
+    DREAM3D_REQUIRE_EQUAL(array->getValue(5), 5)
+    DREAM3D_REQUIRE_EQUAL(loadCount, 1)
+
+    // Allocating again discards a pending load
+    DREAM3D_REQUIRE_EQUAL(array->setDeferredLoader(loader), true)
+    array->allocate();
+    DREAM3D_REQUIRE_EQUAL(array->isDataDeferred(), false)
+    DREAM3D_REQUIRE_EQUAL(loadCount, 1)
+
+    // Values that can not be read leave the array unallocated instead of filled with made up values
+    IDataArray::DeferredLoader failingLoader = [&loadCount](void* /*buffer*/, size_t /*numBytes*/) {
+      loadCount++;
+      return false;
+    };
+    DREAM3D_REQUIRE_EQUAL(array->setDeferredLoader(failingLoader), true)
+    DREAM3D_REQUIRE_EQUAL(array->readDeferredData(), false)
+    DREAM3D_REQUIRE_EQUAL(loadCount, 2)
+    DREAM3D_REQUIRE_EQUAL(array->isDataDeferred(), false)
+    DREAM3D_REQUIRE_EQUAL(array->isAllocated(), false)
+    DREAM3D_REQUIRE(nullptr == array->getPointer(0))
+    DREAM3D_REQUIRE(nullptr == array->getConstPointer(0))
+    DREAM3D_REQUIRE_EQUAL(loadCount, 2)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestDeferredLoadingFailure()
+  {
+    QVector<size_t> tDims = {TEST_SIZE};
+    QVector<size_t> cDims = {3};
+    QString groupPath = "/DataContainers/DataContainer/CellData";
+
+    // The "Truncated" dataset holds fewer tuples than the array that reads it
+    {
+      hid_t fileId = QH5Utilities::createFile(UnitTest::DataArrayTest::TestFile);
+      DREAM3D_REQUIRE(fileId > 0)
+      DREAM3D_REQUIRE(QH5Utilities::createGroupsFromPath(groupPath, fileId) >= 0)
+      hid_t gid = QH5Utilities::openHDF5Object(fileId, groupPath);
+      DREAM3D_REQUIRE(gid > 0)
+      Int32ArrayType::Pointer good = Int32ArrayType::CreateArray(tDims, cDims, "Good", true);
+      for(size_t i = 0; i < good->getSize(); i++)
+      {
+        good->setValue(i, static_cast<int32_t>(i));
+      }
+      DREAM3D_REQUIRE(good->writeH5Data(gid, tDims) >= 0)
+      QVector<size_t> shortDims = {TEST_SIZE / 2};
+      Int32ArrayType::Pointer truncated = Int32ArrayType::CreateArray(shortDims, cDims, "Truncated", true);
+      truncated->initializeWithZeros();
+      DREAM3D_REQUIRE(truncated->writeH5Data(gid, shortDims) >= 0)
+      QH5Utilities::closeHDF5Object(gid);
+      QH5Utilities::closeFile(fileId);
+    }
+
+    AttributeMatrix::Pointer am = AttributeMatrix::New(tDims, "CellData", AttributeMatrix::Type::Cell);
+    Int32ArrayType::Pointer good = Int32ArrayType::CreateArray(tDims, cDims, "Good", false);
+    Int32ArrayType::Pointer truncated = Int32ArrayType::CreateArray(tDims, cDims, "Truncated", false);
+    am->addAttributeArray(good->getName(), good);
+    am->addAttributeArray(truncated->getName(), truncated);
+    {
+      H5DeferredArrayLoader::Pointer loader = H5DeferredArrayLoader::New(UnitTest::DataArrayTest::TestFile);
+      DREAM3D_REQUIRE_EQUAL(loader->isOpen(), true)
+      DREAM3D_REQUIRE_EQUAL(loader->deferArray(good, groupPath), true)
+      DREAM3D_REQUIRE_EQUAL(loader->deferArray(truncated, groupPath), true)
+    }
+
+    // Preflight does not touch the values
+    AbstractFilter::Pointer filter = AbstractFilter::New();
+    filter->setInPreflight(true);
+    DREAM3D_REQUIRE_VALID_POINTER(am->getPrereqArray<Int32ArrayType, AbstractFilter>(filter.get(), "Truncated", -5000, cDims).get())
+    DREAM3D_REQUIRE_EQUAL(filter->getErrorCondition(), 0)
+    DREAM3D_REQUIRE_EQUAL(truncated->isDataDeferred(), true)
+
+    // A filter asking for values that can not be read gets an error instead of an array without values
+    filter->setInPreflight(false);
+    Int32ArrayType::Pointer goodPtr = am->getPrereqArray<Int32ArrayType, AbstractFilter>(filter.get(), "Good", -5000, cDims);
+    DREAM3D_REQUIRE_VALID_POINTER(goodPtr.get())
+    DREAM3D_REQUIRE_EQUAL(filter->getErrorCondition(), 0)
+    DREAM3D_REQUIRE_EQUAL(goodPtr->getValue(7), 7)
+
+    Int32ArrayType::Pointer truncatedPtr = am->getPrereqArray<Int32ArrayType, AbstractFilter>(filter.get(), "Truncated", -5000, cDims);
+    DREAM3D_REQUIRE(nullptr == truncatedPtr.get())
+    DREAM3D_REQUIRE_EQUAL(filter->getErrorCondition(), -5000)
+    DREAM3D_REQUIRE_EQUAL(truncated->isDataDeferred(), false)
+
+    // Asking again still reports the failure even though nothing is deferred any more
+    filter->setErrorCondition(0);
+    IDataArray::Pointer iTruncated = am->getPrereqIDataArray<IDataArray, AbstractFilter>(filter.get(), "Truncated", -5001);
+    DREAM3D_REQUIRE(nullptr == iTruncated.get())
+    DREAM3D_REQUIRE_EQUAL(filter->getErrorCondition(), -5001)
+
+    // New values clear the failure
+    truncated->allocate();
+    DREAM3D_REQUIRE_EQUAL(truncated->readDeferredData(), true)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestCopyOnWrite()
+  {
+    QVector<size_t> cDims = {2};
+    Int32ArrayType::Pointer src = Int32ArrayType::CreateArray(TEST_SIZE, cDims, "Source", true);
+    for(size_t i = 0; i < TEST_SIZE * 2; i++)
+    {
+      src->setValue(i, static_cast<int32_t>(i));
+    }
+    DREAM3D_REQUIRE_EQUAL(src->isDataShared(), false)
+
+    // Copies share the values until one of them is modified
+    Int32ArrayType::Pointer copy = std::dynamic_pointer_cast<Int32ArrayType>(src->deepCopy());
+    Int32ArrayType::Pointer copy2 = std::dynamic_pointer_cast<Int32ArrayType>(copy->deepCopy());
+    DREAM3D_REQUIRE_EQUAL(src->isDataShared(), true)
+    DREAM3D_REQUIRE_EQUAL(copy->isDataShared(), true)
+    DREAM3D_REQUIRE_EQUAL(copy2->isDataShared(), true)
+    DREAM3D_REQUIRE(src->getConstPointer(0) == copy->getConstPointer(0))
+    DREAM3D_REQUIRE(src->getConstPointer(0) == copy2->getConstPointer(0))
+    DREAM3D_REQUIRE_EQUAL(copy->getValue(7), 7)
+    DREAM3D_REQUIRE_EQUAL(copy->getComponent(3, 1), 7)
+    DREAM3D_REQUIRE_EQUAL(copy->isDataShared(), true)
+
+    // Writing to the copy gives it its own values and leaves the others untouched
+    copy->setValue(0, -1);
+    DREAM3D_REQUIRE_EQUAL(copy->isDataShared(), false)
+    DREAM3D_REQUIRE_EQUAL(src->isDataShared(), true)
+    DREAM3D_REQUIRE(src->getConstPointer(0) != copy->getConstPointer(0))
+    DREAM3D_REQUIRE_EQUAL(copy->getValue(0), -1)
+    DREAM3D_REQUIRE_EQUAL(src->getValue(0), 0)
+    DREAM3D_REQUIRE_EQUAL(copy2->getValue(0), 0)
+    for(size_t i = 1; i < TEST_SIZE * 2; i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(copy->getValue(i), static_cast<int32_t>(i))
+    }
+
+    // The last array that references the buffer takes it over without copying
+    const int32_t* sharedPtr = copy2->getConstPointer(0);
+    copy2 = Int32ArrayType::NullPointer();
+    DREAM3D_REQUIRE_EQUAL(src->isDataShared(), false)
+    int32_t* ptr = src->getPointer(0);
+    DREAM3D_REQUIRE(ptr == sharedPtr)
+    ptr[1] = 42;
+    DREAM3D_REQUIRE_EQUAL(copy->getValue(1), 1)
+
+    // Tuple writes detach as well
+    copy2 = std::dynamic_pointer_cast<Int32ArrayType>(src->deepCopy());
+    int32_t tuple[2] = {-5, -6};
+    copy2->setTuple(4, tuple);
+    DREAM3D_REQUIRE_EQUAL(copy2->isDataShared(), false)
+    DREAM3D_REQUIRE_EQUAL(copy2->getValue(8), -5)
+    DREAM3D_REQUIRE_EQUAL(src->getValue(8), 8)
+
+    // Erasing and resizing a shared array do not touch the other copies
+    copy2 = std::dynamic_pointer_cast<Int32ArrayType>(src->deepCopy());
+    QVector<size_t> idxs = {0, 2};
+    DREAM3D_REQUIRE_EQUAL(copy2->eraseTuples(idxs), 0)
+    DREAM3D_REQUIRE_EQUAL(copy2->getSize(), (TEST_SIZE - 2) * 2)
+    DREAM3D_REQUIRE_EQUAL(copy2->getValue(0), 2)
+    DREAM3D_REQUIRE_EQUAL(copy2->getValue(2), 6)
+    DREAM3D_REQUIRE_EQUAL(src->getNumberOfTuples(), TEST_SIZE)
+    DREAM3D_REQUIRE_EQUAL(src->getValue(1), 42)
+
+    copy2 = std::dynamic_pointer_cast<Int32ArrayType>(src->deepCopy());
+    copy2->resize(TEST_SIZE * 2);
+    DREAM3D_REQUIRE_EQUAL(copy2->isDataShared(), false)
+    DREAM3D_REQUIRE_EQUAL(copy2->getValue(1), 42)
+    DREAM3D_REQUIRE_EQUAL(src->getValue(TEST_SIZE * 2 - 1), static_cast<int32_t>(TEST_SIZE * 2 - 1))
+    src->resize(0);
+    DREAM3D_REQUIRE_EQUAL(copy2->getValue(TEST_SIZE * 2 - 1), static_cast<int32_t>(TEST_SIZE * 2 - 1))
+
+    // Arrays that wrap memory they do not own are copied right away
+    std::vector<int32_t> external(TEST_SIZE, 3);
+    Int32ArrayType::Pointer wrapped = Int32ArrayType::WrapPointer(external.data(), TEST_SIZE, QVector<size_t>(1, 1), "Wrapped", false);
+    Int32ArrayType::Pointer wrappedCopy = std::dynamic_pointer_cast<Int32ArrayType>(wrapped->deepCopy());
+    DREAM3D_REQUIRE_EQUAL(wrapped->isDataShared(), false)
+    DREAM3D_REQUIRE(wrappedCopy->getConstPointer(0) != external.data())
+    DREAM3D_REQUIRE_EQUAL(wrappedCopy->getValue(TEST_SIZE - 1), 3)
+
+    // Copies made without allocating do not share anything
+    Int32ArrayType::Pointer noAlloc = std::dynamic_pointer_cast<Int32ArrayType>(copy->deepCopy(true));
+    DREAM3D_REQUIRE_EQUAL(copy->isDataShared(), false)
+    DREAM3D_REQUIRE_EQUAL(noAlloc->isDataShared(), false)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void RequireSameLists(Int32NeighborListType::Pointer a, Int32NeighborListType::Pointer b)
+  {
+    DREAM3D_REQUIRE_EQUAL(a->getNumberOfTuples(), b->getNumberOfTuples())
+    DREAM3D_REQUIRE_EQUAL(a->getNumberOfLists(), b->getNumberOfLists())
+    DREAM3D_REQUIRE_EQUAL(a->getSize(), b->getSize())
+    for(int i = 0; i < a->getNumberOfLists(); i++)
+    {
+      DREAM3D_REQUIRE(a->copyOfList(i) == b->copyOfList(i))
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestPackedNeighborList()
+  {
+    // Appending list after list keeps the storage packed
+    Int32NeighborListType::Pointer packed = Int32NeighborListType::CreateArray(0, "Packed", false);
+    Int32NeighborListType::Pointer unpacked = Int32NeighborListType::CreateArray(0, "Unpacked", false);
+    for(int i = 0; i < 20; i++)
+    {
+      for(int j = 0; j < i % 4; j++)
+      {
+        packed->addEntry(i, i * 10 + j);
+        unpacked->addEntry(i, i * 10 + j);
+      }
+    }
+    unpacked->unpack();
+    DREAM3D_REQUIRE_EQUAL(packed->isPacked(), true)
+    DREAM3D_REQUIRE_EQUAL(unpacked->isPacked(), false)
+    DREAM3D_REQUIRE_EQUAL(packed->getNumberOfLists(), 20)
+    DREAM3D_REQUIRE_EQUAL(packed->getListSize(3), 3)
+    DREAM3D_REQUIRE_EQUAL(packed->getListSize(4), 0)
+    bool ok = true;
+    DREAM3D_REQUIRE_EQUAL(packed->getValue(7, 2, ok), 72)
+    DREAM3D_REQUIRE_EQUAL(ok, true)
+    packed->getValue(4, 0, ok);
+    DREAM3D_REQUIRE_EQUAL(ok, false)
+    RequireSameLists(packed, unpacked);
+
+    // Adding to an earlier list unpacks, pack() restores the same lists
+    packed->addEntry(0, 5);
+    unpacked->addEntry(0, 5);
+    DREAM3D_REQUIRE_EQUAL(packed->isPacked(), false)
+    RequireSameLists(packed, unpacked);
+    packed->pack();
+    DREAM3D_REQUIRE_EQUAL(packed->isPacked(), true)
+    RequireSameLists(packed, unpacked);
+    DREAM3D_REQUIRE_EQUAL(packed->getListReference(9)[0], 90)
+    DREAM3D_REQUIRE_EQUAL(packed->isPacked(), false)
+    // Once unpacked every accessor reads the vectors, not the packed buffers kept for other readers
+    packed->getListReference(9)[0] = 91;
+    DREAM3D_REQUIRE_EQUAL(packed->getValue(9, 0, ok), 91)
+    DREAM3D_REQUIRE_EQUAL(packed->copyOfList(9)[0], 91)
+    packed->getListReference(9)[0] = 90;
+    packed->pack();
+
+    // Erasing and resizing work on either storage
+    QVector<size_t> idxs = {0, 5, 6, 19};
+    QVector<size_t> idxsCopy = idxs;
+    DREAM3D_REQUIRE_EQUAL(packed->eraseTuples(idxs), 0)
+    DREAM3D_REQUIRE_EQUAL(unpacked->eraseTuples(idxsCopy), 0)
+    DREAM3D_REQUIRE_EQUAL(packed->isPacked(), true)
+    RequireSameLists(packed, unpacked);
+    packed->resize(10);
+    unpacked->resize(10);
+    RequireSameLists(packed, unpacked);
+    packed->resize(14);
+    unpacked->resize(14);
+    RequireSameLists(packed, unpacked);
+    DREAM3D_REQUIRE_EQUAL(packed->getListSize(13), 0)
+
+    Int32NeighborListType::Pointer copy = std::dynamic_pointer_cast<Int32NeighborListType>(unpacked->deepCopy());
+    DREAM3D_REQUIRE_EQUAL(copy->isPacked(), true)
+    RequireSameLists(copy, unpacked);
+
+    std::vector<size_t> badOffsets = {0, 3, 2};
+    DREAM3D_REQUIRE_EQUAL(copy->setPackedLists(badOffsets, std::vector<int32_t>(2)), false)
+    RequireSameLists(copy, unpacked);
+
+    // Both storages write the same file contents and read back packed
+    QVector<size_t> tDims(1, 14);
+    hid_t fileId = QH5Utilities::createFile(UnitTest::DataArrayTest::TestFile);
+    DREAM3D_REQUIRE(fileId > 0)
+    DREAM3D_REQUIRE(packed->writeH5Data(fileId, tDims) >= 0)
+    DREAM3D_REQUIRE(unpacked->writeH5Data(fileId, tDims) >= 0)
+    Int32NeighborListType::Pointer readPacked = Int32NeighborListType::CreateArray(0, "Packed", false);
+    Int32NeighborListType::Pointer readUnpacked = Int32NeighborListType::CreateArray(0, "Unpacked", false);
+    DREAM3D_REQUIRE(readPacked->readH5Data(fileId) >= 0)
+    DREAM3D_REQUIRE(readUnpacked->readH5Data(fileId) >= 0)
+    QH5Utilities::closeFile(fileId);
+    DREAM3D_REQUIRE_EQUAL(readPacked->isPacked(), true)
+    RequireSameLists(readPacked, unpacked);
+    RequireSameLists(readUnpacked, unpacked);
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestDynamicListArray()
+  {
+    UInt16Int64DynamicListArray::Pointer lists = UInt16Int64DynamicListArray::New();
+    std::vector<uint16_t> linkCounts = {2, 0, 3};
+    lists->allocateLists(linkCounts);
+    DREAM3D_REQUIRE_EQUAL(lists->size(), 3)
+    DREAM3D_REQUIRE_EQUAL(lists->getNumberOfValues(), 5)
+    lists->insertCellReference(0, 0, 10);
+    lists->insertCellReference(0, 1, 11);
+    for(size_t i = 0; i < 3; i++)
+    {
+      lists->insertCellReference(2, i, 20 + i);
+    }
+
+    // Growing and shrinking a list moves the lists after it
+    int64_t values[4] = {5, 6, 7, 8};
+    DREAM3D_REQUIRE_EQUAL(lists->setElementList(1, 4, values), true)
+    DREAM3D_REQUIRE_EQUAL(lists->getNumberOfElements(1), 4)
+    DREAM3D_REQUIRE_EQUAL(lists->getElementListPointer(1)[3], 8)
+    DREAM3D_REQUIRE_EQUAL(lists->getElementListPointer(2)[2], 22)
+    DREAM3D_REQUIRE_EQUAL(lists->setElementList(1, 1, values), true)
+    DREAM3D_REQUIRE_EQUAL(lists->getNumberOfValues(), 6)
+    DREAM3D_REQUIRE_EQUAL(lists->getElementListPointer(2)[0], 20)
+    DREAM3D_REQUIRE_EQUAL(lists->setElementList(3, 1, values), false)
+
+    UInt16Int64DynamicListArray::ElementList list = lists->getElementList(0);
+    DREAM3D_REQUIRE_EQUAL(list.ncells, 2)
+    DREAM3D_REQUIRE_EQUAL(list.cells[1], 11)
+
+    // Round trip through the serialized layout that is written to HDF5
+    std::vector<uint8_t> buffer;
+    lists->serializeLinks(buffer);
+    DREAM3D_REQUIRE_EQUAL(buffer.size(), 3 * sizeof(uint16_t) + 6 * sizeof(int64_t))
+    UInt16Int64DynamicListArray::Pointer readBack = UInt16Int64DynamicListArray::New();
+    DREAM3D_REQUIRE_EQUAL(readBack->deserializeLinks(buffer, 3), true)
+
+    UInt16Int64DynamicListArray::Pointer copy = readBack->deepCopy();
+    for(size_t i = 0; i < 3; i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(readBack->getNumberOfElements(i), lists->getNumberOfElements(i))
+      DREAM3D_REQUIRE_EQUAL(copy->getNumberOfElements(i), lists->getNumberOfElements(i))
+      for(uint16_t j = 0; j < lists->getNumberOfElements(i); j++)
+      {
+        DREAM3D_REQUIRE_EQUAL(readBack->getElementListPointer(i)[j], lists->getElementListPointer(i)[j])
+        DREAM3D_REQUIRE_EQUAL(copy->getElementListPointer(i)[j], lists->getElementListPointer(i)[j])
+      }
+    }
+
+    UInt16Int64DynamicListArray::Pointer empty = lists->deepCopy(true);
+    DREAM3D_REQUIRE_EQUAL(empty->size(), 3)
+    DREAM3D_REQUIRE_EQUAL(empty->getNumberOfValues(), 0)
+
+    // A truncated buffer is reported instead of being read as empty lists
+    std::vector<uint8_t> truncated(buffer.begin(), buffer.end() - sizeof(int64_t));
+    UInt16Int64DynamicListArray::Pointer truncatedLists = UInt16Int64DynamicListArray::New();
+    DREAM3D_REQUIRE_EQUAL(truncatedLists->deserializeLinks(truncated, 3), false)
+    DREAM3D_REQUIRE_EQUAL(truncatedLists->getNumberOfValues(), 0)
+    DREAM3D_REQUIRE_EQUAL(readBack->deserializeLinks(buffer, 4), false)
+  }
+
   // -----------------------------------------------------------------------------
   //
   // -----------------------------------------------------------------------------
@@ -1236,9 +1627,14 @@ public:
     DREAM3D_REGISTER_TEST(TestcopyTuples())
     DREAM3D_REGISTER_TEST(TestDeepCopyArray())
     DREAM3D_REGISTER_TEST(TestNeighborList())
+    DREAM3D_REGISTER_TEST(TestPackedNeighborList())
     DREAM3D_REGISTER_TEST(TestWrapPointer())
     DREAM3D_REGISTER_TEST(TestPrintDataArray())
     DREAM3D_REGISTER_TEST(TestSetTuple())
+    DREAM3D_REGISTER_TEST(TestDeferredLoading())
+    DREAM3D_REGISTER_TEST(TestDeferredLoadingFailure())
+    DREAM3D_REGISTER_TEST(TestCopyOnWrite())
+    DREAM3D_REGISTER_TEST(TestDynamicListArray())
 
 #if REMOVE_TEST_FILES
     DREAM3D_REGISTER_TEST(RemoveTestFiles())
@@ -35,9 +35,15 @@
 
 #include <stdlib.h>
 
+#include <cstring>
 #include <iostream>
 #include <string>
 
+#include <QtCore/QDir>
+#include <QtCore/QFile>
+
+#include "H5Support/QH5Utilities.h"
+
 #include "SIMPLib/Common/Constants.h"
 #include "SIMPLib/DataArrays/StringDataArray.h"
 #include "SIMPLib/Geometry/MeshStructs.h"
@@ -103,6 +109,11 @@ public:
   // -----------------------------------------------------------------------------
   void RemoveTestFiles()
   {
+#if REMOVE_TEST_FILES
+    QFile::remove(UnitTest::StringDataArrayTest::TestFile);
+    QDir tempDir(UnitTest::StringDataArrayTest::TestDir);
+    tempDir.removeRecursively();
+#endif
   }
 
   // -----------------------------------------------------------------------------
@@ -379,6 +390,103 @@ public:
     }
   }
 
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestReplaceValues()
+  {
+    StringDataArray::Pointer nodes = initializeStringDataArray();
+
+    // Replacing values many times keeps the buffer from growing without bound
+    for(int pass = 0; pass < 1000; pass++)
+    {
+      for(size_t i = 0; i < k_ArraySize; i++)
+      {
+        nodes->setValue(i, QString("Value %1 of pass %2").arg(i).arg(pass));
+      }
+    }
+    for(size_t i = 0; i < k_ArraySize; i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(nodes->getValue(i), QString("Value %1 of pass 999").arg(i));
+    }
+
+    // Setting a value from another value in the same array
+    nodes->setUtf8Value(1, nodes->getUtf8Value(2), strlen(nodes->getUtf8Value(2)));
+    DREAM3D_REQUIRE_EQUAL(nodes->getValue(1), nodes->getValue(2));
+    nodes->setUtf8Value(3, nodes->getUtf8Value(4), 5);
+    DREAM3D_REQUIRE_EQUAL(nodes->getValue(3), QString("Value"));
+
+    nodes->setValue(0, "");
+    DREAM3D_REQUIRE_EQUAL(nodes->getValue(0), QString(""));
+    nodes->initializeWithValue(QString("Same"));
+    for(size_t i = 0; i < k_ArraySize; i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(nodes->getValue(i), QString("Same"));
+    }
+
+    // Tuples that share a value still share it after the buffer is compacted
+    for(int pass = 0; pass < 1000; pass++)
+    {
+      nodes->setValue(0, QString("Value of pass %1").arg(pass));
+    }
+    DREAM3D_REQUIRE_EQUAL(nodes->getValue(0), QString("Value of pass 999"));
+    for(size_t i = 2; i < k_ArraySize; i++)
+    {
+      DREAM3D_REQUIRE(nodes->getUtf8Value(i) == nodes->getUtf8Value(1));
+      DREAM3D_REQUIRE_EQUAL(nodes->getValue(i), QString("Same"));
+    }
+
+    // Values may contain null bytes and copies keep all of them
+    QString withNull = QString::fromUtf8("Ti\0Ni", 5);
+    nodes->setValue(5, withNull);
+    DREAM3D_REQUIRE_EQUAL(nodes->getValue(5), withNull);
+    DREAM3D_REQUIRE_EQUAL(nodes->getUtf8Size(5), 5);
+    StringDataArray::Pointer copy = StringDataArray::CreateArray(k_ArraySize, "Copy");
+    DREAM3D_REQUIRE(copy->copyFromArray(0, nodes, 5, 1));
+    DREAM3D_REQUIRE_EQUAL(copy->getValue(0), withNull);
+    DREAM3D_REQUIRE(nodes->copyFromArray(6, nodes, 4, 2));
+    DREAM3D_REQUIRE_EQUAL(nodes->getValue(6), QString("Same"));
+    DREAM3D_REQUIRE_EQUAL(nodes->getValue(7), withNull);
+
+    // There is no block of QStrings to point to
+    DREAM3D_REQUIRE(nodes->getVoidPointer(0) == nullptr);
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestH5ReadWrite()
+  {
+    StringDataArray::Pointer nodes = initializeStringDataArray();
+    nodes->setValue(3, "");
+    nodes->setValue(4, QString::fromUtf8("\xce\xb1-Titanium"));
+
+    QDir().mkpath(UnitTest::StringDataArrayTest::TestDir);
+    hid_t fileId = QH5Utilities::createFile(UnitTest::StringDataArrayTest::TestFile);
+    DREAM3D_REQUIRE(fileId > 0)
+    QVector<size_t> tDims(1, k_ArraySize);
+    DREAM3D_REQUIRE(nodes->writeH5Data(fileId, tDims) >= 0)
+
+    StringDataArray::Pointer fixedWidth = std::dynamic_pointer_cast<StringDataArray>(nodes->deepCopy());
+    fixedWidth->setName("Fixed Width Strings");
+    fixedWidth->setWriteFixedWidth(true);
+    DREAM3D_REQUIRE(fixedWidth->writeH5Data(fileId, tDims) >= 0)
+
+    StringDataArray::Pointer readNodes = StringDataArray::CreateArray(0, kArrayName);
+    StringDataArray::Pointer readFixedWidth = StringDataArray::CreateArray(0, "Fixed Width Strings");
+    DREAM3D_REQUIRE(readNodes->readH5Data(fileId) >= 0)
+    DREAM3D_REQUIRE(readFixedWidth->readH5Data(fileId) >= 0)
+    QH5Utilities::closeFile(fileId);
+
+    DREAM3D_REQUIRE_EQUAL(readNodes->getNumberOfTuples(), k_ArraySize);
+    DREAM3D_REQUIRE_EQUAL(readFixedWidth->getNumberOfTuples(), k_ArraySize);
+    for(size_t i = 0; i < k_ArraySize; i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(readNodes->getValue(i), nodes->getValue(i));
+      DREAM3D_REQUIRE_EQUAL(readFixedWidth->getValue(i), nodes->getValue(i));
+    }
+  }
+
   // -----------------------------------------------------------------------------
   //
   // -----------------------------------------------------------------------------
@@ -397,6 +505,8 @@ public:
     DREAM3D_REGISTER_TEST(TestTupleCopy())
     DREAM3D_REGISTER_TEST(TestTupleErase())
     DREAM3D_REGISTER_TEST(TestDeepCopyArray())
+    DREAM3D_REGISTER_TEST(TestReplaceValues())
+    DREAM3D_REGISTER_TEST(TestH5ReadWrite())
 
 #if REMOVE_TEST_FILES
     DREAM3D_REGISTER_TEST(RemoveTestFiles())
@@ -50,6 +50,7 @@
 #include "SIMPLib/DataArrays/StatsDataArray.h"
 #include "SIMPLib/DataArrays/DataArray.hpp"
 #include "SIMPLib/HDF5/H5DataArrayReader.h"
+#include "SIMPLib/HDF5/H5DeferredArrayLoader.h"
 #include "SIMPLib/HDF5/VTKH5Constants.h"
 #include "SIMPLib/Math/SIMPLibMath.h"
 #include "SIMPLib/DataContainers/AttributeMatrixProxy.h"
@@ -616,6 +617,14 @@ int AttributeMatrix::addAttributeArrayFromHDF5Path(hid_t gid, QString name, bool
       dPtr->resize(getNumberOfTuples());
     }
   }
+  else if(classType.compare("BitArray") == 0)
+  {
+    dPtr = H5DataArrayReader::ReadBitArray(gid, name, preflight);
+    if(preflight && nullptr != dPtr.get())
+    {
+      dPtr->resize(getNumberOfTuples());
+    }
+  }
   else if(classType.compare("vector") == 0)
   {
   }
@@ -650,11 +659,17 @@ int AttributeMatrix::addAttributeArrayFromHDF5Path(hid_t gid, QString name, bool
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-int AttributeMatrix::readAttributeArraysFromHDF5(hid_t amGid, bool preflight, AttributeMatrixProxy* attrMatProxy)
+int AttributeMatrix::readAttributeArraysFromHDF5(hid_t amGid, bool preflight, AttributeMatrixProxy* attrMatProxy, const std::shared_ptr<H5DeferredArrayLoader>& deferredLoader)
 {
   int err = 0;
   QMap<QString, DataArrayProxy> dasToRead = attrMatProxy->dataArrays;
   QString classType;
+  bool deferData = !preflight && nullptr != deferredLoader.get();
+  QString groupPath;
+  if(deferData)
+  {
+    groupPath = QH5Utilities::getObjectPath(amGid);
+  }
   for(QMap<QString, DataArrayProxy>::iterator iter = dasToRead.begin(); iter != dasToRead.end(); ++iter)
   {
     // qDebug() << "Reading the " << iter->name << " Array from the " << m_Name << " Attribute Matrix \n";
@@ -668,12 +683,21 @@ int AttributeMatrix::readAttributeArraysFromHDF5(hid_t amGid, bool preflight, At
 
     if(classType.startsWith("DataArray"))
     {
-      dPtr = H5DataArrayReader::ReadIDataArray(amGid, iter->name, preflight);
+      dPtr = H5DataArrayReader::ReadIDataArray(amGid, iter->name, preflight || deferData);
+      if(deferData && nullptr != dPtr.get() && !deferredLoader->deferArray(dPtr, groupPath))
+      {
+        // Empty arrays cannot be deferred so just read them now
+        dPtr = H5DataArrayReader::ReadIDataArray(amGid, iter->name, false);
+      }
     }
     else if(classType.compare("StringDataArray") == 0)
     {
       dPtr = H5DataArrayReader::ReadStringDataArray(amGid, iter->name, preflight);
     }
+    else if(classType.compare("BitArray") == 0)
+    {
+      dPtr = H5DataArrayReader::ReadBitArray(amGid, iter->name, preflight);
+    }
     else if(classType.compare("vector") == 0)
     {
     }
@@ -60,6 +60,7 @@
 #include "SIMPLib/DataArrays/IDataArray.h"
 
 class AttributeMatrixProxy;
+class H5DeferredArrayLoader;
 class DataContainerProxy;
 class SIMPLH5DataReaderRequirements;
 template<class T> class DataArray;
@@ -349,6 +350,14 @@ public:
         ss = QObject::tr("The AttributeMatrix named '%1' contains an array with name '%2' but the DataArray could not be downcast using std::dynamic_pointer_cast<T>.").arg(getName()).arg(attributeArrayName);
         filter->notifyErrorMessage(filter->getHumanLabel(), ss, filter->getErrorCondition());
       }
+      // Values that are read on demand must be readable before the filter gets to use them
+      if(nullptr != attributeArray.get() && filter && !filter->getInPreflight() && !attributeArray->readDeferredData())
+      {
+        filter->setErrorCondition(err);
+        ss = QObject::tr("The values of the DataArray '%1' in the AttributeMatrix '%2' could not be read from the file.").arg(attributeArrayName).arg(getName());
+        filter->notifyErrorMessage(filter->getHumanLabel(), ss, filter->getErrorCondition());
+        return ArrayType::NullPointer();
+      }
       return attributeArray;
     }
 
@@ -394,6 +403,13 @@ public:
         IDataArray::Pointer ptr = getAttributeArray(attributeArrayName);
         if (std::dynamic_pointer_cast<ArrayType>(ptr) != nullptr)
         {
+          if(filter && !filter->getInPreflight() && !ptr->readDeferredData())
+          {
+            filter->setErrorCondition(err);
+            ss = QObject::tr("The values of the DataArray '%1' in the AttributeMatrix '%2' could not be read from the file.").arg(attributeArrayName).arg(getName());
+            filter->notifyErrorMessage(filter->getHumanLabel(), ss, filter->getErrorCondition());
+            return attributeArray;
+          }
           return std::dynamic_pointer_cast<ArrayType>(ptr);
         }
         else
@@ -610,9 +626,11 @@ public:
      * @param amGid
      * @param preflight
      * @param attrMatProxy
+     * @param deferredLoader If set, DataArray values are not read now but the first time they are accessed
      * @return
      */
-    virtual int readAttributeArraysFromHDF5(hid_t amGid, bool preflight, AttributeMatrixProxy* attrMatProxy);
+    virtual int readAttributeArraysFromHDF5(hid_t amGid, bool preflight, AttributeMatrixProxy* attrMatProxy,
+                                            const std::shared_ptr<H5DeferredArrayLoader>& deferredLoader = std::shared_ptr<H5DeferredArrayLoader>());
 
     /**
      * @brief generateXdmfText
@@ -369,7 +369,7 @@ int DataContainer::writeAttributeMatricesToHDF5(hid_t parentId)
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-int DataContainer::readAttributeMatricesFromHDF5(bool preflight, hid_t dcGid, const DataContainerProxy& dcProxy)
+int DataContainer::readAttributeMatricesFromHDF5(bool preflight, hid_t dcGid, const DataContainerProxy& dcProxy, const std::shared_ptr<H5DeferredArrayLoader>& deferredLoader)
 {
   int err = 0;
   QVector<size_t> tDims;
@@ -412,7 +412,7 @@ int DataContainer::readAttributeMatricesFromHDF5(bool preflight, hid_t dcGid, co
     }
 
     AttributeMatrixProxy amProxy = iter.value();
-    err = getAttributeMatrix(amName)->readAttributeArraysFromHDF5(amGid, preflight, &amProxy);
+    err = getAttributeMatrix(amName)->readAttributeArraysFromHDF5(amGid, preflight, &amProxy, deferredLoader);
     if(err < 0)
     {
       err |= H5Gclose(dcGid);
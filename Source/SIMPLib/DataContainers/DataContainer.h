@@ -36,6 +36,7 @@
 #pragma once
 
 #include <cstddef>
+#include <memory>
 
 #include <QtCore/QMap>
 #include <QtCore/QString>
@@ -54,6 +55,7 @@ class DataContainerProxy;
 class AttributeMatrix;
 class SIMPLH5DataReaderRequirements;
 class AbstractFilter;
+class H5DeferredArrayLoader;
 
 using AttributeMatrixShPtr = std::shared_ptr<AttributeMatrix>;
 
@@ -328,9 +330,11 @@ public:
 
   /**
    * @brief Reads desired Attribute Matrices from HDF5 file
+   * @param deferredLoader If set, DataArray values are not read now but the first time they are accessed
    * @return
    */
-  virtual int readAttributeMatricesFromHDF5(bool preflight, hid_t dcGid, const DataContainerProxy& dcProxy);
+  virtual int readAttributeMatricesFromHDF5(bool preflight, hid_t dcGid, const DataContainerProxy& dcProxy,
+                                            const std::shared_ptr<H5DeferredArrayLoader>& deferredLoader = std::shared_ptr<H5DeferredArrayLoader>());
 
   /**
    * @brief creates copy of dataContainer
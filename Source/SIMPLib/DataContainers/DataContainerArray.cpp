@@ -284,7 +284,8 @@ void DataContainerArray::printDataContainerNames(QTextStream& out)
 // -----------------------------------------------------------------------------
 int DataContainerArray::readDataContainersFromHDF5(bool preflight, hid_t dcaGid, 
                                                    const DataContainerArrayProxy &dcaProxy, 
-                                                   Observable* obs)
+                                                   Observable* obs,
+                                                   const std::shared_ptr<H5DeferredArrayLoader>& deferredLoader)
 {
   int err = 0;
   QList<DataContainerProxy> dcsToRead = dcaProxy.dataContainers.values();
@@ -332,7 +333,7 @@ int DataContainerArray::readDataContainersFromHDF5(bool preflight, hid_t dcaGid,
       }
       return -198745603;
     }
-    err = this->getDataContainer(dcProxy.name)->readAttributeMatricesFromHDF5(preflight, dcGid, dcProxy);
+    err = this->getDataContainer(dcProxy.name)->readAttributeMatricesFromHDF5(preflight, dcGid, dcProxy, deferredLoader);
     if(err < 0)
     {
       if(nullptr != obs)
@@ -534,6 +535,31 @@ DataContainerArray::Pointer DataContainerArray::deepCopy(bool forceNoAllocate)
   return dcaCopy;
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QVector<DataArrayPath> DataContainerArray::getSharedDataArrayPaths()
+{
+  QVector<DataArrayPath> paths;
+  for(const DataContainer::Pointer& dc : m_Array)
+  {
+    DataContainer::AttributeMatrixMap_t& attrMats = dc->getAttributeMatrices();
+    for(AttributeMatrix::Pointer am : attrMats)
+    {
+      QList<QString> arrayNames = am->getAttributeArrayNames();
+      for(const QString& arrayName : arrayNames)
+      {
+        IDataArray::Pointer array = am->getAttributeArray(arrayName);
+        if(nullptr != array && array->isDataShared())
+        {
+          paths.push_back(DataArrayPath(dc->getName(), am->getName(), arrayName));
+        }
+      }
+    }
+  }
+  return paths;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
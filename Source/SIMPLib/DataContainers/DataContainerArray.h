@@ -37,6 +37,7 @@
 #pragma once
 
 #include <cstddef>       // for nullptr
+#include <memory>
 
 #include <QtCore/QObject> // for Q_OBJECT
 #include <QtCore/QString>
@@ -49,6 +50,7 @@
 
 
 class DataContainer;
+class H5DeferredArrayLoader;
 using DataContainerShPtr = std::shared_ptr<DataContainer>;
 
 /**
@@ -192,12 +194,14 @@ class SIMPLib_EXPORT DataContainerArray : public QObject
      * @param dcaGid
      * @param dcaProxy
      * @param obs
+     * @param deferredLoader If set, DataArray values are not read now but the first time they are accessed
      * @return
      */
     virtual int readDataContainersFromHDF5(bool preflight,
                                            hid_t dcaGid,
                                            const DataContainerArrayProxy& dcaProxy,
-                                           Observable* obs = nullptr);
+                                           Observable* obs = nullptr,
+                                           const std::shared_ptr<H5DeferredArrayLoader>& deferredLoader = std::shared_ptr<H5DeferredArrayLoader>());
 
 
     /**
@@ -735,6 +739,13 @@ class SIMPLib_EXPORT DataContainerArray : public QObject
      */
     DataContainerArray::Pointer deepCopy(bool forceNoAllocate = false);
 
+    /**
+     * @brief getSharedDataArrayPaths Returns the paths of the arrays whose values are still shared
+     * with a copy made by deepCopy(), i.e. the arrays that have not been copied in memory yet.
+     * @return
+     */
+    QVector<DataArrayPath> getSharedDataArrayPaths();
+
   protected:
     DataContainerArray();
 
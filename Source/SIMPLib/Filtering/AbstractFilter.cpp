@@ -52,6 +52,7 @@ AbstractFilter::AbstractFilter()
 , m_InPreflight(false)
 , m_Enabled(true)
 , m_Removing(false)
+, m_MaxNumberOfThreads(0)
 , m_PipelineIndex(0)
 , m_Cancel(false)
 
@@ -360,6 +361,71 @@ DataArrayPath::RenameContainer AbstractFilter::getRenamedPaths()
   return container;
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool AbstractFilter::getSupportsConcurrentExecution()
+{
+  // Implemented in filters that only create new data from the data they select
+  return false;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool AbstractFilter::finishBackgroundWork(bool wait)
+{
+  Q_UNUSED(wait);
+  // Implemented in filters that hand work to other threads
+  return false;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QVector<DataArrayPath> AbstractFilter::getInputPaths()
+{
+  QVector<DataArrayPath> inputPaths;
+
+  const QMetaObject* metaobject = metaObject();
+  int count = metaobject->propertyCount();
+  for(int i = 0; i < count; i++)
+  {
+    QMetaProperty metaproperty = metaobject->property(i);
+    QVariant var = property(metaproperty.name());
+    if(var.userType() == qMetaTypeId<DataArrayPath>())
+    {
+      DataArrayPath path = var.value<DataArrayPath>();
+      if(!path.isEmpty())
+      {
+        inputPaths.push_back(path);
+      }
+    }
+    else if(var.userType() == qMetaTypeId<QVector<DataArrayPath>>())
+    {
+      QVector<DataArrayPath> paths = var.value<QVector<DataArrayPath>>();
+      for(const DataArrayPath& path : paths)
+      {
+        if(!path.isEmpty())
+        {
+          inputPaths.push_back(path);
+        }
+      }
+    }
+  }
+
+  return inputPaths;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QStringList AbstractFilter::getOutputFiles()
+{
+  // Implemented in filters that write files
+  return QStringList();
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -37,6 +37,7 @@
 
 #include <QtCore/QObject>
 #include <QtCore/QString>
+#include <QtCore/QStringList>
 #include <QtCore/QVector>
 #include <QtCore/QUuid>
 
@@ -251,6 +252,13 @@ public:
 
   SIMPL_INSTANCE_PROPERTY(bool, Removing)
 
+  /**
+  * @brief This property limits the number of threads a filter may use for its parallel algorithms. A
+  * value of zero or less lets the filter use every available core. The FilterPipeline sets this value
+  * from its own setting before each filter is executed.
+  */
+  SIMPL_INSTANCE_PROPERTY(int, MaxNumberOfThreads)
+
   // ------------------------------
   // These functions allow interogating the position the filter is in the pipeline and the previous and next filters
   // ------------------------------
@@ -300,6 +308,40 @@ public:
    */
   virtual DataArrayPath::RenameContainer getRenamedPaths();
 
+  /**
+   * @brief Returns true if this filter may execute at the same time as other filters when the FilterPipeline
+   * runs in concurrent mode. A filter returning true must not modify the existing data it selects, must only
+   * read data reachable from the paths returned by getInputPaths(), and must only write to the paths it creates
+   * or renames. The default implementation returns false, which makes the filter run on its own.
+   * @return
+   */
+  virtual bool getSupportsConcurrentExecution();
+
+  /**
+   * @brief Returns the DataArrayPaths that this filter reads during execute(). The default implementation
+   * collects every DataArrayPath and QVector<DataArrayPath> property of the filter. An empty DataArrayPath
+   * in the returned list stands for the entire DataContainerArray.
+   * @return
+   */
+  virtual QVector<DataArrayPath> getInputPaths();
+
+  /**
+   * @brief Returns the files and directories that this filter writes during execute(). The FilterPipeline never
+   * executes two filters at the same time that write the same file or a file inside a directory returned by the
+   * other. The default implementation writes no files and returns an empty list.
+   * @return
+   */
+  virtual QStringList getOutputFiles();
+
+  /**
+   * @brief Reports the outcome of work that execute() handed to other threads, such as a file that is written
+   * in the background or arrays that are read on demand, through the filter's messages and error condition. The FilterPipeline calls this while
+   * it executes and before it finishes. The default implementation has no such work and returns false.
+   * @param wait If true this blocks until the work has finished; otherwise unfinished work is left running
+   * @return true if the outcome of finished work was reported by this call
+   */
+  virtual bool finishBackgroundWork(bool wait);
+
   // ------------------------------
   // These methods are over ridden from the superclass in order to add the
   // pipeline index to the PipelineMessage Object.
@@ -35,12 +35,25 @@
 
 #include "FilterPipeline.h"
 
+#include <algorithm>
+
+#include <QtCore/QDir>
+#include <QtCore/QElapsedTimer>
+#include <QtCore/QFileInfo>
+#include <QtCore/QMutexLocker>
+#include <QtCore/QSet>
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+#include <tbb/task_arena.h>
+#endif
+
 #include "SIMPLib/CoreFilters/EmptyFilter.h"
 #include "SIMPLib/Filtering/FilterFactory.hpp"
 #include "SIMPLib/Filtering/FilterManager.h"
 
 #include "SIMPLib/CoreFilters/DataContainerReader.h"
 #include "SIMPLib/DataContainers/DataContainerArray.h"
+#include "SIMPLib/Filtering/PipelineCheckpoint.h"
 #include "SIMPLib/Utilities/StringOperations.h"
 
 // -----------------------------------------------------------------------------
@@ -48,9 +61,13 @@
 // -----------------------------------------------------------------------------
 FilterPipeline::FilterPipeline()
 : m_ErrorCondition(0)
+, m_MaxNumberOfThreads(0)
+, m_ConcurrentExecution(false)
+, m_CheckpointInterval(0)
 , m_Cancel(false)
 , m_PipelineName("")
 , m_Dca(nullptr)
+, m_ResumeIndex(-1)
 {
 }
 
@@ -93,6 +110,8 @@ FilterPipeline::Pointer FilterPipeline::deepCopy()
   // Convert from JSon
   FilterPipeline::Pointer copy = FilterPipeline::New();
   copy->fromJson(json);
+  copy->setMaxNumberOfThreads(getMaxNumberOfThreads());
+  copy->setConcurrentExecution(getConcurrentExecution());
 
   return copy;
 }
@@ -515,7 +534,7 @@ void FilterPipeline::disconnectFilterNotifications(QObject* filter)
 int FilterPipeline::preflightPipeline()
 {
   // Create the DataContainer object
-  DataContainerArray::Pointer dca = DataContainerArray::New();
+  DataContainerArray::Pointer dca = createStartDataContainerArray(true);
 
   setErrorCondition(0);
   int preflightError = 0;
@@ -621,6 +640,15 @@ int FilterPipeline::preflightPipeline()
 // -----------------------------------------------------------------------------
 DataContainerArray::Pointer FilterPipeline::execute()
 {
+  // Checkpoints record how far the pipeline got in pipeline order, so they need serial execution
+  bool checkpointing = isCheckpointing();
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  if(m_ConcurrentExecution && !checkpointing && m_ResumeIndex < 0)
+  {
+    return executeConcurrently();
+  }
+#endif
+
   int err = 0;
 
   // Clear pipeline cancel state
@@ -628,7 +656,22 @@ DataContainerArray::Pointer FilterPipeline::execute()
 
   connectSignalsSlots();
 
-  m_Dca = DataContainerArray::New();
+  m_Dca = createStartDataContainerArray(false);
+  int resumeIndex = m_ResumeIndex;
+  if(resumeIndex >= 0)
+  {
+    m_Dca = m_ResumeDca;
+    m_ResumeDca = DataContainerArray::NullPointer();
+    m_ResumeIndex = -1;
+  }
+  QStringList parameterHashes;
+  if(checkpointing)
+  {
+    parameterHashes = PipelineCheckpoint::ComputeParametersHashes(m_Pipeline);
+  }
+  QElapsedTimer checkpointTimer;
+  checkpointTimer.start();
+  m_ExecutionProfile.startPipeline();
 
   // Start looping through the Pipeline
   float progress = 0.0f;
@@ -640,9 +683,11 @@ DataContainerArray::Pointer FilterPipeline::execute()
   }
 
   PipelineMessage progValue("", "", 0, PipelineMessage::MessageType::ProgressValue, -1);
+  int pipelineIndex = -1;
   for(FilterContainerType::iterator filter = m_Pipeline.begin(); filter != m_Pipeline.end(); ++filter)
   {
     AbstractFilter::Pointer filt = *filter;
+    pipelineIndex++;
     progress = progress + 1.0f;
     progValue.setType(PipelineMessage::MessageType::ProgressValue);
     progValue.setProgressValue(static_cast<int>(progress / (m_Pipeline.size() + 1) * 100.0f));
@@ -650,6 +695,16 @@ DataContainerArray::Pointer FilterPipeline::execute()
 
     QString ss = QObject::tr("[%1/%2] %3 ").arg(progress).arg(m_Pipeline.size()).arg(filt->getHumanLabel());
 
+    // The results of the filters up to the checkpoint were restored by resumeFromCheckpoint()
+    if(pipelineIndex <= resumeIndex)
+    {
+      progValue.setType(PipelineMessage::MessageType::StatusMessage);
+      progValue.setText(ss + QObject::tr("restored from checkpoint"));
+      emit pipelineGeneratedMessage(progValue);
+      emit filt->filterCompleted(filt.get());
+      continue;
+    }
+
     progValue.setType(PipelineMessage::MessageType::StatusMessage);
     progValue.setText(ss);
     emit pipelineGeneratedMessage(progValue);
@@ -661,8 +716,11 @@ DataContainerArray::Pointer FilterPipeline::execute()
       filt->setMessagePrefix(ss);
       connectFilterNotifications(filt.get());
       filt->setDataContainerArray(m_Dca);
+      filt->setMaxNumberOfThreads(m_MaxNumberOfThreads);
       setCurrentFilter(*filter);
+      m_ExecutionProfile.startFilter(m_Dca);
       filt->execute();
+      m_ExecutionProfile.finishFilter(filt.get(), m_Dca);
       disconnectFilterNotifications((*filter).get());
       filt->setDataContainerArray(DataContainerArray::NullPointer());
       err = filt->getErrorCondition();
@@ -679,6 +737,22 @@ DataContainerArray::Pointer FilterPipeline::execute()
         progValue.setCode(filt->getErrorCondition());
         emit pipelineGeneratedMessage(progValue);
         emit filt->filterCompleted(filt.get());
+        finishBackgroundWork(true);
+        m_ExecutionProfile.finishPipeline(m_Dca);
+        emit pipelineFinished();
+        disconnectSignalsSlots();
+
+        return m_Dca;
+      }
+
+      // Report the background work of earlier filters that finished in the meantime
+      err = finishBackgroundWork(false);
+      if(err < 0)
+      {
+        setErrorCondition(err);
+        emit filt->filterCompleted(filt.get());
+        finishBackgroundWork(true);
+        m_ExecutionProfile.finishPipeline(m_Dca);
         emit pipelineFinished();
         disconnectSignalsSlots();
 
@@ -693,10 +767,448 @@ DataContainerArray::Pointer FilterPipeline::execute()
       break;
     }
 
+    // There is nothing to resume after the last filter
+    if(checkpointing && filt->getEnabled() && pipelineIndex < m_Pipeline.size() - 1)
+    {
+      bool afterFilter = m_CheckpointFilterIndices.contains(pipelineIndex);
+      bool intervalElapsed = m_CheckpointInterval > 0 && checkpointTimer.elapsed() >= static_cast<qint64>(m_CheckpointInterval) * 60000;
+      if(afterFilter || intervalElapsed)
+      {
+        QString errorMessage;
+        int checkpointErr = PipelineCheckpoint::WriteCheckpoint(m_CheckpointFile, m_Dca, parameterHashes, pipelineIndex, errorMessage);
+        // A failed checkpoint is reported but does not stop the pipeline
+        progValue.setType(checkpointErr < 0 ? PipelineMessage::MessageType::Warning : PipelineMessage::MessageType::StatusMessage);
+        progValue.setText(checkpointErr < 0 ? errorMessage : ss + QObject::tr("checkpoint written to %1").arg(m_CheckpointFile));
+        progValue.setCode(checkpointErr);
+        emit pipelineGeneratedMessage(progValue);
+        progValue.setCode(0);
+        checkpointTimer.restart();
+      }
+    }
+
     // Emit that the filter is completed for those objects that care, even the disabled ones.
     emit filt->filterCompleted(filt.get());
   }
 
+  // The pipeline is not complete before the background work of its filters has finished
+  err = finishBackgroundWork(true);
+  if(err < 0)
+  {
+    setErrorCondition(err);
+    m_ExecutionProfile.finishPipeline(m_Dca);
+    emit pipelineFinished();
+    disconnectSignalsSlots();
+
+    return m_Dca;
+  }
+
+  m_ExecutionProfile.finishPipeline(m_Dca);
+  emit pipelineFinished();
+
+  disconnectSignalsSlots();
+
+  PipelineMessage completeMessage("", "Pipeline Complete", 0, PipelineMessage::MessageType::StatusMessage, -1);
+  emit pipelineGeneratedMessage(completeMessage);
+
+  return m_Dca;
+}
+
+namespace
+{
+/**
+ * @brief The data a filter accesses while it executes. Written paths are widened to their parent container
+ * because adding or removing children modifies the container itself. The files a filter writes are held
+ * exclusively, as if they were written paths.
+ */
+struct FilterDataAccess
+{
+  QVector<DataArrayPath> readPaths;
+  QVector<DataArrayPath> writePaths;
+  QStringList outputFiles;
+  bool exclusive = true;
+};
+
+// -----------------------------------------------------------------------------
+// Empty path components act as wild cards that match everything below them
+// -----------------------------------------------------------------------------
+bool pathsOverlap(const DataArrayPath& path1, const DataArrayPath& path2)
+{
+  if(path1.getDataContainerName().isEmpty() || path2.getDataContainerName().isEmpty())
+  {
+    return true;
+  }
+  if(path1.getDataContainerName() != path2.getDataContainerName())
+  {
+    return false;
+  }
+  if(path1.getAttributeMatrixName().isEmpty() || path2.getAttributeMatrixName().isEmpty())
+  {
+    return true;
+  }
+  if(path1.getAttributeMatrixName() != path2.getAttributeMatrixName())
+  {
+    return false;
+  }
+  if(path1.getDataArrayName().isEmpty() || path2.getDataArrayName().isEmpty())
+  {
+    return true;
+  }
+  return path1.getDataArrayName() == path2.getDataArrayName();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool anyPathsOverlap(const QVector<DataArrayPath>& paths1, const QVector<DataArrayPath>& paths2)
+{
+  for(const DataArrayPath& path1 : paths1)
+  {
+    for(const DataArrayPath& path2 : paths2)
+    {
+      if(pathsOverlap(path1, path2))
+      {
+        return true;
+      }
+    }
+  }
+  return false;
+}
+
+// -----------------------------------------------------------------------------
+// A directory overlaps every file inside of it
+// -----------------------------------------------------------------------------
+bool filesOverlap(const QString& file1, const QString& file2)
+{
+#if defined(Q_OS_WIN) || defined(Q_OS_MAC)
+  Qt::CaseSensitivity caseSensitivity = Qt::CaseInsensitive;
+#else
+  Qt::CaseSensitivity caseSensitivity = Qt::CaseSensitive;
+#endif
+  if(file1.compare(file2, caseSensitivity) == 0)
+  {
+    return true;
+  }
+  return file1.startsWith(file2 + "/", caseSensitivity) || file2.startsWith(file1 + "/", caseSensitivity);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool anyFilesOverlap(const QStringList& files1, const QStringList& files2)
+{
+  for(const QString& file1 : files1)
+  {
+    for(const QString& file2 : files2)
+    {
+      if(filesOverlap(file1, file2))
+      {
+        return true;
+      }
+    }
+  }
+  return false;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+DataArrayPath parentContainerPath(const DataArrayPath& path)
+{
+  if(!path.getDataArrayName().isEmpty())
+  {
+    return DataArrayPath(path.getDataContainerName(), path.getAttributeMatrixName(), "");
+  }
+  if(!path.getAttributeMatrixName().isEmpty())
+  {
+    return DataArrayPath(path.getDataContainerName(), "", "");
+  }
+  return DataArrayPath();
+}
+
+// -----------------------------------------------------------------------------
+// Uses the created and renamed paths collected while preflighting the filter
+// -----------------------------------------------------------------------------
+FilterDataAccess getFilterDataAccess(const AbstractFilter::Pointer& filter)
+{
+  FilterDataAccess access;
+  access.exclusive = !filter->getSupportsConcurrentExecution();
+  if(access.exclusive)
+  {
+    return access;
+  }
+
+  access.readPaths = filter->getInputPaths();
+  std::list<DataArrayPath> createdPaths = filter->getCreatedPaths();
+  for(const DataArrayPath& createdPath : createdPaths)
+  {
+    access.writePaths.push_back(parentContainerPath(createdPath));
+  }
+  DataArrayPath::RenameContainer renamedPaths = filter->getRenamedPaths();
+  for(const DataArrayPath::RenameType& rename : renamedPaths)
+  {
+    access.writePaths.push_back(parentContainerPath(std::get<0>(rename)));
+    access.writePaths.push_back(parentContainerPath(std::get<1>(rename)));
+  }
+  QStringList outputFiles = filter->getOutputFiles();
+  for(const QString& outputFile : outputFiles)
+  {
+    if(!outputFile.isEmpty())
+    {
+      access.outputFiles.push_back(QDir::cleanPath(QFileInfo(outputFile).absoluteFilePath()));
+    }
+  }
+  return access;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool filtersConflict(const FilterDataAccess& access1, const FilterDataAccess& access2)
+{
+  if(access1.exclusive || access2.exclusive)
+  {
+    return true;
+  }
+  return anyPathsOverlap(access1.writePaths, access2.writePaths) || anyPathsOverlap(access1.writePaths, access2.readPaths) ||
+         anyPathsOverlap(access1.readPaths, access2.writePaths) || anyFilesOverlap(access1.outputFiles, access2.outputFiles);
+}
+} // namespace
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+DataContainerArray::Pointer FilterPipeline::executeConcurrently()
+{
+  // Clear pipeline cancel state
+  setCancel(false);
+
+  // The dependency graph is built from the paths that preflight collects for each filter
+  int err = preflightPipeline();
+  m_Dca = createStartDataContainerArray(false);
+  m_ExecutionProfile.startPipeline();
+  if(err < 0)
+  {
+    setErrorCondition(err);
+    m_ExecutionProfile.finishPipeline(m_Dca);
+    emit pipelineFinished();
+    return m_Dca;
+  }
+
+  connectSignalsSlots();
+
+  // Connect this object to anything that wants to know about PipelineMessages
+  for(int i = 0; i < m_MessageReceivers.size(); i++)
+  {
+    connect(this, SIGNAL(pipelineGeneratedMessage(const PipelineMessage&)), m_MessageReceivers.at(i), SLOT(processPipelineMessage(const PipelineMessage&)));
+  }
+
+  // A filter depends on every earlier filter whose data access conflicts with its own
+  int numFilters = m_Pipeline.size();
+  QVector<FilterDataAccess> dataAccess(numFilters);
+  QVector<QVector<int>> dependents(numFilters);
+  QVector<int> remainingDependencies(numFilters, 0);
+  for(int i = 0; i < numFilters; i++)
+  {
+    if(!m_Pipeline[i]->getEnabled())
+    {
+      continue;
+    }
+    dataAccess[i] = getFilterDataAccess(m_Pipeline[i]);
+    for(int j = 0; j < i; j++)
+    {
+      if(m_Pipeline[j]->getEnabled() && filtersConflict(dataAccess[j], dataAccess[i]))
+      {
+        dependents[j].push_back(i);
+        remainingDependencies[i]++;
+      }
+    }
+  }
+
+  {
+    QMutexLocker locker(&m_ConcurrentMutex);
+    m_QueuedMessages.clear();
+    m_CompletedFilters.clear();
+  }
+
+  QList<int> readyFilters;
+  for(int i = 0; i < numFilters; i++)
+  {
+    if(remainingDependencies[i] == 0)
+    {
+      readyFilters.push_back(i);
+    }
+  }
+
+  int maxThreads = m_MaxNumberOfThreads > 0 ? m_MaxNumberOfThreads : static_cast<int>(tbb::task_arena::automatic);
+  tbb::task_arena arena(maxThreads, 0);
+
+  // Process wide CPU time and memory cannot be attributed to filters that overlap, so only the wall time is profiled
+  QVector<double> filterWallTimes(numFilters, 0.0);
+  QSet<int> runningFilters;
+  int failedIndex = -1;
+  float progress = 0.0f;
+  PipelineMessage progValue("", "", 0, PipelineMessage::MessageType::ProgressValue, -1);
+  while(true)
+  {
+    // Start every filter whose dependencies have completed, in pipeline order
+    while(!readyFilters.empty() && failedIndex < 0 && !getCancel())
+    {
+      int index = readyFilters.takeFirst();
+      AbstractFilter::Pointer filt = m_Pipeline[index];
+      progress = progress + 1.0f;
+      progValue.setType(PipelineMessage::MessageType::ProgressValue);
+      progValue.setProgressValue(static_cast<int>(progress / (m_Pipeline.size() + 1) * 100.0f));
+      emit pipelineGeneratedMessage(progValue);
+
+      QString ss = QObject::tr("[%1/%2] %3 ").arg(index + 1).arg(m_Pipeline.size()).arg(filt->getHumanLabel());
+
+      progValue.setType(PipelineMessage::MessageType::StatusMessage);
+      progValue.setText(ss);
+      emit pipelineGeneratedMessage(progValue);
+      emit filt->filterInProgress(filt.get());
+
+      // Do not execute disabled filters
+      if(!filt->getEnabled())
+      {
+        emit filt->filterCompleted(filt.get());
+        continue;
+      }
+
+      filt->setMessagePrefix(ss);
+      connect(filt.get(), SIGNAL(filterGeneratedMessage(const PipelineMessage&)), this, SLOT(queueFilterMessage(const PipelineMessage&)), Qt::DirectConnection);
+      filt->setDataContainerArray(m_Dca);
+      filt->setMaxNumberOfThreads(m_MaxNumberOfThreads);
+      setCurrentFilter(filt);
+      runningFilters.insert(index);
+      arena.enqueue([this, filt, index, &filterWallTimes] {
+        QElapsedTimer timer;
+        timer.start();
+        filt->execute();
+        filterWallTimes[index] = static_cast<double>(timer.nsecsElapsed()) * 1.0E-9;
+        QMutexLocker locker(&m_ConcurrentMutex);
+        m_CompletedFilters.push_back(index);
+        m_ConcurrentCondition.wakeAll();
+      });
+    }
+
+    if(runningFilters.empty())
+    {
+      break;
+    }
+
+    // Wait for messages or finished filters; the timeout lets a cancel request be noticed
+    QVector<PipelineMessage> messages;
+    QVector<int> completedFilters;
+    {
+      QMutexLocker locker(&m_ConcurrentMutex);
+      if(m_QueuedMessages.empty() && m_CompletedFilters.empty())
+      {
+        m_ConcurrentCondition.wait(&m_ConcurrentMutex, 100);
+      }
+      messages.swap(m_QueuedMessages);
+      completedFilters.swap(m_CompletedFilters);
+    }
+
+    // Messages are forwarded from this thread so receivers see the same threading as in serial execution
+    for(const PipelineMessage& message : messages)
+    {
+      emit pipelineGeneratedMessage(message);
+    }
+
+    for(int index : completedFilters)
+    {
+      AbstractFilter::Pointer filt = m_Pipeline[index];
+      runningFilters.remove(index);
+      disconnect(filt.get(), SIGNAL(filterGeneratedMessage(const PipelineMessage&)), this, SLOT(queueFilterMessage(const PipelineMessage&)));
+      filt->setDataContainerArray(DataContainerArray::NullPointer());
+
+      PipelineProfile::FilterProfile filterProfile;
+      filterProfile.pipelineIndex = filt->getPipelineIndex();
+      filterProfile.filterClassName = filt->getNameOfClass();
+      filterProfile.filterHumanLabel = filt->getHumanLabel();
+      filterProfile.errorCondition = filt->getErrorCondition();
+      filterProfile.wallTime = filterWallTimes[index];
+      m_ExecutionProfile.addFilterProfile(filterProfile);
+
+      if(filt->getErrorCondition() < 0)
+      {
+        // Report the error of the earliest failing filter, as serial execution would
+        if(failedIndex < 0 || index < failedIndex)
+        {
+          failedIndex = index;
+        }
+        continue;
+      }
+      if(failedIndex >= 0 || getCancel())
+      {
+        continue;
+      }
+
+      // Emit that the filter is completed for those objects that care
+      emit filt->filterCompleted(filt.get());
+      for(int dependent : dependents[index])
+      {
+        remainingDependencies[dependent]--;
+        if(remainingDependencies[dependent] == 0)
+        {
+          readyFilters.push_back(dependent);
+        }
+      }
+    }
+    std::sort(readyFilters.begin(), readyFilters.end());
+
+    // Stop the filters that are still running after an error or a cancel request
+    if(failedIndex >= 0 || getCancel())
+    {
+      for(int index : runningFilters)
+      {
+        m_Pipeline[index]->setCancel(true);
+      }
+    }
+  }
+
+  // Clear cancel filter state
+  for(AbstractFilter::Pointer filt : m_Pipeline)
+  {
+    filt->setCancel(false);
+  }
+
+  // No filter is running anymore, so their background work is finished from this thread as in serial execution
+  err = finishBackgroundWork(true);
+
+  if(failedIndex >= 0)
+  {
+    AbstractFilter::Pointer filt = m_Pipeline[failedIndex];
+    setErrorCondition(filt->getErrorCondition());
+    progValue.setFilterClassName(filt->getNameOfClass());
+    progValue.setFilterHumanLabel(filt->getHumanLabel());
+    progValue.setType(PipelineMessage::MessageType::Error);
+    progValue.setProgressValue(100);
+    QString ss = QObject::tr("[%1/%2] %3 caused an error during execution.").arg(failedIndex + 1).arg(m_Pipeline.size()).arg(filt->getHumanLabel());
+    progValue.setText(ss);
+    progValue.setPipelineIndex(filt->getPipelineIndex());
+    progValue.setCode(filt->getErrorCondition());
+    emit pipelineGeneratedMessage(progValue);
+    emit filt->filterCompleted(filt.get());
+    m_ExecutionProfile.finishPipeline(m_Dca);
+    emit pipelineFinished();
+    disconnectSignalsSlots();
+
+    return m_Dca;
+  }
+
+  if(err < 0)
+  {
+    setErrorCondition(err);
+    m_ExecutionProfile.finishPipeline(m_Dca);
+    emit pipelineFinished();
+    disconnectSignalsSlots();
+
+    return m_Dca;
+  }
+
+  m_ExecutionProfile.finishPipeline(m_Dca);
   emit pipelineFinished();
 
   disconnectSignalsSlots();
@@ -706,6 +1218,97 @@ DataContainerArray::Pointer FilterPipeline::execute()
 
   return m_Dca;
 }
+#endif
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int FilterPipeline::finishBackgroundWork(bool wait)
+{
+  int err = 0;
+  for(const AbstractFilter::Pointer& filt : m_Pipeline)
+  {
+    connectFilterNotifications(filt.get());
+    bool finished = filt->finishBackgroundWork(wait);
+    disconnectFilterNotifications(filt.get());
+    if(!finished || filt->getErrorCondition() >= 0 || err < 0)
+    {
+      continue;
+    }
+
+    err = filt->getErrorCondition();
+    PipelineMessage progValue("", "", 0, PipelineMessage::MessageType::Error, -1);
+    progValue.setFilterClassName(filt->getNameOfClass());
+    progValue.setFilterHumanLabel(filt->getHumanLabel());
+    progValue.setProgressValue(100);
+    QString ss = QObject::tr("[%1/%2] %3 caused an error while finishing its background work.").arg(filt->getPipelineIndex() + 1).arg(m_Pipeline.size()).arg(filt->getHumanLabel());
+    progValue.setText(ss);
+    progValue.setPipelineIndex(filt->getPipelineIndex());
+    progValue.setCode(err);
+    emit pipelineGeneratedMessage(progValue);
+  }
+  return err;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool FilterPipeline::isCheckpointing()
+{
+  return !m_CheckpointFile.isEmpty() && (!m_CheckpointFilterIndices.empty() || m_CheckpointInterval > 0);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+DataContainerArray::Pointer FilterPipeline::createStartDataContainerArray(bool forceNoAllocate)
+{
+  if(nullptr == m_InputDataContainerArray.get())
+  {
+    return DataContainerArray::New();
+  }
+  return m_InputDataContainerArray->deepCopy(forceNoAllocate);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int FilterPipeline::resumeFromCheckpoint(const QString& filePath, QString& errorMessage)
+{
+  m_ResumeDca = DataContainerArray::NullPointer();
+  m_ResumeIndex = -1;
+
+  QStringList parameterHashes = PipelineCheckpoint::ComputeParametersHashes(m_Pipeline);
+  DataContainerArray::Pointer dca;
+  int pipelineIndex = -1;
+  int err = PipelineCheckpoint::ReadCheckpoint(filePath, parameterHashes, dca, pipelineIndex, errorMessage);
+  if(err < 0)
+  {
+    setErrorCondition(err);
+    return err;
+  }
+  m_ResumeDca = dca;
+  m_ResumeIndex = pipelineIndex;
+  return 0;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void FilterPipeline::queueFilterMessage(const PipelineMessage& message)
+{
+  QMutexLocker locker(&m_ConcurrentMutex);
+  m_QueuedMessages.push_back(message);
+  m_ConcurrentCondition.wakeAll();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+PipelineProfile FilterPipeline::getExecutionProfile()
+{
+  return m_ExecutionProfile;
+}
 
 // -----------------------------------------------------------------------------
 //
@@ -37,13 +37,17 @@
 
 #include <QtCore/QJsonObject>
 #include <QtCore/QList>
+#include <QtCore/QMutex>
 #include <QtCore/QObject>
+#include <QtCore/QSet>
 #include <QtCore/QString>
 #include <QtCore/QTextStream>
+#include <QtCore/QWaitCondition>
 
 #include "SIMPLib/Common/Observer.h"
 #include "SIMPLib/Common/SIMPLibSetGetMacros.h"
 #include "SIMPLib/Filtering/AbstractFilter.h"
+#include "SIMPLib/Filtering/PipelineProfile.h"
 #include "SIMPLib/SIMPLib.h"
 
 class IObserver;
@@ -90,6 +94,45 @@ public:
   SIMPL_INSTANCE_PROPERTY(int, ErrorCondition)
   SIMPL_INSTANCE_PROPERTY(AbstractFilter::Pointer, CurrentFilter)
 
+  /**
+   * @brief The maximum number of threads each filter may use while the pipeline executes. A value of
+   * zero or less uses every available core.
+   */
+  SIMPL_INSTANCE_PROPERTY(int, MaxNumberOfThreads)
+
+  /**
+   * @brief When true, execute() preflights the pipeline, builds a dependency graph from the paths each filter
+   * reads, creates and renames, and runs independent filters at the same time. Filters that do not support
+   * concurrent execution still run on their own and in pipeline order. Requires parallel algorithms to be
+   * enabled; otherwise the pipeline always executes serially.
+   */
+  SIMPL_INSTANCE_PROPERTY(bool, ConcurrentExecution)
+
+  /**
+   * @brief The file execute() writes checkpoints to, see PipelineCheckpoint. Each checkpoint replaces the
+   * previous one. No checkpoints are written if this is empty. Pipelines that write or resume from
+   * checkpoints always execute serially.
+   */
+  SIMPL_INSTANCE_PROPERTY(QString, CheckpointFile)
+
+  /**
+   * @brief The pipeline indices of the filters after which execute() writes a checkpoint
+   */
+  SIMPL_INSTANCE_PROPERTY(QSet<int>, CheckpointFilterIndices)
+
+  /**
+   * @brief When greater than zero, execute() writes a checkpoint after the first filter that finishes once
+   * this many minutes have passed since the pipeline started or the last checkpoint was written.
+   */
+  SIMPL_INSTANCE_PROPERTY(int, CheckpointInterval)
+
+  /**
+   * @brief When set, preflightPipeline() and execute() start from a copy of this DataContainerArray instead of an
+   * empty one. The copy shares the values of the DataArrays, so the pipeline never modifies this DataContainerArray
+   * and several pipelines may start from it at the same time.
+   */
+  SIMPL_INSTANCE_PROPERTY(DataContainerArray::Pointer, InputDataContainerArray)
+
   /**
    * @brief Cancel the operation
    */
@@ -102,6 +145,17 @@ public:
    */
   virtual DataContainerArray::Pointer execute();
 
+  /**
+   * @brief Loads the data stored in a checkpoint so that the next call to execute() starts with the filter
+   * after the one the checkpoint was written after. The checkpoint is rejected if any of the filters up to
+   * that point differ from the ones that ran when it was written. Call this after preflightPipeline() as
+   * preflighting can update filter parameters.
+   * @param filePath
+   * @param errorMessage Set if the checkpoint was rejected
+   * @return 0 on success, negative on error
+   */
+  virtual int resumeFromCheckpoint(const QString& filePath, QString& errorMessage);
+
   /**
    * @brief This will preflight the pipeline and report any errors that would occur during
    * execution of the pipeline
@@ -125,6 +179,12 @@ public:
 
   virtual DataContainerArray::Pointer getDataContainerArray();
 
+  /**
+   * @brief Returns the time and memory used by each filter during the last call to execute()
+   * @return
+   */
+  virtual PipelineProfile getExecutionProfile();
+
   /**
    * @brief
    */
@@ -188,6 +248,14 @@ protected:
 
   void updatePrevNextFilters();
 
+protected slots:
+  /**
+   * @brief Stores a message generated by a filter running on a worker thread so that the thread executing
+   * the pipeline can forward it to the message receivers.
+   * @param message
+   */
+  void queueFilterMessage(const PipelineMessage& message);
+
 signals:
   void pipelineGeneratedMessage(const PipelineMessage& message);
 
@@ -232,10 +300,46 @@ private:
   QVector<QObject*> m_MessageReceivers;
 
   DataContainerArray::Pointer m_Dca;
+  PipelineProfile m_ExecutionProfile;
+
+  QMutex m_ConcurrentMutex;
+  QWaitCondition m_ConcurrentCondition;
+  QVector<PipelineMessage> m_QueuedMessages;
+  QVector<int> m_CompletedFilters;
+
+  DataContainerArray::Pointer m_ResumeDca;
+  int m_ResumeIndex;
 
   void connectSignalsSlots();
   void disconnectSignalsSlots();
 
+  /**
+   * @brief Executes the pipeline with independent filters running concurrently
+   * @return
+   */
+  DataContainerArray::Pointer executeConcurrently();
+
+  /**
+   * @brief Returns true if execute() has to write checkpoints
+   * @return
+   */
+  bool isCheckpointing();
+
+  /**
+   * @brief Returns the DataContainerArray the pipeline starts from, see setInputDataContainerArray()
+   * @param forceNoAllocate If true the DataArrays of the copy are not allocated, which suffices for preflight
+   * @return
+   */
+  DataContainerArray::Pointer createStartDataContainerArray(bool forceNoAllocate);
+
+  /**
+   * @brief Reports the outcome of work that the filters handed to other threads, such as background file writes.
+   * An error message is emitted for the first filter whose work failed.
+   * @param wait If true this blocks until all of that work has finished
+   * @return The error condition of the first filter whose work failed, or 0
+   */
+  int finishBackgroundWork(bool wait);
+
 public:
   FilterPipeline(const FilterPipeline&) = delete; // Copy Constructor Not Implemented
   FilterPipeline(FilterPipeline&&) = delete;      // Move Constructor Not Implemented
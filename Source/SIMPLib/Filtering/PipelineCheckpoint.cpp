@@ -0,0 +1,265 @@
+/* ============================================================================
+* Copyright (c) 2009-2015 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-07-D-5800
+*    United States Air Force Prime Contract FA8650-10-D-5210
+*    United States Prime Contract Navy N00173-07-C-2068
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+
+#include "PipelineCheckpoint.h"
+
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <cstdio>
+#endif
+
+#include <QtCore/QCryptographicHash>
+#include <QtCore/QFile>
+#include <QtCore/QJsonArray>
+#include <QtCore/QJsonDocument>
+
+#include "H5Support/H5ScopedSentinel.h"
+#include "H5Support/QH5Lite.h"
+#include "H5Support/QH5Utilities.h"
+
+#include "SIMPLib/CoreFilters/DataContainerReader.h"
+#include "SIMPLib/CoreFilters/DataContainerWriter.h"
+#include "SIMPLib/SIMPLibVersion.h"
+
+const QString PipelineCheckpoint::DatasetName("PipelineCheckpoint");
+
+namespace
+{
+const QString k_PipelineIndex("PipelineIndex");
+const QString k_NumberOfFilters("NumberOfFilters");
+const QString k_ParameterHashes("ParameterHashes");
+const QString k_Version("SIMPLibVersion");
+
+/**
+ * @brief Renames source to target, replacing target in a single step if it exists so there is never
+ * a moment without a file at target
+ * @param source
+ * @param target
+ * @return
+ */
+bool ReplaceFile(const QString& source, const QString& target)
+{
+#if defined(_WIN32)
+  return MoveFileExW(reinterpret_cast<const wchar_t*>(source.utf16()), reinterpret_cast<const wchar_t*>(target.utf16()), MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH) != 0;
+#else
+  return std::rename(QFile::encodeName(source).constData(), QFile::encodeName(target).constData()) == 0;
+#endif
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+PipelineCheckpoint::PipelineCheckpoint() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+PipelineCheckpoint::~PipelineCheckpoint() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString PipelineCheckpoint::ComputeParametersHash(const AbstractFilter::Pointer& filter)
+{
+  if(nullptr == filter)
+  {
+    return QString();
+  }
+  // The keys of a QJsonObject are sorted so equal parameters always produce the same document
+  QByteArray json = QJsonDocument(filter->toJson()).toJson(QJsonDocument::Compact);
+  return QString::fromLatin1(QCryptographicHash::hash(json, QCryptographicHash::Sha256).toHex());
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QStringList PipelineCheckpoint::ComputeParametersHashes(const QList<AbstractFilter::Pointer>& filters)
+{
+  QStringList hashes;
+  for(const AbstractFilter::Pointer& filter : filters)
+  {
+    hashes.push_back(ComputeParametersHash(filter));
+  }
+  return hashes;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int PipelineCheckpoint::WriteCheckpoint(const QString& filePath, const DataContainerArray::Pointer& dca, const QStringList& parameterHashes, int pipelineIndex, QString& errorMessage)
+{
+  if(nullptr == dca || pipelineIndex < 0 || pipelineIndex >= parameterHashes.size())
+  {
+    errorMessage = QObject::tr("Invalid pipeline index %1 for a checkpoint of a pipeline with %2 filters").arg(pipelineIndex).arg(parameterHashes.size());
+    return -1;
+  }
+
+  QString tempFilePath = filePath + ".tmp";
+  DataContainerWriter::Pointer writer = DataContainerWriter::New();
+  writer->setDataContainerArray(dca);
+  writer->setOutputFile(tempFilePath);
+  writer->setWriteXdmfFile(false);
+  writer->setAppendToExisting(false);
+  writer->execute();
+  if(writer->getErrorCondition() < 0)
+  {
+    errorMessage = QObject::tr("Error %1 writing the checkpoint file '%2'").arg(writer->getErrorCondition()).arg(tempFilePath);
+    QFile::remove(tempFilePath);
+    return writer->getErrorCondition();
+  }
+
+  QJsonObject json;
+  json[k_PipelineIndex] = pipelineIndex;
+  json[k_NumberOfFilters] = parameterHashes.size();
+  json[k_ParameterHashes] = QJsonArray::fromStringList(parameterHashes.mid(0, pipelineIndex + 1));
+  json[k_Version] = SIMPLib::Version::Complete();
+  herr_t err = 0;
+  {
+    hid_t fileId = QH5Utilities::openFile(tempFilePath, false);
+    if(fileId < 0)
+    {
+      errorMessage = QObject::tr("Error opening the checkpoint file '%1'").arg(tempFilePath);
+      QFile::remove(tempFilePath);
+      return -2;
+    }
+    H5ScopedFileSentinel sentinel(&fileId, true);
+    QString info = QString::fromUtf8(QJsonDocument(json).toJson(QJsonDocument::Compact));
+    err = QH5Lite::writeStringDataset(fileId, DatasetName, info);
+  }
+  // The sentinel has closed the file so it can be removed
+  if(err < 0)
+  {
+    errorMessage = QObject::tr("Error writing the checkpoint information to '%1'").arg(tempFilePath);
+    QFile::remove(tempFilePath);
+    return -3;
+  }
+
+  // Only replace the previous checkpoint once the new one is complete. The replacement is a single
+  // rename so either the previous or the new checkpoint exists at filePath at all times.
+  if(!ReplaceFile(tempFilePath, filePath))
+  {
+    errorMessage = QObject::tr("The checkpoint file '%1' could not be renamed to '%2'").arg(tempFilePath).arg(filePath);
+    QFile::remove(tempFilePath);
+    return -4;
+  }
+  return 0;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int PipelineCheckpoint::ReadCheckpointInfo(const QString& filePath, QJsonObject& json)
+{
+  hid_t fileId = QH5Utilities::openFile(filePath, true);
+  if(fileId < 0)
+  {
+    return -1;
+  }
+  H5ScopedFileSentinel sentinel(&fileId, true);
+  if(!QH5Lite::datasetExists(fileId, DatasetName))
+  {
+    return -2;
+  }
+  QString info;
+  if(QH5Lite::readStringDataset(fileId, DatasetName, info) < 0)
+  {
+    return -3;
+  }
+  QJsonParseError parseError;
+  QJsonDocument doc = QJsonDocument::fromJson(info.toUtf8(), &parseError);
+  if(parseError.error != QJsonParseError::NoError || !doc.isObject())
+  {
+    return -4;
+  }
+  json = doc.object();
+  return 0;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int PipelineCheckpoint::ReadCheckpoint(const QString& filePath, const QStringList& parameterHashes, DataContainerArray::Pointer& dca, int& pipelineIndex, QString& errorMessage)
+{
+  QJsonObject json;
+  int err = ReadCheckpointInfo(filePath, json);
+  if(err < 0)
+  {
+    errorMessage = QObject::tr("The file '%1' could not be read as a pipeline checkpoint").arg(filePath);
+    return err;
+  }
+
+  int index = json[k_PipelineIndex].toInt(-1);
+  QJsonArray checkpointHashes = json[k_ParameterHashes].toArray();
+  if(index < 0 || checkpointHashes.size() != index + 1)
+  {
+    errorMessage = QObject::tr("The checkpoint file '%1' is damaged").arg(filePath);
+    return -20;
+  }
+  if(index >= parameterHashes.size())
+  {
+    errorMessage = QObject::tr("The checkpoint was written after filter %1 but the pipeline only has %2 filters").arg(index + 1).arg(parameterHashes.size());
+    return -21;
+  }
+
+  // Every filter that contributed to the stored data must still have the same parameters
+  for(int i = 0; i <= index; i++)
+  {
+    if(checkpointHashes[i].toString() != parameterHashes[i])
+    {
+      errorMessage = QObject::tr("Filter %1 is different from the filter that ran when the checkpoint was written or its parameters have changed").arg(i + 1);
+      return -22;
+    }
+  }
+
+  DataContainerReader::Pointer reader = DataContainerReader::New();
+  reader->setInputFile(filePath);
+  DataContainerArrayProxy proxy = reader->readDataContainerArrayStructure(filePath);
+  proxy.setFlags(Qt::Checked);
+  reader->setInputFileDataContainerArrayProxy(proxy);
+  reader->setDataContainerArray(DataContainerArray::New());
+  reader->execute();
+  if(reader->getErrorCondition() < 0)
+  {
+    errorMessage = QObject::tr("Error %1 reading the data stored in the checkpoint file '%2'").arg(reader->getErrorCondition()).arg(filePath);
+    return reader->getErrorCondition();
+  }
+
+  dca = reader->getDataContainerArray();
+  pipelineIndex = index;
+  return 0;
+}
@@ -0,0 +1,118 @@
+/* ============================================================================
+* Copyright (c) 2009-2015 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-07-D-5800
+*    United States Air Force Prime Contract FA8650-10-D-5210
+*    United States Prime Contract Navy N00173-07-C-2068
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+
+#pragma once
+
+#include <QtCore/QJsonObject>
+#include <QtCore/QString>
+#include <QtCore/QStringList>
+
+#include "SIMPLib/DataContainers/DataContainerArray.h"
+#include "SIMPLib/Filtering/AbstractFilter.h"
+#include "SIMPLib/SIMPLib.h"
+
+/**
+ * @brief The PipelineCheckpoint class writes and reads the checkpoints FilterPipeline uses to resume an
+ * execution that stopped part way through. A checkpoint is a regular .dream3d file written by
+ * DataContainerWriter with an extra JSON dataset that records the pipeline index of the last filter that
+ * executed and a hash of the parameters of every filter up to and including it. A checkpoint is only
+ * accepted if those filters still have the same parameters.
+ */
+class SIMPLib_EXPORT PipelineCheckpoint
+{
+  public:
+    virtual ~PipelineCheckpoint();
+
+    /**
+     * @brief The name of the dataset that holds the checkpoint information
+     */
+    static const QString DatasetName;
+
+    /**
+     * @brief Returns the SHA-256 hash of the filter class, its enabled state and its parameters
+     * @param filter
+     * @return The hash as a hexadecimal string
+     */
+    static QString ComputeParametersHash(const AbstractFilter::Pointer& filter);
+
+    /**
+     * @brief Returns the parameter hashes of every filter in the pipeline
+     * @param filters
+     * @return
+     */
+    static QStringList ComputeParametersHashes(const QList<AbstractFilter::Pointer>& filters);
+
+    /**
+     * @brief Writes the DataContainerArray and the checkpoint information to filePath. The file is first
+     * written next to filePath and then renamed so an interrupted write does not destroy a previous checkpoint.
+     * @param filePath
+     * @param dca
+     * @param parameterHashes The parameter hashes of every filter in the pipeline
+     * @param pipelineIndex The index of the last filter that executed
+     * @param errorMessage Set if the checkpoint could not be written
+     * @return 0 on success, negative on error
+     */
+    static int WriteCheckpoint(const QString& filePath, const DataContainerArray::Pointer& dca, const QStringList& parameterHashes, int pipelineIndex, QString& errorMessage);
+
+    /**
+     * @brief Reads a checkpoint and checks that it was written by a pipeline whose filters, up to the one
+     * the checkpoint was written after, have the given parameter hashes
+     * @param filePath
+     * @param parameterHashes The parameter hashes of every filter in the pipeline that is going to resume
+     * @param dca Set to the DataContainerArray stored in the checkpoint
+     * @param pipelineIndex Set to the index of the last filter that executed before the checkpoint was written
+     * @param errorMessage Set if the checkpoint could not be read or does not match the pipeline
+     * @return 0 on success, negative on error
+     */
+    static int ReadCheckpoint(const QString& filePath, const QStringList& parameterHashes, DataContainerArray::Pointer& dca, int& pipelineIndex, QString& errorMessage);
+
+    /**
+     * @brief Reads only the checkpoint information stored in filePath
+     * @param filePath
+     * @param json
+     * @return 0 on success, negative on error
+     */
+    static int ReadCheckpointInfo(const QString& filePath, QJsonObject& json);
+
+  protected:
+    PipelineCheckpoint();
+
+  public:
+    PipelineCheckpoint(const PipelineCheckpoint&) = delete; // Copy Constructor Not Implemented
+    PipelineCheckpoint(PipelineCheckpoint&&) = delete;      // Move Constructor Not Implemented
+    PipelineCheckpoint& operator=(const PipelineCheckpoint&) = delete; // Copy Assignment Not Implemented
+    PipelineCheckpoint& operator=(PipelineCheckpoint&&) = delete;      // Move Assignment Not Implemented
+};
@@ -0,0 +1,274 @@
+/* ============================================================================
+* Copyright (c) 2009-2015 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-07-D-5800
+*    United States Air Force Prime Contract FA8650-10-D-5210
+*    United States Prime Contract Navy N00173-07-C-2068
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+
+#include "PipelineProfile.h"
+
+#include <QtCore/QFile>
+#include <QtCore/QJsonArray>
+#include <QtCore/QJsonDocument>
+
+#include "SIMPLib/Filtering/AbstractFilter.h"
+#include "SIMPLib/Utilities/ProcessResourceUsage.h"
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+PipelineProfile::PipelineProfile() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+PipelineProfile::~PipelineProfile() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PipelineProfile::startPipeline()
+{
+  m_FilterProfiles.clear();
+  m_DataContainerProfiles.clear();
+  m_PipelineWallTime = 0.0;
+  m_PipelineCpuTime = -1.0;
+  m_PeakResidentMemory = -1;
+  m_PipelineCpuStart = ProcessResourceUsage::GetCpuTime();
+  m_PipelineTimer.start();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PipelineProfile::finishPipeline(const DataContainerArray::Pointer& dca)
+{
+  m_PipelineWallTime = static_cast<double>(m_PipelineTimer.nsecsElapsed()) * 1.0E-9;
+  double cpuEnd = ProcessResourceUsage::GetCpuTime();
+  if(m_PipelineCpuStart >= 0.0 && cpuEnd >= 0.0)
+  {
+    m_PipelineCpuTime = cpuEnd - m_PipelineCpuStart;
+  }
+  m_PeakResidentMemory = ProcessResourceUsage::GetPeakResidentMemory();
+
+  m_DataContainerProfiles.clear();
+  if(nullptr == dca)
+  {
+    return;
+  }
+  for(const DataContainer::Pointer& dc : dca->getDataContainers())
+  {
+    DataContainerProfile dcProfile;
+    dcProfile.name = dc->getName();
+    for(const AttributeMatrix::Pointer& am : dc->getAttributeMatrices())
+    {
+      for(const QString& arrayName : am->getAttributeArrayNames())
+      {
+        dcProfile.numberOfArrays++;
+        dcProfile.arrayBytes += GetArrayBytes(am->getAttributeArray(arrayName));
+      }
+    }
+    m_DataContainerProfiles.push_back(dcProfile);
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PipelineProfile::startFilter(const DataContainerArray::Pointer& dca)
+{
+  m_FilterExistingArrays.clear();
+  for(const IDataArray::Pointer& array : GetAllArrays(dca))
+  {
+    m_FilterExistingArrays.insert(array.get());
+  }
+  m_FilterPeakStart = ProcessResourceUsage::GetPeakResidentMemory();
+  m_FilterCpuStart = ProcessResourceUsage::GetCpuTime();
+  m_FilterTimer.start();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PipelineProfile::finishFilter(AbstractFilter* filter, const DataContainerArray::Pointer& dca)
+{
+  FilterProfile profile;
+  profile.wallTime = static_cast<double>(m_FilterTimer.nsecsElapsed()) * 1.0E-9;
+  double cpuEnd = ProcessResourceUsage::GetCpuTime();
+  if(m_FilterCpuStart >= 0.0 && cpuEnd >= 0.0)
+  {
+    profile.cpuTime = cpuEnd - m_FilterCpuStart;
+  }
+  int64_t peakEnd = ProcessResourceUsage::GetPeakResidentMemory();
+  if(m_FilterPeakStart >= 0 && peakEnd >= 0)
+  {
+    profile.peakResidentMemoryDelta = peakEnd - m_FilterPeakStart;
+  }
+
+  // Arrays that were not in the DataContainerArray before the filter executed were created by it
+  profile.allocatedArrayBytes = 0;
+  for(const IDataArray::Pointer& array : GetAllArrays(dca))
+  {
+    if(!m_FilterExistingArrays.contains(array.get()))
+    {
+      profile.allocatedArrayBytes += GetArrayBytes(array);
+    }
+  }
+  m_FilterExistingArrays.clear();
+
+  profile.pipelineIndex = filter->getPipelineIndex();
+  profile.filterClassName = filter->getNameOfClass();
+  profile.filterHumanLabel = filter->getHumanLabel();
+  profile.enabled = filter->getEnabled();
+  profile.errorCondition = filter->getErrorCondition();
+  m_FilterProfiles.push_back(profile);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PipelineProfile::addFilterProfile(const FilterProfile& profile)
+{
+  m_FilterProfiles.push_back(profile);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QVector<PipelineProfile::FilterProfile> PipelineProfile::getFilterProfiles() const
+{
+  return m_FilterProfiles;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QVector<PipelineProfile::DataContainerProfile> PipelineProfile::getDataContainerProfiles() const
+{
+  return m_DataContainerProfiles;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QJsonObject PipelineProfile::toJson() const
+{
+  QJsonObject json;
+  json["WallTime"] = m_PipelineWallTime;
+  json["CpuTime"] = m_PipelineCpuTime;
+  json["PeakResidentMemory"] = static_cast<double>(m_PeakResidentMemory);
+
+  QJsonArray filters;
+  for(const FilterProfile& profile : m_FilterProfiles)
+  {
+    QJsonObject filterJson;
+    filterJson["PipelineIndex"] = profile.pipelineIndex;
+    filterJson["FilterClassName"] = profile.filterClassName;
+    filterJson["FilterHumanLabel"] = profile.filterHumanLabel;
+    filterJson["Enabled"] = profile.enabled;
+    filterJson["ErrorCondition"] = profile.errorCondition;
+    filterJson["WallTime"] = profile.wallTime;
+    filterJson["CpuTime"] = profile.cpuTime;
+    filterJson["PeakResidentMemoryDelta"] = static_cast<double>(profile.peakResidentMemoryDelta);
+    filterJson["AllocatedArrayBytes"] = static_cast<double>(profile.allocatedArrayBytes);
+    filters.append(filterJson);
+  }
+  json["Filters"] = filters;
+
+  QJsonArray dataContainers;
+  int64_t totalBytes = 0;
+  for(const DataContainerProfile& profile : m_DataContainerProfiles)
+  {
+    QJsonObject dcJson;
+    dcJson["Name"] = profile.name;
+    dcJson["NumberOfArrays"] = profile.numberOfArrays;
+    dcJson["ArrayBytes"] = static_cast<double>(profile.arrayBytes);
+    dataContainers.append(dcJson);
+    totalBytes += profile.arrayBytes;
+  }
+  json["DataContainers"] = dataContainers;
+  json["TotalArrayBytes"] = static_cast<double>(totalBytes);
+
+  return json;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool PipelineProfile::writeJsonFile(const QString& filePath) const
+{
+  QFile outputFile(filePath);
+  if(!outputFile.open(QIODevice::WriteOnly))
+  {
+    return false;
+  }
+
+  QJsonDocument doc(toJson());
+  outputFile.write(doc.toJson());
+  outputFile.close();
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int64_t PipelineProfile::GetArrayBytes(const IDataArray::Pointer& array)
+{
+  if(nullptr == array)
+  {
+    return 0;
+  }
+  return static_cast<int64_t>(array->getNumberOfBytes());
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QVector<IDataArray::Pointer> PipelineProfile::GetAllArrays(const DataContainerArray::Pointer& dca)
+{
+  QVector<IDataArray::Pointer> arrays;
+  if(nullptr == dca)
+  {
+    return arrays;
+  }
+  for(const DataContainer::Pointer& dc : dca->getDataContainers())
+  {
+    for(const AttributeMatrix::Pointer& am : dc->getAttributeMatrices())
+    {
+      for(const QString& arrayName : am->getAttributeArrayNames())
+      {
+        arrays.push_back(am->getAttributeArray(arrayName));
+      }
+    }
+  }
+  return arrays;
+}
@@ -0,0 +1,170 @@
+/* ============================================================================
+* Copyright (c) 2009-2015 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-07-D-5800
+*    United States Air Force Prime Contract FA8650-10-D-5210
+*    United States Prime Contract Navy N00173-07-C-2068
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+
+#pragma once
+
+#include <cstdint>
+
+#include <QtCore/QElapsedTimer>
+#include <QtCore/QJsonObject>
+#include <QtCore/QSet>
+#include <QtCore/QString>
+#include <QtCore/QVector>
+
+#include "SIMPLib/DataArrays/IDataArray.h"
+#include "SIMPLib/DataContainers/DataContainerArray.h"
+#include "SIMPLib/SIMPLib.h"
+
+class AbstractFilter;
+
+/**
+ * @brief The PipelineProfile class records the time and memory used by each filter while a FilterPipeline
+ * executes, along with the memory held by each DataContainer when the pipeline finishes. Memory sizes of
+ * arrays are computed as the number of elements times the element size, so they do not include container
+ * overhead. CPU time and peak resident memory are measured for the whole process; a value of -1 means the
+ * measurement was not available, for example when filters ran concurrently.
+ */
+class SIMPLib_EXPORT PipelineProfile
+{
+  public:
+    PipelineProfile();
+    virtual ~PipelineProfile();
+
+    struct FilterProfile
+    {
+      int pipelineIndex = -1;
+      QString filterClassName;
+      QString filterHumanLabel;
+      bool enabled = true;
+      int errorCondition = 0;
+      double wallTime = 0.0;
+      double cpuTime = -1.0;
+      int64_t peakResidentMemoryDelta = -1;
+      int64_t allocatedArrayBytes = -1;
+    };
+
+    struct DataContainerProfile
+    {
+      QString name;
+      int numberOfArrays = 0;
+      int64_t arrayBytes = 0;
+    };
+
+    /**
+     * @brief Clears any previous results and starts measuring the pipeline
+     */
+    void startPipeline();
+
+    /**
+     * @brief Stops measuring the pipeline and records the memory held by each DataContainer
+     * @param dca The DataContainerArray produced by the pipeline
+     */
+    void finishPipeline(const DataContainerArray::Pointer& dca);
+
+    /**
+     * @brief Starts measuring a filter that is about to execute on its own
+     * @param dca The DataContainerArray the filter executes on
+     */
+    void startFilter(const DataContainerArray::Pointer& dca);
+
+    /**
+     * @brief Finishes the measurement started by startFilter() and appends it to the filter profiles
+     * @param filter The filter that executed
+     * @param dca The DataContainerArray the filter executed on
+     */
+    void finishFilter(AbstractFilter* filter, const DataContainerArray::Pointer& dca);
+
+    /**
+     * @brief Appends an externally measured filter profile
+     * @param profile
+     */
+    void addFilterProfile(const FilterProfile& profile);
+
+    /**
+     * @brief Returns the profiles of the filters in the order they finished executing
+     * @return
+     */
+    QVector<FilterProfile> getFilterProfiles() const;
+
+    /**
+     * @brief Returns the memory totals of each DataContainer recorded by finishPipeline()
+     * @return
+     */
+    QVector<DataContainerProfile> getDataContainerProfiles() const;
+
+    /**
+     * @brief Returns the profile as a JSON object
+     * @return
+     */
+    QJsonObject toJson() const;
+
+    /**
+     * @brief Writes the profile as a JSON document to the given file
+     * @param filePath
+     * @return True if the file was written
+     */
+    bool writeJsonFile(const QString& filePath) const;
+
+    /**
+     * @brief Returns the number of bytes used by the elements of an array
+     * @param array
+     * @return
+     */
+    static int64_t GetArrayBytes(const IDataArray::Pointer& array);
+
+  protected:
+    /**
+     * @brief Returns every attribute array held by the DataContainerArray
+     * @param dca
+     * @return
+     */
+    static QVector<IDataArray::Pointer> GetAllArrays(const DataContainerArray::Pointer& dca);
+
+  private:
+    QVector<FilterProfile> m_FilterProfiles;
+    QVector<DataContainerProfile> m_DataContainerProfiles;
+
+    QElapsedTimer m_PipelineTimer;
+    double m_PipelineWallTime = 0.0;
+    double m_PipelineCpuStart = -1.0;
+    double m_PipelineCpuTime = -1.0;
+    int64_t m_PeakResidentMemory = -1;
+
+    QElapsedTimer m_FilterTimer;
+    double m_FilterCpuStart = -1.0;
+    int64_t m_FilterPeakStart = -1;
+    QSet<IDataArray*> m_FilterExistingArrays;
+};
@@ -37,13 +37,31 @@
 #include <QtCore/QDir>
 #include <QtCore/QFile>
 #include <QtCore/QFileInfo>
+#include <QtCore/QJsonArray>
+#include <QtCore/QMutex>
 #include <QtCore/QPluginLoader>
+#include <QtCore/QWaitCondition>
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+#include <tbb/task_arena.h>
+#endif
 
 //#include "Applications/DREAM3D/DREAM3DApplication.h"
 
+#include "H5Support/H5ScopedSentinel.h"
+#include "H5Support/QH5Lite.h"
+#include "H5Support/QH5Utilities.h"
+
 #include "SIMPLib/Common/Observer.h"
+#include "SIMPLib/CoreFilters/ArrayCalculator.h"
+#include "SIMPLib/CoreFilters/CreateAttributeMatrix.h"
+#include "SIMPLib/CoreFilters/CreateDataArray.h"
+#include "SIMPLib/CoreFilters/CreateDataContainer.h"
+#include "SIMPLib/CoreFilters/DataContainerWriter.h"
+#include "SIMPLib/FilterParameters/DynamicTableData.h"
 #include "SIMPLib/Filtering/FilterManager.h"
 #include "SIMPLib/Filtering/FilterPipeline.h"
+#include "SIMPLib/Filtering/PipelineCheckpoint.h"
 #include "SIMPLib/Plugin/ISIMPLibPlugin.h"
 #include "SIMPLib/SIMPLib.h"
 
@@ -58,6 +76,84 @@
 #include "SIMPLib/Testing/SIMPLTestFileLocations.h"
 #include "SIMPLib/Testing/UnitTestSupport.hpp"
 
+/**
+ * @brief Filter that waits for the other probes of a test to execute at the same time. Each probe records
+ * whether all of them were executing together before its timeout expired.
+ */
+class ConcurrencyProbe : public AbstractFilter
+{
+public:
+  SIMPL_SHARED_POINTERS(ConcurrencyProbe)
+  SIMPL_TYPE_MACRO_SUPER_OVERRIDE(ConcurrencyProbe, AbstractFilter)
+
+  struct Barrier
+  {
+    QMutex mutex;
+    QWaitCondition condition;
+    int numProbes = 0;
+    int numArrived = 0;
+    int numOverlapped = 0;
+  };
+
+  static Pointer New(Barrier* barrier, const QString& outputFile, unsigned long timeout)
+  {
+    Pointer sharedPtr(new ConcurrencyProbe(barrier, outputFile, timeout));
+    return sharedPtr;
+  }
+
+  ~ConcurrencyProbe() override = default;
+
+  void preflight() override
+  {
+    setErrorCondition(0);
+  }
+
+  void execute() override
+  {
+    setErrorCondition(0);
+    QMutexLocker locker(&m_Barrier->mutex);
+    m_Barrier->numArrived++;
+    m_Barrier->condition.wakeAll();
+    while(m_Barrier->numArrived < m_Barrier->numProbes)
+    {
+      if(!m_Barrier->condition.wait(&m_Barrier->mutex, m_Timeout))
+      {
+        return;
+      }
+    }
+    m_Barrier->numOverlapped++;
+  }
+
+  bool getSupportsConcurrentExecution() override
+  {
+    return true;
+  }
+
+  QStringList getOutputFiles() override
+  {
+    return QStringList() << m_OutputFile;
+  }
+
+protected:
+  ConcurrencyProbe(Barrier* barrier, const QString& outputFile, unsigned long timeout)
+  : m_Barrier(barrier)
+  , m_OutputFile(outputFile)
+  , m_Timeout(timeout)
+  {
+  }
+
+private:
+  Barrier* m_Barrier;
+  QString m_OutputFile;
+  unsigned long m_Timeout;
+
+public:
+  ConcurrencyProbe(const ConcurrencyProbe&) = delete;            // Copy Constructor Not Implemented
+  ConcurrencyProbe(ConcurrencyProbe&&) = delete;                 // Move Constructor Not Implemented
+  ConcurrencyProbe& operator=(const ConcurrencyProbe&) = delete; // Copy Assignment Not Implemented
+  ConcurrencyProbe& operator=(ConcurrencyProbe&&) = delete;      // Move Assignment Not Implemented
+};
+
 class FilterPipelineTest
 {
 public:
@@ -87,6 +183,14 @@ public:
   {
     return UnitTest::TestTempDir + QString("/FilterPipelineTest.dream3d");
   }
+  QString checkpointFile()
+  {
+    return UnitTest::TestTempDir + QString("/FilterPipelineTest_Checkpoint.dream3d");
+  }
+  QString backgroundWriteFile()
+  {
+    return UnitTest::TestTempDir + QString("/FilterPipelineTest_BackgroundWrite.dream3d");
+  }
 
   // -----------------------------------------------------------------------------
   //
@@ -95,6 +199,8 @@ public:
   {
 #if REMOVE_TEST_FILES
     QFile::remove(outputDREAM3DFile());
+    QFile::remove(checkpointFile());
+    QFile::remove(backgroundWriteFile());
 #endif
   }
 
@@ -154,6 +260,293 @@ public:
 #endif
   }
 
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  FilterPipeline::Pointer CreateIndependentChainsPipeline()
+  {
+    // Two independent chains of filters, each working in its own AttributeMatrix
+    FilterPipeline::Pointer pipeline = FilterPipeline::New();
+
+    CreateDataContainer::Pointer createDataContainer = CreateDataContainer::New();
+    createDataContainer->setDataContainerName("DataContainer");
+    pipeline->pushBack(createDataContainer);
+
+    QStringList amNames = {"AttributeMatrix1", "AttributeMatrix2"};
+    QStringList initValues = {"2", "3"};
+    for(const QString& amName : amNames)
+    {
+      CreateAttributeMatrix::Pointer createAttributeMatrix = CreateAttributeMatrix::New();
+      createAttributeMatrix->setCreatedAttributeMatrix(DataArrayPath("DataContainer", amName, ""));
+      createAttributeMatrix->setAttributeMatrixType(static_cast<int>(AttributeMatrix::Type::Cell));
+      createAttributeMatrix->setTupleDimensions(DynamicTableData(std::vector<std::vector<double>>(1, std::vector<double>(1, 1000.0))));
+      pipeline->pushBack(createAttributeMatrix);
+    }
+    for(int i = 0; i < amNames.size(); i++)
+    {
+      CreateDataArray::Pointer createDataArray = CreateDataArray::New();
+      createDataArray->setScalarType(SIMPL::ScalarTypes::Type::Float);
+      createDataArray->setNumberOfComponents(1);
+      createDataArray->setNewArray(DataArrayPath("DataContainer", amNames[i], "Input"));
+      createDataArray->setInitializationType(CreateDataArray::Manual);
+      createDataArray->setInitializationValue(initValues[i]);
+      pipeline->pushBack(createDataArray);
+    }
+    for(const QString& amName : amNames)
+    {
+      ArrayCalculator::Pointer calculator = ArrayCalculator::New();
+      calculator->setSelectedAttributeMatrix(DataArrayPath("DataContainer", amName, ""));
+      calculator->setInfixEquation("Input * 5");
+      calculator->setCalculatedArray(DataArrayPath("DataContainer", amName, "Result"));
+      pipeline->pushBack(calculator);
+    }
+
+    return pipeline;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestConcurrentExecution()
+  {
+    QStringList amNames = {"AttributeMatrix1", "AttributeMatrix2"};
+    FilterPipeline::Pointer pipeline = CreateIndependentChainsPipeline();
+    pipeline->setConcurrentExecution(true);
+    DataContainerArray::Pointer dca = pipeline->execute();
+    DREAM3D_REQUIRE_EQUAL(pipeline->getErrorCondition(), 0);
+    DREAM3D_REQUIRE_VALID_POINTER(dca.get());
+
+    QVector<double> expectedValues = {10.0, 15.0};
+    for(int i = 0; i < amNames.size(); i++)
+    {
+      AttributeMatrix::Pointer am = dca->getAttributeMatrix(DataArrayPath("DataContainer", amNames[i], ""));
+      DREAM3D_REQUIRE_VALID_POINTER(am.get());
+      DoubleArrayType::Pointer result = std::dynamic_pointer_cast<DoubleArrayType>(am->getAttributeArray("Result"));
+      DREAM3D_REQUIRE_VALID_POINTER(result.get());
+      DREAM3D_REQUIRE(result->getNumberOfTuples() == 1000);
+      for(size_t t = 0; t < result->getNumberOfTuples(); t++)
+      {
+        DREAM3D_REQUIRE(result->getValue(t) == expectedValues[i]);
+      }
+    }
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+    // The filters run on the worker threads, of which TBB starts one fewer than there are cores, so overlap
+    // can only be observed with at least two of them
+    if(tbb::this_task_arena::max_concurrency() < 3)
+    {
+      return;
+    }
+
+    // Independent filters must execute at the same time
+    ConcurrencyProbe::Barrier independentBarrier;
+    independentBarrier.numProbes = 2;
+    pipeline = FilterPipeline::New();
+    pipeline->pushBack(ConcurrencyProbe::New(&independentBarrier, UnitTest::TestTempDir + "/FilterPipelineTest_Probe1.txt", 30000));
+    pipeline->pushBack(ConcurrencyProbe::New(&independentBarrier, UnitTest::TestTempDir + "/FilterPipelineTest_Probe2.txt", 30000));
+    pipeline->setConcurrentExecution(true);
+    pipeline->execute();
+    DREAM3D_REQUIRE_EQUAL(pipeline->getErrorCondition(), 0);
+    DREAM3D_REQUIRE_EQUAL(independentBarrier.numOverlapped, 2);
+
+    // Filters that write the same file, or a file inside a directory written by the other, must not
+    ConcurrencyProbe::Barrier fileBarrier;
+    fileBarrier.numProbes = 3;
+    pipeline = FilterPipeline::New();
+    pipeline->pushBack(ConcurrencyProbe::New(&fileBarrier, UnitTest::TestTempDir + "/FilterPipelineTest_Probe", 500));
+    pipeline->pushBack(ConcurrencyProbe::New(&fileBarrier, UnitTest::TestTempDir + "/FilterPipelineTest_Probe/Probe.txt", 500));
+    pipeline->pushBack(ConcurrencyProbe::New(&fileBarrier, UnitTest::TestTempDir + "/FilterPipelineTest_Probe", 500));
+    pipeline->setConcurrentExecution(true);
+    pipeline->execute();
+    DREAM3D_REQUIRE_EQUAL(pipeline->getErrorCondition(), 0);
+    DREAM3D_REQUIRE_EQUAL(fileBarrier.numArrived, 3);
+    DREAM3D_REQUIRE_EQUAL(fileBarrier.numOverlapped, 0);
+#endif
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestExecutionProfile()
+  {
+    FilterPipeline::Pointer pipeline = CreateIndependentChainsPipeline();
+    DataContainerArray::Pointer dca = pipeline->execute();
+    DREAM3D_REQUIRE_EQUAL(pipeline->getErrorCondition(), 0);
+
+    PipelineProfile profile = pipeline->getExecutionProfile();
+    QVector<PipelineProfile::FilterProfile> filterProfiles = profile.getFilterProfiles();
+    DREAM3D_REQUIRE(static_cast<size_t>(filterProfiles.size()) == pipeline->size());
+    for(const PipelineProfile::FilterProfile& filterProfile : filterProfiles)
+    {
+      DREAM3D_REQUIRE(filterProfile.wallTime >= 0.0);
+      if(filterProfile.filterClassName == "CreateDataArray")
+      {
+        DREAM3D_REQUIRE(filterProfile.allocatedArrayBytes == 1000 * static_cast<int64_t>(sizeof(float)));
+      }
+      else if(filterProfile.filterClassName == "ArrayCalculator")
+      {
+        DREAM3D_REQUIRE(filterProfile.allocatedArrayBytes == 1000 * static_cast<int64_t>(sizeof(double)));
+      }
+      else
+      {
+        DREAM3D_REQUIRE(filterProfile.allocatedArrayBytes == 0);
+      }
+    }
+
+    QVector<PipelineProfile::DataContainerProfile> dcProfiles = profile.getDataContainerProfiles();
+    DREAM3D_REQUIRE(dcProfiles.size() == 1);
+    DREAM3D_REQUIRE(dcProfiles[0].numberOfArrays == 4);
+    DREAM3D_REQUIRE(dcProfiles[0].arrayBytes == 2 * 1000 * static_cast<int64_t>(sizeof(float) + sizeof(double)));
+
+    QJsonObject json = profile.toJson();
+    DREAM3D_REQUIRE(json["Filters"].toArray().size() == filterProfiles.size());
+    DREAM3D_REQUIRE(json["DataContainers"].toArray().size() == 1);
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void CheckResults(const DataContainerArray::Pointer& dca, const QVector<double>& expectedValues)
+  {
+    QStringList amNames = {"AttributeMatrix1", "AttributeMatrix2"};
+    for(int i = 0; i < amNames.size(); i++)
+    {
+      AttributeMatrix::Pointer am = dca->getAttributeMatrix(DataArrayPath("DataContainer", amNames[i], ""));
+      DREAM3D_REQUIRE_VALID_POINTER(am.get());
+      DoubleArrayType::Pointer result = std::dynamic_pointer_cast<DoubleArrayType>(am->getAttributeArray("Result"));
+      DREAM3D_REQUIRE_VALID_POINTER(result.get());
+      DREAM3D_REQUIRE(result->getNumberOfTuples() == 1000);
+      for(size_t t = 0; t < result->getNumberOfTuples(); t++)
+      {
+        DREAM3D_REQUIRE(result->getValue(t) == expectedValues[i]);
+      }
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestCheckpointResume()
+  {
+    QFile::remove(checkpointFile());
+
+    // Write a checkpoint after both input arrays have been created
+    FilterPipeline::Pointer pipeline = CreateIndependentChainsPipeline();
+    pipeline->setCheckpointFile(checkpointFile());
+    pipeline->setCheckpointFilterIndices(QSet<int>({4}));
+    DataContainerArray::Pointer dca = pipeline->execute();
+    DREAM3D_REQUIRE_EQUAL(pipeline->getErrorCondition(), 0);
+    CheckResults(dca, {10.0, 15.0});
+    DREAM3D_REQUIRE(QFile::exists(checkpointFile()));
+
+    QJsonObject info;
+    DREAM3D_REQUIRE_EQUAL(PipelineCheckpoint::ReadCheckpointInfo(checkpointFile(), info), 0);
+    DREAM3D_REQUIRE_EQUAL(info["PipelineIndex"].toInt(), 4);
+    DREAM3D_REQUIRE_EQUAL(info["ParameterHashes"].toArray().size(), 5);
+
+    // Writing over an existing checkpoint replaces it and does not leave the temporary file behind
+    QString errorMessage;
+    QStringList parameterHashes = PipelineCheckpoint::ComputeParametersHashes(pipeline->getFilterContainer());
+    DREAM3D_REQUIRE_EQUAL(PipelineCheckpoint::WriteCheckpoint(checkpointFile(), dca, parameterHashes, 3, errorMessage), 0);
+    DREAM3D_REQUIRE_EQUAL(PipelineCheckpoint::ReadCheckpointInfo(checkpointFile(), info), 0);
+    DREAM3D_REQUIRE_EQUAL(info["PipelineIndex"].toInt(), 3);
+    DREAM3D_REQUIRE(!QFile::exists(checkpointFile() + ".tmp"));
+    DREAM3D_REQUIRE_EQUAL(PipelineCheckpoint::WriteCheckpoint(checkpointFile(), dca, parameterHashes, 4, errorMessage), 0);
+    DREAM3D_REQUIRE(!QFile::exists(checkpointFile() + ".tmp"));
+
+    // Filters after the checkpoint may change; only they run when resuming
+    pipeline = CreateIndependentChainsPipeline();
+    ArrayCalculator::Pointer calculator = std::dynamic_pointer_cast<ArrayCalculator>(pipeline->getFilterContainer()[5]);
+    DREAM3D_REQUIRE_VALID_POINTER(calculator.get());
+    calculator->setInfixEquation("Input * 7");
+    DREAM3D_REQUIRE_EQUAL(pipeline->resumeFromCheckpoint(checkpointFile(), errorMessage), 0);
+    dca = pipeline->execute();
+    DREAM3D_REQUIRE_EQUAL(pipeline->getErrorCondition(), 0);
+    CheckResults(dca, {14.0, 15.0});
+
+    // Changing a filter before the checkpoint invalidates it
+    pipeline = CreateIndependentChainsPipeline();
+    CreateDataArray::Pointer createDataArray = std::dynamic_pointer_cast<CreateDataArray>(pipeline->getFilterContainer()[3]);
+    DREAM3D_REQUIRE_VALID_POINTER(createDataArray.get());
+    createDataArray->setInitializationValue("4");
+    DREAM3D_REQUIRE(pipeline->resumeFromCheckpoint(checkpointFile(), errorMessage) < 0);
+    DREAM3D_REQUIRE(!errorMessage.isEmpty());
+
+    // A pipeline that is too short for the checkpoint is rejected as well
+    pipeline = CreateIndependentChainsPipeline();
+    pipeline->popBack();
+    pipeline->popBack();
+    pipeline->popBack();
+    DREAM3D_REQUIRE(pipeline->resumeFromCheckpoint(checkpointFile(), errorMessage) < 0);
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestInputDataContainerArray()
+  {
+    // Create the inputs once and run only the calculations on them, twice
+    FilterPipeline::Pointer inputPipeline = CreateIndependentChainsPipeline();
+    inputPipeline->popBack();
+    inputPipeline->popBack();
+    DataContainerArray::Pointer inputDca = inputPipeline->execute();
+    DREAM3D_REQUIRE_EQUAL(inputPipeline->getErrorCondition(), 0);
+
+    for(int run = 0; run < 2; run++)
+    {
+      FilterPipeline::Pointer pipeline = CreateIndependentChainsPipeline();
+      for(int i = 0; i < 5; i++)
+      {
+        pipeline->popFront();
+      }
+      pipeline->setInputDataContainerArray(inputDca);
+      DREAM3D_REQUIRE(pipeline->preflightPipeline() >= 0);
+      DataContainerArray::Pointer dca = pipeline->execute();
+      DREAM3D_REQUIRE_EQUAL(pipeline->getErrorCondition(), 0);
+      CheckResults(dca, {10.0, 15.0});
+    }
+
+    // The pipelines worked on copies of the input
+    AttributeMatrix::Pointer am = inputDca->getAttributeMatrix(DataArrayPath("DataContainer", "AttributeMatrix1", ""));
+    DREAM3D_REQUIRE_VALID_POINTER(am.get());
+    DREAM3D_REQUIRE(nullptr == am->getAttributeArray("Result").get());
+    FloatArrayType::Pointer input = std::dynamic_pointer_cast<FloatArrayType>(am->getAttributeArray("Input"));
+    DREAM3D_REQUIRE_VALID_POINTER(input.get());
+    DREAM3D_REQUIRE(input->getValue(0) == 2.0f);
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestBackgroundWrite()
+  {
+    QFile::remove(backgroundWriteFile());
+
+    // The writer runs before the results are calculated, so the file only holds the inputs
+    for(bool concurrent : {false, true})
+    {
+      FilterPipeline::Pointer pipeline = CreateIndependentChainsPipeline();
+      DataContainerWriter::Pointer writer = DataContainerWriter::New();
+      writer->setOutputFile(backgroundWriteFile());
+      writer->setWriteXdmfFile(false);
+      writer->setWriteInBackground(true);
+      pipeline->insert(5, writer);
+      pipeline->setConcurrentExecution(concurrent);
+      DataContainerArray::Pointer dca = pipeline->execute();
+      DREAM3D_REQUIRE_EQUAL(pipeline->getErrorCondition(), 0);
+      CheckResults(dca, {10.0, 15.0});
+
+      hid_t fileId = QH5Utilities::openFile(backgroundWriteFile(), true);
+      DREAM3D_REQUIRE(fileId > 0);
+      H5ScopedFileSentinel sentinel(&fileId, true);
+      std::vector<float> values;
+      DREAM3D_REQUIRE(QH5Lite::readVectorDataset(fileId, "/DataContainers/DataContainer/AttributeMatrix1/Input", values) >= 0);
+      DREAM3D_REQUIRE(values.size() == 1000);
+      DREAM3D_REQUIRE(values[0] == 2.0f && values[999] == 2.0f);
+      DREAM3D_REQUIRE(!QH5Lite::datasetExists(fileId, "/DataContainers/DataContainer/AttributeMatrix1/Result"));
+    }
+  }
+
   // -----------------------------------------------------------------------------
   //
   // -----------------------------------------------------------------------------
@@ -168,6 +561,11 @@ public:
 #endif
 
     DREAM3D_REGISTER_TEST(TestPipelinePushPop());
+    DREAM3D_REGISTER_TEST(TestConcurrentExecution());
+    DREAM3D_REGISTER_TEST(TestExecutionProfile());
+    DREAM3D_REGISTER_TEST(TestCheckpointResume());
+    DREAM3D_REGISTER_TEST(TestInputDataContainerArray());
+    DREAM3D_REGISTER_TEST(TestBackgroundWrite());
 
 #if REMOVE_TEST_FILES
 //  DREAM3D_REGISTER_TEST( RemoveTestFiles() );
@@ -33,8 +33,13 @@
 
 #include <math.h>
 
+#include <algorithm>
+#include <array>
+#include <atomic>
 #include <map>
+#include <memory>
 #include <set>
+#include <vector>
 
 #include <QtCore/QString>
 
@@ -48,6 +53,13 @@
 #include "SIMPLib/Math/GeometryMath.h"
 #include "SIMPLib/Math/MatrixMath.h"
 
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#include <tbb/parallel_sort.h>
+#include <tbb/partitioner.h>
+#endif
+
 /**
 * @brief This file contains a namespace with classes for manipulating IGeometry objects
 */
@@ -170,6 +182,7 @@ public:
    * @param parentId
    * @param numElems
    * @param preflight
+   * @param err -2 if the dataset does not exist, -3 if it is too small for numElems lists
    * @return
    */
   template <typename T, typename K>
@@ -201,7 +214,12 @@ public:
       {
         return dynamicList = DynamicListArray<T, K>::NullPointer();
       }
-      dynamicList->deserializeLinks(buffer, numElems);
+      if(!dynamicList->deserializeLinks(buffer, numElems))
+      {
+        // The dataset holds fewer lists than the geometry has elements
+        err = -3;
+        return dynamicList = DynamicListArray<T, K>::NullPointer();
+      }
     }
 
     return dynamicList;
@@ -222,36 +240,249 @@ public:
     {
       return err;
     }
-    int32_t rank = 0;
-    hsize_t dims[2] = {0, 2ULL};
-    size_t total = 0;
-    for(size_t v = 0; v < numElems; ++v)
+    if(dynamicList->size() < numElems)
     {
-      total += dynamicList->getNumberOfElements(v);
+      return -1;
     }
 
-    size_t totalBytes = numElems * sizeof(T) + total * sizeof(K);
+    // The file keeps the interleaved count/values layout, which the list can produce straight from its offsets
+    std::vector<uint8_t> buffer;
+    dynamicList->serializeLinks(buffer);
+    uint8_t* bufPtr = buffer.data();
+
+    int32_t rank = 1;
+    hsize_t dims[1] = {static_cast<hsize_t>(buffer.size())};
 
-    // Allocate a flat array to copy the data into
-    QVector<uint8_t> buffer(totalBytes, 0);
-    uint8_t* bufPtr = &(buffer.front());
-    size_t offset = 0;
+    err = QH5Lite::writePointerDataset(parentId, name, rank, dims, bufPtr);
+    return err;
+  }
+};
 
-    for(size_t v = 0; v < numElems; ++v)
+/**
+ * @brief The ElementKeys class extracts the edges or faces of a list of elements. Each edge or face is
+ * stored as a key holding its vertex ids in ascending order. All keys are gathered into one flat vector,
+ * which is sorted and then reduced to the unique (or unshared) keys. The sort is lexicographic, so the
+ * output order is the same for any number of threads.
+ */
+class ElementKeys
+{
+public:
+  ElementKeys() = delete;
+
+  // Local vertex indices of each edge/face, following the vertex ordering of each element type
+  static const size_t* TetEdges()
+  {
+    static const size_t table[6 * 2] = {0, 1, 0, 2, 1, 2, 0, 3, 1, 3, 2, 3};
+    return table;
+  }
+  static const size_t* HexEdges()
+  {
+    static const size_t table[12 * 2] = {0, 1, 1, 2, 2, 3, 3, 0, 0, 4, 1, 5, 2, 6, 3, 7, 4, 5, 5, 6, 6, 7, 7, 4};
+    return table;
+  }
+  static const size_t* TetFaces()
+  {
+    static const size_t table[4 * 3] = {0, 1, 2, 1, 2, 3, 0, 2, 3, 0, 1, 3};
+    return table;
+  }
+  static const size_t* HexFaces()
+  {
+    static const size_t table[6 * 4] = {0, 1, 5, 4, 1, 2, 6, 5, 2, 3, 7, 6, 3, 0, 4, 7, 0, 1, 2, 3, 4, 5, 6, 7};
+    return table;
+  }
+
+  /**
+   * @brief PolygonEdges Returns the local edge table of a closed polygon with the given number of vertices
+   * @param numVertsPerElem
+   * @return
+   */
+  static std::vector<size_t> PolygonEdges(size_t numVertsPerElem)
+  {
+    std::vector<size_t> localEdges(2 * numVertsPerElem);
+    for(size_t j = 0; j < numVertsPerElem; j++)
+    {
+      localEdges[2 * j] = j;
+      localEdges[2 * j + 1] = (j + 1) % numVertsPerElem;
+    }
+    return localEdges;
+  }
+
+  /**
+   * @brief FindEdges Writes the unique (or unshared) edges of elemList into edgeList. If every vertex id
+   * fits in 32 bits, each edge is packed into a single 64 bit key. This halves the memory that must be sorted.
+   * @param elemList
+   * @param localEdges Flattened table of keysPerElem local vertex index pairs
+   * @param keysPerElem
+   * @param unsharedOnly Keep only the edges that belong to exactly one element
+   * @param edgeList
+   */
+  template <typename T>
+  static void FindEdges(typename DataArray<T>::Pointer elemList, const size_t* localEdges, size_t keysPerElem, bool unsharedOnly, typename DataArray<T>::Pointer edgeList)
+  {
+    if(!CanPackEdges<T>(elemList))
     {
-      T nelems = dynamicList->getNumberOfElements(v);
-      K* elems = dynamicList->getElementListPointer(v);
-      ::memcpy(bufPtr + offset, &nelems, sizeof(T));
-      offset += sizeof(T);
-      ::memcpy(bufPtr + offset, elems, nelems * sizeof(K));
-      offset += nelems * sizeof(K);
+      FindKeys<T, 2>(elemList, localEdges, keysPerElem, unsharedOnly, edgeList);
+      return;
     }
 
-    rank = 1;
-    dims[0] = totalBytes;
+    std::vector<uint64_t> keys = GatherKeys<uint64_t, T>(elemList, keysPerElem, [localEdges, keysPerElem](const T* verts, uint64_t* elemKeys) {
+      for(size_t k = 0; k < keysPerElem; k++)
+      {
+        uint64_t v0 = static_cast<uint64_t>(verts[localEdges[2 * k]]);
+        uint64_t v1 = static_cast<uint64_t>(verts[localEdges[2 * k + 1]]);
+        elemKeys[k] = (v0 < v1) ? ((v0 << 32) | v1) : ((v1 << 32) | v0);
+      }
+    });
+    SortKeys(keys);
+    ReduceKeys(keys, unsharedOnly);
 
-    err = QH5Lite::writePointerDataset(parentId, name, rank, dims, bufPtr);
-    return err;
+    edgeList->resize(keys.size());
+    T* uEdges = edgeList->getPointer(0);
+    for(size_t i = 0; i < keys.size(); i++)
+    {
+      uEdges[2 * i] = static_cast<T>(keys[i] >> 32);
+      uEdges[2 * i + 1] = static_cast<T>(keys[i] & 0xFFFFFFFFULL);
+    }
+  }
+
+  /**
+   * @brief FindKeys Writes the unique (or unshared) N vertex keys of elemList into keyList
+   * @param elemList
+   * @param localKeys Flattened table of keysPerElem local vertex index N-tuples
+   * @param keysPerElem
+   * @param unsharedOnly Keep only the keys that belong to exactly one element
+   * @param keyList
+   */
+  template <typename T, size_t N>
+  static void FindKeys(typename DataArray<T>::Pointer elemList, const size_t* localKeys, size_t keysPerElem, bool unsharedOnly, typename DataArray<T>::Pointer keyList)
+  {
+    using KeyType = std::array<T, N>;
+    std::vector<KeyType> keys = GatherKeys<KeyType, T>(elemList, keysPerElem, [localKeys, keysPerElem](const T* verts, KeyType* elemKeys) {
+      for(size_t k = 0; k < keysPerElem; k++)
+      {
+        KeyType& key = elemKeys[k];
+        for(size_t n = 0; n < N; n++)
+        {
+          key[n] = verts[localKeys[N * k + n]];
+        }
+        // Insertion sort; N is at most 4
+        for(size_t n = 1; n < N; n++)
+        {
+          T v = key[n];
+          size_t m = n;
+          for(; m > 0 && key[m - 1] > v; m--)
+          {
+            key[m] = key[m - 1];
+          }
+          key[m] = v;
+        }
+      }
+    });
+    SortKeys(keys);
+    ReduceKeys(keys, unsharedOnly);
+
+    keyList->resize(keys.size());
+    T* uKeys = keyList->getPointer(0);
+    for(size_t i = 0; i < keys.size(); i++)
+    {
+      std::copy(keys[i].begin(), keys[i].end(), uKeys + N * i);
+    }
+  }
+
+protected:
+  /**
+   * @brief CanPackEdges Returns true if every vertex id referenced by elemList lies in [0, 2^32)
+   * @param elemList
+   * @return
+   */
+  template <typename T> static bool CanPackEdges(typename DataArray<T>::Pointer elemList)
+  {
+    const T* verts = elemList->getConstPointer(0);
+    size_t count = elemList->getSize();
+    for(size_t i = 0; i < count; i++)
+    {
+      if(static_cast<uint64_t>(verts[i]) > 0xFFFFFFFFULL)
+      {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  /**
+   * @brief GatherKeys Calls generator once per element to fill that element's keysPerElem keys. Each element
+   * writes to its own slots, so elements are processed in parallel when TBB is available.
+   * @param elemList
+   * @param keysPerElem
+   * @param generator
+   * @return
+   */
+  template <typename K, typename T, typename Generator> static std::vector<K> GatherKeys(typename DataArray<T>::Pointer elemList, size_t keysPerElem, Generator generator)
+  {
+    size_t numElems = elemList->getNumberOfTuples();
+    size_t numVertsPerElem = elemList->getNumberOfComponents();
+    const T* elems = elemList->getConstPointer(0);
+    std::vector<K> keys(numElems * keysPerElem);
+    K* keyPtr = keys.data();
+
+    auto gather = [=](size_t start, size_t end) {
+      for(size_t i = start; i < end; i++)
+      {
+        generator(elems + i * numVertsPerElem, keyPtr + i * keysPerElem);
+      }
+    };
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, numElems), [&gather](const tbb::blocked_range<size_t>& r) { gather(r.begin(), r.end()); }, tbb::auto_partitioner());
+#else
+    gather(0, numElems);
+#endif
+    return keys;
+  }
+
+  /**
+   * @brief SortKeys
+   * @param keys
+   */
+  template <typename K> static void SortKeys(std::vector<K>& keys)
+  {
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+    tbb::parallel_sort(keys.begin(), keys.end());
+#else
+    std::sort(keys.begin(), keys.end());
+#endif
+  }
+
+  /**
+   * @brief ReduceKeys Collapses a sorted key vector to its unique keys, or to the keys that occur exactly once
+   * @param keys
+   * @param unsharedOnly
+   */
+  template <typename K> static void ReduceKeys(std::vector<K>& keys, bool unsharedOnly)
+  {
+    if(!unsharedOnly)
+    {
+      keys.erase(std::unique(keys.begin(), keys.end()), keys.end());
+      return;
+    }
+
+    size_t numKeys = keys.size();
+    size_t count = 0;
+    size_t i = 0;
+    while(i < numKeys)
+    {
+      size_t j = i + 1;
+      while(j < numKeys && keys[j] == keys[i])
+      {
+        j++;
+      }
+      if(j - i == 1)
+      {
+        keys[count++] = keys[i];
+      }
+      i = j;
+    }
+    keys.resize(count);
   }
 };
 
@@ -274,39 +505,74 @@ public:
   {
     size_t numElems = elemList->getNumberOfTuples();
     size_t numVertsPerElem = elemList->getNumberOfComponents();
+    const K* elems = elemList->getConstPointer(0);
 
-    // Allocate the basic structures
-    QVector<T> linkCount(numVerts, 0);
-    size_t elemId = 0;
-
-    // Fill out lists with number of references to cells
-    typename DataArray<K>::Pointer linkLocPtr = DataArray<K>::CreateArray(numVerts, "_INTERNAL_USE_ONLY_Vertices");
-    linkLocPtr->initializeWithValue(0);
-    K* linkLoc = linkLocPtr->getPointer(0);
-    K* verts = nullptr;
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+    // Pass 1: count the uses of each vertex
+    std::unique_ptr<std::atomic<size_t>[]> cursor(new std::atomic<size_t>[numVerts]);
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, numVerts), [&cursor](const tbb::blocked_range<size_t>& r) {
+      for(size_t v = r.begin(); v < r.end(); v++)
+      {
+        cursor[v].store(0, std::memory_order_relaxed);
+      }
+    });
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, numElems * numVertsPerElem), [&cursor, elems](const tbb::blocked_range<size_t>& r) {
+      for(size_t i = r.begin(); i < r.end(); i++)
+      {
+        cursor[elems[i]].fetch_add(1, std::memory_order_relaxed);
+      }
+    });
 
-    // vtkPolyData *pdata = static_cast<vtkPolyData *>(data);
-    // Traverse data to determine number of uses of each point
-    for(elemId = 0; elemId < numElems; elemId++)
+    // The lists are carved out of one contiguous buffer using the running sum of the counts
+    std::vector<T> linkCount(numVerts, 0);
+    for(size_t v = 0; v < numVerts; v++)
     {
-      verts = elemList->getTuplePointer(elemId);
-      for(size_t j = 0; j < numVertsPerElem; j++)
+      linkCount[v] = static_cast<T>(cursor[v].load(std::memory_order_relaxed));
+      cursor[v].store(0, std::memory_order_relaxed);
+    }
+    dynamicList->allocateLists(linkCount);
+
+    // Pass 2: scatter the element ids. Threads race for the slots of shared vertices, so each
+    // list is sorted afterwards to restore the ascending order of the serial build.
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, numElems), [&cursor, &dynamicList, elems, numVertsPerElem](const tbb::blocked_range<size_t>& r) {
+      for(size_t elemId = r.begin(); elemId < r.end(); elemId++)
       {
-        linkCount[verts[j]]++;
+        const K* verts = elems + elemId * numVertsPerElem;
+        for(size_t j = 0; j < numVertsPerElem; j++)
+        {
+          size_t pos = cursor[verts[j]].fetch_add(1, std::memory_order_relaxed);
+          dynamicList->insertCellReference(verts[j], pos, elemId);
+        }
+      }
+    });
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, numVerts), [&dynamicList](const tbb::blocked_range<size_t>& r) {
+      for(size_t v = r.begin(); v < r.end(); v++)
+      {
+        K* cells = dynamicList->getElementListPointer(v);
+        std::sort(cells, cells + dynamicList->getNumberOfElements(v));
       }
+    });
+#else
+    // Traverse data to determine number of uses of each point
+    std::vector<T> linkCount(numVerts, 0);
+    for(size_t i = 0; i < numElems * numVertsPerElem; i++)
+    {
+      linkCount[elems[i]]++;
     }
 
     // Now allocate storage for the links
     dynamicList->allocateLists(linkCount);
 
-    for(elemId = 0; elemId < numElems; elemId++)
+    std::vector<T> linkLoc(numVerts, 0);
+    for(size_t elemId = 0; elemId < numElems; elemId++)
     {
-      verts = elemList->getTuplePointer(elemId);
+      const K* verts = elems + elemId * numVertsPerElem;
       for(size_t j = 0; j < numVertsPerElem; j++)
       {
         dynamicList->insertCellReference(verts[j], (linkLoc[verts[j]])++, elemId);
       }
     }
+#endif
   }
 
   /**
@@ -324,7 +590,7 @@ public:
     size_t numElems = elemList->getNumberOfTuples();
     size_t numVertsPerElem = elemList->getNumberOfComponents();
     size_t numSharedVerts = 0;
-    QVector<T> linkCount(numElems, 0);
+    std::vector<T> linkCount(numElems, 0);
     int err = 0;
 
     switch(geometryType)
@@ -364,78 +630,76 @@ public:
       return -1;
     }
 
-    dynamicList->allocateLists(linkCount);
-
-    // Allocate an array of bools that we use each iteration so that we don't put duplicates into the array
-    typename DataArray<bool>::Pointer visitedPtr = DataArray<bool>::CreateArray(numElems, "_INTERNAL_USE_ONLY_Visited");
-    visitedPtr->initializeWithValue(false);
-    bool* visited = visitedPtr->getPointer(0);
+    const K* elems = elemList->getConstPointer(0);
 
-    // Reuse this vector for each loop. Avoids re-allocating the memory each time through the loop
-    QVector<K> loop_neighbors(32, 0);
+    // The elements are processed in fixed chunks. Each chunk gathers the neighbor lists of its
+    // elements back to back, so the result does not depend on how the chunks are scheduled.
+    const size_t chunkSize = 4096;
+    size_t numChunks = (numElems + chunkSize - 1) / chunkSize;
+    std::vector<std::vector<K>> chunkNeighbors(numChunks);
 
-    // Build up the element adjacency list now that we have the element links
-    for(size_t t = 0; t < numElems; ++t)
-    {
-      //   qDebug() << "Analyzing Cell " << t << "\n";
-      K* seedElem = elemList->getTuplePointer(t);
-      for(size_t v = 0; v < numVertsPerElem; ++v)
+    auto findNeighbors = [&](size_t chunkStart, size_t chunkEnd) {
+      // Per call scratch space: the sorted vertices of the current element
+      std::vector<K> sortedSeed(numVertsPerElem);
+      for(size_t chunk = chunkStart; chunk < chunkEnd; chunk++)
       {
-        //   qDebug() << " vert " << v << "\n";
-        T nEs = elemsContainingVert->getNumberOfElements(seedElem[v]);
-        K* vertIdxs = elemsContainingVert->getElementListPointer(seedElem[v]);
-
-        for(T vt = 0; vt < nEs; ++vt)
+        std::vector<K>& neighbors = chunkNeighbors[chunk];
+        size_t end = std::min(numElems, (chunk + 1) * chunkSize);
+        for(size_t t = chunk * chunkSize; t < end; ++t)
         {
-          if(vertIdxs[vt] == static_cast<K>(t))
-          {
-            continue;
-          } // This is the same element as our "source"
-          if(visited[vertIdxs[vt]] == true)
-          {
-            continue;
-          } // We already added this element so loop again
-          //      qDebug() << "   Comparing Element " << vertIdxs[vt] << "\n";
-          K* vertCell = elemList->getTuplePointer(vertIdxs[vt]);
-          size_t vCount = 0;
-          // Loop over all the vertex indices of this element and try to match numSharedVerts of them to the current loop element
-          // If there is numSharedVerts match then that element is a neighbor of the source. If there are more than numVertsPerElem
-          // matches then there is a real problem with the mesh and the program is going to return an error.
-          for(size_t i = 0; i < numVertsPerElem; i++)
+          const K* seedElem = elems + t * numVertsPerElem;
+          std::copy(seedElem, seedElem + numVertsPerElem, sortedSeed.begin());
+          std::sort(sortedSeed.begin(), sortedSeed.end());
+          size_t firstNeighbor = neighbors.size();
+
+          for(size_t v = 0; v < numVertsPerElem; ++v)
           {
-            for(size_t j = 0; j < numVertsPerElem; j++)
+            T nEs = elemsContainingVert->getNumberOfElements(seedElem[v]);
+            K* vertIdxs = elemsContainingVert->getElementListPointer(seedElem[v]);
+
+            for(T vt = 0; vt < nEs; ++vt)
             {
-              if(seedElem[i] == vertCell[j])
+              K candidate = vertIdxs[vt];
+              // Skip the source element and any element that was already added. The lists hold only a handful
+              // of neighbors, so a linear search is cheaper than a shared visited array.
+              if(candidate == static_cast<K>(t) || std::find(neighbors.begin() + firstNeighbor, neighbors.end(), candidate) != neighbors.end())
               {
-                vCount++;
+                continue;
               }
-            }
-          }
 
-          // So if our vertex match count is numSharedVerts and we have not visited the element in question then add this element index
-          // into the list of vertex indices as neighbors for the source element.
-          if(vCount == numSharedVerts)
-          {
-            // qDebug() << "       Neighbor: " << vertIdxs[vt] << "\n";
-            // Use the current count of neighbors as the index
-            // into the loop_neighbors vector and place the value of the vertex element at that index
-            loop_neighbors[linkCount[t]] = vertIdxs[vt];
-            linkCount[t]++; // Increment the count for the next time through
-            if(linkCount[t] >= loop_neighbors.size())
-            {
-              loop_neighbors.resize(loop_neighbors.size() + 10);
+              // Count the vertex matches between the two elements by looking up each candidate
+              // vertex in the sorted source vertices. If there are exactly numSharedVerts matches,
+              // the candidate is a neighbor of the source.
+              const K* vertCell = elems + static_cast<size_t>(candidate) * numVertsPerElem;
+              size_t vCount = 0;
+              for(size_t j = 0; j < numVertsPerElem; j++)
+              {
+                auto range = std::equal_range(sortedSeed.begin(), sortedSeed.end(), vertCell[j]);
+                vCount += static_cast<size_t>(range.second - range.first);
+              }
+              if(vCount == numSharedVerts)
+              {
+                neighbors.push_back(candidate);
+              }
             }
-            visited[vertIdxs[vt]] = true; // Set this element as visited so we do NOT add it again
           }
+          linkCount[t] = static_cast<T>(neighbors.size() - firstNeighbor);
         }
       }
-      // Reset all the visited cell indexs back to false (zero)
-      for(int64_t k = 0; k < linkCount[t]; ++k)
-      {
-        visited[loop_neighbors[k]] = false;
-      }
-      // Allocate the array storage for the current edge to hold its vertex list
-      dynamicList->setElementList(t, linkCount[t], &(loop_neighbors[0]));
+    };
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, numChunks), [&findNeighbors](const tbb::blocked_range<size_t>& r) { findNeighbors(r.begin(), r.end()); }, tbb::auto_partitioner());
+#else
+    findNeighbors(0, numChunks);
+#endif
+
+    dynamicList->allocateLists(linkCount);
+    K* values = dynamicList->getValuesPointer();
+    const size_t* offsets = dynamicList->getOffsetsPointer();
+    for(size_t chunk = 0; chunk < numChunks; chunk++)
+    {
+      std::copy(chunkNeighbors[chunk].begin(), chunkNeighbors[chunk].end(), values + offsets[chunk * chunkSize]);
     }
 
     return err;
@@ -448,62 +712,8 @@ public:
    */
   template <typename T> static void Find2DElementEdges(typename DataArray<T>::Pointer elemList, typename DataArray<T>::Pointer edgeList)
   {
-    size_t numElems = elemList->getNumberOfTuples();
-    size_t numVertsPerElem = elemList->getNumberOfComponents();
-    T v0 = 0;
-    T v1 = 0;
-
-    std::pair<T, T> edge;
-    std::set<std::pair<T, T>> edgeSet;
-
-    for(size_t i = 0; i < numElems; i++)
-    {
-      T* verts = elemList->getTuplePointer(i);
-
-      for(size_t j = 0; j < numVertsPerElem; j++)
-      {
-        if(j == (numVertsPerElem - 1))
-        {
-          if(verts[j] > verts[0])
-          {
-            v0 = verts[0];
-            v1 = verts[j];
-          }
-          else
-          {
-            v0 = verts[j];
-            v1 = verts[0];
-          }
-        }
-        else
-        {
-          if(verts[j] > verts[j + 1])
-          {
-            v0 = verts[j + 1];
-            v1 = verts[j];
-          }
-          else
-          {
-            v0 = verts[j];
-            v1 = verts[j + 1];
-          }
-        }
-        edge = std::make_pair(v0, v1);
-        edgeSet.insert(edge);
-      }
-    }
-
-    typename std::set<std::pair<T, T>>::iterator setIter;
-    edgeList->resize(edgeSet.size());
-    T* uEdges = edgeList->getPointer(0);
-    T index = 0;
-
-    for(setIter = edgeSet.begin(); setIter != edgeSet.end(); ++setIter)
-    {
-      uEdges[2 * index] = (*setIter).first;
-      uEdges[2 * index + 1] = (*setIter).second;
-      ++index;
-    }
+    std::vector<size_t> localEdges = ElementKeys::PolygonEdges(elemList->getNumberOfComponents());
+    ElementKeys::FindEdges<T>(elemList, localEdges.data(), localEdges.size() / 2, false, edgeList);
   }
 
   /**
@@ -513,42 +723,7 @@ public:
    */
   template <typename T> static void FindTetEdges(typename DataArray<T>::Pointer tetList, typename DataArray<T>::Pointer edgeList)
   {
-    size_t numElems = tetList->getNumberOfTuples();
-
-    std::pair<T, T> edge;
-    std::set<std::pair<T, T>> edgeSet;
-
-    for(size_t i = 0; i < numElems; i++)
-    {
-      T* verts = tetList->getTuplePointer(i);
-
-      std::vector<T> edge0 = {verts[0], verts[1]};
-      std::vector<T> edge1 = {verts[0], verts[2]};
-      std::vector<T> edge2 = {verts[1], verts[2]};
-      std::vector<T> edge3 = {verts[0], verts[3]};
-      std::vector<T> edge4 = {verts[1], verts[3]};
-      std::vector<T> edge5 = {verts[2], verts[3]};
-      std::list<std::vector<T>> edgeList = {edge0, edge1, edge2, edge3, edge4, edge5};
-
-      for(auto&& uEdge : edgeList)
-      {
-        std::sort(uEdge.begin(), uEdge.end());
-        edge = std::make_pair(uEdge[0], uEdge[1]);
-        edgeSet.insert(edge);
-      }
-    }
-
-    typename std::set<std::pair<T, T>>::iterator setIter;
-    edgeList->resize(edgeSet.size());
-    T* uEdges = edgeList->getPointer(0);
-    T index = 0;
-
-    for(setIter = edgeSet.begin(); setIter != edgeSet.end(); ++setIter)
-    {
-      uEdges[2 * index] = (*setIter).first;
-      uEdges[2 * index + 1] = (*setIter).second;
-      ++index;
-    }
+    ElementKeys::FindEdges<T>(tetList, ElementKeys::TetEdges(), 6, false, edgeList);
   }
 
   /**
@@ -558,52 +733,7 @@ public:
   */
   template <typename T> static void FindHexEdges(typename DataArray<T>::Pointer hexList, typename DataArray<T>::Pointer edgeList)
   {
-    size_t numElems = hexList->getNumberOfTuples();
-
-    std::pair<T, T> edge;
-    std::set<std::pair<T, T>> edgeSet;
-
-    for(size_t i = 0; i < numElems; i++)
-    {
-      T* verts = hexList->getTuplePointer(i);
-
-      std::vector<T> edge0 = {verts[0], verts[1]};
-      std::vector<T> edge1 = {verts[1], verts[2]};
-      std::vector<T> edge2 = {verts[2], verts[3]};
-      std::vector<T> edge3 = {verts[3], verts[0]};
-
-      std::vector<T> edge4 = {verts[0], verts[4]};
-      std::vector<T> edge5 = {verts[1], verts[5]};
-      std::vector<T> edge6 = {verts[2], verts[6]};
-      std::vector<T> edge7 = {verts[3], verts[7]};
-
-      std::vector<T> edge8 =  {verts[4], verts[5]};
-      std::vector<T> edge9 =  {verts[5], verts[6]};
-      std::vector<T> edge10 = {verts[6], verts[7]};
-      std::vector<T> edge11 = {verts[7], verts[4]};
-
-      std::list<std::vector<T>> edgeList = {edge0, edge1, edge2, edge3, edge4, edge5,
-                                            edge6, edge7, edge8, edge9, edge10, edge11};
-
-      for(auto&& uEdge : edgeList)
-      {
-        std::sort(uEdge.begin(), uEdge.end());
-        edge = std::make_pair(uEdge[0], uEdge[1]);
-        edgeSet.insert(edge);
-      }
-    }
-
-    typename std::set<std::pair<T, T>>::iterator setIter;
-    edgeList->resize(edgeSet.size());
-    T* uEdges = edgeList->getPointer(0);
-    T index = 0;
-
-    for(setIter = edgeSet.begin(); setIter != edgeSet.end(); ++setIter)
-    {
-      uEdges[2 * index] = (*setIter).first;
-      uEdges[2 * index + 1] = (*setIter).second;
-      ++index;
-    }
+    ElementKeys::FindEdges<T>(hexList, ElementKeys::HexEdges(), 12, false, edgeList);
   }
 
   /**
@@ -613,41 +743,7 @@ public:
    */
   template <typename T> static void FindTetFaces(typename DataArray<T>::Pointer tetList, typename DataArray<T>::Pointer faceList)
   {
-    size_t numElems = tetList->getNumberOfTuples();
-
-    std::tuple<T, T, T> face;
-    std::set<std::tuple<T, T, T>> faceSet;
-
-    for(size_t i = 0; i < numElems; i++)
-    {
-      T* verts = tetList->getTuplePointer(i);
-
-      std::vector<T> tri0 = {verts[0], verts[1], verts[2]};
-      std::vector<T> tri1 = {verts[1], verts[2], verts[3]};
-      std::vector<T> tri2 = {verts[0], verts[2], verts[3]};
-      std::vector<T> tri3 = {verts[0], verts[1], verts[3]};
-      std::list<std::vector<T>> triList = {tri0, tri1, tri2, tri3};
-
-      for(auto&& tri : triList)
-      {
-        std::sort(tri.begin(), tri.end());
-        face = std::make_tuple(tri[0], tri[1], tri[2]);
-        faceSet.insert(face);
-      }
-    }
-
-    typename std::set<std::tuple<T, T, T>>::iterator setIter;
-    faceList->resize(faceSet.size());
-    T* uFaces = faceList->getPointer(0);
-    T index = 0;
-
-    for(setIter = faceSet.begin(); setIter != faceSet.end(); ++setIter)
-    {
-      uFaces[3 * index] = std::get<0>(*setIter);
-      uFaces[3 * index + 1] = std::get<1>(*setIter);
-      uFaces[3 * index + 2] = std::get<2>(*setIter);
-      ++index;
-    }
+    ElementKeys::FindKeys<T, 3>(tetList, ElementKeys::TetFaces(), 4, false, faceList);
   }
 
   /**
@@ -657,45 +753,7 @@ public:
   */
   template <typename T> static void FindHexFaces(typename DataArray<T>::Pointer hexList, typename DataArray<T>::Pointer faceList)
   {
-    size_t numElems = hexList->getNumberOfTuples();
-
-    std::tuple<T, T, T, T> face;
-    std::set<std::tuple<T, T, T, T>> faceSet;
-
-    for(size_t i = 0; i < numElems; i++)
-    {
-      T* verts = hexList->getTuplePointer(i);
-
-      std::vector<T> quad0 = {verts[0], verts[1], verts[5], verts[4]};
-      std::vector<T> quad1 = {verts[1], verts[2], verts[6], verts[5]};
-      std::vector<T> quad2 = {verts[2], verts[3], verts[7], verts[6]};
-      std::vector<T> quad3 = {verts[3], verts[0], verts[4], verts[7]};
-      std::vector<T> quad4 = {verts[0], verts[1], verts[2], verts[3]};
-      std::vector<T> quad5 = {verts[4], verts[5], verts[6], verts[7]};
-
-      std::list<std::vector<T>> quadList = {quad0, quad1, quad2, quad3, quad4, quad5};
-
-      for(auto&& quad : quadList)
-      {
-        std::sort(quad.begin(), quad.end());
-        face = std::make_tuple(quad[0], quad[1], quad[2], quad[3]);
-        faceSet.insert(face);
-      }
-    }
-
-    typename std::set<std::tuple<T, T, T, T>>::iterator setIter;
-    faceList->resize(faceSet.size());
-    T* uFaces = faceList->getPointer(0);
-    T index = 0;
-
-    for(setIter = faceSet.begin(); setIter != faceSet.end(); ++setIter)
-    {
-      uFaces[4 * index] = std::get<0>(*setIter);
-      uFaces[4 * index + 1] = std::get<1>(*setIter);
-      uFaces[4 * index + 2] = std::get<2>(*setIter);
-      uFaces[4 * index + 3] = std::get<3>(*setIter);
-      ++index;
-    }
+    ElementKeys::FindKeys<T, 4>(hexList, ElementKeys::HexFaces(), 6, false, faceList);
   }
 
   /**
@@ -705,75 +763,8 @@ public:
    */
   template <typename T> static void Find2DUnsharedEdges(typename DataArray<T>::Pointer elemList, typename DataArray<T>::Pointer edgeList)
   {
-    size_t numElems = elemList->getNumberOfTuples();
-    size_t numVertsPerElem = elemList->getNumberOfComponents();
-    T v0 = 0;
-    T v1 = 0;
-
-    std::pair<T, T> edge;
-    std::map<std::pair<T, T>, T> edgeMap;
-
-    for(size_t i = 0; i < numElems; i++)
-    {
-      T* verts = elemList->getTuplePointer(i);
-
-      for(size_t j = 0; j < numVertsPerElem; j++)
-      {
-        if(j == (numVertsPerElem - 1))
-        {
-          if(verts[j] > verts[0])
-          {
-            v0 = verts[0];
-            v1 = verts[j];
-          }
-          else
-          {
-            v0 = verts[j];
-            v1 = verts[0];
-          }
-        }
-        else
-        {
-          if(verts[j] > verts[j + 1])
-          {
-            v0 = verts[j + 1];
-            v1 = verts[j];
-          }
-          else
-          {
-            v0 = verts[j];
-            v1 = verts[j + 1];
-          }
-        }
-        edge = std::make_pair(v0, v1);
-        edgeMap[edge]++;
-      }
-    }
-
-    typename std::map<std::pair<T, T>, T>::iterator mapIter = edgeMap.begin();
-
-    while(mapIter != edgeMap.end())
-    {
-      if((*mapIter).second > 1)
-      {
-        edgeMap.erase(mapIter++);
-      }
-      else
-      {
-        ++mapIter;
-      }
-    }
-
-    edgeList->resize(edgeMap.size());
-    T* bEdges = edgeList->getPointer(0);
-    T index = 0;
-
-    for(mapIter = edgeMap.begin(); mapIter != edgeMap.end(); ++mapIter)
-    {
-      bEdges[2 * index] = (*mapIter).first.first;
-      bEdges[2 * index + 1] = (*mapIter).first.second;
-      ++index;
-    }
+    std::vector<size_t> localEdges = ElementKeys::PolygonEdges(elemList->getNumberOfComponents());
+    ElementKeys::FindEdges<T>(elemList, localEdges.data(), localEdges.size() / 2, true, edgeList);
   }
 
   /**
@@ -783,55 +774,7 @@ public:
   */
   template <typename T> static void FindUnsharedTetEdges(typename DataArray<T>::Pointer tetList, typename DataArray<T>::Pointer edgeList)
   {
-    size_t numElems = tetList->getNumberOfTuples();
-
-    std::pair<T, T> edge;
-    std::map<std::pair<T, T>, T> edgeMap;
-
-    for(size_t i = 0; i < numElems; i++)
-    {
-      T* verts = tetList->getTuplePointer(i);
-
-      std::vector<T> edge0 = {verts[0], verts[1]};
-      std::vector<T> edge1 = {verts[0], verts[2]};
-      std::vector<T> edge2 = {verts[1], verts[2]};
-      std::vector<T> edge3 = {verts[0], verts[3]};
-      std::vector<T> edge4 = {verts[1], verts[3]};
-      std::vector<T> edge5 = {verts[2], verts[3]};
-      std::list<std::vector<T>> edgeList = {edge0, edge1, edge2, edge3, edge4, edge5};
-
-      for(auto&& uEdge : edgeList)
-      {
-        std::sort(uEdge.begin(), uEdge.end());
-        edge = std::make_pair(uEdge[0], uEdge[1]);
-        edgeMap[edge]++;
-      }
-    }
-
-    typename std::map<std::pair<T, T>, T>::iterator mapIter = edgeMap.begin();
-
-    while(mapIter != edgeMap.end())
-    {
-      if((*mapIter).second > 1)
-      {
-        edgeMap.erase(mapIter++);
-      }
-      else
-      {
-        ++mapIter;
-      }
-    }
-
-    edgeList->resize(edgeMap.size());
-    T* bEdges = edgeList->getPointer(0);
-    T index = 0;
-
-    for(mapIter = edgeMap.begin(); mapIter != edgeMap.end(); ++mapIter)
-    {
-      bEdges[2 * index] = (*mapIter).first.first;
-      bEdges[2 * index + 1] = (*mapIter).first.second;
-      ++index;
-    }
+    ElementKeys::FindEdges<T>(tetList, ElementKeys::TetEdges(), 6, true, edgeList);
   }
 
   /**
@@ -841,65 +784,7 @@ public:
   */
   template <typename T> static void FindUnsharedHexEdges(typename DataArray<T>::Pointer hexList, typename DataArray<T>::Pointer edgeList)
   {
-    size_t numElems = hexList->getNumberOfTuples();
-
-    std::pair<T, T> edge;
-    std::map<std::pair<T, T>, T> edgeMap;
-
-    for(size_t i = 0; i < numElems; i++)
-    {
-      T* verts = hexList->getTuplePointer(i);
-
-      std::vector<T> edge0 = {verts[0], verts[1]};
-      std::vector<T> edge1 = {verts[1], verts[2]};
-      std::vector<T> edge2 = {verts[2], verts[3]};
-      std::vector<T> edge3 = {verts[3], verts[0]};
-
-      std::vector<T> edge4 = {verts[0], verts[4]};
-      std::vector<T> edge5 = {verts[1], verts[5]};
-      std::vector<T> edge6 = {verts[2], verts[6]};
-      std::vector<T> edge7 = {verts[3], verts[7]};
-
-      std::vector<T> edge8 = {verts[4], verts[5]};
-      std::vector<T> edge9 = {verts[5], verts[6]};
-      std::vector<T> edge10 = {verts[6], verts[7]};
-      std::vector<T> edge11 = {verts[7], verts[4]};
-
-      std::list<std::vector<T>> edgeList = {edge0, edge1, edge2, edge3, edge4, edge5,
-                                            edge6, edge7, edge8, edge9, edge10, edge11};
-
-      for(auto&& uEdge : edgeList)
-      {
-        std::sort(uEdge.begin(), uEdge.end());
-        edge = std::make_pair(uEdge[0], uEdge[1]);
-        edgeMap[edge]++;
-      }
-    }
-
-    typename std::map<std::pair<T, T>, T>::iterator mapIter = edgeMap.begin();
-
-    while(mapIter != edgeMap.end())
-    {
-      if((*mapIter).second > 1)
-      {
-        edgeMap.erase(mapIter++);
-      }
-      else
-      {
-        ++mapIter;
-      }
-    }
-
-    edgeList->resize(edgeMap.size());
-    T* bEdges = edgeList->getPointer(0);
-    T index = 0;
-
-    for(mapIter = edgeMap.begin(); mapIter != edgeMap.end(); ++mapIter)
-    {
-      bEdges[2 * index] = (*mapIter).first.first;
-      bEdges[2 * index + 1] = (*mapIter).first.second;
-      ++index;
-    }
+    ElementKeys::FindEdges<T>(hexList, ElementKeys::HexEdges(), 12, true, edgeList);
   }
 
   /**
@@ -909,54 +794,7 @@ public:
    */
   template <typename T> static void FindUnsharedTetFaces(typename DataArray<T>::Pointer tetList, typename DataArray<T>::Pointer faceList)
   {
-    size_t numElems = tetList->getNumberOfTuples();
-
-    std::tuple<T, T, T> face;
-    std::map<std::tuple<T, T, T>, T> faceMap;
-
-    for(size_t i = 0; i < numElems; i++)
-    {
-      T* verts = tetList->getTuplePointer(i);
-
-      std::vector<T> tri0 = {verts[0], verts[1], verts[2]};
-      std::vector<T> tri1 = {verts[1], verts[2], verts[3]};
-      std::vector<T> tri2 = {verts[0], verts[2], verts[3]};
-      std::vector<T> tri3 = {verts[0], verts[1], verts[3]};
-      std::list<std::vector<T>> triList = {tri0, tri1, tri2, tri3};
-
-      for(auto&& tri : triList)
-      {
-        std::sort(tri.begin(), tri.end());
-        face = std::make_tuple(tri[0], tri[1], tri[2]);
-        faceMap[face]++;
-      }
-    }
-
-    typename std::map<std::tuple<T, T, T>, T>::iterator mapIter = faceMap.begin();
-
-    while(mapIter != faceMap.end())
-    {
-      if((*mapIter).second > 1)
-      {
-        faceMap.erase(mapIter++);
-      }
-      else
-      {
-        ++mapIter;
-      }
-    }
-
-    faceList->resize(faceMap.size());
-    T* uFaces = faceList->getPointer(0);
-    T index = 0;
-
-    for(mapIter = faceMap.begin(); mapIter != faceMap.end(); ++mapIter)
-    {
-      uFaces[3 * index] = std::get<0>((*mapIter).first);
-      uFaces[3 * index + 1] = std::get<1>((*mapIter).first);
-      uFaces[3 * index + 2] = std::get<2>((*mapIter).first);
-      ++index;
-    }
+    ElementKeys::FindKeys<T, 3>(tetList, ElementKeys::TetFaces(), 4, true, faceList);
   }
 
   /**
@@ -966,58 +804,7 @@ public:
   */
   template <typename T> static void FindUnsharedHexFaces(typename DataArray<T>::Pointer hexList, typename DataArray<T>::Pointer faceList)
   {
-    size_t numElems = hexList->getNumberOfTuples();
-
-    std::tuple<T, T, T, T> face;
-    std::map<std::tuple<T, T, T, T>, T> faceMap;
-
-    for(size_t i = 0; i < numElems; i++)
-    {
-      T* verts = hexList->getTuplePointer(i);
-
-      std::vector<T> quad0 = {verts[0], verts[1], verts[5], verts[4]};
-      std::vector<T> quad1 = {verts[1], verts[2], verts[6], verts[5]};
-      std::vector<T> quad2 = {verts[2], verts[3], verts[7], verts[6]};
-      std::vector<T> quad3 = {verts[3], verts[0], verts[4], verts[7]};
-      std::vector<T> quad4 = {verts[0], verts[1], verts[2], verts[3]};
-      std::vector<T> quad5 = {verts[4], verts[5], verts[6], verts[7]};
-
-      std::list<std::vector<T>> quadList = {quad0, quad1, quad2, quad3, quad4, quad5};
-
-      for(auto&& quad : quadList)
-      {
-        std::sort(quad.begin(), quad.end());
-        face = std::make_tuple(quad[0], quad[1], quad[2], quad[3]);
-        faceMap[face]++;
-      }
-    }
-
-    typename std::map<std::tuple<T, T, T, T>, T>::iterator mapIter = faceMap.begin();
-
-    while(mapIter != faceMap.end())
-    {
-      if((*mapIter).second > 1)
-      {
-        faceMap.erase(mapIter++);
-      }
-      else
-      {
-        ++mapIter;
-      }
-    }
-
-    faceList->resize(faceMap.size());
-    T* uFaces = faceList->getPointer(0);
-    T index = 0;
-
-    for(mapIter = faceMap.begin(); mapIter != faceMap.end(); ++mapIter)
-    {
-      uFaces[4 * index] = std::get<0>((*mapIter).first);
-      uFaces[4 * index + 1] = std::get<1>((*mapIter).first);
-      uFaces[4 * index + 2] = std::get<2>((*mapIter).first);
-      uFaces[4 * index + 3] = std::get<3>((*mapIter).first);
-      ++index;
-    }
+    ElementKeys::FindKeys<T, 4>(hexList, ElementKeys::HexFaces(), 6, true, faceList);
   }
 };
 
@@ -1042,13 +829,13 @@ public:
     size_t numVertsPerElem = elemList->getNumberOfComponents();
     size_t numDims = 3;
     float* elementCentroids = centroids->getPointer(0);
-    float* vertex = vertices->getPointer(0);
+    const float* vertex = vertices->getConstPointer(0);
 
     for(size_t i = 0; i < numDims; i++)
     {
       for(size_t j = 0; j < numElems; j++)
       {
-        T* Elem = elemList->getTuplePointer(j);
+        const T* Elem = elemList->getConstPointer(j * numVertsPerElem);
         float vertPos = 0.0;
         for(size_t k = 0; k < numVertsPerElem; k++)
         {
@@ -1077,7 +864,7 @@ public:
     {
       return;
     }
-    float* vertex = vertices->getPointer(0);
+    const float* vertex = vertices->getConstPointer(0);
     float* elemAreas = areas->getPointer(0);
     float normal[3] = {0.0f, 0.0f, 0.0f};
     std::vector<float> coords(3 * numVertsPerElem, 0.0f);
@@ -1088,7 +875,7 @@ public:
     for(size_t i = 0; i < numElems; i++)
     {
       float area = 0.0f;
-      T* elem = elemList->getTuplePointer(i);
+      const T* elem = elemList->getConstPointer(i * numVertsPerElem);
 
       // Create a contiguous vertex coordinates list
       // This simplifies the pointer arithmetic a bit
@@ -1162,12 +949,12 @@ public:
   template <typename T> static void FindTetVolumes(typename DataArray<T>::Pointer tetList, FloatArrayType::Pointer vertices, FloatArrayType::Pointer volumes)
   {
     size_t numTets = tetList->getNumberOfTuples();
-    float* vertex = vertices->getPointer(0);
+    const float* vertex = vertices->getConstPointer(0);
     float* volumePtr = volumes->getPointer(0);
 
     for(size_t i = 0; i < numTets; i++)
     {
-      T* tet = tetList->getTuplePointer(i);
+      const T* tet = tetList->getConstPointer(i * tetList->getNumberOfComponents());
       float vert0[3] = {vertex[3 * tet[0] + 0], vertex[3 * tet[0] + 1], vertex[3 * tet[0] + 2]};
       float vert1[3] = {vertex[3 * tet[1] + 0], vertex[3 * tet[1] + 1], vertex[3 * tet[1] + 2]};
       float vert2[3] = {vertex[3 * tet[2] + 0], vertex[3 * tet[2] + 1], vertex[3 * tet[2] + 2]};
@@ -1190,14 +977,14 @@ public:
   template <typename T> static void FindHexVolumes(typename DataArray<T>::Pointer hexList, FloatArrayType::Pointer vertices, FloatArrayType::Pointer volumes)
   {
     size_t numHexas = hexList->getNumberOfTuples();
-    float* vertex = vertices->getPointer(0);
+    const float* vertex = vertices->getConstPointer(0);
     float* volumePtr = volumes->getPointer(0);
 
     for(size_t i = 0; i < numHexas; i++)
     {
       // Subdivide each hexahedron into 5 tetrahedra & sum their volumes
       std::vector<std::vector<int64_t>> subTets(5, std::vector<int64_t>(4, 0));
-      T* hex = hexList->getTuplePointer(i);
+      const T* hex = hexList->getConstPointer(i * hexList->getNumberOfComponents());
 
       // First tetrahedron from hexahedron vertices (0, 1, 3, 4);
       subTets[0][0] = hex[0];
@@ -1258,12 +1045,12 @@ public:
   template <typename T> static void FindTetJacobians(typename DataArray<T>::Pointer tetList, FloatArrayType::Pointer vertices, FloatArrayType::Pointer jacobians)
   {
 	  size_t numTets = tetList->getNumberOfTuples();
-	  float* vertex = vertices->getPointer(0);
+	  const float* vertex = vertices->getConstPointer(0);
 	  float* jacobianPtr = jacobians->getPointer(0);
 
 	  for (size_t i = 0; i < numTets; i++)
 	  {
-		  T* tet = tetList->getTuplePointer(i);
+		  const T* tet = tetList->getConstPointer(i * tetList->getNumberOfComponents());
 		  //get vert positions
 		  float vert0[3] = { vertex[3 * tet[0] + 0], vertex[3 * tet[0] + 1], vertex[3 * tet[0] + 2] };
 		  float vert1[3] = { vertex[3 * tet[1] + 0], vertex[3 * tet[1] + 1], vertex[3 * tet[1] + 2] };
@@ -1287,12 +1074,12 @@ public:
   template <typename T> static void FindTetMinDihedralAngles(typename DataArray<T>::Pointer tetList, FloatArrayType::Pointer vertices, FloatArrayType::Pointer minAngles)
   {
 	  size_t numTets = tetList->getNumberOfTuples();
-	  float* vertex = vertices->getPointer(0);
+	  const float* vertex = vertices->getConstPointer(0);
 	  float* minAnglesPtr = minAngles->getPointer(0);
 
 	  for (size_t i = 0; i < numTets; i++)
 	  {
-		  T* tet = tetList->getTuplePointer(i);
+		  const T* tet = tetList->getConstPointer(i * tetList->getNumberOfComponents());
 		  //get vert positions
 		  float vert0[3] = { vertex[3 * tet[0] + 0], vertex[3 * tet[0] + 1], vertex[3 * tet[0] + 2] };
 		  float vert1[3] = { vertex[3 * tet[1] + 0], vertex[3 * tet[1] + 1], vertex[3 * tet[1] + 2] };
@@ -1354,7 +1141,7 @@ public:
     Q_ASSERT(outElemArray->getComponentDimensions() == inVertexArray->getComponentDimensions());
     Q_ASSERT(elemList->getNumberOfTuples() == outElemArray->getNumberOfTuples());
 
-    K* vertArray = inVertexArray->getPointer(0);
+    const K* vertArray = inVertexArray->getConstPointer(0);
     float* elemArray = outElemArray->getPointer(0);
 
     size_t numElems = outElemArray->getNumberOfTuples();
@@ -1365,7 +1152,7 @@ public:
     {
       for(size_t j = 0; j < numElems; j++)
       {
-        T* Elem = elemList->getTuplePointer(j);
+        const T* Elem = elemList->getConstPointer(j * numVertsPerElem);
         float vertValue = 0.0;
         for(size_t k = 0; k < numVertsPerElem; k++)
         {
@@ -1392,10 +1179,10 @@ public:
     Q_ASSERT(outElemArray->getNumberOfTuples() == elemList->getNumberOfTuples());
     Q_ASSERT(outElemArray->getComponentDimensions() == inVertexArray->getComponentDimensions());
 
-    K* vertArray = inVertexArray->getPointer(0);
+    const K* vertArray = inVertexArray->getConstPointer(0);
     float* elemArray = outElemArray->getPointer(0);
-    float* elementCentroids = centroids->getPointer(0);
-    float* vertex = vertices->getPointer(0);
+    const float* elementCentroids = centroids->getConstPointer(0);
+    const float* vertex = vertices->getConstPointer(0);
 
     size_t numElems = outElemArray->getNumberOfTuples();
     size_t cDims = inVertexArray->getNumberOfComponents();
@@ -1407,7 +1194,7 @@ public:
 
     for(size_t i = 0; i < numElems; i++)
     {
-      T* Elem = elemList->getTuplePointer(i);
+      const T* Elem = elemList->getConstPointer(i * numVertsPerElem);
       for(size_t j = 0; j < numVertsPerElem; j++)
       {
         for(size_t k = 0; k < numDims; k++)
@@ -1422,7 +1209,7 @@ public:
     {
       for(size_t j = 0; j < numElems; j++)
       {
-        T* Elem = elemList->getTuplePointer(j);
+        const T* Elem = elemList->getConstPointer(j * numVertsPerElem);
         float vertValue = 0.0;
         float sumDist = 0.0;
         for(size_t k = 0; k < numVertsPerElem; k++)
@@ -1443,7 +1230,7 @@ public:
     Q_ASSERT(outVertexArray->getNumberOfTuples() == vertices->getNumberOfTuples());
     Q_ASSERT(outVertexArray->getComponentDimensions() == inElemArray->getComponentDimensions());
 
-    K* elemArray = inElemArray->getPointer(0);
+    const K* elemArray = inElemArray->getConstPointer(0);
     M* vertArray = outVertexArray->getPointer(0);
 
     size_t numVerts = vertices->getNumberOfTuples();
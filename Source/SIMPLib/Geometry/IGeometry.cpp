@@ -219,6 +219,93 @@ AttributeMatrix::Pointer IGeometry::removeAttributeMatrix(const QString& name)
   return p;
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int IGeometry::findPointLocator(IPointLocator::Type type)
+{
+  validateSpatialIndexes();
+  FloatArrayType::Pointer centroids = getElementCentroids();
+  if(nullptr == centroids.get())
+  {
+    findElementCentroids();
+    centroids = getElementCentroids();
+  }
+  if(nullptr == centroids.get())
+  {
+    return -1;
+  }
+  if(nullptr != m_PointLocator.get() && m_PointLocator->getType() == type && m_PointLocator->getPoints() == centroids)
+  {
+    return 1;
+  }
+  if(type == IPointLocator::Type::UniformGrid)
+  {
+    m_PointLocator = UniformGridPointLocator::New(centroids);
+  }
+  else
+  {
+    m_PointLocator = KdTreePointLocator::New(centroids);
+  }
+  return 1;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+IPointLocator::Pointer IGeometry::getPointLocator()
+{
+  validateSpatialIndexes();
+  return m_PointLocator;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void IGeometry::setPointLocator(IPointLocator::Pointer locator)
+{
+  m_PointLocator = locator;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void IGeometry::deletePointLocator()
+{
+  m_PointLocator = IPointLocator::NullPointer();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void IGeometry::deleteSpatialIndexes()
+{
+  deletePointLocator();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void IGeometry::markVerticesModified()
+{
+  // Loops fetch a pointer per vertex, so only store when the flag actually changes
+  if(!m_VerticesModified.load(std::memory_order_relaxed))
+  {
+    m_VerticesModified.store(true, std::memory_order_relaxed);
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void IGeometry::validateSpatialIndexes()
+{
+  if(m_VerticesModified.exchange(false))
+  {
+    deleteSpatialIndexes();
+  }
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -35,6 +35,8 @@
 
 #pragma once
 
+#include <atomic>
+
 #include <QMutex>
 #include <QtCore/QMap>
 #include <QtCore/QString>
@@ -45,6 +47,7 @@
 #include "SIMPLib/DataArrays/DynamicListArray.hpp"
 #include "SIMPLib/DataContainers/AttributeMatrix.h"
 #include "SIMPLib/Geometry/ITransformContainer.h"
+#include "SIMPLib/Geometry/PointLocator.h"
 #include "SIMPLib/SIMPLib.h"
 
 class QTextStream;
@@ -226,6 +229,32 @@ class SIMPLib_EXPORT IGeometry : public Observable
      */
     virtual void deleteElementCentroids() = 0;
 
+    /**
+     * @brief findPointLocator Builds a spatial index over the element centroids, computing them first if
+     * needed. An existing locator of the same type is reused.
+     * @param type
+     * @return -1 if there is nothing to index, 1 otherwise
+     */
+    virtual int findPointLocator(IPointLocator::Type type = IPointLocator::Type::KdTree);
+
+    /**
+     * @brief getPointLocator
+     * @return Null Pointer if there is no locator or the vertices were modified since it was built
+     */
+    virtual IPointLocator::Pointer getPointLocator() final;
+
+    /**
+     * @brief deletePointLocator Drops the cached locator
+     */
+    virtual void deletePointLocator() final;
+
+    /**
+     * @brief deleteSpatialIndexes Drops every cached spatial index built from the vertex coordinates. Pointers
+     * handed out by getVertexPointer() invalidate the indexes on their own; code that moves vertices through
+     * the shared vertex list array must call this before querying the geometry again.
+     */
+    virtual void deleteSpatialIndexes();
+
     /**
      * @brief getParametricCenter
      * @param pCoords
@@ -408,6 +437,8 @@ class SIMPLib_EXPORT IGeometry : public Observable
     unsigned int m_SpatialDimensionality = 0;
 
     AttributeMatrixMap_t m_AttributeMatrices;
+    IPointLocator::Pointer m_PointLocator;
+    std::atomic<bool> m_VerticesModified{false};
 
     QMutex m_Mutex;
     int64_t m_ProgressCounter;
@@ -443,6 +474,23 @@ class SIMPLib_EXPORT IGeometry : public Observable
      */
     virtual void setElementSizes(FloatArrayType::Pointer elementSizes) = 0;
 
+    /**
+     * @brief setPointLocator
+     * @param locator
+     */
+    virtual void setPointLocator(IPointLocator::Pointer locator) final;
+
+    /**
+     * @brief markVerticesModified Flags that the vertex coordinates may have been written through a raw pointer
+     */
+    virtual void markVerticesModified() final;
+
+    /**
+     * @brief validateSpatialIndexes Drops the cached spatial indexes if the vertices were flagged as modified
+     * since the last lookup. Every accessor of a cached index calls this first.
+     */
+    virtual void validateSpatialIndexes() final;
+
   public:
     IGeometry(const IGeometry&) = delete;      // Copy Constructor Not Implemented
     IGeometry(IGeometry&&) = delete;           // Move Constructor Not Implemented
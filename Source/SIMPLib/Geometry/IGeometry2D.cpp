@@ -44,3 +44,29 @@ IGeometry2D::IGeometry2D() = default;
 //
 // -----------------------------------------------------------------------------
 IGeometry2D::~IGeometry2D() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+SurfaceBVH::Pointer IGeometry2D::getBoundingVolumeHierarchy()
+{
+  validateSpatialIndexes();
+  return m_BoundingVolumeHierarchy;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void IGeometry2D::deleteBoundingVolumeHierarchy()
+{
+  m_BoundingVolumeHierarchy = SurfaceBVH::NullPointer();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void IGeometry2D::deleteSpatialIndexes()
+{
+  IGeometry::deleteSpatialIndexes();
+  deleteBoundingVolumeHierarchy();
+}
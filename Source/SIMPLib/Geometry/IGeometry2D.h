@@ -38,6 +38,7 @@
 
 #include "SIMPLib/Common/SIMPLibSetGetMacros.h"
 #include "SIMPLib/Geometry/IGeometry.h"
+#include "SIMPLib/Geometry/SurfaceBVH.h"
 
 /**
  * @brief The IGeometry2D class extends IGeometry for elements with a topology of 2D
@@ -187,7 +188,35 @@ class SIMPLib_EXPORT IGeometry2D : public IGeometry
      */
     virtual void deleteUnsharedEdges() = 0;
 
+// -----------------------------------------------------------------------------
+// Spatial Queries
+// -----------------------------------------------------------------------------
+
+    /**
+     * @brief findBoundingVolumeHierarchy Builds the hierarchy over the faces unless one is already cached
+     * @return -1 if the geometry has no vertices or faces or is too large for SurfaceBVH, 1 otherwise
+     */
+    virtual int findBoundingVolumeHierarchy() = 0;
+
+    /**
+     * @brief getBoundingVolumeHierarchy
+     * @return
+     */
+    virtual SurfaceBVH::Pointer getBoundingVolumeHierarchy() final;
+
+    /**
+     * @brief deleteBoundingVolumeHierarchy
+     */
+    virtual void deleteBoundingVolumeHierarchy() final;
+
+    /**
+     * @brief deleteSpatialIndexes
+     */
+    void deleteSpatialIndexes() override;
+
   protected:
+    SurfaceBVH::Pointer m_BoundingVolumeHierarchy;
+
 
     /**
      * @brief setEdges
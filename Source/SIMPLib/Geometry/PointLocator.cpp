@@ -0,0 +1,675 @@
+/* ============================================================================
+* Copyright (c) 2009-2015 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-07-D-5800
+*    United States Air Force Prime Contract FA8650-10-D-5210
+*    United States Prime Contract Navy N00173-07-C-2068
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+
+#include "PointLocator.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <queue>
+#include <utility>
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#include <tbb/parallel_invoke.h>
+#include <tbb/parallel_sort.h>
+#include <tbb/partitioner.h>
+#include <tbb/spin_mutex.h>
+#endif
+
+namespace
+{
+// Ranges smaller than this are not worth handing to another task
+const size_t k_ParallelGrainSize = 65536;
+
+using Neighbor = std::pair<float, int64_t>;
+using NeighborHeap = std::priority_queue<Neighbor>;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+template <typename Func> void ForEachPointRange(size_t count, const Func& func)
+{
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  if(count > k_ParallelGrainSize)
+  {
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, count, k_ParallelGrainSize), [&func](const tbb::blocked_range<size_t>& r) { func(r.begin(), r.end()); }, tbb::auto_partitioner());
+    return;
+  }
+#endif
+  func(0, count);
+}
+
+// -----------------------------------------------------------------------------
+// Keeps the k smallest (distance, index) pairs seen so far
+// -----------------------------------------------------------------------------
+inline void OfferNeighbor(NeighborHeap& heap, size_t k, float distance, int64_t id)
+{
+  Neighbor candidate(distance, id);
+  if(heap.size() < k)
+  {
+    heap.push(candidate);
+  }
+  else if(candidate < heap.top())
+  {
+    heap.pop();
+    heap.push(candidate);
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void DrainNeighbors(NeighborHeap& heap, std::vector<int64_t>& points)
+{
+  points.resize(heap.size());
+  for(size_t i = points.size(); i > 0; i--)
+  {
+    points[i - 1] = heap.top().second;
+    heap.pop();
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+inline bool InsideBox(const float* p, const float minCoords[3], const float maxCoords[3])
+{
+  return p[0] >= minCoords[0] && p[0] <= maxCoords[0] && p[1] >= minCoords[1] && p[1] <= maxCoords[1] && p[2] >= minCoords[2] && p[2] <= maxCoords[2];
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+IPointLocator::IPointLocator(const FloatArrayType::Pointer& points)
+: m_Points(points)
+{
+  if(nullptr != m_Points.get() && m_Points->getNumberOfComponents() == 3)
+  {
+    m_NumPoints = m_Points->getNumberOfTuples();
+    m_Coords = m_Points->getConstPointer(0);
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+IPointLocator::~IPointLocator() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int64_t IPointLocator::findNearestPoint(const float coords[3]) const
+{
+  std::vector<int64_t> points;
+  findNearestPoints(coords, 1, points);
+  return points.empty() ? -1 : points[0];
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t IPointLocator::getNumberOfPoints() const
+{
+  return m_NumPoints;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+FloatArrayType::Pointer IPointLocator::getPoints() const
+{
+  return m_Points;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void IPointLocator::computeBounds(float minCoords[3], float maxCoords[3]) const
+{
+  for(int a = 0; a < 3; a++)
+  {
+    minCoords[a] = std::numeric_limits<float>::max();
+    maxCoords[a] = std::numeric_limits<float>::lowest();
+  }
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  tbb::spin_mutex mutex;
+#endif
+  const float* coords = m_Coords;
+  ForEachPointRange(m_NumPoints, [&](size_t start, size_t end) {
+    float localMin[3] = {std::numeric_limits<float>::max(), std::numeric_limits<float>::max(), std::numeric_limits<float>::max()};
+    float localMax[3] = {std::numeric_limits<float>::lowest(), std::numeric_limits<float>::lowest(), std::numeric_limits<float>::lowest()};
+    for(size_t i = start; i < end; i++)
+    {
+      for(int a = 0; a < 3; a++)
+      {
+        localMin[a] = std::min(localMin[a], coords[3 * i + a]);
+        localMax[a] = std::max(localMax[a], coords[3 * i + a]);
+      }
+    }
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+    tbb::spin_mutex::scoped_lock lock(mutex);
+#endif
+    for(int a = 0; a < 3; a++)
+    {
+      minCoords[a] = std::min(minCoords[a], localMin[a]);
+      maxCoords[a] = std::max(maxCoords[a], localMax[a]);
+    }
+  });
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+UniformGridPointLocator::UniformGridPointLocator(const FloatArrayType::Pointer& points, size_t pointsPerBucket)
+: IPointLocator(points)
+{
+  build(std::max<size_t>(pointsPerBucket, 1));
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+UniformGridPointLocator::~UniformGridPointLocator() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+UniformGridPointLocator::Pointer UniformGridPointLocator::New(const FloatArrayType::Pointer& points, size_t pointsPerBucket)
+{
+  Pointer sharedPtr(new UniformGridPointLocator(points, pointsPerBucket));
+  return sharedPtr;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+IPointLocator::Type UniformGridPointLocator::getType() const
+{
+  return Type::UniformGrid;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void UniformGridPointLocator::getGridDimensions(size_t dims[3]) const
+{
+  dims[0] = m_Dims[0];
+  dims[1] = m_Dims[1];
+  dims[2] = m_Dims[2];
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t UniformGridPointLocator::cellIndex(float value, int axis) const
+{
+  float cell = std::floor((value - m_Origin[axis]) / m_CellSize[axis]);
+  if(!(cell > 0.0f))
+  {
+    return 0;
+  }
+  return std::min(static_cast<size_t>(cell), m_Dims[axis] - 1);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void UniformGridPointLocator::build(size_t pointsPerBucket)
+{
+  m_CellStarts.assign(2, 0);
+  if(m_NumPoints == 0)
+  {
+    return;
+  }
+  computeBounds(m_Origin, m_Max);
+
+  // Size the cells so that the grid holds about pointsPerBucket points per cell, ignoring flat axes
+  double volume = 1.0;
+  int numAxes = 0;
+  for(int a = 0; a < 3; a++)
+  {
+    double extent = static_cast<double>(m_Max[a]) - static_cast<double>(m_Origin[a]);
+    if(extent > 0.0)
+    {
+      volume *= extent;
+      numAxes++;
+    }
+  }
+  double targetCells = std::max(1.0, static_cast<double>(m_NumPoints) / static_cast<double>(pointsPerBucket));
+  double cellSize = numAxes > 0 ? std::pow(volume / targetCells, 1.0 / numAxes) : 1.0;
+  size_t numCells = 1;
+  for(int a = 0; a < 3; a++)
+  {
+    double extent = static_cast<double>(m_Max[a]) - static_cast<double>(m_Origin[a]);
+    m_Dims[a] = 1;
+    m_CellSize[a] = 1.0f;
+    if(extent > 0.0)
+    {
+      double dim = std::ceil(extent / cellSize);
+      m_Dims[a] = static_cast<size_t>(std::min(std::max(dim, 1.0), targetCells));
+      m_CellSize[a] = static_cast<float>(extent / static_cast<double>(m_Dims[a]));
+      if(!(m_CellSize[a] > 0.0f))
+      {
+        m_Dims[a] = 1;
+        m_CellSize[a] = 1.0f;
+      }
+    }
+    numCells *= m_Dims[a];
+  }
+
+  // Bin every point, then sort by (cell, point) so the ids of each cell are contiguous and ascending
+  std::vector<std::pair<size_t, int64_t>> keys(m_NumPoints);
+  const float* coords = m_Coords;
+  ForEachPointRange(m_NumPoints, [&](size_t start, size_t end) {
+    for(size_t i = start; i < end; i++)
+    {
+      const float* p = coords + 3 * i;
+      size_t cell = (cellIndex(p[2], 2) * m_Dims[1] + cellIndex(p[1], 1)) * m_Dims[0] + cellIndex(p[0], 0);
+      keys[i] = std::make_pair(cell, static_cast<int64_t>(i));
+    }
+  });
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  tbb::parallel_sort(keys.begin(), keys.end());
+#else
+  std::sort(keys.begin(), keys.end());
+#endif
+
+  // Every cell boundary fills the start offsets of the cells since the previous boundary, so each slot is
+  // written by exactly one range
+  m_PointIds.resize(m_NumPoints);
+  m_CellStarts.assign(numCells + 1, m_NumPoints);
+  ForEachPointRange(m_NumPoints, [&](size_t start, size_t end) {
+    for(size_t i = start; i < end; i++)
+    {
+      m_PointIds[i] = keys[i].second;
+      size_t firstCell = (i == 0) ? 0 : keys[i - 1].first + 1;
+      for(size_t c = firstCell; c <= keys[i].first && (i == 0 || keys[i].first != keys[i - 1].first); c++)
+      {
+        m_CellStarts[c] = i;
+      }
+    }
+  });
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void UniformGridPointLocator::appendCell(size_t x, size_t y, size_t z, const float minCoords[3], const float maxCoords[3], std::vector<int64_t>& points) const
+{
+  size_t cell = (z * m_Dims[1] + y) * m_Dims[0] + x;
+  for(size_t i = m_CellStarts[cell]; i < m_CellStarts[cell + 1]; i++)
+  {
+    int64_t id = m_PointIds[i];
+    if(InsideBox(m_Coords + 3 * id, minCoords, maxCoords))
+    {
+      points.push_back(id);
+    }
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void UniformGridPointLocator::findPointsInBox(const float minCoords[3], const float maxCoords[3], std::vector<int64_t>& points) const
+{
+  points.clear();
+  if(m_NumPoints == 0)
+  {
+    return;
+  }
+  for(int a = 0; a < 3; a++)
+  {
+    if(!(minCoords[a] <= m_Max[a] && maxCoords[a] >= m_Origin[a] && minCoords[a] <= maxCoords[a]))
+    {
+      return;
+    }
+  }
+  size_t lo[3] = {cellIndex(minCoords[0], 0), cellIndex(minCoords[1], 1), cellIndex(minCoords[2], 2)};
+  size_t hi[3] = {cellIndex(maxCoords[0], 0), cellIndex(maxCoords[1], 1), cellIndex(maxCoords[2], 2)};
+  for(size_t z = lo[2]; z <= hi[2]; z++)
+  {
+    for(size_t y = lo[1]; y <= hi[1]; y++)
+    {
+      for(size_t x = lo[0]; x <= hi[0]; x++)
+      {
+        appendCell(x, y, z, minCoords, maxCoords, points);
+      }
+    }
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void UniformGridPointLocator::findPointsInRadius(const float center[3], float radius, std::vector<int64_t>& points) const
+{
+  float minCoords[3] = {center[0] - radius, center[1] - radius, center[2] - radius};
+  float maxCoords[3] = {center[0] + radius, center[1] + radius, center[2] + radius};
+  findPointsInBox(minCoords, maxCoords, points);
+  float radiusSquared = radius * radius;
+  points.erase(std::remove_if(points.begin(), points.end(), [&](int64_t id) { return squaredDistance(id, center) > radiusSquared; }), points.end());
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void UniformGridPointLocator::findNearestPoints(const float coords[3], size_t k, std::vector<int64_t>& points) const
+{
+  points.clear();
+  if(m_NumPoints == 0 || k == 0)
+  {
+    return;
+  }
+
+  // Visit shells of cells around the cell nearest to coords. Every point outside the first r shells is at
+  // least r cells away along some axis, so the search stops once the k-th best distance is inside that bound.
+  size_t home[3] = {cellIndex(coords[0], 0), cellIndex(coords[1], 1), cellIndex(coords[2], 2)};
+  size_t maxRing = std::max(std::max(m_Dims[0], m_Dims[1]), m_Dims[2]);
+  float minCellSize = std::numeric_limits<float>::max();
+  for(int a = 0; a < 3; a++)
+  {
+    if(m_Dims[a] > 1)
+    {
+      minCellSize = std::min(minCellSize, m_CellSize[a]);
+    }
+  }
+
+  NeighborHeap heap;
+  for(size_t ring = 0; ring < maxRing; ring++)
+  {
+    size_t lo[3];
+    size_t hi[3];
+    for(int a = 0; a < 3; a++)
+    {
+      lo[a] = home[a] >= ring ? home[a] - ring : 0;
+      hi[a] = std::min(home[a] + ring, m_Dims[a] - 1);
+    }
+    for(size_t z = lo[2]; z <= hi[2]; z++)
+    {
+      bool zShell = (z + ring == home[2]) || (z == home[2] + ring);
+      for(size_t y = lo[1]; y <= hi[1]; y++)
+      {
+        bool yShell = zShell || (y + ring == home[1]) || (y == home[1] + ring);
+        for(size_t x = lo[0]; x <= hi[0]; x++)
+        {
+          // Only the cells on the surface of the shell are new
+          if(!yShell && x + ring != home[0] && x != home[0] + ring)
+          {
+            continue;
+          }
+          size_t cell = (z * m_Dims[1] + y) * m_Dims[0] + x;
+          for(size_t i = m_CellStarts[cell]; i < m_CellStarts[cell + 1]; i++)
+          {
+            int64_t id = m_PointIds[i];
+            OfferNeighbor(heap, k, squaredDistance(id, coords), id);
+          }
+        }
+      }
+    }
+    if(heap.size() == k)
+    {
+      // Shrink the bound slightly to stay conservative with respect to the rounding of the cell indices
+      float bound = (static_cast<float>(ring) - 0.01f) * minCellSize;
+      if(bound > 0.0f && heap.top().first < bound * bound)
+      {
+        break;
+      }
+    }
+  }
+  DrainNeighbors(heap, points);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+KdTreePointLocator::KdTreePointLocator(const FloatArrayType::Pointer& points, size_t leafSize)
+: IPointLocator(points)
+, m_LeafSize(std::max<size_t>(leafSize, 1))
+{
+  if(m_NumPoints == 0)
+  {
+    return;
+  }
+  m_PointIds.resize(m_NumPoints);
+  for(size_t i = 0; i < m_NumPoints; i++)
+  {
+    m_PointIds[i] = static_cast<int64_t>(i);
+  }
+
+  // The tree is complete down to the deepest leaf, the right child always holds the larger half
+  size_t depth = 0;
+  for(size_t count = m_NumPoints; count > m_LeafSize; count -= count / 2)
+  {
+    depth++;
+  }
+  size_t numNodes = (static_cast<size_t>(1) << (depth + 1)) - 1;
+  m_SplitValues.resize(numNodes, 0.0f);
+  m_SplitAxes.resize(numNodes, 0);
+
+  float cellMin[3];
+  float cellMax[3];
+  computeBounds(cellMin, cellMax);
+  buildNode(0, 0, m_NumPoints, cellMin, cellMax);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+KdTreePointLocator::~KdTreePointLocator() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+KdTreePointLocator::Pointer KdTreePointLocator::New(const FloatArrayType::Pointer& points, size_t leafSize)
+{
+  Pointer sharedPtr(new KdTreePointLocator(points, leafSize));
+  return sharedPtr;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+IPointLocator::Type KdTreePointLocator::getType() const
+{
+  return Type::KdTree;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void KdTreePointLocator::buildNode(size_t node, size_t begin, size_t end, float cellMin[3], float cellMax[3])
+{
+  if(end - begin <= m_LeafSize)
+  {
+    return;
+  }
+
+  // Split the longest side of the cell at the median point
+  uint8_t axis = 0;
+  for(uint8_t a = 1; a < 3; a++)
+  {
+    if(cellMax[a] - cellMin[a] > cellMax[axis] - cellMin[axis])
+    {
+      axis = a;
+    }
+  }
+  size_t mid = begin + (end - begin) / 2;
+  const float* coords = m_Coords;
+  std::nth_element(m_PointIds.begin() + begin, m_PointIds.begin() + mid, m_PointIds.begin() + end, [coords, axis](int64_t lhs, int64_t rhs) {
+    return coords[3 * lhs + axis] < coords[3 * rhs + axis];
+  });
+  float split = coords[3 * m_PointIds[mid] + axis];
+  m_SplitValues[node] = split;
+  m_SplitAxes[node] = axis;
+
+  float leftMax[3] = {cellMax[0], cellMax[1], cellMax[2]};
+  float rightMin[3] = {cellMin[0], cellMin[1], cellMin[2]};
+  leftMax[axis] = split;
+  rightMin[axis] = split;
+
+  auto buildLeft = [&]() { buildNode(2 * node + 1, begin, mid, cellMin, leftMax); };
+  auto buildRight = [&]() { buildNode(2 * node + 2, mid, end, rightMin, cellMax); };
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  if(end - begin > k_ParallelGrainSize)
+  {
+    tbb::parallel_invoke(buildLeft, buildRight);
+    return;
+  }
+#endif
+  buildLeft();
+  buildRight();
+}
+
+// -----------------------------------------------------------------------------
+// Points equal to a split value may land on either side, so both traversals below
+// visit a child whenever the query touches the split plane.
+// -----------------------------------------------------------------------------
+void KdTreePointLocator::findPointsInBox(const float minCoords[3], const float maxCoords[3], std::vector<int64_t>& points) const
+{
+  points.clear();
+  if(m_NumPoints == 0)
+  {
+    return;
+  }
+  struct Range
+  {
+    size_t node;
+    size_t begin;
+    size_t end;
+  };
+  std::vector<Range> stack(1, Range{0, 0, m_NumPoints});
+  while(!stack.empty())
+  {
+    Range r = stack.back();
+    stack.pop_back();
+    if(r.end - r.begin <= m_LeafSize)
+    {
+      for(size_t i = r.begin; i < r.end; i++)
+      {
+        if(InsideBox(m_Coords + 3 * m_PointIds[i], minCoords, maxCoords))
+        {
+          points.push_back(m_PointIds[i]);
+        }
+      }
+      continue;
+    }
+    size_t mid = r.begin + (r.end - r.begin) / 2;
+    uint8_t axis = m_SplitAxes[r.node];
+    float split = m_SplitValues[r.node];
+    if(maxCoords[axis] >= split)
+    {
+      stack.push_back(Range{2 * r.node + 2, mid, r.end});
+    }
+    if(minCoords[axis] <= split)
+    {
+      stack.push_back(Range{2 * r.node + 1, r.begin, mid});
+    }
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void KdTreePointLocator::findPointsInRadius(const float center[3], float radius, std::vector<int64_t>& points) const
+{
+  float minCoords[3] = {center[0] - radius, center[1] - radius, center[2] - radius};
+  float maxCoords[3] = {center[0] + radius, center[1] + radius, center[2] + radius};
+  findPointsInBox(minCoords, maxCoords, points);
+  float radiusSquared = radius * radius;
+  points.erase(std::remove_if(points.begin(), points.end(), [&](int64_t id) { return squaredDistance(id, center) > radiusSquared; }), points.end());
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void KdTreePointLocator::findNearestPoints(const float coords[3], size_t k, std::vector<int64_t>& points) const
+{
+  points.clear();
+  if(m_NumPoints == 0 || k == 0)
+  {
+    return;
+  }
+  struct Range
+  {
+    size_t node;
+    size_t begin;
+    size_t end;
+    float planeDistance;
+  };
+
+  // Depth first, near side first. The far side is only opened if the split plane is not farther than the
+  // current k-th neighbor.
+  NeighborHeap heap;
+  std::vector<Range> stack(1, Range{0, 0, m_NumPoints, 0.0f});
+  while(!stack.empty())
+  {
+    Range r = stack.back();
+    stack.pop_back();
+    if(heap.size() == k && r.planeDistance > heap.top().first)
+    {
+      continue;
+    }
+    if(r.end - r.begin <= m_LeafSize)
+    {
+      for(size_t i = r.begin; i < r.end; i++)
+      {
+        int64_t id = m_PointIds[i];
+        OfferNeighbor(heap, k, squaredDistance(id, coords), id);
+      }
+      continue;
+    }
+    size_t mid = r.begin + (r.end - r.begin) / 2;
+    uint8_t axis = m_SplitAxes[r.node];
+    float delta = coords[axis] - m_SplitValues[r.node];
+    float planeDistance = std::max(r.planeDistance, delta * delta);
+    Range left{2 * r.node + 1, r.begin, mid, delta <= 0.0f ? r.planeDistance : planeDistance};
+    Range right{2 * r.node + 2, mid, r.end, delta >= 0.0f ? r.planeDistance : planeDistance};
+    if(delta <= 0.0f)
+    {
+      stack.push_back(right);
+      stack.push_back(left);
+    }
+    else
+    {
+      stack.push_back(left);
+      stack.push_back(right);
+    }
+  }
+  DrainNeighbors(heap, points);
+}
@@ -0,0 +1,258 @@
+/* ============================================================================
+* Copyright (c) 2009-2015 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-07-D-5800
+*    United States Air Force Prime Contract FA8650-10-D-5210
+*    United States Prime Contract Navy N00173-07-C-2068
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "SIMPLib/Common/SIMPLibSetGetMacros.h"
+#include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/SIMPLib.h"
+
+/**
+ * @brief The IPointLocator class is the interface of the spatial indexes that answer box, radius and
+ * k-nearest queries over a fixed set of 3D points. A locator keeps a reference to the coordinate array it
+ * was built from and must be rebuilt whenever those coordinates change. Geometries cache one through
+ * IGeometry::findPointLocator() and drop it when their vertices are replaced or moved.
+ *
+ * Box and radius queries return point indices in no particular order. Nearest point queries return the
+ * indices sorted by increasing distance, with ties broken by the smaller index, so both implementations
+ * return identical results.
+ */
+class SIMPLib_EXPORT IPointLocator
+{
+public:
+  SIMPL_SHARED_POINTERS(IPointLocator)
+
+  using EnumType = unsigned int;
+
+  enum class Type : EnumType
+  {
+    UniformGrid = 0,
+    KdTree = 1
+  };
+
+  virtual ~IPointLocator();
+
+  /**
+   * @brief getType
+   * @return
+   */
+  virtual Type getType() const = 0;
+
+  /**
+   * @brief findPointsInBox Finds the points inside the closed box [minCoords, maxCoords]
+   * @param minCoords
+   * @param maxCoords
+   * @param points Cleared and filled with the indices of the points found
+   */
+  virtual void findPointsInBox(const float minCoords[3], const float maxCoords[3], std::vector<int64_t>& points) const = 0;
+
+  /**
+   * @brief findPointsInRadius Finds the points whose distance to center is less than or equal to radius
+   * @param center
+   * @param radius
+   * @param points Cleared and filled with the indices of the points found
+   */
+  virtual void findPointsInRadius(const float center[3], float radius, std::vector<int64_t>& points) const = 0;
+
+  /**
+   * @brief findNearestPoints Finds the k points closest to coords
+   * @param coords
+   * @param k
+   * @param points Cleared and filled with at most k indices, nearest first
+   */
+  virtual void findNearestPoints(const float coords[3], size_t k, std::vector<int64_t>& points) const = 0;
+
+  /**
+   * @brief findNearestPoint
+   * @param coords
+   * @return The index of the point closest to coords or -1 if the locator is empty
+   */
+  int64_t findNearestPoint(const float coords[3]) const;
+
+  /**
+   * @brief getNumberOfPoints
+   * @return
+   */
+  size_t getNumberOfPoints() const;
+
+  /**
+   * @brief getPoints Returns the coordinate array the locator was built from
+   * @return
+   */
+  FloatArrayType::Pointer getPoints() const;
+
+protected:
+  /**
+   * @brief IPointLocator
+   * @param points Array of 3 component coordinates
+   */
+  IPointLocator(const FloatArrayType::Pointer& points);
+
+  /**
+   * @brief squaredDistance
+   * @param id
+   * @param coords
+   * @return
+   */
+  inline float squaredDistance(int64_t id, const float coords[3]) const
+  {
+    const float* p = m_Coords + 3 * id;
+    float dx = p[0] - coords[0];
+    float dy = p[1] - coords[1];
+    float dz = p[2] - coords[2];
+    return dx * dx + dy * dy + dz * dz;
+  }
+
+  /**
+   * @brief computeBounds Computes the bounding box of all the points in parallel
+   * @param minCoords
+   * @param maxCoords
+   */
+  void computeBounds(float minCoords[3], float maxCoords[3]) const;
+
+  FloatArrayType::Pointer m_Points;
+  const float* m_Coords = nullptr;
+  size_t m_NumPoints = 0;
+
+public:
+  IPointLocator(const IPointLocator&) = delete;            // Copy Constructor Not Implemented
+  IPointLocator(IPointLocator&&) = delete;                 // Move Constructor Not Implemented
+  IPointLocator& operator=(const IPointLocator&) = delete; // Copy Assignment Not Implemented
+  IPointLocator& operator=(IPointLocator&&) = delete;      // Move Assignment Not Implemented
+};
+
+/**
+ * @brief The UniformGridPointLocator class buckets the points into a regular grid sized so that each cell
+ * holds about pointsPerBucket points. It is cheap to build and works best for evenly distributed points.
+ */
+class SIMPLib_EXPORT UniformGridPointLocator : public IPointLocator
+{
+public:
+  SIMPL_SHARED_POINTERS(UniformGridPointLocator)
+
+  /**
+   * @brief New Builds the grid over points
+   * @param points Array of 3 component coordinates
+   * @param pointsPerBucket Target average number of points per grid cell
+   * @return
+   */
+  static Pointer New(const FloatArrayType::Pointer& points, size_t pointsPerBucket = 8);
+
+  ~UniformGridPointLocator() override;
+
+  Type getType() const override;
+
+  void findPointsInBox(const float minCoords[3], const float maxCoords[3], std::vector<int64_t>& points) const override;
+
+  void findPointsInRadius(const float center[3], float radius, std::vector<int64_t>& points) const override;
+
+  void findNearestPoints(const float coords[3], size_t k, std::vector<int64_t>& points) const override;
+
+  /**
+   * @brief getGridDimensions
+   * @param dims
+   */
+  void getGridDimensions(size_t dims[3]) const;
+
+protected:
+  UniformGridPointLocator(const FloatArrayType::Pointer& points, size_t pointsPerBucket);
+
+private:
+  float m_Origin[3] = {0.0f, 0.0f, 0.0f};
+  float m_Max[3] = {0.0f, 0.0f, 0.0f};
+  float m_CellSize[3] = {1.0f, 1.0f, 1.0f};
+  size_t m_Dims[3] = {1, 1, 1};
+  std::vector<size_t> m_CellStarts;
+  std::vector<int64_t> m_PointIds;
+
+  void build(size_t pointsPerBucket);
+  size_t cellIndex(float value, int axis) const;
+  void appendCell(size_t x, size_t y, size_t z, const float minCoords[3], const float maxCoords[3], std::vector<int64_t>& points) const;
+
+public:
+  UniformGridPointLocator(const UniformGridPointLocator&) = delete;            // Copy Constructor Not Implemented
+  UniformGridPointLocator(UniformGridPointLocator&&) = delete;                 // Move Constructor Not Implemented
+  UniformGridPointLocator& operator=(const UniformGridPointLocator&) = delete; // Copy Assignment Not Implemented
+  UniformGridPointLocator& operator=(UniformGridPointLocator&&) = delete;      // Move Assignment Not Implemented
+};
+
+/**
+ * @brief The KdTreePointLocator class is a balanced k-d tree stored as an implicit binary tree. Each node
+ * splits its points at the median along the longest side of its cell, so it adapts to clustered points.
+ */
+class SIMPLib_EXPORT KdTreePointLocator : public IPointLocator
+{
+public:
+  SIMPL_SHARED_POINTERS(KdTreePointLocator)
+
+  /**
+   * @brief New Builds the tree over points
+   * @param points Array of 3 component coordinates
+   * @param leafSize Maximum number of points stored in a leaf
+   * @return
+   */
+  static Pointer New(const FloatArrayType::Pointer& points, size_t leafSize = 16);
+
+  ~KdTreePointLocator() override;
+
+  Type getType() const override;
+
+  void findPointsInBox(const float minCoords[3], const float maxCoords[3], std::vector<int64_t>& points) const override;
+
+  void findPointsInRadius(const float center[3], float radius, std::vector<int64_t>& points) const override;
+
+  void findNearestPoints(const float coords[3], size_t k, std::vector<int64_t>& points) const override;
+
+protected:
+  KdTreePointLocator(const FloatArrayType::Pointer& points, size_t leafSize);
+
+private:
+  size_t m_LeafSize = 16;
+  std::vector<int64_t> m_PointIds;
+  std::vector<float> m_SplitValues;
+  std::vector<uint8_t> m_SplitAxes;
+
+  void buildNode(size_t node, size_t begin, size_t end, float cellMin[3], float cellMax[3]);
+
+public:
+  KdTreePointLocator(const KdTreePointLocator&) = delete;            // Copy Constructor Not Implemented
+  KdTreePointLocator(KdTreePointLocator&&) = delete;                 // Move Constructor Not Implemented
+  KdTreePointLocator& operator=(const KdTreePointLocator&) = delete; // Copy Assignment Not Implemented
+  KdTreePointLocator& operator=(KdTreePointLocator&&) = delete;      // Move Assignment Not Implemented
+};
@@ -463,6 +463,23 @@ void QuadGeom::deleteUnsharedEdges()
   m_UnsharedEdgeList = SharedEdgeList::NullPointer();
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int QuadGeom::findBoundingVolumeHierarchy()
+{
+  validateSpatialIndexes();
+  if(nullptr == m_VertexList.get() || nullptr == m_QuadList.get())
+  {
+    return -1;
+  }
+  if(nullptr == m_BoundingVolumeHierarchy.get())
+  {
+    m_BoundingVolumeHierarchy = SurfaceBVH::New(m_VertexList, m_QuadList);
+  }
+  return nullptr == m_BoundingVolumeHierarchy.get() ? -1 : 1;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
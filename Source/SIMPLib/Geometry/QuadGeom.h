@@ -426,6 +426,12 @@ class SIMPLib_EXPORT QuadGeom : public IGeometry2D
      */
     void deleteUnsharedEdges() override;
 
+    /**
+     * @brief findBoundingVolumeHierarchy
+     * @return
+     */
+    int findBoundingVolumeHierarchy() override;
+
   protected:
 
     QuadGeom();
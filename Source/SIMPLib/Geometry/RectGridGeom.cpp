@@ -487,9 +487,9 @@ void RectGridGeom::setZBounds(FloatArrayType::Pointer zBnds)
 // -----------------------------------------------------------------------------
 void RectGridGeom::getPlaneCoords(size_t idx[3], float coords[3])
 {
-  float* xBnds = m_xBounds->getPointer(0);
-  float* yBnds = m_yBounds->getPointer(0);
-  float* zBnds = m_zBounds->getPointer(0);
+  const float* xBnds = m_xBounds->getConstPointer(0);
+  const float* yBnds = m_yBounds->getConstPointer(0);
+  const float* zBnds = m_zBounds->getConstPointer(0);
 
   coords[0] = xBnds[idx[0]];
   coords[1] = yBnds[idx[1]];
@@ -501,9 +501,9 @@ void RectGridGeom::getPlaneCoords(size_t idx[3], float coords[3])
 // -----------------------------------------------------------------------------
 void RectGridGeom::getPlaneCoords(size_t x, size_t y, size_t z, float coords[3])
 {
-  float* xBnds = m_xBounds->getPointer(0);
-  float* yBnds = m_yBounds->getPointer(0);
-  float* zBnds = m_zBounds->getPointer(0);
+  const float* xBnds = m_xBounds->getConstPointer(0);
+  const float* yBnds = m_yBounds->getConstPointer(0);
+  const float* zBnds = m_zBounds->getConstPointer(0);
 
   coords[0] = xBnds[x];
   coords[1] = yBnds[y];
@@ -519,9 +519,9 @@ void RectGridGeom::getPlaneCoords(size_t idx, float coords[3])
   size_t row = (idx / m_Dimensions[0]) % m_Dimensions[1];
   size_t plane = idx / (m_Dimensions[0] * m_Dimensions[1]);
 
-  float* xBnds = m_xBounds->getPointer(0);
-  float* yBnds = m_yBounds->getPointer(0);
-  float* zBnds = m_zBounds->getPointer(0);
+  const float* xBnds = m_xBounds->getConstPointer(0);
+  const float* yBnds = m_yBounds->getConstPointer(0);
+  const float* zBnds = m_zBounds->getConstPointer(0);
 
   coords[0] = xBnds[column];
   coords[1] = yBnds[row];
@@ -533,9 +533,9 @@ void RectGridGeom::getPlaneCoords(size_t idx, float coords[3])
 // -----------------------------------------------------------------------------
 void RectGridGeom::getPlaneCoords(size_t idx[3], double coords[3])
 {
-  float* xBnds = m_xBounds->getPointer(0);
-  float* yBnds = m_yBounds->getPointer(0);
-  float* zBnds = m_zBounds->getPointer(0);
+  const float* xBnds = m_xBounds->getConstPointer(0);
+  const float* yBnds = m_yBounds->getConstPointer(0);
+  const float* zBnds = m_zBounds->getConstPointer(0);
 
   coords[0] = static_cast<double>(xBnds[idx[0]]);
   coords[1] = static_cast<double>(yBnds[idx[1]]);
@@ -547,9 +547,9 @@ void RectGridGeom::getPlaneCoords(size_t idx[3], double coords[3])
 // -----------------------------------------------------------------------------
 void RectGridGeom::getPlaneCoords(size_t x, size_t y, size_t z, double coords[3])
 {
-  float* xBnds = m_xBounds->getPointer(0);
-  float* yBnds = m_yBounds->getPointer(0);
-  float* zBnds = m_zBounds->getPointer(0);
+  const float* xBnds = m_xBounds->getConstPointer(0);
+  const float* yBnds = m_yBounds->getConstPointer(0);
+  const float* zBnds = m_zBounds->getConstPointer(0);
 
   coords[0] = static_cast<double>(xBnds[x]);
   coords[1] = static_cast<double>(yBnds[y]);
@@ -565,9 +565,9 @@ void RectGridGeom::getPlaneCoords(size_t idx, double coords[3])
   size_t row = (idx / m_Dimensions[0]) % m_Dimensions[1];
   size_t plane = idx / (m_Dimensions[0] * m_Dimensions[1]);
 
-  float* xBnds = m_xBounds->getPointer(0);
-  float* yBnds = m_yBounds->getPointer(0);
-  float* zBnds = m_zBounds->getPointer(0);
+  const float* xBnds = m_xBounds->getConstPointer(0);
+  const float* yBnds = m_yBounds->getConstPointer(0);
+  const float* zBnds = m_zBounds->getConstPointer(0);
 
   coords[0] = static_cast<double>(xBnds[column]);
   coords[1] = static_cast<double>(yBnds[row]);
@@ -579,9 +579,9 @@ void RectGridGeom::getPlaneCoords(size_t idx, double coords[3])
 // -----------------------------------------------------------------------------
 void RectGridGeom::getCoords(size_t idx[3], float coords[3])
 {
-  float* xBnds = m_xBounds->getPointer(0);
-  float* yBnds = m_yBounds->getPointer(0);
-  float* zBnds = m_zBounds->getPointer(0);
+  const float* xBnds = m_xBounds->getConstPointer(0);
+  const float* yBnds = m_yBounds->getConstPointer(0);
+  const float* zBnds = m_zBounds->getConstPointer(0);
 
   coords[0] = 0.5f * (xBnds[idx[0]] + xBnds[idx[0] + 1]);
   coords[1] = 0.5f * (yBnds[idx[1]] + yBnds[idx[1] + 1]);
@@ -593,9 +593,9 @@ void RectGridGeom::getCoords(size_t idx[3], float coords[3])
 // -----------------------------------------------------------------------------
 void RectGridGeom::getCoords(size_t x, size_t y, size_t z, float coords[3])
 {
-  float* xBnds = m_xBounds->getPointer(0);
-  float* yBnds = m_yBounds->getPointer(0);
-  float* zBnds = m_zBounds->getPointer(0);
+  const float* xBnds = m_xBounds->getConstPointer(0);
+  const float* yBnds = m_yBounds->getConstPointer(0);
+  const float* zBnds = m_zBounds->getConstPointer(0);
 
   coords[0] = 0.5f * (xBnds[x] + xBnds[x + 1]);
   coords[1] = 0.5f * (yBnds[y] + yBnds[y + 1]);
@@ -611,9 +611,9 @@ void RectGridGeom::getCoords(size_t idx, float coords[3])
   size_t row = (idx / m_Dimensions[0]) % m_Dimensions[1];
   size_t plane = idx / (m_Dimensions[0] * m_Dimensions[1]);
 
-  float* xBnds = m_xBounds->getPointer(0);
-  float* yBnds = m_yBounds->getPointer(0);
-  float* zBnds = m_zBounds->getPointer(0);
+  const float* xBnds = m_xBounds->getConstPointer(0);
+  const float* yBnds = m_yBounds->getConstPointer(0);
+  const float* zBnds = m_zBounds->getConstPointer(0);
 
   coords[0] = 0.5f * (xBnds[column] + xBnds[column + 1]);
   coords[1] = 0.5f * (yBnds[row] + yBnds[row + 1]);
@@ -625,9 +625,9 @@ void RectGridGeom::getCoords(size_t idx, float coords[3])
 // -----------------------------------------------------------------------------
 void RectGridGeom::getCoords(size_t idx[3], double coords[3])
 {
-  float* xBnds = m_xBounds->getPointer(0);
-  float* yBnds = m_yBounds->getPointer(0);
-  float* zBnds = m_zBounds->getPointer(0);
+  const float* xBnds = m_xBounds->getConstPointer(0);
+  const float* yBnds = m_yBounds->getConstPointer(0);
+  const float* zBnds = m_zBounds->getConstPointer(0);
 
   coords[0] = static_cast<double>(0.5 * (xBnds[idx[0]] + xBnds[idx[0] + 1]));
   coords[1] = static_cast<double>(0.5 * (yBnds[idx[1]] + yBnds[idx[1] + 1]));
@@ -639,9 +639,9 @@ void RectGridGeom::getCoords(size_t idx[3], double coords[3])
 // -----------------------------------------------------------------------------
 void RectGridGeom::getCoords(size_t x, size_t y, size_t z, double coords[3])
 {
-  float* xBnds = m_xBounds->getPointer(0);
-  float* yBnds = m_yBounds->getPointer(0);
-  float* zBnds = m_zBounds->getPointer(0);
+  const float* xBnds = m_xBounds->getConstPointer(0);
+  const float* yBnds = m_yBounds->getConstPointer(0);
+  const float* zBnds = m_zBounds->getConstPointer(0);
 
   coords[0] = static_cast<double>(0.5 * (xBnds[x] + xBnds[x + 1]));
   coords[1] = static_cast<double>(0.5 * (yBnds[y] + yBnds[y + 1]));
@@ -657,9 +657,9 @@ void RectGridGeom::getCoords(size_t idx, double coords[3])
   size_t row = (idx / m_Dimensions[0]) % m_Dimensions[1];
   size_t plane = idx / (m_Dimensions[0] * m_Dimensions[1]);
 
-  float* xBnds = m_xBounds->getPointer(0);
-  float* yBnds = m_yBounds->getPointer(0);
-  float* zBnds = m_zBounds->getPointer(0);
+  const float* xBnds = m_xBounds->getConstPointer(0);
+  const float* yBnds = m_yBounds->getConstPointer(0);
+  const float* zBnds = m_zBounds->getConstPointer(0);
 
   coords[0] = static_cast<double>(0.5f * (xBnds[column] + xBnds[column + 1]));
   coords[1] = static_cast<double>(0.5f * (yBnds[row] + yBnds[row + 1]));
@@ -807,9 +807,9 @@ int RectGridGeom::findElementSizes()
   m_VoxelSizes = FloatArrayType::CreateArray(getNumberOfElements(), SIMPL::StringConstants::VoxelSizes);
 
   float* sizes = m_VoxelSizes->getPointer(0);
-  float* xBnds = m_xBounds->getPointer(0);
-  float* yBnds = m_yBounds->getPointer(0);
-  float* zBnds = m_zBounds->getPointer(0);
+  const float* xBnds = m_xBounds->getConstPointer(0);
+  const float* yBnds = m_yBounds->getConstPointer(0);
+  const float* zBnds = m_zBounds->getConstPointer(0);
   float xRes = 0.0f;
   float yRes = 0.0f;
   float zRes = 0.0f;
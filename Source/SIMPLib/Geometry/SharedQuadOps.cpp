@@ -50,6 +50,7 @@ SharedQuadList::Pointer GEOM_CLASS_NAME::CreateSharedQuadList(int64_t numQuads,
 void GEOM_CLASS_NAME::resizeQuadList(int64_t newNumQuads)
 {
   m_QuadList->resize(newNumQuads);
+  deleteSpatialIndexes();
 }
 
 // -----------------------------------------------------------------------------
@@ -65,6 +66,7 @@ void GEOM_CLASS_NAME::setQuads(SharedQuadList::Pointer quads)
     }
   }
   m_QuadList = quads;
+  deleteSpatialIndexes();
 }
 
 // -----------------------------------------------------------------------------
@@ -85,6 +87,7 @@ void GEOM_CLASS_NAME::setVertsAtQuad(int64_t quadId, int64_t verts[4])
   Quad[1] = verts[1];
   Quad[2] = verts[2];
   Quad[3] = verts[3];
+  deleteSpatialIndexes();
 }
 
 // -----------------------------------------------------------------------------
@@ -50,6 +50,7 @@ SharedTriList::Pointer GEOM_CLASS_NAME::CreateSharedTriList(int64_t numTris, boo
 void GEOM_CLASS_NAME::resizeTriList(int64_t newNumTris)
 {
   m_TriList->resize(newNumTris);
+  deleteSpatialIndexes();
 }
 
 // -----------------------------------------------------------------------------
@@ -65,6 +66,7 @@ void GEOM_CLASS_NAME::setTriangles(SharedTriList::Pointer triangles)
     }
   }
   m_TriList = triangles;
+  deleteSpatialIndexes();
 }
 
 // -----------------------------------------------------------------------------
@@ -84,6 +86,7 @@ void GEOM_CLASS_NAME::setVertsAtTri(int64_t triId, int64_t verts[3])
   Tri[0] = verts[0];
   Tri[1] = verts[1];
   Tri[2] = verts[2];
+  deleteSpatialIndexes();
 }
 
 // -----------------------------------------------------------------------------
@@ -50,6 +50,7 @@ SharedVertexList::Pointer GEOM_CLASS_NAME::CreateSharedVertexList(int64_t numVer
 void GEOM_CLASS_NAME::resizeVertexList(int64_t newNumVertices)
 {
   m_VertexList->resize(newNumVertices);
+  deleteSpatialIndexes();
 }
 
 // -----------------------------------------------------------------------------
@@ -65,6 +66,7 @@ void GEOM_CLASS_NAME::setVertices(SharedVertexList::Pointer vertices)
     }
   }
   m_VertexList = vertices;
+  deleteSpatialIndexes();
 }
 
 // -----------------------------------------------------------------------------
@@ -84,6 +86,7 @@ void GEOM_CLASS_NAME::setCoords(int64_t vertId, float coords[3])
   Vert[0] = coords[0];
   Vert[1] = coords[1];
   Vert[2] = coords[2];
+  deleteSpatialIndexes();
 }
 
 // -----------------------------------------------------------------------------
@@ -102,6 +105,7 @@ void GEOM_CLASS_NAME::getCoords(int64_t vertId, float coords[3])
 // -----------------------------------------------------------------------------
 float* GEOM_CLASS_NAME::getVertexPointer(int64_t i)
 {
+  markVerticesModified();
   return m_VertexList->getTuplePointer(i);
 }
 
@@ -14,6 +14,7 @@ set(SIMPLib_${SUBDIR_NAME}_HDRS
   ${SIMPLib_SOURCE_DIR}/Geometry/ImageGeom.h
   ${SIMPLib_SOURCE_DIR}/Geometry/ITransformContainer.h
   ${SIMPLib_SOURCE_DIR}/Geometry/MeshStructs.h
+  ${SIMPLib_SOURCE_DIR}/Geometry/PointLocator.h
   ${SIMPLib_SOURCE_DIR}/Geometry/QuadGeom.h
   ${SIMPLib_SOURCE_DIR}/Geometry/RectGridGeom.h
   ${SIMPLib_SOURCE_DIR}/Geometry/ShapeOps/CubeOctohedronOps.h
@@ -23,6 +24,7 @@ set(SIMPLib_${SUBDIR_NAME}_HDRS
   ${SIMPLib_SOURCE_DIR}/Geometry/ShapeOps/EllipsoidOps.h
   ${SIMPLib_SOURCE_DIR}/Geometry/ShapeOps/ShapeOps.h
   ${SIMPLib_SOURCE_DIR}/Geometry/ShapeOps/SuperEllipsoidOps.h
+  ${SIMPLib_SOURCE_DIR}/Geometry/SurfaceBVH.h
   ${SIMPLib_SOURCE_DIR}/Geometry/TetrahedralGeom.h
   ${SIMPLib_SOURCE_DIR}/Geometry/TransformContainer.h
   ${SIMPLib_SOURCE_DIR}/Geometry/TriangleGeom.h
@@ -39,6 +41,7 @@ set(SIMPLib_${SUBDIR_NAME}_SRCS
   ${SIMPLib_SOURCE_DIR}/Geometry/IGeometry3D.cpp
   ${SIMPLib_SOURCE_DIR}/Geometry/IGeometryGrid.cpp
   ${SIMPLib_SOURCE_DIR}/Geometry/ImageGeom.cpp
+  ${SIMPLib_SOURCE_DIR}/Geometry/PointLocator.cpp
   ${SIMPLib_SOURCE_DIR}/Geometry/QuadGeom.cpp
   ${SIMPLib_SOURCE_DIR}/Geometry/RectGridGeom.cpp
   ${SIMPLib_SOURCE_DIR}/Geometry/ShapeOps/CubeOctohedronOps.cpp
@@ -48,6 +51,7 @@ set(SIMPLib_${SUBDIR_NAME}_SRCS
   ${SIMPLib_SOURCE_DIR}/Geometry/ShapeOps/EllipsoidOps.cpp
   ${SIMPLib_SOURCE_DIR}/Geometry/ShapeOps/ShapeOps.cpp
   ${SIMPLib_SOURCE_DIR}/Geometry/ShapeOps/SuperEllipsoidOps.cpp
+  ${SIMPLib_SOURCE_DIR}/Geometry/SurfaceBVH.cpp
   ${SIMPLib_SOURCE_DIR}/Geometry/TetrahedralGeom.cpp
   ${SIMPLib_SOURCE_DIR}/Geometry/TransformContainer.cpp
   ${SIMPLib_SOURCE_DIR}/Geometry/TriangleGeom.cpp
@@ -0,0 +1,794 @@
+/* ============================================================================
+* Copyright (c) 2009-2015 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-07-D-5800
+*    United States Air Force Prime Contract FA8650-10-D-5210
+*    United States Prime Contract Navy N00173-07-C-2068
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+
+#include "SurfaceBVH.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <tuple>
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#include <tbb/parallel_invoke.h>
+#include <tbb/partitioner.h>
+#endif
+
+namespace
+{
+// Subtrees with fewer triangles than this are built by the calling task
+const size_t k_ParallelBuildSize = 16384;
+
+static_assert(sizeof(SurfaceBVH::Node) == 32, "SurfaceBVH nodes are expected to fill 32 bytes");
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+template <typename Func> void ForEachRange(size_t count, size_t grain, const Func& func)
+{
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  if(count > grain)
+  {
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, count, grain), [&func](const tbb::blocked_range<size_t>& r) { func(r.begin(), r.end()); }, tbb::auto_partitioner());
+    return;
+  }
+#else
+  Q_UNUSED(grain)
+#endif
+  func(0, count);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+inline float SquaredDistanceToBox(const SurfaceBVH::Node& node, const float p[3])
+{
+  float d = 0.0f;
+  for(int a = 0; a < 3; a++)
+  {
+    float delta = std::max(std::max(node.minCoords[a] - p[a], p[a] - node.maxCoords[a]), 0.0f);
+    d += delta * delta;
+  }
+  return d;
+}
+
+// -----------------------------------------------------------------------------
+// Closest point on the triangle (a, b, c) by Voronoi region, see Ericson, Real-Time Collision Detection, 5.1.5
+// -----------------------------------------------------------------------------
+void ClosestPointOnTriangle(const float* tri, const float p[3], float closest[3])
+{
+  const float* a = tri;
+  const float* b = tri + 3;
+  const float* c = tri + 6;
+  float ab[3] = {b[0] - a[0], b[1] - a[1], b[2] - a[2]};
+  float ac[3] = {c[0] - a[0], c[1] - a[1], c[2] - a[2]};
+  float ap[3] = {p[0] - a[0], p[1] - a[1], p[2] - a[2]};
+  auto dot = [](const float* u, const float* v) { return u[0] * v[0] + u[1] * v[1] + u[2] * v[2]; };
+  auto combine = [&](float v, float w) {
+    for(int i = 0; i < 3; i++)
+    {
+      closest[i] = a[i] + ab[i] * v + ac[i] * w;
+    }
+  };
+
+  float d1 = dot(ab, ap);
+  float d2 = dot(ac, ap);
+  if(d1 <= 0.0f && d2 <= 0.0f)
+  {
+    std::copy(a, a + 3, closest);
+    return;
+  }
+  float bp[3] = {p[0] - b[0], p[1] - b[1], p[2] - b[2]};
+  float d3 = dot(ab, bp);
+  float d4 = dot(ac, bp);
+  if(d3 >= 0.0f && d4 <= d3)
+  {
+    std::copy(b, b + 3, closest);
+    return;
+  }
+  float vc = d1 * d4 - d3 * d2;
+  if(vc <= 0.0f && d1 >= 0.0f && d3 <= 0.0f)
+  {
+    combine(d1 / (d1 - d3), 0.0f);
+    return;
+  }
+  float cp[3] = {p[0] - c[0], p[1] - c[1], p[2] - c[2]};
+  float d5 = dot(ab, cp);
+  float d6 = dot(ac, cp);
+  if(d6 >= 0.0f && d5 <= d6)
+  {
+    std::copy(c, c + 3, closest);
+    return;
+  }
+  float vb = d5 * d2 - d1 * d6;
+  if(vb <= 0.0f && d2 >= 0.0f && d6 <= 0.0f)
+  {
+    combine(0.0f, d2 / (d2 - d6));
+    return;
+  }
+  float va = d3 * d6 - d5 * d4;
+  if(va <= 0.0f && (d4 - d3) >= 0.0f && (d5 - d6) >= 0.0f)
+  {
+    float w = (d4 - d3) / ((d4 - d3) + (d5 - d6));
+    for(int i = 0; i < 3; i++)
+    {
+      closest[i] = b[i] + (c[i] - b[i]) * w;
+    }
+    return;
+  }
+  float denom = 1.0f / (va + vb + vc);
+  combine(vb * denom, vc * denom);
+}
+
+// -----------------------------------------------------------------------------
+// Moller-Trumbore ray/triangle intersection
+// -----------------------------------------------------------------------------
+bool IntersectTriangle(const float* tri, const float origin[3], const float dir[3], float& t)
+{
+  const float* a = tri;
+  float e1[3] = {tri[3] - a[0], tri[4] - a[1], tri[5] - a[2]};
+  float e2[3] = {tri[6] - a[0], tri[7] - a[1], tri[8] - a[2]};
+  float p[3] = {dir[1] * e2[2] - dir[2] * e2[1], dir[2] * e2[0] - dir[0] * e2[2], dir[0] * e2[1] - dir[1] * e2[0]};
+  float det = e1[0] * p[0] + e1[1] * p[1] + e1[2] * p[2];
+  if(det == 0.0f)
+  {
+    return false;
+  }
+  float invDet = 1.0f / det;
+  float s[3] = {origin[0] - a[0], origin[1] - a[1], origin[2] - a[2]};
+  float u = (s[0] * p[0] + s[1] * p[1] + s[2] * p[2]) * invDet;
+  if(u < 0.0f || u > 1.0f)
+  {
+    return false;
+  }
+  float q[3] = {s[1] * e1[2] - s[2] * e1[1], s[2] * e1[0] - s[0] * e1[2], s[0] * e1[1] - s[1] * e1[0]};
+  float v = (dir[0] * q[0] + dir[1] * q[1] + dir[2] * q[2]) * invDet;
+  if(v < 0.0f || u + v > 1.0f)
+  {
+    return false;
+  }
+  t = (e2[0] * q[0] + e2[1] * q[1] + e2[2] * q[2]) * invDet;
+  return t >= 0.0f;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool IntersectBox(const SurfaceBVH::Node& node, const float origin[3], const float dir[3], float maxT)
+{
+  float tMin = 0.0f;
+  float tMax = maxT;
+  for(int a = 0; a < 3; a++)
+  {
+    if(dir[a] == 0.0f)
+    {
+      if(origin[a] < node.minCoords[a] || origin[a] > node.maxCoords[a])
+      {
+        return false;
+      }
+      continue;
+    }
+    float t0 = (node.minCoords[a] - origin[a]) / dir[a];
+    float t1 = (node.maxCoords[a] - origin[a]) / dir[a];
+    if(t0 > t1)
+    {
+      std::swap(t0, t1);
+    }
+    tMin = std::max(tMin, t0);
+    tMax = std::min(tMax, t1);
+    if(tMin > tMax)
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+// Tie breaking order of the projected edge a -> b; reversing the edge always flips the result
+// -----------------------------------------------------------------------------
+inline bool EdgeOwnsTies(const float* a, const float* b)
+{
+  return std::tie(a[1], a[2], a[0]) < std::tie(b[1], b[2], b[0]);
+}
+
+// -----------------------------------------------------------------------------
+// Intersects the triangle with the line parallel to x through (y, z). The edge functions are computed so that
+// the triangles on both sides of an edge evaluate exactly opposite values, and points exactly on an edge are
+// given to one side only. A line through an edge or vertex is therefore counted once when it crosses the
+// surface and zero or two times when it grazes it, which keeps the crossing parity correct.
+// -----------------------------------------------------------------------------
+bool CrossTriangle(const float* tri, float y, float z, float& x)
+{
+  const float* v[3] = {tri, tri + 3, tri + 6};
+  double e[3];
+  int sign[3];
+  for(int i = 0; i < 3; i++)
+  {
+    const float* a = v[(i + 1) % 3];
+    const float* b = v[(i + 2) % 3];
+    double ay = static_cast<double>(a[1]) - y;
+    double az = static_cast<double>(a[2]) - z;
+    double by = static_cast<double>(b[1]) - y;
+    double bz = static_cast<double>(b[2]) - z;
+    e[i] = ay * bz - az * by;
+    sign[i] = e[i] > 0.0 ? 1 : (e[i] < 0.0 ? -1 : (EdgeOwnsTies(a, b) ? 1 : -1));
+  }
+  if(sign[0] != sign[1] || sign[1] != sign[2])
+  {
+    return false;
+  }
+  double area = e[0] + e[1] + e[2];
+  if(area == 0.0)
+  {
+    return false;
+  }
+  x = static_cast<float>((e[0] * v[0][0] + e[1] * v[1][0] + e[2] * v[2][0]) / area);
+  return true;
+}
+} // namespace
+
+/**
+ * @brief The SurfaceBVHBuilder class builds the nodes of a subtree. Splits always happen at the median, so the
+ * size of every subtree only depends on its number of triangles and the subtrees can be written in parallel at
+ * precomputed offsets.
+ */
+class SurfaceBVHBuilder
+{
+public:
+  SurfaceBVHBuilder(std::vector<SurfaceBVH::Node>& nodes, std::vector<size_t>& order, const std::vector<float>& triangles, const std::vector<float>& centroids, size_t leafSize)
+  : m_Nodes(nodes)
+  , m_Order(order)
+  , m_Triangles(triangles)
+  , m_Centroids(centroids)
+  , m_LeafSize(leafSize)
+  {
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  size_t countNodes(size_t numTriangles)
+  {
+    // Only two distinct subtree sizes appear at each depth, so the counts are tabulated bottom up
+    m_Sizes.clear();
+    std::vector<size_t> level(1, numTriangles);
+    while(!level.empty())
+    {
+      std::vector<size_t> next;
+      for(size_t size : level)
+      {
+        m_Sizes.push_back(size);
+        if(size > m_LeafSize)
+        {
+          next.push_back(size / 2);
+          next.push_back(size - size / 2);
+        }
+      }
+      std::sort(next.begin(), next.end());
+      next.erase(std::unique(next.begin(), next.end()), next.end());
+      level.swap(next);
+    }
+    std::sort(m_Sizes.begin(), m_Sizes.end());
+    m_Sizes.erase(std::unique(m_Sizes.begin(), m_Sizes.end()), m_Sizes.end());
+    m_Counts.resize(m_Sizes.size());
+    for(size_t i = 0; i < m_Sizes.size(); i++)
+    {
+      size_t size = m_Sizes[i];
+      m_Counts[i] = size > m_LeafSize ? 1 + nodesForSize(size / 2) + nodesForSize(size - size / 2) : 1;
+    }
+    return nodesForSize(numTriangles);
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void buildNode(size_t node, size_t begin, size_t end)
+  {
+    SurfaceBVH::Node& n = m_Nodes[node];
+    float centroidMin[3] = {std::numeric_limits<float>::max(), std::numeric_limits<float>::max(), std::numeric_limits<float>::max()};
+    float centroidMax[3] = {std::numeric_limits<float>::lowest(), std::numeric_limits<float>::lowest(), std::numeric_limits<float>::lowest()};
+    for(int a = 0; a < 3; a++)
+    {
+      n.minCoords[a] = std::numeric_limits<float>::max();
+      n.maxCoords[a] = std::numeric_limits<float>::lowest();
+    }
+    for(size_t i = begin; i < end; i++)
+    {
+      const float* tri = m_Triangles.data() + 9 * m_Order[i];
+      const float* centroid = m_Centroids.data() + 3 * m_Order[i];
+      for(int a = 0; a < 3; a++)
+      {
+        n.minCoords[a] = std::min(std::min(n.minCoords[a], tri[a]), std::min(tri[3 + a], tri[6 + a]));
+        n.maxCoords[a] = std::max(std::max(n.maxCoords[a], tri[a]), std::max(tri[3 + a], tri[6 + a]));
+        centroidMin[a] = std::min(centroidMin[a], centroid[a]);
+        centroidMax[a] = std::max(centroidMax[a], centroid[a]);
+      }
+    }
+
+    size_t count = end - begin;
+    if(count <= m_LeafSize)
+    {
+      n.offset = static_cast<uint32_t>(begin);
+      n.count = static_cast<uint32_t>(count);
+      return;
+    }
+
+    // Split at the median centroid along the longest side of the centroid bounds
+    int axis = 0;
+    for(int a = 1; a < 3; a++)
+    {
+      if(centroidMax[a] - centroidMin[a] > centroidMax[axis] - centroidMin[axis])
+      {
+        axis = a;
+      }
+    }
+    size_t mid = begin + count / 2;
+    const float* centroids = m_Centroids.data();
+    std::nth_element(m_Order.begin() + begin, m_Order.begin() + mid, m_Order.begin() + end,
+                     [centroids, axis](size_t lhs, size_t rhs) { return centroids[3 * lhs + axis] < centroids[3 * rhs + axis]; });
+
+    size_t left = node + 1;
+    size_t right = left + nodesForSize(mid - begin);
+    n.offset = static_cast<uint32_t>(right);
+    n.count = 0;
+
+    auto buildLeft = [&]() { buildNode(left, begin, mid); };
+    auto buildRight = [&]() { buildNode(right, mid, end); };
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+    if(count > k_ParallelBuildSize)
+    {
+      tbb::parallel_invoke(buildLeft, buildRight);
+      return;
+    }
+#endif
+    buildLeft();
+    buildRight();
+  }
+
+private:
+  std::vector<SurfaceBVH::Node>& m_Nodes;
+  std::vector<size_t>& m_Order;
+  const std::vector<float>& m_Triangles;
+  const std::vector<float>& m_Centroids;
+  size_t m_LeafSize;
+  std::vector<size_t> m_Sizes;
+  std::vector<size_t> m_Counts;
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  size_t nodesForSize(size_t size) const
+  {
+    return m_Counts[std::lower_bound(m_Sizes.begin(), m_Sizes.end(), size) - m_Sizes.begin()];
+  }
+};
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+const size_t SurfaceBVH::k_MaxIndex = std::numeric_limits<uint32_t>::max();
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+SurfaceBVH::SurfaceBVH() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+SurfaceBVH::~SurfaceBVH() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+SurfaceBVH::Pointer SurfaceBVH::New(const FloatArrayType::Pointer& vertices, const Int64ArrayType::Pointer& faces, size_t leafSize)
+{
+  Pointer sharedPtr(new SurfaceBVH());
+  if(!sharedPtr->build(vertices, faces, std::max<size_t>(leafSize, 1)))
+  {
+    return NullPointer();
+  }
+  return sharedPtr;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool SurfaceBVH::build(const FloatArrayType::Pointer& vertices, const Int64ArrayType::Pointer& faces, size_t leafSize)
+{
+  if(nullptr == vertices.get() || nullptr == faces.get() || vertices->getNumberOfComponents() != 3 || faces->getNumberOfComponents() < 3)
+  {
+    return true;
+  }
+  m_NumFaces = faces->getNumberOfTuples();
+  size_t vertsPerFace = static_cast<size_t>(faces->getNumberOfComponents());
+  size_t trisPerFace = vertsPerFace - 2;
+  size_t numTris = m_NumFaces * trisPerFace;
+  if(numTris == 0)
+  {
+    return true;
+  }
+
+  // Node offsets are 32 bit, so refuse surfaces whose triangles or nodes they cannot address
+  std::vector<float> triangles;
+  std::vector<float> centroids;
+  std::vector<size_t> order;
+  SurfaceBVHBuilder builder(m_Nodes, order, triangles, centroids, leafSize);
+  size_t numNodes = builder.countNodes(numTris);
+  if(numTris > k_MaxIndex || numNodes > k_MaxIndex)
+  {
+    m_NumFaces = 0;
+    return false;
+  }
+
+  // Fan triangulate the faces and gather their coordinates
+  triangles.resize(9 * numTris);
+  centroids.resize(3 * numTris);
+  const float* coords = vertices->getConstPointer(0);
+  const int64_t* faceVerts = faces->getConstPointer(0);
+  ForEachRange(numTris, 4096, [&](size_t start, size_t end) {
+    for(size_t t = start; t < end; t++)
+    {
+      const int64_t* face = faceVerts + vertsPerFace * (t / trisPerFace);
+      size_t fan = t % trisPerFace;
+      int64_t ids[3] = {face[0], face[fan + 1], face[fan + 2]};
+      for(size_t v = 0; v < 3; v++)
+      {
+        std::copy(coords + 3 * ids[v], coords + 3 * ids[v] + 3, triangles.data() + 9 * t + 3 * v);
+      }
+      for(size_t a = 0; a < 3; a++)
+      {
+        centroids[3 * t + a] = (triangles[9 * t + a] + triangles[9 * t + 3 + a] + triangles[9 * t + 6 + a]) / 3.0f;
+      }
+    }
+  });
+
+  order.resize(numTris);
+  for(size_t t = 0; t < numTris; t++)
+  {
+    order[t] = t;
+  }
+  m_Nodes.resize(numNodes);
+  builder.buildNode(0, 0, numTris);
+
+  // Store the triangles in leaf order
+  m_Triangles.resize(9 * numTris);
+  m_TriangleFaces.resize(numTris);
+  ForEachRange(numTris, 4096, [&](size_t start, size_t end) {
+    for(size_t i = start; i < end; i++)
+    {
+      std::copy(triangles.data() + 9 * order[i], triangles.data() + 9 * order[i] + 9, m_Triangles.data() + 9 * i);
+      m_TriangleFaces[i] = static_cast<int64_t>(order[i] / trisPerFace);
+    }
+  });
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t SurfaceBVH::getNumberOfFaces() const
+{
+  return m_NumFaces;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t SurfaceBVH::getNumberOfTriangles() const
+{
+  return m_TriangleFaces.size();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+const std::vector<SurfaceBVH::Node>& SurfaceBVH::getNodes() const
+{
+  return m_Nodes;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int64_t SurfaceBVH::findClosestPoint(const float coords[3], float closest[3], float& distanceSquared) const
+{
+  int64_t bestFace = -1;
+  distanceSquared = std::numeric_limits<float>::max();
+  if(m_Nodes.empty())
+  {
+    return bestFace;
+  }
+
+  std::vector<uint32_t> stack(1, 0);
+  float candidate[3];
+  while(!stack.empty())
+  {
+    const Node& node = m_Nodes[stack.back()];
+    stack.pop_back();
+    if(SquaredDistanceToBox(node, coords) > distanceSquared)
+    {
+      continue;
+    }
+    if(node.count > 0)
+    {
+      for(uint32_t i = node.offset; i < node.offset + node.count; i++)
+      {
+        ClosestPointOnTriangle(m_Triangles.data() + 9 * i, coords, candidate);
+        float dx = candidate[0] - coords[0];
+        float dy = candidate[1] - coords[1];
+        float dz = candidate[2] - coords[2];
+        float d = dx * dx + dy * dy + dz * dz;
+        if(d < distanceSquared || (d == distanceSquared && m_TriangleFaces[i] < bestFace))
+        {
+          distanceSquared = d;
+          bestFace = m_TriangleFaces[i];
+          std::copy(candidate, candidate + 3, closest);
+        }
+      }
+      continue;
+    }
+    // Descend into the nearer child first
+    uint32_t left = static_cast<uint32_t>(&node - m_Nodes.data()) + 1;
+    uint32_t right = node.offset;
+    if(SquaredDistanceToBox(m_Nodes[left], coords) <= SquaredDistanceToBox(m_Nodes[right], coords))
+    {
+      stack.push_back(right);
+      stack.push_back(left);
+    }
+    else
+    {
+      stack.push_back(left);
+      stack.push_back(right);
+    }
+  }
+  return bestFace;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int64_t SurfaceBVH::intersectRay(const float origin[3], const float direction[3], float& distance) const
+{
+  int64_t bestFace = -1;
+  distance = std::numeric_limits<float>::max();
+  if(m_Nodes.empty())
+  {
+    return bestFace;
+  }
+
+  std::vector<uint32_t> stack(1, 0);
+  float t = 0.0f;
+  while(!stack.empty())
+  {
+    uint32_t index = stack.back();
+    stack.pop_back();
+    const Node& node = m_Nodes[index];
+    if(!IntersectBox(node, origin, direction, distance))
+    {
+      continue;
+    }
+    if(node.count > 0)
+    {
+      for(uint32_t i = node.offset; i < node.offset + node.count; i++)
+      {
+        if(IntersectTriangle(m_Triangles.data() + 9 * i, origin, direction, t) && (t < distance || (t == distance && m_TriangleFaces[i] < bestFace)))
+        {
+          distance = t;
+          bestFace = m_TriangleFaces[i];
+        }
+      }
+      continue;
+    }
+    stack.push_back(node.offset);
+    stack.push_back(index + 1);
+  }
+  return bestFace;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void SurfaceBVH::findCrossings(float y, float z, float minX, std::vector<float>& crossings) const
+{
+  crossings.clear();
+  if(m_Nodes.empty())
+  {
+    return;
+  }
+  std::vector<uint32_t> stack(1, 0);
+  float x = 0.0f;
+  while(!stack.empty())
+  {
+    uint32_t index = stack.back();
+    stack.pop_back();
+    const Node& node = m_Nodes[index];
+    if(y < node.minCoords[1] || y > node.maxCoords[1] || z < node.minCoords[2] || z > node.maxCoords[2] || minX > node.maxCoords[0])
+    {
+      continue;
+    }
+    if(node.count > 0)
+    {
+      for(uint32_t i = node.offset; i < node.offset + node.count; i++)
+      {
+        if(CrossTriangle(m_Triangles.data() + 9 * i, y, z, x) && x > minX)
+        {
+          crossings.push_back(x);
+        }
+      }
+      continue;
+    }
+    stack.push_back(node.offset);
+    stack.push_back(index + 1);
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool SurfaceBVH::isInside(const float coords[3]) const
+{
+  std::vector<float> crossings;
+  findCrossings(coords[1], coords[2], coords[0], crossings);
+  return (crossings.size() % 2) == 1;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool SurfaceBVH::findClosestPoints(const FloatArrayType::Pointer& points, const Int64ArrayType::Pointer& faceIds, const FloatArrayType::Pointer& closestPoints) const
+{
+  if(nullptr == points.get() || nullptr == faceIds.get() || points->getNumberOfComponents() != 3 || faceIds->getNumberOfTuples() != points->getNumberOfTuples())
+  {
+    return false;
+  }
+  if(nullptr != closestPoints.get() && (closestPoints->getNumberOfComponents() != 3 || closestPoints->getNumberOfTuples() != points->getNumberOfTuples()))
+  {
+    return false;
+  }
+  size_t numPoints = points->getNumberOfTuples();
+  if(numPoints == 0)
+  {
+    return true;
+  }
+  const float* coords = points->getConstPointer(0);
+  int64_t* faces = faceIds->getPointer(0);
+  float* closest = nullptr == closestPoints.get() ? nullptr : closestPoints->getPointer(0);
+  ForEachRange(numPoints, 256, [&](size_t start, size_t end) {
+    float point[3];
+    float distanceSquared = 0.0f;
+    for(size_t i = start; i < end; i++)
+    {
+      faces[i] = findClosestPoint(coords + 3 * i, point, distanceSquared);
+      if(nullptr != closest)
+      {
+        std::copy(point, point + 3, closest + 3 * i);
+      }
+    }
+  });
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool SurfaceBVH::intersectRays(const FloatArrayType::Pointer& origins, const FloatArrayType::Pointer& directions, const Int64ArrayType::Pointer& faceIds, const FloatArrayType::Pointer& distances) const
+{
+  if(nullptr == origins.get() || nullptr == directions.get() || nullptr == faceIds.get() || origins->getNumberOfComponents() != 3 || directions->getNumberOfComponents() != 3)
+  {
+    return false;
+  }
+  size_t numRays = origins->getNumberOfTuples();
+  if(directions->getNumberOfTuples() != numRays || faceIds->getNumberOfTuples() != numRays || (nullptr != distances.get() && distances->getNumberOfTuples() != numRays))
+  {
+    return false;
+  }
+  if(numRays == 0)
+  {
+    return true;
+  }
+  const float* o = origins->getConstPointer(0);
+  const float* d = directions->getConstPointer(0);
+  int64_t* faces = faceIds->getPointer(0);
+  float* hits = nullptr == distances.get() ? nullptr : distances->getPointer(0);
+  ForEachRange(numRays, 256, [&](size_t start, size_t end) {
+    float t = 0.0f;
+    for(size_t i = start; i < end; i++)
+    {
+      faces[i] = intersectRay(o + 3 * i, d + 3 * i, t);
+      if(nullptr != hits)
+      {
+        hits[i] = faces[i] < 0 ? std::numeric_limits<float>::infinity() : t;
+      }
+    }
+  });
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool SurfaceBVH::findInsideCells(const ImageGeom::Pointer& image, const BoolArrayType::Pointer& inside) const
+{
+  if(nullptr == image.get() || nullptr == inside.get())
+  {
+    return false;
+  }
+  size_t dims[3] = {image->getXPoints(), image->getYPoints(), image->getZPoints()};
+  size_t numCells = dims[0] * dims[1] * dims[2];
+  if(inside->getNumberOfTuples() != numCells)
+  {
+    return false;
+  }
+  if(numCells == 0)
+  {
+    return true;
+  }
+
+  std::vector<float> xCenters(dims[0]);
+  float center[3] = {0.0f, 0.0f, 0.0f};
+  for(size_t x = 0; x < dims[0]; x++)
+  {
+    image->getCoords(x, 0, 0, center);
+    xCenters[x] = center[0];
+  }
+
+  // One traversal finds every crossing along a row, the cells between alternate crossings are inside
+  bool* cells = inside->getPointer(0);
+  ForEachRange(dims[1] * dims[2], 1, [&](size_t start, size_t end) {
+    std::vector<float> crossings;
+    float rowCenter[3] = {0.0f, 0.0f, 0.0f};
+    for(size_t row = start; row < end; row++)
+    {
+      image->getCoords(0, row % dims[1], row / dims[1], rowCenter);
+      findCrossings(rowCenter[1], rowCenter[2], std::numeric_limits<float>::lowest(), crossings);
+      std::sort(crossings.begin(), crossings.end());
+      size_t passed = 0;
+      bool* rowCells = cells + row * dims[0];
+      for(size_t x = 0; x < dims[0]; x++)
+      {
+        while(passed < crossings.size() && crossings[passed] < xCenters[x])
+        {
+          passed++;
+        }
+        rowCells[x] = (passed % 2) == 1;
+      }
+    }
+  });
+  return true;
+}
@@ -0,0 +1,175 @@
+/* ============================================================================
+* Copyright (c) 2009-2015 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-07-D-5800
+*    United States Air Force Prime Contract FA8650-10-D-5210
+*    United States Prime Contract Navy N00173-07-C-2068
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "SIMPLib/Common/SIMPLibSetGetMacros.h"
+#include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/Geometry/ImageGeom.h"
+#include "SIMPLib/SIMPLib.h"
+
+/**
+ * @brief The SurfaceBVH class is a bounding volume hierarchy over the faces of a triangle or quad surface
+ * mesh. Faces with more than 3 vertices are split into a fan of triangles; query results always refer to the
+ * original face index. The tree is stored depth first as an array of 32 byte nodes, with the triangle
+ * coordinates copied next to each other in leaf order so traversals do not touch the shared vertex list.
+ *
+ * The hierarchy keeps no reference to the geometry arrays and must be rebuilt when they change. Surface
+ * geometries cache one through IGeometry2D::findBoundingVolumeHierarchy().
+ */
+class SIMPLib_EXPORT SurfaceBVH
+{
+public:
+  SIMPL_SHARED_POINTERS(SurfaceBVH)
+
+  struct Node
+  {
+    float minCoords[3];
+    float maxCoords[3];
+    uint32_t offset; // Leaf: first triangle. Interior: index of the second child, the first child follows the node
+    uint32_t count;  // Number of triangles in a leaf, 0 for interior nodes
+  };
+
+  /**
+   * @brief The largest number of triangles or nodes the 32 bit node fields can address
+   */
+  static const size_t k_MaxIndex;
+
+  /**
+   * @brief New Builds the hierarchy in parallel
+   * @param vertices Shared vertex list
+   * @param faces Face list with 3 or more vertex indices per face
+   * @param leafSize Maximum number of triangles stored in a leaf
+   * @return Null Pointer if the surface needs more than k_MaxIndex triangles or nodes
+   */
+  static Pointer New(const FloatArrayType::Pointer& vertices, const Int64ArrayType::Pointer& faces, size_t leafSize = 4);
+
+  virtual ~SurfaceBVH();
+
+  /**
+   * @brief getNumberOfFaces
+   * @return
+   */
+  size_t getNumberOfFaces() const;
+
+  /**
+   * @brief getNumberOfTriangles
+   * @return
+   */
+  size_t getNumberOfTriangles() const;
+
+  /**
+   * @brief getNodes
+   * @return
+   */
+  const std::vector<Node>& getNodes() const;
+
+  /**
+   * @brief findClosestPoint Finds the point of the surface closest to coords
+   * @param coords
+   * @param closest Closest point on the surface
+   * @param distanceSquared Squared distance between coords and closest
+   * @return The face containing the closest point or -1 if the surface is empty. Ties go to the smaller face index.
+   */
+  int64_t findClosestPoint(const float coords[3], float closest[3], float& distanceSquared) const;
+
+  /**
+   * @brief intersectRay Finds the first face hit by the ray origin + t * direction, t >= 0
+   * @param origin
+   * @param direction Does not need to be normalized
+   * @param distance Ray parameter t of the hit
+   * @return The face hit or -1 if the ray misses the surface
+   */
+  int64_t intersectRay(const float origin[3], const float direction[3], float& distance) const;
+
+  /**
+   * @brief isInside Classifies coords against a closed surface by counting the faces crossed by a ray along +x.
+   * Crossings through shared edges and vertices are counted exactly once, so the result does not depend on
+   * where the ray hits the mesh. The result is meaningless for surfaces that are not closed.
+   * @param coords
+   * @return
+   */
+  bool isInside(const float coords[3]) const;
+
+  /**
+   * @brief findClosestPoints Batched, parallel version of findClosestPoint
+   * @param points Query points with 3 components
+   * @param faceIds Filled with the closest face of each point, same number of tuples as points
+   * @param closestPoints Filled with the closest points if not null, 3 components
+   * @return false if the array sizes do not match
+   */
+  bool findClosestPoints(const FloatArrayType::Pointer& points, const Int64ArrayType::Pointer& faceIds, const FloatArrayType::Pointer& closestPoints) const;
+
+  /**
+   * @brief intersectRays Batched, parallel version of intersectRay
+   * @param origins Ray origins with 3 components
+   * @param directions Ray directions with 3 components
+   * @param faceIds Filled with the face hit by each ray or -1
+   * @param distances Filled with the ray parameter of each hit if not null
+   * @return false if the array sizes do not match
+   */
+  bool intersectRays(const FloatArrayType::Pointer& origins, const FloatArrayType::Pointer& directions, const Int64ArrayType::Pointer& faceIds, const FloatArrayType::Pointer& distances) const;
+
+  /**
+   * @brief findInsideCells Classifies every cell centre of an image against a closed surface. Each row of cells
+   * along x is resolved with a single traversal, rows are processed in parallel.
+   * @param image
+   * @param inside Filled with true for the cells inside the surface, one tuple per cell
+   * @return false if inside does not have one tuple per cell
+   */
+  bool findInsideCells(const ImageGeom::Pointer& image, const BoolArrayType::Pointer& inside) const;
+
+protected:
+  SurfaceBVH();
+
+private:
+  size_t m_NumFaces = 0;
+  std::vector<Node> m_Nodes;
+  std::vector<float> m_Triangles;
+  std::vector<int64_t> m_TriangleFaces;
+
+  bool build(const FloatArrayType::Pointer& vertices, const Int64ArrayType::Pointer& faces, size_t leafSize);
+  void findCrossings(float y, float z, float minX, std::vector<float>& crossings) const;
+
+public:
+  SurfaceBVH(const SurfaceBVH&) = delete;            // Copy Constructor Not Implemented
+  SurfaceBVH(SurfaceBVH&&) = delete;                 // Move Constructor Not Implemented
+  SurfaceBVH& operator=(const SurfaceBVH&) = delete; // Copy Assignment Not Implemented
+  SurfaceBVH& operator=(SurfaceBVH&&) = delete;      // Move Assignment Not Implemented
+};
@@ -0,0 +1,271 @@
+#include <stdlib.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+
+#include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/DataArrays/DynamicListArray.hpp"
+#include "SIMPLib/Geometry/GeometryHelpers.h"
+
+#include "SIMPLib/Testing/SIMPLTestFileLocations.h"
+#include "SIMPLib/Testing/UnitTestSupport.hpp"
+
+class GeometryHelpersTest
+{
+public:
+  GeometryHelpersTest() = default;
+
+  virtual ~GeometryHelpersTest() = default;
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  template <typename T> void CheckSorted(typename DataArray<T>::Pointer list)
+  {
+    size_t numTuples = list->getNumberOfTuples();
+    size_t numComps = list->getNumberOfComponents();
+    for(size_t i = 0; i < numTuples; i++)
+    {
+      T* tuple = list->getTuplePointer(i);
+      for(size_t c = 1; c < numComps; c++)
+      {
+        DREAM3D_REQUIRE(tuple[c - 1] < tuple[c])
+      }
+      if(i > 0)
+      {
+        T* prev = list->getTuplePointer(i - 1);
+        DREAM3D_REQUIRE(std::lexicographical_compare(prev, prev + numComps, tuple, tuple + numComps))
+      }
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  template <typename T> void TestTriangleEdgesForType(T offset)
+  {
+    // Two triangles sharing the edge (1, 2)
+    typename DataArray<T>::Pointer tris = DataArray<T>::CreateArray(2, QVector<size_t>(1, 3), "Triangles", true);
+    T verts[6] = {0, 1, 2, 2, 1, 3};
+    for(size_t i = 0; i < 6; i++)
+    {
+      tris->setValue(i, verts[i] + offset);
+    }
+
+    typename DataArray<T>::Pointer edges = DataArray<T>::CreateArray(0, QVector<size_t>(1, 2), "Edges", true);
+    GeometryHelpers::Connectivity::Find2DElementEdges<T>(tris, edges);
+    DREAM3D_REQUIRE_EQUAL(edges->getNumberOfTuples(), 5)
+    CheckSorted<T>(edges);
+    DREAM3D_REQUIRE_EQUAL(edges->getValue(0), offset)
+    DREAM3D_REQUIRE_EQUAL(edges->getValue(1), offset + 1)
+
+    GeometryHelpers::Connectivity::Find2DUnsharedEdges<T>(tris, edges);
+    DREAM3D_REQUIRE_EQUAL(edges->getNumberOfTuples(), 4)
+    CheckSorted<T>(edges);
+    for(size_t i = 0; i < edges->getNumberOfTuples(); i++)
+    {
+      bool shared = (edges->getComponent(i, 0) == offset + 1 && edges->getComponent(i, 1) == offset + 2);
+      DREAM3D_REQUIRE_EQUAL(shared, false)
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestTriangleEdges()
+  {
+    TestTriangleEdgesForType<int32_t>(0);
+    TestTriangleEdgesForType<int64_t>(0);
+    // Vertex ids that do not fit in 32 bits take the unpacked path
+    TestTriangleEdgesForType<int64_t>(static_cast<int64_t>(1) << 40);
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestHexEdgesAndFaces()
+  {
+    // Two unit hexahedra sharing the face x = 1 on a 3 x 2 x 2 vertex grid
+    Int64ArrayType::Pointer hexes = Int64ArrayType::CreateArray(2, QVector<size_t>(1, 8), "Hexahedra", true);
+    for(int64_t h = 0; h < 2; h++)
+    {
+      int64_t* verts = hexes->getTuplePointer(h);
+      for(int64_t z = 0; z < 2; z++)
+      {
+        verts[4 * z + 0] = z * 6 + h;
+        verts[4 * z + 1] = z * 6 + h + 1;
+        verts[4 * z + 2] = z * 6 + h + 4;
+        verts[4 * z + 3] = z * 6 + h + 3;
+      }
+    }
+
+    Int64ArrayType::Pointer edges = Int64ArrayType::CreateArray(0, QVector<size_t>(1, 2), "Edges", true);
+    GeometryHelpers::Connectivity::FindHexEdges<int64_t>(hexes, edges);
+    DREAM3D_REQUIRE_EQUAL(edges->getNumberOfTuples(), 20)
+    CheckSorted<int64_t>(edges);
+
+    GeometryHelpers::Connectivity::FindUnsharedHexEdges<int64_t>(hexes, edges);
+    DREAM3D_REQUIRE_EQUAL(edges->getNumberOfTuples(), 16)
+    CheckSorted<int64_t>(edges);
+
+    Int64ArrayType::Pointer faces = Int64ArrayType::CreateArray(0, QVector<size_t>(1, 4), "Faces", true);
+    GeometryHelpers::Connectivity::FindHexFaces<int64_t>(hexes, faces);
+    DREAM3D_REQUIRE_EQUAL(faces->getNumberOfTuples(), 11)
+    CheckSorted<int64_t>(faces);
+
+    GeometryHelpers::Connectivity::FindUnsharedHexFaces<int64_t>(hexes, faces);
+    DREAM3D_REQUIRE_EQUAL(faces->getNumberOfTuples(), 10)
+    CheckSorted<int64_t>(faces);
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestTetEdgesAndFaces()
+  {
+    // Two tetrahedra sharing the face (1, 2, 3)
+    Int64ArrayType::Pointer tets = Int64ArrayType::CreateArray(2, QVector<size_t>(1, 4), "Tetrahedra", true);
+    int64_t verts[8] = {0, 1, 2, 3, 4, 3, 2, 1};
+    for(size_t i = 0; i < 8; i++)
+    {
+      tets->setValue(i, verts[i]);
+    }
+
+    Int64ArrayType::Pointer edges = Int64ArrayType::CreateArray(0, QVector<size_t>(1, 2), "Edges", true);
+    GeometryHelpers::Connectivity::FindTetEdges<int64_t>(tets, edges);
+    DREAM3D_REQUIRE_EQUAL(edges->getNumberOfTuples(), 9)
+    CheckSorted<int64_t>(edges);
+
+    GeometryHelpers::Connectivity::FindUnsharedTetEdges<int64_t>(tets, edges);
+    DREAM3D_REQUIRE_EQUAL(edges->getNumberOfTuples(), 6)
+
+    Int64ArrayType::Pointer faces = Int64ArrayType::CreateArray(0, QVector<size_t>(1, 3), "Faces", true);
+    GeometryHelpers::Connectivity::FindTetFaces<int64_t>(tets, faces);
+    DREAM3D_REQUIRE_EQUAL(faces->getNumberOfTuples(), 7)
+    CheckSorted<int64_t>(faces);
+
+    GeometryHelpers::Connectivity::FindUnsharedTetFaces<int64_t>(tets, faces);
+    DREAM3D_REQUIRE_EQUAL(faces->getNumberOfTuples(), 6)
+    CheckSorted<int64_t>(faces);
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestElementsContainingVert()
+  {
+    // A strip of quads sharing edges; vertex 2i and 2i+1 belong to quads i - 1 and i
+    const size_t numQuads = 1000;
+    const size_t numVerts = 2 * (numQuads + 1) + 1; // The last vertex is unused
+    Int64ArrayType::Pointer quads = Int64ArrayType::CreateArray(numQuads, QVector<size_t>(1, 4), "Quads", true);
+    for(size_t i = 0; i < numQuads; i++)
+    {
+      int64_t* verts = quads->getTuplePointer(i);
+      verts[0] = 2 * i;
+      verts[1] = 2 * i + 2;
+      verts[2] = 2 * i + 3;
+      verts[3] = 2 * i + 1;
+    }
+
+    UInt16Int64DynamicListArray::Pointer links = UInt16Int64DynamicListArray::New();
+    GeometryHelpers::Connectivity::FindElementsContainingVert<uint16_t, int64_t>(quads, links, numVerts);
+    DREAM3D_REQUIRE_EQUAL(links->size(), numVerts)
+    DREAM3D_REQUIRE_EQUAL(links->getNumberOfElements(numVerts - 1), 0)
+    for(size_t v = 0; v < numVerts - 1; v++)
+    {
+      size_t quad = v / 2;
+      uint16_t expected = (quad == 0 || quad == numQuads) ? 1 : 2;
+      DREAM3D_REQUIRE_EQUAL(links->getNumberOfElements(v), expected)
+      int64_t* cells = links->getElementListPointer(v);
+      // Lists are in ascending element order
+      if(expected == 2)
+      {
+        DREAM3D_REQUIRE_EQUAL(cells[0], static_cast<int64_t>(quad - 1))
+        DREAM3D_REQUIRE_EQUAL(cells[1], static_cast<int64_t>(quad))
+      }
+    }
+
+    UInt16Int64DynamicListArray::Pointer copy = links->deepCopy();
+    DREAM3D_REQUIRE_EQUAL(copy->size(), numVerts)
+    for(size_t v = 0; v < numVerts; v++)
+    {
+      DREAM3D_REQUIRE_EQUAL(copy->getNumberOfElements(v), links->getNumberOfElements(v))
+      for(uint16_t c = 0; c < links->getNumberOfElements(v); c++)
+      {
+        DREAM3D_REQUIRE_EQUAL(copy->getElementListPointer(v)[c], links->getElementListPointer(v)[c])
+      }
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestElementNeighbors()
+  {
+    // A 20 x 20 x 20 block of hexahedra; interior cells have 6 face neighbors
+    const int64_t n = 20;
+    auto vertId = [n](int64_t x, int64_t y, int64_t z) { return (z * (n + 1) + y) * (n + 1) + x; };
+    Int64ArrayType::Pointer hexes = Int64ArrayType::CreateArray(n * n * n, QVector<size_t>(1, 8), "Hexahedra", true);
+    for(int64_t z = 0; z < n; z++)
+    {
+      for(int64_t y = 0; y < n; y++)
+      {
+        for(int64_t x = 0; x < n; x++)
+        {
+          int64_t* verts = hexes->getTuplePointer((z * n + y) * n + x);
+          int64_t hex[8] = {vertId(x, y, z),     vertId(x + 1, y, z),     vertId(x + 1, y + 1, z),     vertId(x, y + 1, z),
+                            vertId(x, y, z + 1), vertId(x + 1, y, z + 1), vertId(x + 1, y + 1, z + 1), vertId(x, y + 1, z + 1)};
+          std::copy(hex, hex + 8, verts);
+        }
+      }
+    }
+
+    UInt16Int64DynamicListArray::Pointer links = UInt16Int64DynamicListArray::New();
+    GeometryHelpers::Connectivity::FindElementsContainingVert<uint16_t, int64_t>(hexes, links, (n + 1) * (n + 1) * (n + 1));
+    UInt16Int64DynamicListArray::Pointer neighbors = UInt16Int64DynamicListArray::New();
+    int err = GeometryHelpers::Connectivity::FindElementNeighbors<uint16_t, int64_t>(hexes, links, neighbors, IGeometry::Type::Hexahedral);
+    DREAM3D_REQUIRE_EQUAL(err, 0)
+    DREAM3D_REQUIRE_EQUAL(neighbors->size(), n * n * n)
+    DREAM3D_REQUIRE_EQUAL(neighbors->getNumberOfValues(), 6 * n * n * n - 6 * n * n)
+
+    for(int64_t z = 0; z < n; z++)
+    {
+      for(int64_t y = 0; y < n; y++)
+      {
+        for(int64_t x = 0; x < n; x++)
+        {
+          int64_t cell = (z * n + y) * n + x;
+          uint16_t expected = 6;
+          expected -= (x == 0) + (x == n - 1) + (y == 0) + (y == n - 1) + (z == 0) + (z == n - 1);
+          DREAM3D_REQUIRE_EQUAL(neighbors->getNumberOfElements(cell), expected)
+          int64_t* cells = neighbors->getElementListPointer(cell);
+          for(uint16_t i = 0; i < expected; i++)
+          {
+            int64_t d = std::abs(cells[i] - cell);
+            DREAM3D_REQUIRE(d == 1 || d == n || d == n * n)
+          }
+        }
+      }
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void operator()()
+  {
+    std::cout << "#### GeometryHelpersTest Starting ####" << std::endl;
+    int err = EXIT_SUCCESS;
+
+    DREAM3D_REGISTER_TEST(TestTriangleEdges());
+    DREAM3D_REGISTER_TEST(TestHexEdgesAndFaces());
+    DREAM3D_REGISTER_TEST(TestTetEdgesAndFaces());
+    DREAM3D_REGISTER_TEST(TestElementsContainingVert());
+    DREAM3D_REGISTER_TEST(TestElementNeighbors());
+  }
+
+private:
+  GeometryHelpersTest(const GeometryHelpersTest&) = delete; // Copy Constructor Not Implemented
+  void operator=(const GeometryHelpersTest&) = delete;      // Move assignment Not Implemented
+};
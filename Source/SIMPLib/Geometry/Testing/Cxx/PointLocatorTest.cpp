@@ -0,0 +1,224 @@
+#include <stdlib.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/Geometry/PointLocator.h"
+#include "SIMPLib/Geometry/VertexGeom.h"
+
+#include "SIMPLib/Testing/SIMPLTestFileLocations.h"
+#include "SIMPLib/Testing/UnitTestSupport.hpp"
+
+class PointLocatorTest
+{
+public:
+  PointLocatorTest() = default;
+
+  virtual ~PointLocatorTest() = default;
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  FloatArrayType::Pointer CreatePoints(size_t numPoints, bool clustered)
+  {
+    FloatArrayType::Pointer points = FloatArrayType::CreateArray(numPoints, QVector<size_t>(1, 3), "Points", true);
+    std::mt19937 generator(static_cast<std::mt19937::result_type>(numPoints));
+    std::uniform_real_distribution<float> uniform(-10.0f, 10.0f);
+    std::normal_distribution<float> normal(0.0f, 0.5f);
+    for(size_t i = 0; i < numPoints; i++)
+    {
+      float* p = points->getTuplePointer(i);
+      for(size_t c = 0; c < 3; c++)
+      {
+        // Clustered points pile up around a few centers and repeat some coordinates exactly
+        p[c] = clustered ? std::round(uniform(generator) / 5.0f) * 5.0f + std::round(normal(generator) * 8.0f) / 8.0f : uniform(generator);
+      }
+    }
+    return points;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  float SquaredDistance(const float* p, const float* q)
+  {
+    float dx = p[0] - q[0];
+    float dy = p[1] - q[1];
+    float dz = p[2] - q[2];
+    return dx * dx + dy * dy + dz * dz;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void CheckLocator(IPointLocator::Pointer locator, FloatArrayType::Pointer points)
+  {
+    size_t numPoints = points->getNumberOfTuples();
+    DREAM3D_REQUIRE_EQUAL(locator->getNumberOfPoints(), numPoints)
+    std::mt19937 generator(5489u);
+    std::uniform_real_distribution<float> uniform(-12.0f, 12.0f);
+    std::uniform_real_distribution<float> extent(0.0f, 6.0f);
+    std::vector<int64_t> found;
+    std::vector<int64_t> expected;
+
+    for(int q = 0; q < 200; q++)
+    {
+      float center[3] = {uniform(generator), uniform(generator), uniform(generator)};
+      // Query around existing points as well so that exact hits and ties are covered
+      if(q % 2 == 1 && numPoints > 0)
+      {
+        const float* p = points->getTuplePointer(static_cast<size_t>(q) % numPoints);
+        std::copy(p, p + 3, center);
+      }
+      float half[3] = {extent(generator), extent(generator), extent(generator)};
+      float minCoords[3] = {center[0] - half[0], center[1] - half[1], center[2] - half[2]};
+      float maxCoords[3] = {center[0] + half[0], center[1] + half[1], center[2] + half[2]};
+      float radius = half[0];
+
+      expected.clear();
+      for(size_t i = 0; i < numPoints; i++)
+      {
+        const float* p = points->getTuplePointer(i);
+        if(p[0] >= minCoords[0] && p[0] <= maxCoords[0] && p[1] >= minCoords[1] && p[1] <= maxCoords[1] && p[2] >= minCoords[2] && p[2] <= maxCoords[2])
+        {
+          expected.push_back(static_cast<int64_t>(i));
+        }
+      }
+      locator->findPointsInBox(minCoords, maxCoords, found);
+      std::sort(found.begin(), found.end());
+      DREAM3D_REQUIRE(found == expected)
+
+      expected.clear();
+      for(size_t i = 0; i < numPoints; i++)
+      {
+        if(SquaredDistance(points->getTuplePointer(i), center) <= radius * radius)
+        {
+          expected.push_back(static_cast<int64_t>(i));
+        }
+      }
+      locator->findPointsInRadius(center, radius, found);
+      std::sort(found.begin(), found.end());
+      DREAM3D_REQUIRE(found == expected)
+
+      size_t k = static_cast<size_t>(q % 20) + 1;
+      std::vector<std::pair<float, int64_t>> sorted(numPoints);
+      for(size_t i = 0; i < numPoints; i++)
+      {
+        sorted[i] = std::make_pair(SquaredDistance(points->getTuplePointer(i), center), static_cast<int64_t>(i));
+      }
+      std::sort(sorted.begin(), sorted.end());
+      expected.clear();
+      for(size_t i = 0; i < std::min(k, numPoints); i++)
+      {
+        expected.push_back(sorted[i].second);
+      }
+      locator->findNearestPoints(center, k, found);
+      DREAM3D_REQUIRE(found == expected)
+      DREAM3D_REQUIRE_EQUAL(locator->findNearestPoint(center), expected.empty() ? -1 : expected[0])
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestLocators()
+  {
+    FloatArrayType::Pointer points;
+    std::vector<size_t> sizes = {0, 1, 7, 1000, 20000};
+    for(size_t numPoints : sizes)
+    {
+      for(bool clustered : {false, true})
+      {
+        points = CreatePoints(numPoints, clustered);
+        CheckLocator(UniformGridPointLocator::New(points), points);
+        CheckLocator(UniformGridPointLocator::New(points, 1), points);
+        CheckLocator(KdTreePointLocator::New(points), points);
+        CheckLocator(KdTreePointLocator::New(points, 1), points);
+      }
+    }
+
+    // A flat set of points exercises the degenerate axis handling
+    points = CreatePoints(2000, false);
+    for(size_t i = 0; i < 2000; i++)
+    {
+      points->setComponent(i, 2, 0.5f);
+    }
+    CheckLocator(UniformGridPointLocator::New(points), points);
+    CheckLocator(KdTreePointLocator::New(points), points);
+
+    // Every point at the same location
+    points = FloatArrayType::CreateArray(100, QVector<size_t>(1, 3), "Points", true);
+    points->initializeWithValue(1.0f);
+    CheckLocator(UniformGridPointLocator::New(points), points);
+    CheckLocator(KdTreePointLocator::New(points), points);
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestVertexGeomCache()
+  {
+    FloatArrayType::Pointer points = CreatePoints(500, false);
+    VertexGeom::Pointer geom = VertexGeom::CreateGeometry(points, "Vertices");
+    DREAM3D_REQUIRE(geom->getPointLocator().get() == nullptr)
+
+    DREAM3D_REQUIRE_EQUAL(geom->findPointLocator(), 1)
+    IPointLocator::Pointer locator = geom->getPointLocator();
+    DREAM3D_REQUIRE(locator.get() != nullptr)
+    DREAM3D_REQUIRE(locator->getType() == IPointLocator::Type::KdTree)
+
+    // The cached locator is reused until the vertices change
+    DREAM3D_REQUIRE_EQUAL(geom->findPointLocator(), 1)
+    DREAM3D_REQUIRE(geom->getPointLocator() == locator)
+    DREAM3D_REQUIRE_EQUAL(geom->findPointLocator(IPointLocator::Type::UniformGrid), 1)
+    DREAM3D_REQUIRE(geom->getPointLocator()->getType() == IPointLocator::Type::UniformGrid)
+
+    float far[3] = {100.0f, 100.0f, 100.0f};
+    geom->setCoords(42, far);
+    DREAM3D_REQUIRE(geom->getPointLocator().get() == nullptr)
+    DREAM3D_REQUIRE_EQUAL(geom->findPointLocator(), 1)
+    DREAM3D_REQUIRE_EQUAL(geom->getPointLocator()->findNearestPoint(far), 42)
+
+    // Writes through the raw vertex pointer invalidate the locator the next time it is looked up
+    DREAM3D_REQUIRE(geom->getPointLocator().get() != nullptr)
+    float* coords = geom->getVertexPointer(7);
+    coords[0] = far[0];
+    coords[1] = far[1];
+    coords[2] = far[2] + 1.0f;
+    DREAM3D_REQUIRE(geom->getPointLocator().get() == nullptr)
+    DREAM3D_REQUIRE_EQUAL(geom->findPointLocator(), 1)
+    float farther[3] = {far[0], far[1], far[2] + 2.0f};
+    DREAM3D_REQUIRE_EQUAL(geom->getPointLocator()->findNearestPoint(farther), 7)
+    DREAM3D_REQUIRE(geom->getPointLocator().get() != nullptr)
+
+    geom->resizeVertexList(10);
+    DREAM3D_REQUIRE(geom->getPointLocator().get() == nullptr)
+    DREAM3D_REQUIRE_EQUAL(geom->findPointLocator(), 1)
+    DREAM3D_REQUIRE_EQUAL(geom->getPointLocator()->getNumberOfPoints(), 10)
+    CheckLocator(geom->getPointLocator(), geom->getVertices());
+
+    geom->setVertices(CreatePoints(50, true));
+    DREAM3D_REQUIRE(geom->getPointLocator().get() == nullptr)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void operator()()
+  {
+    std::cout << "#### PointLocatorTest Starting ####" << std::endl;
+    int err = EXIT_SUCCESS;
+
+    DREAM3D_REGISTER_TEST(TestLocators());
+    DREAM3D_REGISTER_TEST(TestVertexGeomCache());
+  }
+
+private:
+  PointLocatorTest(const PointLocatorTest&) = delete; // Copy Constructor Not Implemented
+  void operator=(const PointLocatorTest&) = delete;   // Move assignment Not Implemented
+};
@@ -0,0 +1,330 @@
+#include <stdlib.h>
+
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <map>
+#include <random>
+#include <tuple>
+#include <vector>
+
+#include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/Geometry/ImageGeom.h"
+#include "SIMPLib/Geometry/QuadGeom.h"
+#include "SIMPLib/Geometry/SurfaceBVH.h"
+#include "SIMPLib/Geometry/TriangleGeom.h"
+
+#include "SIMPLib/Testing/SIMPLTestFileLocations.h"
+#include "SIMPLib/Testing/UnitTestSupport.hpp"
+
+class SurfaceBVHTest
+{
+public:
+  SurfaceBVHTest() = default;
+
+  virtual ~SurfaceBVHTest() = default;
+
+  // -----------------------------------------------------------------------------
+  // Surface of the cube [0, n]^3 made of unit quads, or of triangles when split is set
+  // -----------------------------------------------------------------------------
+  void CreateCube(int64_t n, bool split, FloatArrayType::Pointer& vertices, Int64ArrayType::Pointer& faces)
+  {
+    std::map<std::tuple<int64_t, int64_t, int64_t>, int64_t> ids;
+    std::vector<float> coords;
+    auto vertex = [&](int64_t x, int64_t y, int64_t z) {
+      auto key = std::make_tuple(x, y, z);
+      auto it = ids.find(key);
+      if(it != ids.end())
+      {
+        return it->second;
+      }
+      int64_t id = static_cast<int64_t>(ids.size());
+      ids[key] = id;
+      coords.push_back(static_cast<float>(x));
+      coords.push_back(static_cast<float>(y));
+      coords.push_back(static_cast<float>(z));
+      return id;
+    };
+
+    std::vector<int64_t> verts;
+    for(int axis = 0; axis < 3; axis++)
+    {
+      for(int64_t side = 0; side <= n; side += n)
+      {
+        for(int64_t u = 0; u < n; u++)
+        {
+          for(int64_t v = 0; v < n; v++)
+          {
+            int64_t corners[4][2] = {{u, v}, {u + 1, v}, {u + 1, v + 1}, {u, v + 1}};
+            int64_t quad[4];
+            for(int c = 0; c < 4; c++)
+            {
+              int64_t p[3];
+              p[axis] = side;
+              p[(axis + 1) % 3] = corners[c][0];
+              p[(axis + 2) % 3] = corners[c][1];
+              quad[c] = vertex(p[0], p[1], p[2]);
+            }
+            if(split)
+            {
+              int64_t tris[6] = {quad[0], quad[1], quad[2], quad[0], quad[2], quad[3]};
+              verts.insert(verts.end(), tris, tris + 6);
+            }
+            else
+            {
+              verts.insert(verts.end(), quad, quad + 4);
+            }
+          }
+        }
+      }
+    }
+
+    vertices = FloatArrayType::CreateArray(ids.size(), QVector<size_t>(1, 3), "Vertices", true);
+    std::copy(coords.begin(), coords.end(), vertices->getPointer(0));
+    size_t vertsPerFace = split ? 3 : 4;
+    faces = Int64ArrayType::CreateArray(verts.size() / vertsPerFace, QVector<size_t>(1, vertsPerFace), "Faces", true);
+    std::copy(verts.begin(), verts.end(), faces->getPointer(0));
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void CreateSphere(size_t rings, size_t segments, float radius, FloatArrayType::Pointer& vertices, Int64ArrayType::Pointer& faces)
+  {
+    const float pi = 3.14159265358979f;
+    vertices = FloatArrayType::CreateArray(2 + (rings - 1) * segments, QVector<size_t>(1, 3), "Vertices", true);
+    float north[3] = {0.0f, 0.0f, radius};
+    float south[3] = {0.0f, 0.0f, -radius};
+    std::copy(north, north + 3, vertices->getTuplePointer(0));
+    std::copy(south, south + 3, vertices->getTuplePointer(1));
+    for(size_t r = 1; r < rings; r++)
+    {
+      float theta = pi * r / rings;
+      for(size_t s = 0; s < segments; s++)
+      {
+        float phi = 2.0f * pi * s / segments;
+        float* p = vertices->getTuplePointer(2 + (r - 1) * segments + s);
+        p[0] = radius * std::sin(theta) * std::cos(phi);
+        p[1] = radius * std::sin(theta) * std::sin(phi);
+        p[2] = radius * std::cos(theta);
+      }
+    }
+
+    auto id = [segments](size_t r, size_t s) { return static_cast<int64_t>(2 + (r - 1) * segments + (s % segments)); };
+    std::vector<int64_t> verts;
+    for(size_t s = 0; s < segments; s++)
+    {
+      int64_t top[3] = {0, id(1, s), id(1, s + 1)};
+      int64_t bottom[3] = {1, id(rings - 1, s + 1), id(rings - 1, s)};
+      verts.insert(verts.end(), top, top + 3);
+      verts.insert(verts.end(), bottom, bottom + 3);
+      for(size_t r = 1; r + 1 < rings; r++)
+      {
+        int64_t tris[6] = {id(r, s), id(r + 1, s), id(r + 1, s + 1), id(r, s), id(r + 1, s + 1), id(r, s + 1)};
+        verts.insert(verts.end(), tris, tris + 6);
+      }
+    }
+    faces = Int64ArrayType::CreateArray(verts.size() / 3, QVector<size_t>(1, 3), "Faces", true);
+    std::copy(verts.begin(), verts.end(), faces->getPointer(0));
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void CheckNodes(SurfaceBVH::Pointer bvh)
+  {
+    const std::vector<SurfaceBVH::Node>& nodes = bvh->getNodes();
+    size_t numTris = 0;
+    for(size_t i = 0; i < nodes.size(); i++)
+    {
+      if(nodes[i].count > 0)
+      {
+        numTris += nodes[i].count;
+        continue;
+      }
+      // Children are inside their parent
+      size_t children[2] = {i + 1, nodes[i].offset};
+      for(size_t c : children)
+      {
+        DREAM3D_REQUIRE(c > i && c < nodes.size())
+        for(int a = 0; a < 3; a++)
+        {
+          DREAM3D_REQUIRE(nodes[c].minCoords[a] >= nodes[i].minCoords[a])
+          DREAM3D_REQUIRE(nodes[c].maxCoords[a] <= nodes[i].maxCoords[a])
+        }
+      }
+    }
+    DREAM3D_REQUIRE_EQUAL(numTris, bvh->getNumberOfTriangles())
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestCubeInsideCells()
+  {
+    const int64_t n = 6;
+    for(bool split : {true, false})
+    {
+      FloatArrayType::Pointer vertices;
+      Int64ArrayType::Pointer faces;
+      CreateCube(n, split, vertices, faces);
+      SurfaceBVH::Pointer bvh = SurfaceBVH::New(vertices, faces, 2);
+      DREAM3D_REQUIRE_EQUAL(bvh->getNumberOfFaces(), faces->getNumberOfTuples())
+      DREAM3D_REQUIRE_EQUAL(bvh->getNumberOfTriangles(), 6 * n * n * 2)
+      CheckNodes(bvh);
+
+      // Rows of cell centres run exactly through the edges and vertices of the mesh and along its faces
+      ImageGeom::Pointer image = ImageGeom::CreateGeometry("Image");
+      image->setDimensions(n + 2, n + 3, n + 3);
+      image->setResolution(1.0f, 1.0f, 1.0f);
+      image->setOrigin(-1.0f, -1.5f, -1.5f);
+      size_t numCells = (n + 2) * (n + 3) * (n + 3);
+      BoolArrayType::Pointer inside = BoolArrayType::CreateArray(numCells, "Inside", true);
+      DREAM3D_REQUIRE(bvh->findInsideCells(image, inside))
+
+      float center[3] = {0.0f, 0.0f, 0.0f};
+      for(size_t i = 0; i < numCells; i++)
+      {
+        image->getCoords(i, center);
+        bool interior = center[0] > 0.0f && center[0] < n && center[1] > 0.0f && center[1] < n && center[2] > 0.0f && center[2] < n;
+        bool exterior = center[0] < 0.0f || center[0] > n || center[1] < 0.0f || center[1] > n || center[2] < 0.0f || center[2] > n;
+        if(interior || exterior)
+        {
+          DREAM3D_REQUIRE_EQUAL(inside->getValue(i), interior)
+          DREAM3D_REQUIRE_EQUAL(bvh->isInside(center), interior)
+        }
+      }
+
+      BoolArrayType::Pointer wrongSize = BoolArrayType::CreateArray(numCells - 1, "Inside", true);
+      DREAM3D_REQUIRE_EQUAL(bvh->findInsideCells(image, wrongSize), false)
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestSphereQueries()
+  {
+    const float radius = 5.0f;
+    FloatArrayType::Pointer vertices;
+    Int64ArrayType::Pointer faces;
+    CreateSphere(24, 32, radius, vertices, faces);
+    size_t numFaces = faces->getNumberOfTuples();
+
+    // A single leaf holding every triangle is a brute force search
+    SurfaceBVH::Pointer reference = SurfaceBVH::New(vertices, faces, numFaces);
+    DREAM3D_REQUIRE_EQUAL(reference->getNodes().size(), 1)
+    std::vector<SurfaceBVH::Pointer> trees = {SurfaceBVH::New(vertices, faces), SurfaceBVH::New(vertices, faces, 1)};
+    for(const SurfaceBVH::Pointer& bvh : trees)
+    {
+      CheckNodes(bvh);
+    }
+
+    const size_t numQueries = 2000;
+    std::mt19937 generator(1234u);
+    std::uniform_real_distribution<float> uniform(-8.0f, 8.0f);
+    FloatArrayType::Pointer points = FloatArrayType::CreateArray(numQueries, QVector<size_t>(1, 3), "Points", true);
+    FloatArrayType::Pointer directions = FloatArrayType::CreateArray(numQueries, QVector<size_t>(1, 3), "Directions", true);
+    for(size_t i = 0; i < 3 * numQueries; i++)
+    {
+      points->setValue(i, uniform(generator));
+      directions->setValue(i, uniform(generator));
+    }
+
+    Int64ArrayType::Pointer expectedFaces = Int64ArrayType::CreateArray(numQueries, "Faces", true);
+    FloatArrayType::Pointer expectedPoints = FloatArrayType::CreateArray(numQueries, QVector<size_t>(1, 3), "Closest", true);
+    DREAM3D_REQUIRE(reference->findClosestPoints(points, expectedFaces, expectedPoints))
+    Int64ArrayType::Pointer expectedHits = Int64ArrayType::CreateArray(numQueries, "Hits", true);
+    FloatArrayType::Pointer expectedDistances = FloatArrayType::CreateArray(numQueries, "Distances", true);
+    DREAM3D_REQUIRE(reference->intersectRays(points, directions, expectedHits, expectedDistances))
+
+    for(const SurfaceBVH::Pointer& bvh : trees)
+    {
+      Int64ArrayType::Pointer closestFaces = Int64ArrayType::CreateArray(numQueries, "Faces", true);
+      FloatArrayType::Pointer closestPoints = FloatArrayType::CreateArray(numQueries, QVector<size_t>(1, 3), "Closest", true);
+      DREAM3D_REQUIRE(bvh->findClosestPoints(points, closestFaces, closestPoints))
+      Int64ArrayType::Pointer hits = Int64ArrayType::CreateArray(numQueries, "Hits", true);
+      FloatArrayType::Pointer distances = FloatArrayType::CreateArray(numQueries, "Distances", true);
+      DREAM3D_REQUIRE(bvh->intersectRays(points, directions, hits, distances))
+
+      for(size_t i = 0; i < numQueries; i++)
+      {
+        DREAM3D_REQUIRE_EQUAL(closestFaces->getValue(i), expectedFaces->getValue(i))
+        for(int a = 0; a < 3; a++)
+        {
+          DREAM3D_REQUIRE_EQUAL(closestPoints->getComponent(i, a), expectedPoints->getComponent(i, a))
+        }
+        DREAM3D_REQUIRE_EQUAL(hits->getValue(i), expectedHits->getValue(i))
+        DREAM3D_REQUIRE_EQUAL(distances->getValue(i), expectedDistances->getValue(i))
+
+        // The mesh is inscribed in the sphere, points well inside or outside of it are unambiguous
+        float* p = points->getTuplePointer(i);
+        float length = std::sqrt(p[0] * p[0] + p[1] * p[1] + p[2] * p[2]);
+        if(length < 0.95f * radius || length > radius)
+        {
+          DREAM3D_REQUIRE_EQUAL(bvh->isInside(p), length < radius)
+        }
+      }
+    }
+
+    // A ray from the centre hits the surface at about the radius
+    float origin[3] = {0.0f, 0.0f, 0.0f};
+    float direction[3] = {1.0f, 0.0f, 0.0f};
+    float t = 0.0f;
+    DREAM3D_REQUIRE(trees[0]->intersectRay(origin, direction, t) >= 0)
+    DREAM3D_REQUIRE(t > 0.95f * radius && t <= radius)
+    float away[3] = {20.0f, 0.0f, 0.0f};
+    DREAM3D_REQUIRE_EQUAL(trees[0]->intersectRay(away, direction, t), -1)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestGeometryCache()
+  {
+    FloatArrayType::Pointer vertices;
+    Int64ArrayType::Pointer faces;
+    CreateCube(2, true, vertices, faces);
+    TriangleGeom::Pointer triangles = TriangleGeom::CreateGeometry(faces, vertices, "Triangles");
+    DREAM3D_REQUIRE(triangles->getBoundingVolumeHierarchy().get() == nullptr)
+    DREAM3D_REQUIRE_EQUAL(triangles->findBoundingVolumeHierarchy(), 1)
+    SurfaceBVH::Pointer bvh = triangles->getBoundingVolumeHierarchy();
+    DREAM3D_REQUIRE(bvh.get() != nullptr)
+    DREAM3D_REQUIRE_EQUAL(triangles->findBoundingVolumeHierarchy(), 1)
+    DREAM3D_REQUIRE(triangles->getBoundingVolumeHierarchy() == bvh)
+
+    // Moving a vertex or replacing the faces drops the cached hierarchy
+    float coords[3] = {0.0f, 0.0f, -1.0f};
+    triangles->setCoords(0, coords);
+    DREAM3D_REQUIRE(triangles->getBoundingVolumeHierarchy().get() == nullptr)
+    DREAM3D_REQUIRE_EQUAL(triangles->findBoundingVolumeHierarchy(), 1)
+    triangles->setTriangles(faces);
+    DREAM3D_REQUIRE(triangles->getBoundingVolumeHierarchy().get() == nullptr)
+
+    CreateCube(2, false, vertices, faces);
+    QuadGeom::Pointer quads = QuadGeom::CreateGeometry(faces, vertices, "Quads");
+    DREAM3D_REQUIRE_EQUAL(quads->findBoundingVolumeHierarchy(), 1)
+    DREAM3D_REQUIRE_EQUAL(quads->getBoundingVolumeHierarchy()->getNumberOfFaces(), 24)
+    float center[3] = {1.0f, 1.0f, 1.0f};
+    DREAM3D_REQUIRE(quads->getBoundingVolumeHierarchy()->isInside(center))
+    quads->resizeVertexList(vertices->getNumberOfTuples());
+    DREAM3D_REQUIRE(quads->getBoundingVolumeHierarchy().get() == nullptr)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void operator()()
+  {
+    std::cout << "#### SurfaceBVHTest Starting ####" << std::endl;
+    int err = EXIT_SUCCESS;
+
+    DREAM3D_REGISTER_TEST(TestCubeInsideCells());
+    DREAM3D_REGISTER_TEST(TestSphereQueries());
+    DREAM3D_REGISTER_TEST(TestGeometryCache());
+  }
+
+private:
+  SurfaceBVHTest(const SurfaceBVHTest&) = delete; // Copy Constructor Not Implemented
+  void operator=(const SurfaceBVHTest&) = delete; // Move assignment Not Implemented
+};
@@ -462,6 +462,23 @@ void TriangleGeom::deleteUnsharedEdges()
   m_UnsharedEdgeList = SharedEdgeList::NullPointer();
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int TriangleGeom::findBoundingVolumeHierarchy()
+{
+  validateSpatialIndexes();
+  if(nullptr == m_VertexList.get() || nullptr == m_TriList.get())
+  {
+    return -1;
+  }
+  if(nullptr == m_BoundingVolumeHierarchy.get())
+  {
+    m_BoundingVolumeHierarchy = SurfaceBVH::New(m_VertexList, m_TriList);
+  }
+  return nullptr == m_BoundingVolumeHierarchy.get() ? -1 : 1;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
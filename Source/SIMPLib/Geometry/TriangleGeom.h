@@ -425,6 +425,12 @@ class SIMPLib_EXPORT TriangleGeom : public IGeometry2D
      */
     void deleteUnsharedEdges() override;
 
+    /**
+     * @brief findBoundingVolumeHierarchy
+     * @return
+     */
+    int findBoundingVolumeHierarchy() override;
+
   protected:
 
     TriangleGeom();
@@ -234,6 +234,32 @@ void VertexGeom::deleteElementCentroids()
 {
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int VertexGeom::findPointLocator(IPointLocator::Type type)
+{
+  validateSpatialIndexes();
+  if(nullptr == m_VertexList.get())
+  {
+    return -1;
+  }
+  if(nullptr != m_PointLocator.get() && m_PointLocator->getType() == type && m_PointLocator->getPoints() == m_VertexList &&
+     m_PointLocator->getNumberOfPoints() == m_VertexList->getNumberOfTuples())
+  {
+    return 1;
+  }
+  if(type == IPointLocator::Type::UniformGrid)
+  {
+    m_PointLocator = UniformGridPointLocator::New(m_VertexList);
+  }
+  else
+  {
+    m_PointLocator = KdTreePointLocator::New(m_VertexList);
+  }
+  return 1;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -209,6 +209,13 @@ class SIMPLib_EXPORT VertexGeom : public IGeometry
      */
     void deleteElementCentroids() override;
 
+    /**
+     * @brief findPointLocator Builds a spatial index directly over the shared vertex list
+     * @param type
+     * @return -1 if the geometry has no vertices, 1 otherwise
+     */
+    int findPointLocator(IPointLocator::Type type = IPointLocator::Type::KdTree) override;
+
     /**
      * @brief getParametricCenter
      * @param pCoords
@@ -0,0 +1,215 @@
+/* ============================================================================
+* Copyright (c) 2009-2015 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-07-D-5800
+*    United States Air Force Prime Contract FA8650-10-D-5210
+*    United States Prime Contract Navy N00173-07-C-2068
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+
+#include "H5BackgroundWriter.h"
+
+#include <QtCore/QFileInfo>
+#include <QtCore/QMutexLocker>
+#include <QtCore/QVector>
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+H5BackgroundWriter::Job::Job(const QString& filePath, const WriteFunction& write)
+: m_FilePath(QFileInfo(filePath).absoluteFilePath())
+, m_Write(write)
+{
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+H5BackgroundWriter::Job::~Job() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString H5BackgroundWriter::Job::getFilePath() const
+{
+  return m_FilePath;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool H5BackgroundWriter::Job::isFinished() const
+{
+  QMutexLocker locker(&m_Mutex);
+  return m_Finished;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+H5BackgroundWriter::Result H5BackgroundWriter::Job::wait() const
+{
+  QMutexLocker locker(&m_Mutex);
+  while(!m_Finished)
+  {
+    m_FinishedCondition.wait(&m_Mutex);
+  }
+  return m_Result;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void H5BackgroundWriter::Job::run()
+{
+  Result result = m_Write();
+  // Release the captured data before anybody is told that the write finished
+  m_Write = WriteFunction();
+
+  QMutexLocker locker(&m_Mutex);
+  m_Result = result;
+  m_Finished = true;
+  m_FinishedCondition.wakeAll();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+H5BackgroundWriter::H5BackgroundWriter() = default;
+
+// -----------------------------------------------------------------------------
+// Writes that are still queued when the process exits are completed first
+// -----------------------------------------------------------------------------
+H5BackgroundWriter::~H5BackgroundWriter()
+{
+  {
+    QMutexLocker locker(&m_Mutex);
+    m_Stop = true;
+    m_JobQueued.wakeAll();
+  }
+  if(m_Thread.joinable())
+  {
+    m_Thread.join();
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+H5BackgroundWriter* H5BackgroundWriter::Instance()
+{
+  static H5BackgroundWriter instance;
+  return &instance;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+H5BackgroundWriter::Job::Pointer H5BackgroundWriter::enqueue(const QString& filePath, const WriteFunction& write)
+{
+  Job::Pointer job = std::make_shared<Job>(filePath, write);
+
+  QMutexLocker locker(&m_Mutex);
+  // The I/O thread is only started once something is written in the background
+  if(!m_Thread.joinable())
+  {
+    m_Thread = std::thread(&H5BackgroundWriter::processJobs, this);
+  }
+  m_Jobs.push_back(job);
+  m_JobQueued.wakeAll();
+  return job;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void H5BackgroundWriter::waitForFile(const QString& filePath)
+{
+  waitForJobs(QFileInfo(filePath).absoluteFilePath());
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void H5BackgroundWriter::waitForAll()
+{
+  waitForJobs(QString());
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void H5BackgroundWriter::waitForJobs(const QString& filePath)
+{
+  QVector<Job::Pointer> jobs;
+  {
+    QMutexLocker locker(&m_Mutex);
+    for(const Job::Pointer& job : m_Jobs)
+    {
+      if(filePath.isEmpty() || job->getFilePath() == filePath)
+      {
+        jobs.push_back(job);
+      }
+    }
+  }
+  for(const Job::Pointer& job : jobs)
+  {
+    job->wait();
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void H5BackgroundWriter::processJobs()
+{
+  while(true)
+  {
+    Job::Pointer job;
+    {
+      QMutexLocker locker(&m_Mutex);
+      while(m_Jobs.empty() && !m_Stop)
+      {
+        m_JobQueued.wait(&m_Mutex);
+      }
+      if(m_Jobs.empty())
+      {
+        return;
+      }
+      // The job stays queued while it runs so that waitForFile() still finds it
+      job = m_Jobs.front();
+    }
+
+    job->run();
+
+    QMutexLocker locker(&m_Mutex);
+    m_Jobs.pop_front();
+  }
+}
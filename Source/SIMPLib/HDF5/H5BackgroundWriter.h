@@ -0,0 +1,179 @@
+/* ============================================================================
+* Copyright (c) 2009-2015 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-07-D-5800
+*    United States Air Force Prime Contract FA8650-10-D-5210
+*    United States Prime Contract Navy N00173-07-C-2068
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+
+#pragma once
+
+#include <deque>
+#include <functional>
+#include <memory>
+#include <thread>
+
+#include <QtCore/QMutex>
+#include <QtCore/QString>
+#include <QtCore/QWaitCondition>
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/Common/SIMPLibSetGetMacros.h"
+
+/**
+ * @brief The H5BackgroundWriter class runs HDF5 writes on a dedicated I/O thread so that the thread which
+ * queues them can continue with other work. Writes run one after the other in the order they were queued.
+ * Writing while other threads use the HDF5 library requires a thread safe build of the library.
+ */
+class SIMPLib_EXPORT H5BackgroundWriter
+{
+  public:
+    /**
+     * @brief The Result struct describes the outcome of a finished write
+     */
+    struct Result
+    {
+      int errorCode = 0;
+      QString errorMessage;
+      int64_t bytesWritten = 0;
+      double seconds = 0.0;
+    };
+
+    using WriteFunction = std::function<Result()>;
+
+    /**
+     * @brief The Job class is the handle of a write that was handed to the I/O thread
+     */
+    class SIMPLib_EXPORT Job
+    {
+      public:
+        SIMPL_SHARED_POINTERS(Job)
+
+        Job(const QString& filePath, const WriteFunction& write);
+        virtual ~Job();
+
+        /**
+         * @brief getFilePath Returns the absolute path of the file that is written
+         * @return
+         */
+        QString getFilePath() const;
+
+        /**
+         * @brief isFinished Returns true once the write has run
+         * @return
+         */
+        bool isFinished() const;
+
+        /**
+         * @brief wait Blocks until the write has run
+         * @return The outcome of the write
+         */
+        Result wait() const;
+
+      protected:
+        /**
+         * @brief run Runs the write on the calling thread and wakes every thread waiting for it
+         */
+        void run();
+
+      private:
+        friend class H5BackgroundWriter;
+
+        QString m_FilePath;
+        WriteFunction m_Write;
+        Result m_Result;
+        bool m_Finished = false;
+        mutable QMutex m_Mutex;
+        mutable QWaitCondition m_FinishedCondition;
+
+      public:
+        Job(const Job&) = delete;            // Copy Constructor Not Implemented
+        Job(Job&&) = delete;                 // Move Constructor Not Implemented
+        Job& operator=(const Job&) = delete; // Copy Assignment Not Implemented
+        Job& operator=(Job&&) = delete;      // Move Assignment Not Implemented
+    };
+
+    /**
+     * @brief Instance Returns the writer shared by the whole process
+     * @return
+     */
+    static H5BackgroundWriter* Instance();
+
+    virtual ~H5BackgroundWriter();
+
+    /**
+     * @brief enqueue Queues a write of the given file. The write function runs on the I/O thread and is
+     * destroyed there once it returns, which also releases any data it captured.
+     * @param filePath The file the write function writes to
+     * @param write
+     * @return The handle of the queued write
+     */
+    Job::Pointer enqueue(const QString& filePath, const WriteFunction& write);
+
+    /**
+     * @brief waitForFile Blocks until every queued write of the given file has run
+     * @param filePath
+     */
+    void waitForFile(const QString& filePath);
+
+    /**
+     * @brief waitForAll Blocks until every queued write has run
+     */
+    void waitForAll();
+
+  protected:
+    H5BackgroundWriter();
+
+    /**
+     * @brief processJobs The loop of the I/O thread
+     */
+    void processJobs();
+
+    /**
+     * @brief waitForJobs Blocks until the queued writes that match the file path have run. An empty
+     * path matches every write.
+     * @param filePath
+     */
+    void waitForJobs(const QString& filePath);
+
+  private:
+    std::thread m_Thread;
+    QMutex m_Mutex;
+    QWaitCondition m_JobQueued;
+    std::deque<Job::Pointer> m_Jobs;
+    bool m_Stop = false;
+
+  public:
+    H5BackgroundWriter(const H5BackgroundWriter&) = delete;            // Copy Constructor Not Implemented
+    H5BackgroundWriter(H5BackgroundWriter&&) = delete;                 // Move Constructor Not Implemented
+    H5BackgroundWriter& operator=(const H5BackgroundWriter&) = delete; // Copy Assignment Not Implemented
+    H5BackgroundWriter& operator=(H5BackgroundWriter&&) = delete;      // Move Assignment Not Implemented
+};
@@ -40,6 +40,7 @@
 #include "H5Support/QH5Lite.h"
 #include "H5Support/QH5Utilities.h"
 
+#include "SIMPLib/DataArrays/BitArray.h"
 #include "SIMPLib/DataArrays/DataArray.hpp"
 #include "SIMPLib/DataArrays/NeighborList.hpp"
 #include "SIMPLib/DataArrays/StringDataArray.h"
@@ -174,13 +175,7 @@ IDataArray::Pointer H5DataArrayReader::ReadStringDataArray(hid_t gid, const QStr
   // dimensions does not make sense.
   StringDataArray::Pointer strTemp = StringDataArray::CreateArray(dims[0], name);
 
-  std::vector<std::string> strings;
-  err = H5Lite::readVectorOfStringDataset(gid, name.toStdString(), strings);
-  // Copy the data into
-  for(std::vector<std::string>::size_type i = 0; i < strings.size(); i++)
-  {
-    strTemp->setValue(i, QString::fromStdString(strings[i]));
-  }
+  err = strTemp->readH5Data(gid);
   if(err < 0)
   {
     err = H5Tclose(typeId);
@@ -192,6 +187,40 @@ IDataArray::Pointer H5DataArrayReader::ReadStringDataArray(hid_t gid, const QStr
   return ptr;
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+IDataArray::Pointer H5DataArrayReader::ReadBitArray(hid_t gid, const QString& name, bool metaDataOnly)
+{
+  IDataArray::Pointer ptr = IDataArray::NullPointer();
+
+  QString classType;
+  int version = 0;
+  QVector<size_t> tDims;
+  QVector<size_t> cDims;
+  herr_t err = ReadRequiredAttributes(gid, name, classType, version, tDims, cDims);
+  if(err < 0)
+  {
+    return ptr;
+  }
+
+  BitArray::Pointer bitArray = BitArray::CreateArray(tDims, name);
+  if(nullptr == bitArray.get())
+  {
+    return ptr;
+  }
+  if(!metaDataOnly)
+  {
+    err = bitArray->readH5Data(gid);
+    if(err < 0)
+    {
+      return ptr;
+    }
+  }
+  ptr = bitArray;
+  return ptr;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
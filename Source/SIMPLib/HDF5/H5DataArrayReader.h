@@ -94,6 +94,15 @@ class SIMPLib_EXPORT H5DataArrayReader
      */
     static IDataArray::Pointer ReadStringDataArray(hid_t gid, const QString& name, bool metaDataOnly = false);
 
+    /**
+     * @brief ReadBitArray
+     * @param gid The HDF5 Group to read the data array from
+     * @param name The name of the data set
+     * @param metaDataOnly Read just the meta data about the DataArray or actually read all the data
+     * @return
+     */
+    static IDataArray::Pointer ReadBitArray(hid_t gid, const QString& name, bool metaDataOnly = false);
+
 
   protected:
     H5DataArrayReader();
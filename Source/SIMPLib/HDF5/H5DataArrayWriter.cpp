@@ -0,0 +1,123 @@
+/* ============================================================================
+* Copyright (c) 2009-2015 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-07-D-5800
+*    United States Air Force Prime Contract FA8650-10-D-5210
+*    United States Prime Contract Navy N00173-07-C-2068
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+
+#include "H5DataArrayWriter.hpp"
+
+#include <algorithm>
+
+namespace
+{
+thread_local H5DataArrayWriter::ChunkSettings s_ChunkSettings;
+}
+
+const size_t H5DataArrayWriter::DefaultChunkTupleCount;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void H5DataArrayWriter::SetChunkSettings(const ChunkSettings& settings)
+{
+  s_ChunkSettings = settings;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+H5DataArrayWriter::ChunkSettings H5DataArrayWriter::GetChunkSettings()
+{
+  return s_ChunkSettings;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+H5DataArrayWriter::ScopedChunkSettings::ScopedChunkSettings(const ChunkSettings& settings)
+: m_Previous(s_ChunkSettings)
+{
+  s_ChunkSettings = settings;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+H5DataArrayWriter::ScopedChunkSettings::~ScopedChunkSettings()
+{
+  s_ChunkSettings = m_Previous;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+hid_t H5DataArrayWriter::CreateDatasetProperties(const QVector<hsize_t>& h5Dims, int tupleRank, size_t numBytes)
+{
+  const ChunkSettings& settings = s_ChunkSettings;
+  if(!settings.isChunked() || numBytes == 0 || numBytes < settings.minimumChunkedArrayBytes || tupleRank < 1 || h5Dims.size() < tupleRank)
+  {
+    return H5P_DEFAULT;
+  }
+  for(const hsize_t& dim : h5Dims)
+  {
+    if(dim == 0)
+    {
+      return H5P_DEFAULT;
+    }
+  }
+
+  // The first entry of h5Dims is the slowest varying tuple dimension (Z for an image). All the
+  // faster dimensions are kept whole so a chunk is a contiguous run of tuples in memory.
+  hsize_t tuplesPerSlice = 1;
+  for(int i = 1; i < tupleRank; i++)
+  {
+    tuplesPerSlice *= h5Dims[i];
+  }
+
+  size_t chunkTupleCount = settings.chunkTupleCount;
+  if(chunkTupleCount == 0)
+  {
+    chunkTupleCount = (tupleRank >= 3) ? static_cast<size_t>(tuplesPerSlice) : DefaultChunkTupleCount;
+  }
+
+  QVector<hsize_t> chunkDims = h5Dims;
+  hsize_t slices = std::max<hsize_t>(1, chunkTupleCount / tuplesPerSlice);
+  chunkDims[0] = std::min<hsize_t>(h5Dims[0], slices);
+  // HDF5 refuses chunks of 4GB or more
+  if(numBytes / h5Dims[0] * chunkDims[0] >= 0xFFFFFFFFULL)
+  {
+    return H5P_DEFAULT;
+  }
+
+  return H5Lite::createChunkedDatasetProperties(chunkDims.size(), chunkDims.data(), settings.compressionLevel, settings.shuffle);
+}
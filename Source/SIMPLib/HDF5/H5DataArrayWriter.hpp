@@ -53,11 +53,73 @@
  * @date Jan 22, 2012
  * @version 1.0
  */
-class H5DataArrayWriter
+class SIMPLib_EXPORT H5DataArrayWriter
 {
   public:
     virtual ~H5DataArrayWriter() = default;
 
+    /**
+     * @brief The ChunkSettings struct controls the storage layout of the datasets created by writeDataArray().
+     * With the default values every dataset is written contiguous and uncompressed.
+     */
+    struct ChunkSettings
+    {
+      int32_t compressionLevel = 0;     // gzip level 0-9, 0 disables compression
+      bool shuffle = false;             // byte shuffle the chunks before compressing them
+      size_t chunkTupleCount = 0;       // tuples per chunk. 0 means one Z slice for 3D arrays, otherwise DefaultChunkTupleCount
+      size_t minimumChunkedArrayBytes = 0; // arrays smaller than this stay contiguous
+
+      /**
+       * @brief Returns true if the settings ask for anything other than a contiguous layout
+       */
+      bool isChunked() const
+      {
+        return compressionLevel > 0 || chunkTupleCount > 0;
+      }
+    };
+
+    static const size_t DefaultChunkTupleCount = 65536;
+
+    /**
+     * @brief Sets the ChunkSettings used by writeDataArray() on the calling thread
+     * @param settings
+     */
+    static void SetChunkSettings(const ChunkSettings& settings);
+
+    /**
+     * @brief Returns the ChunkSettings used by writeDataArray() on the calling thread
+     * @return
+     */
+    static ChunkSettings GetChunkSettings();
+
+    /**
+     * @brief The ScopedChunkSettings class applies a set of ChunkSettings to the calling thread
+     * and restores the previous settings when it goes out of scope.
+     */
+    class SIMPLib_EXPORT ScopedChunkSettings
+    {
+      public:
+        explicit ScopedChunkSettings(const ChunkSettings& settings);
+        ~ScopedChunkSettings();
+
+        ScopedChunkSettings(const ScopedChunkSettings&) = delete;            // Copy Constructor Not Implemented
+        ScopedChunkSettings& operator=(const ScopedChunkSettings&) = delete; // Copy Assignment Not Implemented
+
+      private:
+        ChunkSettings m_Previous;
+    };
+
+    /**
+     * @brief Creates the dataset creation property list for an array using the current ChunkSettings.
+     * The chunk spans all dimensions except the slowest tuple dimension, which is cut so that a chunk
+     * holds about chunkTupleCount tuples.
+     * @param h5Dims The HDF5 dimensions of the dataset (slowest to fastest, tuple dimensions first)
+     * @param tupleRank The number of leading entries of h5Dims that are tuple dimensions
+     * @param numBytes The size of the array in bytes
+     * @return A property list id that the caller must close with H5Pclose() or H5P_DEFAULT for a contiguous dataset
+     */
+    static hid_t CreateDatasetProperties(const QVector<hsize_t>& h5Dims, int tupleRank, size_t numBytes);
+
     /**
      * @brief writeDataArrayAttributes
      * @param gid
@@ -163,21 +225,22 @@ class H5DataArrayWriter
         h5Dims[i + tDims.size()] = cDims[i];
       }
 #endif
+      hid_t dcpl = CreateDatasetProperties(h5Dims, tDims.size(), dataArray->getSize() * dataArray->getTypeSize());
       if (QH5Lite::datasetExists(gid, dataArray->getName()) == false)
       {
-        err = QH5Lite::writePointerDataset(gid, dataArray->getName(), h5Rank, h5Dims.data(), dataArray->getPointer(0));
-        if(err < 0)
-        {
-          return err;
-        }
+        err = QH5Lite::writePointerDataset(gid, dataArray->getName(), h5Rank, h5Dims.data(), dataArray->getConstPointer(0), dcpl);
       }
       else
       {
-        err = QH5Lite::replacePointerDataset(gid, dataArray->getName(), h5Rank, h5Dims.data(), dataArray->getPointer(0));
-        if(err < 0)
-        {
-          return err;
-        }
+        err = QH5Lite::replacePointerDataset(gid, dataArray->getName(), h5Rank, h5Dims.data(), dataArray->getConstPointer(0), dcpl);
+      }
+      if(dcpl != H5P_DEFAULT)
+      {
+        H5Pclose(dcpl);
+      }
+      if(err < 0)
+      {
+        return err;
       }
 
       err = writeDataArrayAttributes<T>(gid, dataArray, tDims, cDims);
@@ -198,13 +261,18 @@ class H5DataArrayWriter
     {
       int err = 0;
 
-      std::vector<std::string> data(dataArray->getNumberOfTuples());
-      for(int i = 0; i < data.size(); i++)
+      // The strings are written straight from the array's buffer in one call
+      std::vector<const char*> data(dataArray->getNumberOfTuples());
+      for(size_t i = 0; i < data.size(); i++)
       {
-        data[i] = dataArray->getValue(i).toStdString();
+        data[i] = dataArray->getUtf8Value(i);
       }
 
-      err = H5Lite::writeVectorOfStringsDataset(gid, dataArray->getName().toStdString(), data);
+      err = H5Lite::writeVectorOfStringsDataset(gid, dataArray->getName().toStdString(), data, dataArray->getWriteFixedWidth());
+      if(err < 0)
+      {
+        return err;
+      }
       QVector<size_t> tDims(1, dataArray->getNumberOfTuples());
       QVector<size_t> cDims(1, 1);
       err = writeDataArrayAttributes<T>(gid, dataArray, tDims, cDims);
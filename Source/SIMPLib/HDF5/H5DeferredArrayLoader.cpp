@@ -0,0 +1,342 @@
+/* ============================================================================
+* Copyright (c) 2009-2015 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-07-D-5800
+*    United States Air Force Prime Contract FA8650-10-D-5210
+*    United States Prime Contract Navy N00173-07-C-2068
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+
+#include "H5DeferredArrayLoader.h"
+
+#include <algorithm>
+
+#include <QtCore/QDir>
+#include <QtCore/QFileInfo>
+#include <QtCore/QMutexLocker>
+#include <QtCore/QStringList>
+
+#include "H5Support/QH5Utilities.h"
+
+namespace
+{
+// -----------------------------------------------------------------------------
+// The loaders of all files share this lock when the HDF5 library may only be used by one thread at a time
+// -----------------------------------------------------------------------------
+QMutex* hdf5Mutex()
+{
+#ifdef H5_HAVE_THREADSAFE
+  return nullptr;
+#else
+  static QMutex mutex;
+  return &mutex;
+#endif
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QMutex& loadersMutex()
+{
+  static QMutex mutex;
+  return mutex;
+}
+
+// -----------------------------------------------------------------------------
+// Every loader that was created, so that the arrays deferred to a file can be read before it is overwritten
+// -----------------------------------------------------------------------------
+QVector<std::weak_ptr<H5DeferredArrayLoader>>& loaders()
+{
+  static QVector<std::weak_ptr<H5DeferredArrayLoader>> loaders;
+  return loaders;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString normalizedFilePath(const QString& filePath)
+{
+  QFileInfo fi(filePath);
+  QString canonicalPath = fi.canonicalFilePath();
+  return canonicalPath.isEmpty() ? QDir::cleanPath(fi.absoluteFilePath()) : canonicalPath;
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void H5DeferredArrayLoader::ArrayRecord::addDeferred(const DataArrayPath& path)
+{
+  QMutexLocker locker(&m_Mutex);
+  if(!m_Deferred.contains(path))
+  {
+    m_Deferred.push_back(path);
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void H5DeferredArrayLoader::ArrayRecord::addMaterialized(const DataArrayPath& path)
+{
+  QMutexLocker locker(&m_Mutex);
+  if(!m_Materialized.contains(path))
+  {
+    m_Materialized.push_back(path);
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QVector<DataArrayPath> H5DeferredArrayLoader::ArrayRecord::getDeferredPaths() const
+{
+  QMutexLocker locker(&m_Mutex);
+  return m_Deferred;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QVector<DataArrayPath> H5DeferredArrayLoader::ArrayRecord::getMaterializedPaths() const
+{
+  QMutexLocker locker(&m_Mutex);
+  return m_Materialized;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void H5DeferredArrayLoader::ArrayRecord::addFailed(const DataArrayPath& path)
+{
+  QMutexLocker locker(&m_Mutex);
+  if(!m_Failed.contains(path))
+  {
+    m_Failed.push_back(path);
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QVector<DataArrayPath> H5DeferredArrayLoader::ArrayRecord::getFailedPaths() const
+{
+  QMutexLocker locker(&m_Mutex);
+  return m_Failed;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool H5DeferredArrayLoader::ArrayRecord::isMaterialized(const DataArrayPath& path) const
+{
+  QMutexLocker locker(&m_Mutex);
+  return m_Materialized.contains(path);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+H5DeferredArrayLoader::Pointer H5DeferredArrayLoader::New(const QString& filePath, const ArrayRecordPointer& record)
+{
+  Pointer sharedPtr(new H5DeferredArrayLoader(filePath, record));
+
+  QMutexLocker locker(&loadersMutex());
+  QVector<std::weak_ptr<H5DeferredArrayLoader>>& allLoaders = loaders();
+  allLoaders.erase(std::remove_if(allLoaders.begin(), allLoaders.end(), [](const std::weak_ptr<H5DeferredArrayLoader>& loader) { return loader.expired(); }),
+                   allLoaders.end());
+  allLoaders.push_back(sharedPtr);
+  return sharedPtr;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+H5DeferredArrayLoader::H5DeferredArrayLoader(const QString& filePath, const ArrayRecordPointer& record)
+: m_FilePath(normalizedFilePath(filePath))
+, m_Record(record)
+{
+  // This is a separate file id from the one the DataContainerArray was read with so that closing
+  // that one does not close the datasets that are still to be read.
+  QMutexLocker locker(hdf5Mutex());
+  m_FileId = QH5Utilities::openFile(filePath, true);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+H5DeferredArrayLoader::~H5DeferredArrayLoader()
+{
+  if(m_FileId >= 0)
+  {
+    QMutexLocker locker(hdf5Mutex());
+    QH5Utilities::closeFile(m_FileId);
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool H5DeferredArrayLoader::isOpen() const
+{
+  return m_FileId >= 0;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+DataArrayPath H5DeferredArrayLoader::GetDataArrayPath(const QString& groupPath, const QString& arrayName)
+{
+  QStringList tokens = groupPath.split('/', QString::SkipEmptyParts);
+  if(tokens.size() < 2)
+  {
+    return DataArrayPath("", "", arrayName);
+  }
+  return DataArrayPath(tokens[tokens.size() - 2], tokens[tokens.size() - 1], arrayName);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool H5DeferredArrayLoader::deferArray(const IDataArray::Pointer& array, const QString& groupPath)
+{
+  if(m_FileId < 0 || nullptr == array.get())
+  {
+    return false;
+  }
+
+  QString datasetPath = groupPath + "/" + array->getName();
+  DataArrayPath arrayPath = GetDataArrayPath(groupPath, array->getName());
+  // The loader holds a reference to this object, which keeps the file open until the array reads its values
+  Pointer self = shared_from_this();
+  IDataArray::DeferredLoader loader = [self, datasetPath, arrayPath](void* buffer, size_t numBytes) {
+    bool ok = nullptr != buffer && self->readDataset(datasetPath, buffer, numBytes);
+    if(nullptr != self->m_Record.get())
+    {
+      if(ok)
+      {
+        self->m_Record->addMaterialized(arrayPath);
+      }
+      else
+      {
+        self->m_Record->addFailed(arrayPath);
+      }
+    }
+    return ok;
+  };
+  if(!array->setDeferredLoader(loader))
+  {
+    return false;
+  }
+  {
+    QMutexLocker locker(&m_Mutex);
+    m_Arrays.push_back(array);
+  }
+  if(nullptr != m_Record.get())
+  {
+    m_Record->addDeferred(arrayPath);
+  }
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool H5DeferredArrayLoader::ReadDeferredArrays(const QString& filePath)
+{
+  QString path = normalizedFilePath(filePath);
+  QVector<Pointer> fileLoaders;
+  {
+    QMutexLocker locker(&loadersMutex());
+    for(const std::weak_ptr<H5DeferredArrayLoader>& weakLoader : loaders())
+    {
+      Pointer loader = weakLoader.lock();
+      if(nullptr != loader.get() && loader->m_FilePath == path)
+      {
+        fileLoaders.push_back(loader);
+      }
+    }
+  }
+
+  bool ok = true;
+  for(const Pointer& loader : fileLoaders)
+  {
+    QVector<std::weak_ptr<IDataArray>> arrays;
+    {
+      QMutexLocker locker(&loader->m_Mutex);
+      arrays = loader->m_Arrays;
+      loader->m_Arrays.clear();
+    }
+    for(const std::weak_ptr<IDataArray>& weakArray : arrays)
+    {
+      IDataArray::Pointer array = weakArray.lock();
+      if(nullptr != array.get() && !array->readDeferredData())
+      {
+        ok = false;
+      }
+    }
+  }
+  // Releasing the last references closes the files
+  return ok;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool H5DeferredArrayLoader::readDataset(const QString& datasetPath, void* buffer, size_t numBytes)
+{
+  QMutexLocker locker(&m_Mutex);
+  QMutexLocker hdf5Locker(hdf5Mutex());
+
+  hid_t did = H5Dopen(m_FileId, datasetPath.toLatin1().data(), H5P_DEFAULT);
+  if(did < 0)
+  {
+    return false;
+  }
+  hid_t fileType = H5Dget_type(did);
+  hid_t memType = H5Tget_native_type(fileType, H5T_DIR_ASCEND);
+  hid_t sid = H5Dget_space(did);
+  hssize_t numElements = H5Sget_simple_extent_npoints(sid);
+
+  bool ok = false;
+  if(memType >= 0 && numElements >= 0 && static_cast<size_t>(numElements) * H5Tget_size(memType) == numBytes)
+  {
+    ok = H5Dread(did, memType, H5S_ALL, H5S_ALL, H5P_DEFAULT, buffer) >= 0;
+  }
+
+  H5Sclose(sid);
+  if(memType >= 0)
+  {
+    H5Tclose(memType);
+  }
+  H5Tclose(fileType);
+  H5Dclose(did);
+  return ok;
+}
@@ -0,0 +1,152 @@
+/* ============================================================================
+* Copyright (c) 2009-2015 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-07-D-5800
+*    United States Air Force Prime Contract FA8650-10-D-5210
+*    United States Prime Contract Navy N00173-07-C-2068
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+
+#pragma once
+
+#include <memory>
+
+#include <hdf5.h>
+
+#include <QtCore/QMutex>
+#include <QtCore/QString>
+#include <QtCore/QVector>
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/Common/SIMPLibSetGetMacros.h"
+#include "SIMPLib/DataArrays/IDataArray.h"
+#include "SIMPLib/DataContainers/DataArrayPath.h"
+
+/**
+ * @brief The H5DeferredArrayLoader class keeps an HDF5 file open so that arrays read from it can postpone
+ * reading their values until a filter first accesses them. Each deferred array keeps the loader alive; the
+ * file is closed once every deferred array has either read its values or been destroyed. Code that writes
+ * an HDF5 file calls ReadDeferredArrays() first so that no loader still has to read from it.
+ */
+class SIMPLib_EXPORT H5DeferredArrayLoader : public std::enable_shared_from_this<H5DeferredArrayLoader>
+{
+  public:
+    SIMPL_SHARED_POINTERS(H5DeferredArrayLoader)
+
+    /**
+     * @brief The ArrayRecord class is a thread safe record of the arrays that were deferred, of those
+     * whose values were read afterwards and of those whose values could not be read
+     */
+    class SIMPLib_EXPORT ArrayRecord
+    {
+      public:
+        void addDeferred(const DataArrayPath& path);
+        void addMaterialized(const DataArrayPath& path);
+        void addFailed(const DataArrayPath& path);
+        QVector<DataArrayPath> getDeferredPaths() const;
+        QVector<DataArrayPath> getMaterializedPaths() const;
+        QVector<DataArrayPath> getFailedPaths() const;
+        bool isMaterialized(const DataArrayPath& path) const;
+
+      private:
+        mutable QMutex m_Mutex;
+        QVector<DataArrayPath> m_Deferred;
+        QVector<DataArrayPath> m_Materialized;
+        QVector<DataArrayPath> m_Failed;
+    };
+    using ArrayRecordPointer = std::shared_ptr<ArrayRecord>;
+
+    /**
+     * @brief New Opens the file read only
+     * @param filePath The HDF5 file the arrays are read from
+     * @param record Optional record of the deferred arrays and of those whose values get read
+     * @return
+     */
+    static Pointer New(const QString& filePath, const ArrayRecordPointer& record = ArrayRecordPointer());
+
+    virtual ~H5DeferredArrayLoader();
+
+    /**
+     * @brief isOpen Returns true if the file could be opened
+     * @return
+     */
+    bool isOpen() const;
+
+    /**
+     * @brief deferArray Makes the array read its values from the dataset with the array's name in the
+     * group at groupPath the first time they are accessed.
+     * @param array An array whose tuple and component dimensions match the dataset
+     * @param groupPath The absolute HDF5 path of the AttributeMatrix group, e.g. /DataContainers/DC/AM
+     * @return true if the array will read its values on demand
+     */
+    bool deferArray(const IDataArray::Pointer& array, const QString& groupPath);
+
+    /**
+     * @brief GetDataArrayPath Converts the HDF5 path of an AttributeMatrix group and an array name to a DataArrayPath
+     * @param groupPath
+     * @param arrayName
+     * @return
+     */
+    static DataArrayPath GetDataArrayPath(const QString& groupPath, const QString& arrayName);
+
+    /**
+     * @brief ReadDeferredArrays Reads the values of every array that is still deferred to the file, which
+     * closes the file unless an array is being read at the same time. Must be called before the file is
+     * opened for writing.
+     * @param filePath
+     * @return false if the values of an array could not be read
+     */
+    static bool ReadDeferredArrays(const QString& filePath);
+
+  protected:
+    H5DeferredArrayLoader(const QString& filePath, const ArrayRecordPointer& record);
+
+    /**
+     * @brief readDataset Reads the whole dataset into the buffer using the native type of the dataset
+     * @param datasetPath
+     * @param buffer
+     * @param numBytes The size of the buffer, which must match the size of the dataset
+     * @return
+     */
+    bool readDataset(const QString& datasetPath, void* buffer, size_t numBytes);
+
+  private:
+    hid_t m_FileId = -1;
+    QString m_FilePath;
+    QMutex m_Mutex;
+    ArrayRecordPointer m_Record;
+    QVector<std::weak_ptr<IDataArray>> m_Arrays;
+
+  public:
+    H5DeferredArrayLoader(const H5DeferredArrayLoader&) = delete;            // Copy Constructor Not Implemented
+    H5DeferredArrayLoader(H5DeferredArrayLoader&&) = delete;                 // Move Constructor Not Implemented
+    H5DeferredArrayLoader& operator=(const H5DeferredArrayLoader&) = delete; // Copy Assignment Not Implemented
+    H5DeferredArrayLoader& operator=(H5DeferredArrayLoader&&) = delete;      // Move Assignment Not Implemented
+};
@@ -35,11 +35,18 @@
 
 #include "RadialDistributionFunction.h"
 
+#include <algorithm>
 #include <cmath>
 
 #include <fstream>
 #include <iostream>
 
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#include <tbb/partitioner.h>
+#endif
+
 #include "SIMPLib/Math/SIMPLibRandom.h"
 #include "SIMPLib/StatsData/StatsData.h"
 
@@ -186,10 +193,19 @@ RadialDistributionFunction::~RadialDistributionFunction() = default;
 //
 // -----------------------------------------------------------------------------
 std::vector<float> RadialDistributionFunction::GenerateRandomDistribution(float minDistance, float maxDistance, int numBins, std::vector<float> boxdims, std::vector<float> boxres)
+{
+  unsigned long long int seed = QDateTime::currentMSecsSinceEpoch();
+  return GenerateRandomDistribution(minDistance, maxDistance, numBins, boxdims, boxres, seed);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+std::vector<float> RadialDistributionFunction::GenerateRandomDistribution(float minDistance, float maxDistance, int numBins, std::vector<float> boxdims, std::vector<float> boxres,
+                                                                          unsigned long long int seed)
 {
   std::vector<float> freq(numBins, 0);
   std::vector<float> randomCentroids;
-  std::vector<std::vector<float>> distancelist;
   size_t largeNumber = 1000;
   size_t numDistances = largeNumber * (largeNumber - 1);
 
@@ -201,10 +217,7 @@ std::vector<float> RadialDistributionFunction::GenerateRandomDistribution(float
 
   size_t totalpoints = xpoints * ypoints * zpoints;
 
-  float x, y, z;
-  float xn, yn, zn;
   float xc, yc, zc;
-  float r;
 
   size_t featureOwnerIdx = 0;
   size_t column, row, plane;
@@ -215,7 +228,7 @@ std::vector<float> RadialDistributionFunction::GenerateRandomDistribution(float
 
   freq.resize(static_cast<size_t>(current_num_bins + 1));
 
-  SIMPL_RANDOMNG_NEW();
+  SIMPL_RANDOMNG_NEW_SEEDED(seed);
 
   randomCentroids.resize(largeNumber * 3);
 
@@ -237,53 +250,55 @@ std::vector<float> RadialDistributionFunction::GenerateRandomDistribution(float
     randomCentroids[3 * i + 2] = zc;
   }
 
-  distancelist.resize(largeNumber);
-
-  // Calculating all of the distances and storing them in the distance list
-  for(size_t i = 1; i < largeNumber; i++)
-  {
-
-    x = randomCentroids[3 * i];
-    y = randomCentroids[3 * i + 1];
-    z = randomCentroids[3 * i + 2];
-
-    for(size_t j = i + 1; j < largeNumber; j++)
-    {
-
-      xn = randomCentroids[3 * j];
-      yn = randomCentroids[3 * j + 1];
-      zn = randomCentroids[3 * j + 2];
-
-      r = sqrtf((x - xn) * (x - xn) + (y - yn) * (y - yn) + (z - zn) * (z - zn));
-
-      distancelist[i].push_back(r);
-      distancelist[j].push_back(r);
-    }
-  }
-
-  // bin up the distance list
-  for(size_t i = 0; i < largeNumber; i++)
-  {
-    for(size_t j = 0; j < distancelist[i].size(); j++)
+  // Bin every pair directly instead of storing the distances first. The histogram spans the whole box
+  // diagonal, so every pair contributes and there is no cutoff distance to prune the search with. The rows
+  // of the pair triangle are dealt out round robin so each chunk gets a similar amount of work, and each
+  // chunk fills its own histogram so the result does not depend on the scheduling.
+  const size_t numChunks = 64;
+  std::vector<std::vector<size_t>> chunkCounts(numChunks, std::vector<size_t>(current_num_bins + 1, 0));
+  auto binPairs = [&](size_t chunkBegin, size_t chunkEnd) {
+    for(size_t chunk = chunkBegin; chunk < chunkEnd; chunk++)
     {
-      float distance = distancelist[i][j];
-      size_t bin = static_cast<size_t>((distance - minDistance) / stepsize);
-
-      if(distance < minDistance)
-      {
-        freq[0]++;
-      }
-      else
+      std::vector<size_t>& counts = chunkCounts[chunk];
+      for(size_t i = chunk; i < largeNumber; i += numChunks)
       {
-        freq[bin + 1]++;
+        float x = randomCentroids[3 * i];
+        float y = randomCentroids[3 * i + 1];
+        float z = randomCentroids[3 * i + 2];
+        for(size_t j = i + 1; j < largeNumber; j++)
+        {
+          float xn = randomCentroids[3 * j];
+          float yn = randomCentroids[3 * j + 1];
+          float zn = randomCentroids[3 * j + 2];
+          float distance = sqrtf((x - xn) * (x - xn) + (y - yn) * (y - yn) + (z - zn) * (z - zn));
+          if(distance < minDistance)
+          {
+            counts[0]++;
+          }
+          else
+          {
+            size_t bin = static_cast<size_t>((distance - minDistance) / stepsize);
+            counts[std::min(bin + 1, current_num_bins)]++;
+          }
+        }
       }
     }
-  }
-  
-  // Normalize the frequencies
+  };
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  tbb::parallel_for(tbb::blocked_range<size_t>(0, numChunks), [&](const tbb::blocked_range<size_t>& r) { binPairs(r.begin(), r.end()); }, tbb::auto_partitioner());
+#else
+  binPairs(0, numChunks);
+#endif
+
+  // Normalize the frequencies, every pair is counted once from each of its two points
   for(size_t i = 0; i < current_num_bins + 1; i++)
   {
-    freq[i] = freq[i] / (numDistances);
+    size_t count = 0;
+    for(size_t chunk = 0; chunk < numChunks; chunk++)
+    {
+      count += chunkCounts[chunk][i];
+    }
+    freq[i] = static_cast<float>(2 * count) / (numDistances);
   }
 
   return freq;
@@ -115,6 +115,19 @@ class SIMPLib_EXPORT RadialDistributionFunction
      */
     static std::vector<float> GenerateRandomDistribution(float minDistance, float maxDistance, int numBins, std::vector<float> boxdims, std::vector<float> boxres);
 
+    /**
+     * @brief GenerateRandomDistribution Same as above with an explicit seed for the random points, so the
+     * same seed always produces the same frequencies.
+     * @param minDistance The minimum distance between objects
+     * @param maxDistance The maximum distance between objects
+     * @param numBins The number of bins to generate
+     * @param boxdims
+     * @param boxres
+     * @param seed
+     * @return An array of values that are the frequency values for the histogram
+     */
+    static std::vector<float> GenerateRandomDistribution(float minDistance, float maxDistance, int numBins, std::vector<float> boxdims, std::vector<float> boxres, unsigned long long int seed);
+
   protected:
     RadialDistributionFunction();
 
@@ -0,0 +1,155 @@
+/* ============================================================================
+* Copyright (c) 2009-2015 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-07-D-5800
+*    United States Air Force Prime Contract FA8650-10-D-5210
+*    United States Prime Contract Navy N00173-07-C-2068
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+#include "SIMPLib/Math/RadialDistributionFunction.h"
+#include "SIMPLib/Math/SIMPLibRandom.h"
+#include "SIMPLib/SIMPLib.h"
+
+#include "SIMPLib/Testing/SIMPLTestFileLocations.h"
+#include "SIMPLib/Testing/UnitTestSupport.hpp"
+
+class RadialDistributionFunctionTest
+{
+public:
+  RadialDistributionFunctionTest() = default;
+  virtual ~RadialDistributionFunctionTest() = default;
+
+  // -----------------------------------------------------------------------------
+  // Straightforward version of the binning, storing every distance of every point before counting
+  // -----------------------------------------------------------------------------
+  std::vector<float> ReferenceDistribution(float minDistance, float maxDistance, int numBins, const std::vector<float>& boxdims, const std::vector<float>& boxres, unsigned long long int seed)
+  {
+    const size_t largeNumber = 1000;
+    size_t xpoints = static_cast<size_t>(boxdims[0] / boxres[0]);
+    size_t ypoints = static_cast<size_t>(boxdims[1] / boxres[1]);
+    size_t zpoints = static_cast<size_t>(boxdims[2] / boxres[2]);
+    size_t totalpoints = xpoints * ypoints * zpoints;
+    float stepsize = (maxDistance - minDistance) / numBins;
+    float maxBoxDistance = sqrtf((boxdims[0] * boxdims[0]) + (boxdims[1] * boxdims[1]) + (boxdims[2] * boxdims[2]));
+    size_t current_num_bins = static_cast<size_t>(ceil((maxBoxDistance - minDistance) / stepsize));
+
+    SIMPL_RANDOMNG_NEW_SEEDED(seed);
+    std::vector<float> points(3 * largeNumber);
+    for(size_t i = 0; i < largeNumber; i++)
+    {
+      size_t idx = static_cast<size_t>(rg.genrand_res53() * totalpoints);
+      points[3 * i] = static_cast<float>((idx % xpoints) * boxres[0]);
+      points[3 * i + 1] = static_cast<float>(((idx / xpoints) % ypoints) * boxres[1]);
+      points[3 * i + 2] = static_cast<float>((idx / (xpoints * ypoints)) * boxres[2]);
+    }
+
+    std::vector<std::vector<float>> distancelist(largeNumber);
+    for(size_t i = 0; i < largeNumber; i++)
+    {
+      for(size_t j = i + 1; j < largeNumber; j++)
+      {
+        float dx = points[3 * i] - points[3 * j];
+        float dy = points[3 * i + 1] - points[3 * j + 1];
+        float dz = points[3 * i + 2] - points[3 * j + 2];
+        float r = sqrtf(dx * dx + dy * dy + dz * dz);
+        distancelist[i].push_back(r);
+        distancelist[j].push_back(r);
+      }
+    }
+
+    std::vector<float> freq(current_num_bins + 1, 0.0f);
+    for(size_t i = 0; i < largeNumber; i++)
+    {
+      for(float distance : distancelist[i])
+      {
+        if(distance < minDistance)
+        {
+          freq[0]++;
+        }
+        else
+        {
+          freq[static_cast<size_t>((distance - minDistance) / stepsize) + 1]++;
+        }
+      }
+    }
+    for(float& f : freq)
+    {
+      f = f / (largeNumber * (largeNumber - 1));
+    }
+    return freq;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestSeededDistribution()
+  {
+    std::vector<float> boxDims = {98.0f, 60.0f, 45.0f};
+    std::vector<float> boxRes = {0.1f, 0.2f, 0.25f};
+    unsigned long long int seed = 5489;
+
+    std::vector<float> freqs = RadialDistributionFunction::GenerateRandomDistribution(8, 93, 55, boxDims, boxRes, seed);
+    std::vector<float> expected = ReferenceDistribution(8, 93, 55, boxDims, boxRes, seed);
+    DREAM3D_REQUIRE_EQUAL(freqs.size(), expected.size())
+    float sum = 0.0f;
+    for(size_t i = 0; i < freqs.size(); i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(freqs[i], expected[i])
+      sum += freqs[i];
+    }
+    // Every pair of points lands in exactly one bin
+    DREAM3D_REQUIRE(std::fabs(sum - 1.0f) < 1.0E-4f)
+
+    // The same seed gives the same frequencies
+    std::vector<float> again = RadialDistributionFunction::GenerateRandomDistribution(8, 93, 55, boxDims, boxRes, seed);
+    DREAM3D_REQUIRE(again == freqs)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void operator()()
+  {
+    std::cout << "#### RadialDistributionFunctionTest Starting ####" << std::endl;
+
+    int err = EXIT_SUCCESS;
+    DREAM3D_REGISTER_TEST(TestSeededDistribution())
+  }
+
+private:
+  RadialDistributionFunctionTest(const RadialDistributionFunctionTest&); // Copy Constructor Not Implemented
+  void operator=(const RadialDistributionFunctionTest&);                 // Move assignment Not Implemented
+};
@@ -108,7 +108,7 @@ bool SIMPLH5DataReader::closeFile()
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-DataContainerArray::Pointer SIMPLH5DataReader::readSIMPLDataUsingProxy(const DataContainerArrayProxy &proxy, bool preflight)
+DataContainerArray::Pointer SIMPLH5DataReader::readSIMPLDataUsingProxy(const DataContainerArrayProxy &proxy, bool preflight, const std::shared_ptr<H5DeferredArrayLoader>& deferredLoader)
 {
   if (m_FileId < 0)
   {
@@ -157,7 +157,7 @@ DataContainerArray::Pointer SIMPLH5DataReader::readSIMPLDataUsingProxy(const Dat
     return DataContainerArray::NullPointer();
   }
 
-  err = dca->readDataContainersFromHDF5(preflight, dcaGid, proxy, this);
+  err = dca->readDataContainersFromHDF5(preflight, dcaGid, proxy, this, deferredLoader);
   if(err < 0)
   {
     QString ss = QObject::tr("Error trying to read the DataContainers from the file '%1'").arg(m_CurrentFilePath);
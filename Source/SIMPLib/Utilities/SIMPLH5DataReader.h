@@ -34,6 +34,8 @@
 
 #include <QtCore/QStringList>
 
+#include <memory>
+
 #include <hdf5.h>
 
 #include "SIMPLib/SIMPLib.h"
@@ -46,6 +48,7 @@
 class IObserver;
 class DataContainerArrayProxy;
 class SIMPLH5DataReaderRequirements;
+class H5DeferredArrayLoader;
 
 /**
  * @brief The SIMPLH5DataReader class
@@ -90,9 +93,11 @@ class SIMPLib_EXPORT SIMPLH5DataReader : public Observable
      * @brief readSIMPLDataUsingProxy
      * @param proxy
      * @param preflight
+     * @param deferredLoader If set, DataArray values are not read now but the first time they are accessed
      * @return
      */
-    DataContainerArray::Pointer readSIMPLDataUsingProxy(const DataContainerArrayProxy &proxy, bool preflight);
+    DataContainerArray::Pointer readSIMPLDataUsingProxy(const DataContainerArrayProxy &proxy, bool preflight,
+                                                        const std::shared_ptr<H5DeferredArrayLoader>& deferredLoader = std::shared_ptr<H5DeferredArrayLoader>());
 
     /**
      * @brief readPipelineJson
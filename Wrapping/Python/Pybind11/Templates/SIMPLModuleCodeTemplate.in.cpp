@@ -128,6 +128,57 @@ template <typename T> using PySharedPtrClass = py::class_<T, std::shared_ptr<T>>
  *
  ******************************************************************************/
 #include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/DataArrays/NeighborList.hpp"
+#include "SIMPLib/DataArrays/StringDataArray.h"
+
+/**
+ * @brief Describes the memory of a DataArray<T> as a C ordered buffer without copying it. SIMPL stores
+ * tuples with X varying fastest, so the tuple dimensions are reversed to get the NumPy shape (Z, Y, X, components...).
+ * If tupleDims is empty or does not match the number of tuples, the tuples are exposed as a single dimension.
+ * Component dimensions of {1} are dropped from the shape.
+ * @param da
+ * @param tupleDims
+ * @return
+ */
+template <typename T> py::buffer_info PYB11_DataArrayBufferInfo(DataArray<T>& da, const std::vector<size_t>& tupleDims)
+{
+  size_t numTuples = da.getNumberOfTuples();
+  if(numTuples > 0 && !da.isAllocated())
+  {
+    throw std::runtime_error("DataArray '" + da.getName().toStdString() + "' is not allocated");
+  }
+
+  std::vector<ssize_t> shape;
+  size_t tupleCount = 1;
+  for(const auto& dim : tupleDims)
+  {
+    tupleCount *= dim;
+  }
+  if(!tupleDims.empty() && tupleCount == numTuples)
+  {
+    shape.assign(tupleDims.rbegin(), tupleDims.rend());
+  }
+  else
+  {
+    shape.push_back(static_cast<ssize_t>(numTuples));
+  }
+  QVector<size_t> cDims = da.getComponentDimensions();
+  if(!(cDims.size() == 1 && cDims[0] == 1))
+  {
+    shape.insert(shape.end(), cDims.begin(), cDims.end());
+  }
+
+  std::vector<ssize_t> strides(shape.size());
+  ssize_t stride = sizeof(T);
+  for(size_t i = shape.size(); i > 0; i--)
+  {
+    strides[i - 1] = stride;
+    stride *= shape[i - 1];
+  }
+
+  void* ptr = (numTuples > 0) ? da.getVoidPointer(0) : nullptr;
+  return py::buffer_info(ptr, sizeof(T), py::format_descriptor<T>::format(), static_cast<ssize_t>(shape.size()), shape, strides);
+}
 
 /**
  * @brief Initializes a template specialization of DataArray<T>
@@ -154,6 +205,17 @@ template <typename T> using PySharedPtrClass = py::class_<T, std::shared_ptr<T>>
         })) /* Class instance method setValue */                                                                                                                                                       \
         .def("setValue", &DataArrayType::setValue, py::arg("index"), py::arg("value"))                                                                                                                 \
         .def("getValue", &DataArrayType::getValue, py::arg("index"))                                                                                                                                   \
+        .def("getNumberOfTuples", &DataArrayType::getNumberOfTuples)                                                                                                                                   \
+        .def("getNumberOfComponents", &DataArrayType::getNumberOfComponents)                                                                                                                           \
+        .def("getComponentDimensions", [](DataArrayType& da) { return da.getComponentDimensions().toStdVector(); })                                                                                    \
+        .def_buffer([](DataArrayType& da) -> py::buffer_info { return PYB11_DataArrayBufferInfo<T>(da, std::vector<size_t>()); })                                                                      \
+        /* A NumPy view that shares the memory of the DataArray and keeps it alive through its base object */                                                                                          \
+        .def("npview",                                                                                                                                                                                 \
+             [](std::shared_ptr<DataArrayType> da, std::vector<size_t> tupleDims) {                                                                                                                    \
+               py::buffer_info info = PYB11_DataArrayBufferInfo<T>(*da, tupleDims);                                                                                                                    \
+               return py::array_t<T>(info.shape, info.strides, static_cast<T*>(info.ptr), py::cast(da));                                                                                               \
+             },                                                                                                                                                                                        \
+             py::arg("tupleDims") = std::vector<size_t>())                                                                                                                                             \
         .def_property("Name", &DataArrayType::getName, &DataArrayType::setName)                                                                                                                        \
         .def("Cleanup", []() { return DataArrayType::NullPointer(); });                                                                                                                                \
     ;                                                                                                                                                                                                  \
@@ -175,6 +237,112 @@ PYB11_DEFINE_DATAARRAY_INIT(uint64_t, UInt64ArrayType);
 PYB11_DEFINE_DATAARRAY_INIT(float, FloatArrayType);
 PYB11_DEFINE_DATAARRAY_INIT(double, DoubleArrayType);
 
+/**
+ * @brief Initializes a template specialization of NeighborList<T>. The lists are exchanged with NumPy in the
+ * compressed sparse row form NeighborList stores them in: an offsets array with one more entry than there are
+ * tuples, and a values array holding every list back to back. Reading goes through copyOfList() and
+ * getListSize() so it never unpacks the lists.
+ * @param T The Type
+ * @param NAME The name of the Variable
+ */
+#define PYB11_DEFINE_NEIGHBORLIST_INIT(T, NAME)                                                                                                                                                        \
+  PySharedPtrClass<NeighborList<T>> declare##NAME(py::module& m, PySharedPtrClass<IDataArray>& parent)                                                                                                 \
+  {                                                                                                                                                                                                    \
+    using NeighborListType = NeighborList<T>;                                                                                                                                                          \
+    PySharedPtrClass<NeighborListType> instance(m, #NAME, parent);                                                                                                                                     \
+    instance.def(py::init([](size_t numTuples, QString name, bool allocate) { return NeighborListType::CreateArray(numTuples, name, allocate); }))                                                     \
+        .def("getNumberOfTuples", &NeighborListType::getNumberOfTuples)                                                                                                                                \
+        .def("getListSize", &NeighborListType::getListSize, py::arg("index"))                                                                                                                          \
+        .def("getList",                                                                                                                                                                                \
+             [](NeighborListType& nl, int index) {                                                                                                                                                     \
+               typename NeighborListType::VectorType list = nl.copyOfList(index);                                                                                                                      \
+               return py::array_t<T>(list.size(), list.data());                                                                                                                                        \
+             },                                                                                                                                                                                        \
+             py::arg("index"))                                                                                                                                                                         \
+        .def("toNumPy",                                                                                                                                                                                \
+             [](NeighborListType& nl) {                                                                                                                                                                \
+               size_t numTuples = nl.getNumberOfTuples();                                                                                                                                              \
+               py::array_t<int64_t> offsets(numTuples + 1);                                                                                                                                            \
+               int64_t* offsetPtr = offsets.mutable_data();                                                                                                                                            \
+               offsetPtr[0] = 0;                                                                                                                                                                       \
+               for(size_t i = 0; i < numTuples; i++)                                                                                                                                                   \
+               {                                                                                                                                                                                       \
+                 offsetPtr[i + 1] = offsetPtr[i] + nl.getListSize(static_cast<int>(i));                                                                                                                \
+               }                                                                                                                                                                                       \
+               py::array_t<T> values(offsetPtr[numTuples]);                                                                                                                                            \
+               T* valuePtr = values.mutable_data();                                                                                                                                                    \
+               for(size_t i = 0; i < numTuples; i++)                                                                                                                                                   \
+               {                                                                                                                                                                                       \
+                 typename NeighborListType::VectorType list = nl.copyOfList(static_cast<int>(i));                                                                                                      \
+                 std::copy(list.begin(), list.end(), valuePtr + offsetPtr[i]);                                                                                                                         \
+               }                                                                                                                                                                                       \
+               return py::make_tuple(offsets, values);                                                                                                                                                 \
+             })                                                                                                                                                                                        \
+        .def("fromNumPy",                                                                                                                                                                              \
+             [](NeighborListType& nl, py::array_t<int64_t, py::array::c_style> offsets, py::array_t<T, py::array::c_style> values) {                                                                   \
+               size_t numTuples = nl.getNumberOfTuples();                                                                                                                                              \
+               if(static_cast<size_t>(offsets.size()) != numTuples + 1)                                                                                                                                \
+               {                                                                                                                                                                                       \
+                 throw std::invalid_argument("offsets must have one more entry than the NeighborList has tuples");                                                                                     \
+               }                                                                                                                                                                                       \
+               const int64_t* offsetPtr = offsets.data();                                                                                                                                              \
+               const T* valuePtr = values.data();                                                                                                                                                      \
+               if(offsetPtr[0] < 0 || offsetPtr[0] > values.size())                                                                                                                                    \
+               {                                                                                                                                                                                       \
+                 throw std::invalid_argument("offsets must be ascending and lie within values");                                                                                                       \
+               }                                                                                                                                                                                       \
+               std::vector<size_t> packedOffsets(numTuples + 1, 0);                                                                                                                                    \
+               for(size_t i = 0; i < numTuples; i++)                                                                                                                                                   \
+               {                                                                                                                                                                                       \
+                 if(offsetPtr[i + 1] < offsetPtr[i] || offsetPtr[i + 1] > values.size())                                                                                                               \
+                 {                                                                                                                                                                                     \
+                   throw std::invalid_argument("offsets must be ascending and lie within values");                                                                                                     \
+                 }                                                                                                                                                                                     \
+                 packedOffsets[i + 1] = static_cast<size_t>(offsetPtr[i + 1] - offsetPtr[0]);                                                                                                          \
+               }                                                                                                                                                                                       \
+               nl.setPackedLists(packedOffsets, std::vector<T>(valuePtr + offsetPtr[0], valuePtr + offsetPtr[numTuples]));                                                                             \
+             },                                                                                                                                                                                        \
+             py::arg("offsets"), py::arg("values"))                                                                                                                                                    \
+        .def_property("Name", &NeighborListType::getName, &NeighborListType::setName);                                                                                                                 \
+    return instance;                                                                                                                                                                                   \
+  }
+
+PYB11_DEFINE_NEIGHBORLIST_INIT(int32_t, Int32NeighborListType);
+PYB11_DEFINE_NEIGHBORLIST_INIT(float, FloatNeighborListType);
+
+/**
+ * @brief Initializes the StringDataArray class. Strings are converted to and from Python lists of str.
+ */
+PySharedPtrClass<StringDataArray> declareStringDataArray(py::module& m, PySharedPtrClass<IDataArray>& parent)
+{
+  PySharedPtrClass<StringDataArray> instance(m, "StringDataArray", parent);
+  instance.def(py::init([](size_t numTuples, QString name, bool allocate) { return StringDataArray::CreateArray(numTuples, name, allocate); }))
+      .def("getNumberOfTuples", &StringDataArray::getNumberOfTuples)
+      .def("setValue", &StringDataArray::setValue, py::arg("index"), py::arg("value"))
+      .def("getValue", &StringDataArray::getValue, py::arg("index"))
+      .def("toList",
+           [](StringDataArray& sa) {
+             size_t numTuples = sa.getNumberOfTuples();
+             std::vector<QString> values(numTuples);
+             for(size_t i = 0; i < numTuples; i++)
+             {
+               values[i] = sa.getValue(i);
+             }
+             return values;
+           })
+      .def("fromList",
+           [](StringDataArray& sa, const std::vector<QString>& values) {
+             sa.resize(values.size());
+             for(size_t i = 0; i < values.size(); i++)
+             {
+               sa.setValue(i, values[i]);
+             }
+           },
+           py::arg("values"))
+      .def_property("Name", &StringDataArray::getName, &StringDataArray::setName);
+  return instance;
+}
+
 
 
 //------------------------------------------------------------------------------
@@ -267,6 +435,11 @@ PYBIND11_MODULE(dream3d_py, m)
   PySharedPtrClass<FloatArrayType> @LIB_NAME@_FloatArrayType = declareFloatArrayType(mod, @LIB_NAME@_IDataArray);
   PySharedPtrClass<DoubleArrayType> @LIB_NAME@_DoubleArrayType = declareDoubleArrayType(mod, @LIB_NAME@_IDataArray);
 
+  /* Init codes for the NeighborList<T> and StringDataArray classes */
+  PySharedPtrClass<Int32NeighborListType> @LIB_NAME@_Int32NeighborListType = declareInt32NeighborListType(mod, @LIB_NAME@_IDataArray);
+  PySharedPtrClass<FloatNeighborListType> @LIB_NAME@_FloatNeighborListType = declareFloatNeighborListType(mod, @LIB_NAME@_IDataArray);
+  PySharedPtrClass<StringDataArray> @LIB_NAME@_StringDataArray = declareStringDataArray(mod, @LIB_NAME@_IDataArray);
+
   py::enum_<SIMPL::InfoStringFormat>(mod, "InfoStringFormat").value("HtmlFormat", SIMPL::InfoStringFormat::HtmlFormat).value("UnknownFormat", SIMPL::InfoStringFormat::UnknownFormat).export_values();
 
   
@@ -65,9 +65,57 @@ def DataArrayTest():
     err = sc.WriteDREAM3DFile(sd.GetTestTempDirectory() + "/DataArrayTest.dream3d", dca, True)
     assert err == 0
 
+
+def NumPyViewTest():
+    """
+    Checks that DataArray, NeighborList and StringDataArray objects can be exchanged with numpy
+    """
+    array = simpl.Int32ArrayType(24, "Int32 View", True)
+    for i in range(24):
+        array.setValue(i, i)
+
+    # Tuple dimensions are given X first, the numpy shape is Z, Y, X
+    view = array.npview([4, 3, 2])
+    assert view.shape == (2, 3, 4)
+    assert view[1, 2, 3] == 23
+
+    # The view shares the memory of the DataArray
+    view[0, 0, 0] = 100
+    assert array.getValue(0) == 100
+
+    # The buffer protocol gives the same memory without a shape
+    flat = np.asarray(array)
+    assert flat.shape == (24,)
+    assert flat[0] == 100
+
+    # The view keeps the DataArray alive
+    del array
+    del flat
+    assert view[1, 2, 3] == 23
+
+    # Keep the numpy array in scope, the wrapping DataArray does not own it
+    rgbData = np.zeros(30, dtype=np.uint8)
+    rgb = simpl.UInt8ArrayType(rgbData, simpl.VectorSizeT([3]), "RGB", False)
+    assert rgb.npview().shape == (10, 3)
+
+    neighbors = simpl.Int32NeighborListType(3, "Neighbors", True)
+    neighbors.fromNumPy(np.array([0, 2, 2, 5], dtype=np.int64), np.array([1, 2, 3, 4, 5], dtype=np.int32))
+    assert neighbors.getListSize(1) == 0
+    offsets, values = neighbors.toNumPy()
+    assert list(offsets) == [0, 2, 2, 5]
+    assert list(values) == [1, 2, 3, 4, 5]
+    assert list(neighbors.getList(2)) == [3, 4, 5]
+
+    strings = simpl.StringDataArray(0, "Strings", True)
+    strings.fromList(["a", "bb", "ccc"])
+    assert strings.getNumberOfTuples() == 3
+    assert strings.toList() == ["a", "bb", "ccc"]
+
+
 """
 Main entry point for python script
 """
 if __name__ == "__main__":
     DataArrayTest()
+    NumPyViewTest()
     print("[DataArrayTest] Complete")